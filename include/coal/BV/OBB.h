@@ -147,6 +147,17 @@ COAL_DLLAPI bool overlap(const Matrix3s& R0, const Vec3s& T0, const OBB& b1,
 /// The second box is in identity configuration.
 COAL_DLLAPI bool obbDisjoint(const Matrix3s& B, const Vec3s& T, const Vec3s& a,
                              const Vec3s& b);
+
+/// Check collision between two boxes, and bound their distance from below
+/// @param B, T orientation and position of second box in the frame of the
+///        first box,
+/// @param a half dimensions of first box,
+/// @param b half dimensions of second box.
+/// @retval squaredLowerBoundDistance squared lower bound on the distance
+///         between the boxes if they are disjoint.
+COAL_DLLAPI bool obbDisjointAndLowerBoundDistance(
+    const Matrix3s& B, const Vec3s& T, const Vec3s& a, const Vec3s& b,
+    const CollisionRequest& request, Scalar& squaredLowerBoundDistance);
 }  // namespace coal
 
 #endif
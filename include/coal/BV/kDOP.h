@@ -170,18 +170,25 @@ class COAL_DLLAPI KDOP {
 
 /** @} */  // end of Bounding_Volume
 
+/// @brief Check collision between two KDOPs, b1 is in configuration (R0, T0)
+/// and b2 is in identity.
+///
+/// The planes of a KDOP are only defined in its frame. The test bounds each
+/// KDOP by the box of its first three pairs of planes, and checks this box,
+/// placed in the frame of the other KDOP, against all the planes of the other
+/// KDOP. It may report an overlap of disjoint KDOPs, never the converse.
 template <short N>
-bool overlap(const Matrix3s& /*R0*/, const Vec3s& /*T0*/, const KDOP<N>& /*b1*/,
-             const KDOP<N>& /*b2*/) {
-  COAL_THROW_PRETTY("not implemented", std::logic_error);
-}
+COAL_DLLAPI bool overlap(const Matrix3s& R0, const Vec3s& T0, const KDOP<N>& b1,
+                         const KDOP<N>& b2);
 
+/// @brief Check collision between two KDOPs, b1 is in configuration (R0, T0)
+/// and b2 is in identity.
+/// @retval sqrDistLowerBound squared lower bound on distance between the KDOPs
+///         if they do not overlap.
 template <short N>
-bool overlap(const Matrix3s& /*R0*/, const Vec3s& /*T0*/, const KDOP<N>& /*b1*/,
-             const KDOP<N>& /*b2*/, const CollisionRequest& /*request*/,
-             Scalar& /*sqrDistLowerBound*/) {
-  COAL_THROW_PRETTY("not implemented", std::logic_error);
-}
+COAL_DLLAPI bool overlap(const Matrix3s& R0, const Vec3s& T0, const KDOP<N>& b1,
+                         const KDOP<N>& b2, const CollisionRequest& request,
+                         Scalar& sqrDistLowerBound);
 
 /// @brief translate the KDOP BV
 template <short N>
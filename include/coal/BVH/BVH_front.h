@@ -41,6 +41,7 @@
 #include <list>
 
 #include "coal/config.hh"
+#include "coal/data_types.h"
 
 namespace coal {
 
@@ -71,6 +72,122 @@ inline void updateFrontList(BVHFrontList* front_list, unsigned int b1,
   if (front_list) front_list->push_back(BVHFrontNode(b1, b2));
 }
 
+/// @brief Persistent front list of the collision queries between a pair of
+/// objects.
+///
+/// The traversal of the hierarchies of two objects stops on a set of pairs of
+/// nodes, its front. When the objects move slowly, the next query visits
+/// almost the same nodes: restarting it from the front of the previous query
+/// saves the bounding volume tests from the roots down to the front.
+///
+/// The front is used by the collision queries between
+/// - a height field and a shape, a mesh or another height field,
+/// - an octree and any geometry, if the octrees have a flat copy (see
+///   OcTree::buildFlatTree).
+///
+/// The other pairs ignore it. A query which uses the front does not stop at
+/// the first contacts, since its front must cover both hierarchies.
+///
+/// The front never moves up in the hierarchies, so it grows when the objects
+/// move away from where it was built. When it becomes larger than
+/// max_front_growth times the front of the last query started from the roots,
+/// it is dropped and the next query starts from the roots again. It is also
+/// dropped after a query without collision: the traversal from the roots
+/// then stops close to them.
+///
+/// A cache is meant for one pair of objects: it is cleared when it is used
+/// with another pair. It must also be cleared when the hierarchy of one of the
+/// objects is rebuilt, e.g. the flat copy of an octree. Updating the heights of
+/// a height field keeps it valid.
+///
+/// \code
+///   TraversalFrontCache cache;
+///   // At each frame:
+///   collide(o1, o2, request, result, cache);
+/// \endcode
+class COAL_DLLAPI TraversalFrontCache {
+ public:
+  /// @brief Statistics on the use of the cache.
+  struct Statistics {
+    /// @brief number of queries using the cache
+    std::size_t num_queries;
+    /// @brief number of queries started from the front of the previous query
+    std::size_t num_restarts;
+    /// @brief number of fronts dropped after a query which restarted from them
+    std::size_t num_resets;
+
+    Statistics() : num_queries(0), num_restarts(0), num_resets(0) {}
+  };
+
+  /// @param max_front_growth_ see max_front_growth.
+  explicit TraversalFrontCache(Scalar max_front_growth_ = 2)
+      : max_front_growth(max_front_growth_), m_reference_size(0) {
+    m_objects[0] = m_objects[1] = NULL;
+  }
+
+  /// @brief Front of the last query.
+  const BVHFrontList& getFront() const { return m_front; }
+
+  /// @brief Front list filled by the traversals.
+  BVHFrontList& front() { return m_front; }
+
+  /// @brief Number of pairs of nodes in the front.
+  std::size_t size() const { return m_front.size(); }
+
+  /// @brief Drops the front: the next query starts from the roots. The
+  /// statistics are kept.
+  void clear() { m_front.clear(); }
+
+  /// @brief Statistics since the creation of the cache or the last call to
+  /// resetStatistics.
+  const Statistics& getStatistics() const { return m_statistics; }
+
+  void resetStatistics() { m_statistics = Statistics(); }
+
+  /// @brief Prepares the front for a query between o1 and o2, as seen by the
+  /// narrow phase. The front is cleared if it belongs to another pair.
+  /// @return whether the query restarts from the front.
+  bool beginQuery(const void* o1, const void* o2) {
+    if (o1 != m_objects[0] || o2 != m_objects[1]) {
+      m_front.clear();
+      m_objects[0] = o1;
+      m_objects[1] = o2;
+    }
+    return !m_front.empty();
+  }
+
+  /// @brief Updates the statistics after a query and drops the front if it
+  /// grew too much or if the objects are not in collision.
+  /// @param restarted the value returned by beginQuery.
+  /// @param collision whether the query found a collision.
+  void endQuery(const bool restarted, const bool collision = true) {
+    ++m_statistics.num_queries;
+    if (!restarted) {
+      m_reference_size = m_front.size();
+      return;
+    }
+    ++m_statistics.num_restarts;
+    const Scalar max_size =
+        max_front_growth *
+        Scalar(m_reference_size > 0 ? m_reference_size : std::size_t(1));
+    if (!collision || Scalar(m_front.size()) > max_size) {
+      m_front.clear();
+      ++m_statistics.num_resets;
+    }
+  }
+
+  /// @brief The front is dropped when its size exceeds max_front_growth times
+  /// the size of the front of the last query started from the roots.
+  Scalar max_front_growth;
+
+ private:
+  BVHFrontList m_front;
+  const void* m_objects[2];
+  /// @brief Size of the front of the last query started from the roots.
+  std::size_t m_reference_size;
+  Statistics m_statistics;
+};
+
 }  // namespace coal
 
 #endif
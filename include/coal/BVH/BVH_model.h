@@ -176,6 +176,25 @@ class COAL_DLLAPI BVHModelBase : public CollisionGeometry {
   /// volume hierarchy
   int endUpdateModel(bool refit = true, bool bottomup = true);
 
+  /// @brief Move a subset of the vertices and refit only the part of the
+  /// bounding volume hierarchy which depends on them.
+  ///
+  /// The result is the same as a beginUpdateModel(), updateVertex(),
+  /// endUpdateModel(true, true) sequence in which the other vertices keep
+  /// their position: the bounding volumes enclose both the previous and the
+  /// new positions of the vertices. However, only the leaves using a vertex
+  /// moved by this call or by the previous one, and their ancestors, are
+  /// refitted.
+  ///
+  /// \param[in] indices indices of the moved vertices.
+  /// \param[in] positions new positions of the vertices, of the same size as
+  /// indices.
+  /// \param[in] num_threads number of threads used for large updates: 1
+  /// (default) refits serially, 0 uses one thread per hardware thread.
+  int updateVertices(const std::vector<unsigned int>& indices,
+                     const std::vector<Vec3s>& positions,
+                     std::size_t num_threads = 1);
+
   /// @brief Build this \ref Convex "Convex<Triangle>" representation of this
   /// model. The result is stored in attribute \ref convex. \note this only
   /// takes the points of this model. It does not check that the
@@ -310,10 +329,18 @@ class COAL_DLLAPI BVHModelBase : public CollisionGeometry {
   /// @brief Refit the bounding volume hierarchy
   virtual int refitTree(bool bottomup) = 0;
 
+  /// @brief Refit the leaves using the given vertices and their ancestors
+  virtual int refitTree_partial(const std::vector<unsigned int>& vertex_ids,
+                                std::size_t num_threads) = 0;
+
   unsigned int num_tris_allocated;
   unsigned int num_vertices_allocated;
   unsigned int num_vertex_updated;  /// for ccd vertex update
 
+  /// @brief Vertices moved by the last call to updateVertices. Their previous
+  /// position is reset at the next call.
+  std::vector<unsigned int> last_updated_vertices;
+
  protected:
   /// \brief Comparison operators
   virtual bool isEqual(const CollisionGeometry& other) const;
@@ -336,6 +363,11 @@ class COAL_DLLAPI BVHModel : public BVHModelBase {
   /// @brief Fitting rule to fit a BV node to a set of geometry primitives
   shared_ptr<BVFitter<BV>> bv_fitter;
 
+  /// @brief Number of threads used to build the hierarchy in endModel:
+  /// 1 (default) builds it serially, 0 uses one thread per hardware thread.
+  /// The hierarchy does not depend on the number of threads.
+  std::size_t num_build_threads;
+
   /// @brief Default constructor to build an empty BVH
   BVHModel();
 
@@ -411,13 +443,65 @@ class COAL_DLLAPI BVHModel : public BVHModelBase {
   /// less compact)
   int refitTree_bottomup();
 
+  /// @brief Subtree of the hierarchy which remains to be built.
+  struct BuildTask {
+    /// @brief Index of the root node of the subtree.
+    int bv_id;
+    unsigned int first_primitive;
+    unsigned int num_primitives;
+    /// @brief Index of the first of the 2 * num_primitives - 2 nodes
+    /// reserved for the descendants of bv_id.
+    int first_free_bv;
+  };
+
   /// @brief Recursive kernel for hierarchy construction
   int recursiveBuildTree(int bv_id, unsigned int first_primitive,
                          unsigned int num_primitives);
 
+  /// @brief Recursive kernel for hierarchy construction, using the given
+  /// splitter. Subtrees built with different splitters do not share any
+  /// data, which allows to build them in parallel.
+  ///
+  /// \param[in,out] splitter the split rule, which holds the split of the
+  /// current node.
+  /// \param[in] task the subtree to build.
+  /// \param[out] children if not null, only the root node of the subtree is
+  /// built and the subtrees of its children are appended to children.
+  int recursiveBuildTree(BVSplitter<BV>& splitter, const BuildTask& task,
+                         std::vector<BuildTask>* children);
+
   /// @brief Recursive kernel for bottomup refitting
   int recursiveRefitTree_bottomup(int bv_id);
 
+  /// @brief Refit the BV of a leaf to the vertices of its primitive
+  int refitLeaf(int bv_id);
+
+  /// @brief Refit the leaves using the given vertices and their ancestors
+  int refitTree_partial(const std::vector<unsigned int>& vertex_ids,
+                        std::size_t num_threads);
+
+  /// @brief Topology of the hierarchy used by refitTree_partial.
+  struct RefitTopology {
+    /// @brief Parent of each node, -1 for the root.
+    std::vector<int> parents;
+    /// @brief Depth of each node, 0 for the root.
+    std::vector<unsigned int> depths;
+    /// @brief The leaves using vertex i are
+    /// vertex_leaves[vertex_leaf_offsets[i]:vertex_leaf_offsets[i+1]].
+    std::vector<unsigned int> vertex_leaf_offsets;
+    std::vector<int> vertex_leaves;
+  };
+
+  /// @brief Built on demand by refitTree_partial and reset when the hierarchy
+  /// is rebuilt.
+  std::shared_ptr<const RefitTopology> refit_topology;
+
+  /// @brief Nodes marked by refitTree_partial, all false between two calls.
+  std::vector<unsigned char> refit_marks;
+
+  /// @brief Compute refit_topology from the current hierarchy.
+  void computeRefitTopology();
+
   /// @ recursively compute each bv's transform related to its parent. For
   /// default BV, only the translation works. For oriented BV (OBB, RSS,
   /// OBBRSS), special implementation is provided.
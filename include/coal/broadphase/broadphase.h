@@ -42,7 +42,10 @@
 #include "coal/broadphase/broadphase_SSaP.h"
 #include "coal/broadphase/broadphase_interval_tree.h"
 #include "coal/broadphase/broadphase_spatialhash.h"
+#include "coal/broadphase/broadphase_wide_AABB_tree.h"
+#include "coal/broadphase/broadphase_continuous_dynamic_AABB_tree.h"
 
 #include "coal/broadphase/default_broadphase_callbacks.h"
+#include "coal/broadphase/broadphase_narrowphase.h"
 
 #endif  // ifndef COAL_BROADPHASE_BROADPHASE_H
@@ -63,6 +63,31 @@ struct COAL_DLLAPI CollisionCallBackBase {
   virtual bool operator()(CollisionObject* o1, CollisionObject* o2) {
     return collide(o1, o2);
   }
+
+  /// @brief Creates a new callback used by one worker thread of a parallel
+  ///        broadphase query (see
+  ///        BroadPhaseCollisionManager::collideParallel).
+  ///
+  ///        The returned callback must not share any mutable state with this
+  ///        callback: each worker thread calls its own copy, and the copies
+  ///        are merged back into this callback with \ref merge once all the
+  ///        workers are done. The caller takes ownership of the returned
+  ///        pointer.
+  ///
+  /// @return nullptr if the callback does not support parallel queries (the
+  ///         default). In this case, parallel queries fall back to the
+  ///         serial ones.
+  virtual CollisionCallBackBase* clone() const { return nullptr; }
+
+  /// @brief Merges the results accumulated by a callback created with
+  ///        \ref clone into this callback.
+  ///        This method is always called from the thread which started the
+  ///        parallel query.
+  virtual void merge(const CollisionCallBackBase& other) {
+    COAL_UNUSED_VARIABLE(other);
+  }
+
+  virtual ~CollisionCallBackBase() {};
 };
 
 /// @brief Base callback class for distance queries.
@@ -91,6 +116,32 @@ struct COAL_DLLAPI DistanceCallBackBase {
   }
 };
 
+/// @brief Base callback class for continuous collision queries (see
+/// BroadPhaseContinuousCollisionManager).
+struct COAL_DLLAPI ContinuousCollisionCallBackBase {
+  /// @brief Initialization of the callback before running the continuous
+  /// collision broadphase manager.
+  virtual void init() {};
+
+  /// @brief Continuous collision evaluation between two objects whose swept
+  ///        volumes overlap.
+  ///        This callback will cause the broadphase evaluation to stop if it
+  ///        returns true.
+  ///
+  /// @param[in] o1 Continuous collision object #1.
+  /// @param[in] o2 Continuous collision object #2.
+  virtual bool collide(ContinuousCollisionObject* o1,
+                       ContinuousCollisionObject* o2) = 0;
+
+  /// @brief Functor call associated to the collide operation.
+  virtual bool operator()(ContinuousCollisionObject* o1,
+                          ContinuousCollisionObject* o2) {
+    return collide(o1, o2);
+  }
+
+  virtual ~ContinuousCollisionCallBackBase() {};
+};
+
 }  // namespace coal
 
 #endif  // COAL_BROADPHASE_BROAD_PHASE_CALLBACKS_H
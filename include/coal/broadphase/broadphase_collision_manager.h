@@ -41,6 +41,7 @@
 #include <set>
 #include <vector>
 #include <functional>
+#include <utility>
 
 #include "coal/collision_object.h"
 #include "coal/broadphase/broadphase_callbacks.h"
@@ -53,6 +54,9 @@ using CollisionCallBackFunctor =
 using DistanceCallBackFunctor =
     std::function<bool(CollisionObject*, CollisionObject*, Scalar&)>;
 
+/// @brief Pair of collision objects reported by a broadphase query.
+typedef std::pair<CollisionObject*, CollisionObject*> CollisionObjectPair;
+
 /// @brief Base class for broad phase collision. It helps to accelerate the
 /// collision/distance between N objects. Also support self collision, self
 /// distance and collision/distance with another M objects.
@@ -143,6 +147,58 @@ class COAL_DLLAPI BroadPhaseCollisionManager {
   void distance(BroadPhaseCollisionManager* other_manager,
                 const DistanceCallBackFunctor& fn) const;
 
+  /// @brief computes the pairs of objects belonging to the manager whose
+  /// AABBs overlap (i.e. the broad phase of the N^2 self collision), without
+  /// running any narrow phase.
+  ///
+  /// Each unordered pair of objects is reported once, in the order of the
+  /// first time the traversal of the manager reaches it. The pairs can then
+  /// be processed by the narrow phase driver of
+  /// coal/broadphase/broadphase_narrowphase.h.
+  ///
+  /// @param[out] pairs the candidate pairs. The vector is cleared first.
+  void getCandidatePairs(std::vector<CollisionObjectPair>& pairs) const;
+
+  /// @brief computes the pairs made of one object of the manager and one
+  /// object of other_manager whose AABBs overlap, without running any narrow
+  /// phase.
+  /// See getCandidatePairs(std::vector<CollisionObjectPair>&) for the order
+  /// of the pairs.
+  ///
+  /// @param[out] pairs the candidate pairs. The vector is cleared first.
+  void getCandidatePairs(BroadPhaseCollisionManager* other_manager,
+                         std::vector<CollisionObjectPair>& pairs) const;
+
+  /// @brief perform collision test for the objects belonging to the manager
+  /// (i.e., N^2 self collision), using several threads.
+  ///
+  /// Each thread calls its own copy of the callback, created with
+  /// CollisionCallBackBase::clone, and the copies are merged into callback
+  /// at the end of the query. If the callback does not support parallel
+  /// queries (i.e. clone returns nullptr), this falls back to
+  /// collide(CollisionCallBackBase*).
+  /// When a callback returns true, all the threads stop as soon as possible.
+  /// The order in which the pairs are reported is not deterministic.
+  ///
+  /// The default implementation gathers the pairs of objects whose AABBs
+  /// overlap with the serial query, then runs the callbacks on these pairs in
+  /// parallel. Managers may override it to also split the traversal itself,
+  /// which only DynamicAABBTreeCollisionManager does: with the other managers
+  /// (SaP, interval tree, spatial hash...), the broad phase stays serial and
+  /// only the callbacks run in parallel.
+  ///
+  /// @param num_threads number of threads. 0 means one per hardware thread.
+  virtual void collideParallel(CollisionCallBackBase* callback,
+                               std::size_t num_threads) const;
+
+  /// @brief perform collision test with objects belonging to another manager,
+  /// using several threads.
+  /// See collideParallel(CollisionCallBackBase*, std::size_t) for the
+  /// requirements on the callback.
+  virtual void collideParallel(BroadPhaseCollisionManager* other_manager,
+                               CollisionCallBackBase* callback,
+                               std::size_t num_threads) const;
+
   /// @brief whether the manager is empty
   virtual bool empty() const = 0;
 
@@ -159,6 +215,24 @@ class COAL_DLLAPI BroadPhaseCollisionManager {
   bool inTestedSet(CollisionObject* a, CollisionObject* b) const;
 
   void insertTestedSet(CollisionObject* a, CollisionObject* b) const;
+
+  /// @brief Function processing one task of a parallel collision query with
+  /// the callback of the thread running it.
+  typedef std::function<void(std::size_t, CollisionCallBackBase*)>
+      CollisionTaskFunction;
+
+  /// @brief Runs num_tasks tasks on num_threads threads. Each thread uses its
+  /// own copy of callback, which is merged into callback once all the tasks
+  /// are done. As soon as one of the copies returns true, the copies of the
+  /// other threads return true without calling the user callback, and the
+  /// remaining tasks are skipped.
+  ///
+  /// @return false if the callback does not support parallel queries. In this
+  /// case, no task is run.
+  bool runParallelCollisionTasks(std::size_t num_tasks,
+                                 std::size_t num_threads,
+                                 CollisionCallBackBase* callback,
+                                 const CollisionTaskFunction& task) const;
 };
 
 }  // namespace coal
@@ -0,0 +1,130 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COAL_BROADPHASE_BROADPHASE_CONTINUOUS_DYNAMIC_AABB_TREE_H
+#define COAL_BROADPHASE_BROADPHASE_CONTINUOUS_DYNAMIC_AABB_TREE_H
+
+#include <unordered_map>
+
+#include "coal/broadphase/broadphase_continuous_collision_manager.h"
+#include "coal/broadphase/detail/hierarchy_tree.h"
+
+namespace coal {
+
+/// @brief Broad phase continuous collision manager based on a dynamic AABB
+/// tree built over the swept AABBs of the objects (see
+/// ContinuousCollisionObject::computeAABB).
+///
+/// The pairs of objects whose swept AABBs overlap are reported to the
+/// callback, which typically calls continuousCollide on them (see
+/// ContinuousCollisionCallBackDefault). When the motions of the objects
+/// change (ContinuousCollisionObject::setMotion), update() must be called
+/// before the next query.
+class COAL_DLLAPI DynamicAABBTreeContinuousCollisionManager
+    : public BroadPhaseContinuousCollisionManager {
+ public:
+  typedef BroadPhaseContinuousCollisionManager Base;
+  using Base::getObjects;
+
+  using DynamicAABBNode = detail::NodeBase<AABB>;
+  using DynamicAABBTable =
+      std::unordered_map<ContinuousCollisionObject*, DynamicAABBNode*>;
+
+  int max_tree_nonbalanced_level;
+  int tree_incremental_balance_pass;
+  int tree_init_level;
+
+  DynamicAABBTreeContinuousCollisionManager();
+
+  /// @brief add objects to the manager
+  void registerObjects(
+      const std::vector<ContinuousCollisionObject*>& other_objs);
+
+  /// @brief add one object to the manager
+  void registerObject(ContinuousCollisionObject* obj);
+
+  /// @brief remove one object from the manager
+  void unregisterObject(ContinuousCollisionObject* obj);
+
+  /// @brief initialize the manager, related with the specific type of manager
+  void setup();
+
+  /// @brief update the condition of manager
+  void update();
+
+  /// @brief update the manager by explicitly given the object updated
+  void update(ContinuousCollisionObject* updated_obj);
+
+  /// @brief update the manager by explicitly given the set of objects update
+  void update(const std::vector<ContinuousCollisionObject*>& updated_objs);
+
+  /// @brief clear the manager
+  void clear();
+
+  /// @brief return the objects managed by the manager
+  void getObjects(std::vector<ContinuousCollisionObject*>& objs) const;
+
+  /// @brief perform collision test between one object and all the objects
+  /// belonging to the manager
+  void collide(ContinuousCollisionObject* obj,
+               ContinuousCollisionCallBackBase* callback) const;
+
+  /// @brief perform collision test for the objects belonging to the manager
+  /// (i.e., N^2 self collision)
+  void collide(ContinuousCollisionCallBackBase* callback) const;
+
+  /// @brief perform collision test with objects belonging to another manager
+  void collide(BroadPhaseContinuousCollisionManager* other_manager_,
+               ContinuousCollisionCallBackBase* callback) const;
+
+  /// @brief whether the manager is empty
+  bool empty() const;
+
+  /// @brief the number of objects managed by the manager
+  size_t size() const;
+
+  const detail::HierarchyTree<AABB>& getTree() const;
+
+ private:
+  detail::HierarchyTree<AABB> dtree;
+  DynamicAABBTable table;
+
+  bool setup_;
+
+  void update_(ContinuousCollisionObject* updated_obj);
+};
+
+}  // namespace coal
+
+#endif
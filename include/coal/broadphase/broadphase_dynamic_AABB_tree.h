@@ -122,6 +122,22 @@ class COAL_DLLAPI DynamicAABBTreeCollisionManager
   void distance(BroadPhaseCollisionManager* other_manager_,
                 DistanceCallBackBase* callback) const;
 
+  /// @brief perform collision test for the objects belonging to the manager
+  /// (i.e., N^2 self collision), using several threads.
+  /// The tree traversal is split into independent subtasks (self collision of
+  /// a subtree or collision between two subtrees), which are distributed over
+  /// the threads.
+  void collideParallel(CollisionCallBackBase* callback,
+                       std::size_t num_threads) const;
+
+  /// @brief perform collision test with objects belonging to another manager,
+  /// using several threads.
+  /// The tree traversal is split into independent subtasks (collision between
+  /// two subtrees), which are distributed over the threads.
+  void collideParallel(BroadPhaseCollisionManager* other_manager_,
+                       CollisionCallBackBase* callback,
+                       std::size_t num_threads) const;
+
   /// @brief whether the manager is empty
   bool empty() const;
 
@@ -0,0 +1,88 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COAL_BROADPHASE_BROADPHASE_NARROWPHASE_H
+#define COAL_BROADPHASE_BROADPHASE_NARROWPHASE_H
+
+#include <vector>
+
+#include "coal/collision_data.h"
+#include "coal/broadphase/broadphase_collision_manager.h"
+
+namespace coal {
+
+/// @brief Narrow phase of a two-phase broadphase query: performs the
+/// collision between the objects of each candidate pair, as returned by
+/// BroadPhaseCollisionManager::getCandidatePairs, using several threads.
+///
+/// The pairs are split into chunks processed by BatchCollision, one instance
+/// per thread. Each pair is queried with its own copy of request, so that
+/// results[i] only depends on pairs[i] and request and the results do not
+/// depend on the number of threads. In particular, with a cached GJK guess
+/// (QueryRequest::enable_cached_gjk_guess), every pair starts from the guess
+/// of request, which is left unchanged.
+///
+/// \code
+///   std::vector<CollisionObjectPair> pairs;
+///   manager.getCandidatePairs(pairs);
+///   std::vector<CollisionResult> results;
+///   std::size_t ncolliding = collide(pairs, request, results, 4);
+/// \endcode
+///
+/// @param[in] pairs the candidate pairs.
+/// @param[in] request the collision request used for every pair.
+/// @param[out] results resized to the number of pairs and cleared.
+/// results[i] contains the result of the collision of pairs[i].
+/// @param[in] num_threads number of threads. 0 means one per hardware thread.
+/// @return the number of pairs in collision.
+COAL_DLLAPI std::size_t collide(const std::vector<CollisionObjectPair>& pairs,
+                                const CollisionRequest& request,
+                                std::vector<CollisionResult>& results,
+                                std::size_t num_threads);
+
+/// @brief Narrow phase of a two-phase broadphase query: computes the distance
+/// between the objects of each candidate pair, using several threads.
+/// See collide(const std::vector<CollisionObjectPair>&, const
+/// CollisionRequest&, std::vector<CollisionResult>&, std::size_t).
+///
+/// @param[out] results resized to the number of pairs and cleared.
+/// results[i] contains the result of the distance of pairs[i].
+COAL_DLLAPI void distance(const std::vector<CollisionObjectPair>& pairs,
+                          const DistanceRequest& request,
+                          std::vector<DistanceResult>& results,
+                          std::size_t num_threads);
+
+}  // namespace coal
+
+#endif  // COAL_BROADPHASE_BROADPHASE_NARROWPHASE_H
@@ -0,0 +1,129 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COAL_BROADPHASE_BROADPHASE_WIDE_AABB_TREE_H
+#define COAL_BROADPHASE_BROADPHASE_WIDE_AABB_TREE_H
+
+#include <vector>
+
+#include "coal/broadphase/broadphase_collision_manager.h"
+#include "coal/broadphase/detail/wide_AABB_tree.h"
+
+namespace coal {
+
+/// @brief Broad phase collision manager based on a 4-wide bounding volume
+/// hierarchy of AABBs (see detail::WideAABBTree).
+///
+/// It is an alternative to DynamicAABBTreeArrayCollisionManager: a query box
+/// is tested against the 4 children of a node at once with SIMD instructions,
+/// and the tree is shallower. Registered and unregistered objects are
+/// inserted in and removed from the tree immediately, and update(obj) only
+/// refits the nodes above obj. setup() rebuilds the tree, to rebalance it
+/// after objects were registered or unregistered one at a time.
+class COAL_DLLAPI WideAABBTreeCollisionManager
+    : public BroadPhaseCollisionManager {
+ public:
+  typedef BroadPhaseCollisionManager Base;
+  using Base::getObjects;
+
+  WideAABBTreeCollisionManager();
+
+  /// @brief add objects to the manager
+  void registerObjects(const std::vector<CollisionObject*>& other_objs);
+
+  /// @brief add one object to the manager
+  void registerObject(CollisionObject* obj);
+
+  /// @brief remove one object from the manager
+  void unregisterObject(CollisionObject* obj);
+
+  /// @brief initialize the manager, related with the specific type of manager
+  void setup();
+
+  /// @brief update the condition of manager
+  void update();
+
+  /// @brief update the manager by explicitly given the object updated
+  void update(CollisionObject* updated_obj);
+
+  /// @brief update the manager by explicitly given the set of objects update
+  void update(const std::vector<CollisionObject*>& updated_objs);
+
+  /// @brief clear the manager
+  void clear();
+
+  /// @brief return the objects managed by the manager
+  void getObjects(std::vector<CollisionObject*>& objs) const;
+
+  /// @brief perform collision test between one object and all the objects
+  /// belonging to the manager
+  void collide(CollisionObject* obj, CollisionCallBackBase* callback) const;
+
+  /// @brief perform distance computation between one object and all the objects
+  /// belonging to the manager
+  void distance(CollisionObject* obj, DistanceCallBackBase* callback) const;
+
+  /// @brief perform collision test for the objects belonging to the manager
+  /// (i.e., N^2 self collision)
+  void collide(CollisionCallBackBase* callback) const;
+
+  /// @brief perform distance test for the objects belonging to the manager
+  /// (i.e., N^2 self distance)
+  void distance(DistanceCallBackBase* callback) const;
+
+  /// @brief perform collision test with objects belonging to another manager
+  void collide(BroadPhaseCollisionManager* other_manager_,
+               CollisionCallBackBase* callback) const;
+
+  /// @brief perform distance test with objects belonging to another manager
+  void distance(BroadPhaseCollisionManager* other_manager_,
+                DistanceCallBackBase* callback) const;
+
+  /// @brief whether the manager is empty
+  bool empty() const;
+
+  /// @brief the number of objects managed by the manager
+  size_t size() const;
+
+  const detail::WideAABBTree& getTree() const;
+
+ private:
+  detail::WideAABBTree tree;
+
+  bool setup_;
+};
+
+}  // namespace coal
+
+#endif  // COAL_BROADPHASE_BROADPHASE_WIDE_AABB_TREE_H
@@ -42,9 +42,7 @@
 #include "coal/broadphase/broadphase_callbacks.h"
 #include "coal/collision.h"
 #include "coal/distance.h"
-// #include "coal/narrowphase/continuous_collision.h"
-// #include "coal/narrowphase/continuous_collision_request.h"
-// #include "coal/narrowphase/continuous_collision_result.h"
+#include "coal/narrowphase/continuous_collision.h"
 // #include "coal/narrowphase/distance_request.h"
 // #include "coal/narrowphase/distance_result.h"
 
@@ -61,6 +59,11 @@ struct CollisionData {
   /// @brief Collision result
   CollisionResult result;
 
+  /// @brief Optional GJK warm-start cache shared between the queries (see
+  /// GJKWarmStartCache). It is kept by \ref clear so that the warm starts
+  /// persist across frames.
+  shared_ptr<GJKWarmStartCache> warm_start_cache;
+
   /// @brief Whether the collision iteration can stop
   bool done;
 
@@ -82,6 +85,11 @@ struct DistanceData {
   /// @brief Distance result
   DistanceResult result;
 
+  /// @brief Optional GJK warm-start cache shared between the queries (see
+  /// GJKWarmStartCache). It is kept by \ref clear so that the warm starts
+  /// persist across frames.
+  shared_ptr<GJKWarmStartCache> warm_start_cache;
+
   /// @brief Whether the distance iteration can stop
   bool done;
 
@@ -117,54 +125,49 @@ struct DistanceData {
 bool defaultCollisionFunction(CollisionObject* o1, CollisionObject* o2,
                               void* data);
 
-/// @brief Collision data for use with the DefaultContinuousCollisionFunction.
-/// It stores the collision request and the result given by the collision
-/// algorithm (and stores the conclusion of whether further evaluation of the
-/// broadphase collision manager has been deemed unnecessary).
-// struct DefaultContinuousCollisionData {
-//   ContinuousCollisionRequest request;
-//   ContinuousCollisionResult result;
-//
-//   /// If `true`, requests that the broadphase evaluation stop.
-//   bool done{false};
-// };
+/// @brief Continuous collision data stores the continuous collision request
+/// and the earliest contact found by the continuous collision algorithm.
+struct ContinuousCollisionData {
+  ContinuousCollisionData() { clear(); }
+
+  /// @brief Continuous collision request
+  ContinuousCollisionRequest request;
+
+  /// @brief Earliest contact among the pairs reported by the broadphase
+  ContinuousCollisionResult result;
+
+  /// @brief Pair of objects of the earliest contact (null if there is no
+  /// collision)
+  ContinuousCollisionObject* o1;
+  ContinuousCollisionObject* o2;
+
+  /// @brief Whether the continuous collision iteration can stop
+  bool done;
+
+  /// @brief Clears the ContinuousCollisionData
+  void clear() {
+    result.clear();
+    o1 = o2 = nullptr;
+    done = false;
+  }
+};
 
 /// @brief Provides a simple callback for the continuous collision query in the
-/// BroadPhaseCollisionManager. It assumes the `data` parameter is non-null and
-/// points to an instance of DefaultContinuousCollisionData. It simply invokes
-/// the `collide()` method on the culled pair of geometries and stores the
-/// results in the data's ContinuousCollisionResult instance.
-///
-/// This callback will never cause the broadphase evaluation to terminate early.
-/// However, if the `done` member of the DefaultContinuousCollisionData is set
-/// to true, this method will simply return without doing any computation.
+/// BroadPhaseContinuousCollisionManager. It assumes the `data` parameter is
+/// non-null and points to an instance of ContinuousCollisionData. It invokes
+/// continuousCollide() on the culled pair of objects and keeps the result if
+/// its time of contact is earlier than the one stored in the data.
 ///
-/// For a given instance of DefaultContinuousCollisionData, if broadphase
-/// evaluation has already terminated (i.e.,
-/// DefaultContinuousCollisionFunction() returned `true`), subsequent
-/// invocations with the same instance of CollisionData will return
-/// immediately, requesting termination of broadphase evaluation (i.e., return
-/// `true`).
+/// This callback causes the broadphase evaluation to stop once a contact at
+/// time 0 has been found, since no earlier contact can exist.
 ///
 /// @param o1   The first object in the culled pair.
 /// @param o2   The second object in the culled pair.
-/// @param data A non-null pointer to a CollisionData instance.
-/// @return True if the broadphase evaluation should stop.
-/// @tparam S   The scalar type with which the computation will be performed.
-// bool DefaultContinuousCollisionFunction(ContinuousCollisionObject* o1,
-//                                         ContinuousCollisionObject* o2,
-//                                         void* data) {
-//   assert(data != nullptr);
-//   auto* cdata = static_cast<DefaultContinuousCollisionData*>(data);
-//
-//   if (cdata->done) return true;
-//
-//   const ContinuousCollisionRequest& request = cdata->request;
-//   ContinuousCollisionResult& result = cdata->result;
-//   collide(o1, o2, request, result);
-//
-//   return cdata->done;
-// }
+/// @param data A non-null pointer to a ContinuousCollisionData instance.
+/// @return `true` if the broadphase evaluation should stop.
+bool defaultContinuousCollisionFunction(ContinuousCollisionObject* o1,
+                                        ContinuousCollisionObject* o2,
+                                        void* data);
 
 /// @brief Provides a simple callback for the distance query in the
 /// BroadPhaseCollisionManager. It assumes the `data` parameter is non-null and
@@ -200,6 +203,14 @@ struct COAL_DLLAPI CollisionCallBackDefault : CollisionCallBackBase {
 
   bool collide(CollisionObject* o1, CollisionObject* o2);
 
+  /// @brief Creates a callback with the same request and an empty result.
+  CollisionCallBackBase* clone() const;
+
+  /// @brief Appends the contacts of other to the result, up to the maximum
+  /// number of contacts of the request, and keeps the smallest distance lower
+  /// bound.
+  void merge(const CollisionCallBackBase& other);
+
   CollisionData data;
 
   virtual ~CollisionCallBackDefault() {};
@@ -219,6 +230,22 @@ struct COAL_DLLAPI DistanceCallBackDefault : DistanceCallBackBase {
   virtual ~DistanceCallBackDefault() {};
 };
 
+/// @brief Default continuous collision callback: finds the earliest contact
+/// between the continuous collision objects.
+struct COAL_DLLAPI ContinuousCollisionCallBackDefault
+    : ContinuousCollisionCallBackBase {
+  /// @brief Initialize the callback.
+  /// Clears the continuous collision result and sets the done boolean to
+  /// false.
+  void init() { data.clear(); }
+
+  bool collide(ContinuousCollisionObject* o1, ContinuousCollisionObject* o2);
+
+  ContinuousCollisionData data;
+
+  virtual ~ContinuousCollisionCallBackDefault() {};
+};
+
 /// @brief Collision callback to collect collision pairs potentially in contacts
 struct COAL_DLLAPI CollisionCallBackCollect : CollisionCallBackBase {
   typedef std::pair<CollisionObject*, CollisionObject*> CollisionPair;
@@ -243,6 +270,12 @@ struct COAL_DLLAPI CollisionCallBackCollect : CollisionCallBackBase {
   /// @brief Check whether a collision pair exists
   bool exist(CollisionObject* o1, CollisionObject* o2) const;
 
+  /// @brief Creates a callback with the same maximum size and no pair.
+  CollisionCallBackBase* clone() const;
+
+  /// @brief Appends the collision pairs of other.
+  void merge(const CollisionCallBackBase& other);
+
   virtual ~CollisionCallBackCollect() {};
 
  protected:
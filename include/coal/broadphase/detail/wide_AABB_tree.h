@@ -0,0 +1,208 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COAL_BROADPHASE_DETAIL_WIDE_AABB_TREE_H
+#define COAL_BROADPHASE_DETAIL_WIDE_AABB_TREE_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "coal/BV/AABB.h"
+#include "coal/collision_object.h"
+
+namespace coal {
+namespace detail {
+
+/// @brief Bounding volume hierarchy of AABBs where each node has up to 4
+/// children (BVH4).
+///
+/// The bounds of the children of a node are stored as a structure of arrays,
+/// so that a query box is tested against all the children of a node at once
+/// with SIMD instructions (see the traversals of
+/// WideAABBTreeCollisionManager).
+///
+/// The tree is built top-down by splitting the objects at the median of their
+/// centers along the largest axis. Objects can then be inserted, removed or
+/// moved one at a time: insert and remove only modify the nodes on the path
+/// from the root to the object, and update refits them bottom-up.
+class COAL_DLLAPI WideAABBTree {
+ public:
+  /// @brief Maximum number of children of a node.
+  enum { width = 4 };
+
+  typedef std::uint32_t ChildIndex;
+
+  /// @brief Flag set in the index of a child which is an object.
+  static const ChildIndex leaf_flag = 0x80000000u;
+
+  /// @brief Index of an unused child slot.
+  static const ChildIndex empty_child = 0xFFFFFFFFu;
+
+  /// @brief Node of the tree. The bounds of the unused child slots are empty
+  /// (min > max), so that they never overlap nor get close to any box. The
+  /// used slots come first.
+  struct Node {
+    /// @brief Minimum corner of the bounds of the children, per axis.
+    Scalar min[3][width];
+    /// @brief Maximum corner of the bounds of the children, per axis.
+    Scalar max[3][width];
+    /// @brief Index of the children: index of a node, or index of an object
+    /// combined with leaf_flag, or empty_child.
+    ChildIndex children[width];
+    /// @brief Index of the parent node, empty_child for the root and for the
+    /// unused nodes.
+    ChildIndex parent;
+  };
+
+  WideAABBTree() : m_children_after_parents(true) {}
+
+  /// @brief Builds the tree of the objects, from their current AABB.
+  void build(const std::vector<CollisionObject*>& objects);
+
+  /// @brief Updates the bounds of the nodes from the current AABB of the
+  /// objects, without changing the structure of the tree.
+  void refit();
+
+  /// @brief Adds an object below the child whose bounds grow the least.
+  /// @return false if the object is already in the tree.
+  bool insert(CollisionObject* object);
+
+  /// @brief Removes an object. @return false if it is not in the tree.
+  /// The last object takes the index of the removed one.
+  bool remove(CollisionObject* object);
+
+  /// @brief Refits the nodes above an object from its current AABB.
+  /// @return false if the object is not in the tree.
+  bool update(CollisionObject* object);
+
+  /// @brief Removes all the objects.
+  void clear();
+
+  bool empty() const { return m_objects.empty(); }
+
+  /// @brief Returns the bounds of all the objects of the tree.
+  AABB getBounds() const;
+
+  /// @brief Objects of the tree. The index of an object in this vector is the
+  /// index stored in the leaves.
+  const std::vector<CollisionObject*>& getObjects() const {
+    return m_objects;
+  }
+
+  /// @brief Nodes of the tree. The root is the first node. Nodes freed by
+  /// remove have no parent nor children and are reused by insert.
+  const std::vector<Node>& getNodes() const { return m_nodes; }
+
+  static bool isLeaf(ChildIndex child) {
+    return child != empty_child && (child & leaf_flag);
+  }
+
+  static bool isNode(ChildIndex child) { return !(child & leaf_flag); }
+
+  static std::size_t objectIndex(ChildIndex child) {
+    return static_cast<std::size_t>(child & ~leaf_flag);
+  }
+
+  /// @brief Computes the distance between box and the bounds of each child
+  /// of node, as AABB::distance. The distance to an unused slot is infinite.
+  static void distances(const Node& node, const AABB& box,
+                        Scalar (&dist)[width]) {
+    Scalar squared[width] = {0};
+    for (int k = 0; k < 3; ++k) {
+      for (int i = 0; i < width; ++i) {
+        const Scalar gap = (std::max)(node.min[k][i] - box.max_[k],
+                                      box.min_[k] - node.max[k][i]);
+        squared[i] += gap > 0 ? gap * gap : Scalar(0);
+      }
+    }
+    for (int i = 0; i < width; ++i) dist[i] = std::sqrt(squared[i]);
+  }
+
+ protected:
+  /// @brief Builds the node containing the objects m_order[begin:end].
+  /// @return the index of the node.
+  ChildIndex buildNode(std::vector<Vec3s>& centers, std::size_t begin,
+                       std::size_t end);
+
+  /// @brief Splits m_order[begin:end] at the median of the centers along the
+  /// largest axis of their bounds. @return the index of the median.
+  std::size_t split(std::vector<Vec3s>& centers, std::size_t begin,
+                    std::size_t end);
+
+  /// @brief Returns an unused node, without children, below parent.
+  ChildIndex allocateNode(ChildIndex parent);
+
+  /// @brief Returns the slot of child in the node node_id.
+  int slotOf(ChildIndex node_id, ChildIndex child) const;
+
+  /// @brief Sets the child of a slot, and the back link of the child.
+  void setChild(ChildIndex node_id, int slot, ChildIndex child);
+
+  /// @brief Removes the child of a slot, moving the last child of the node to
+  /// it. A node left without children is freed and removed from its parent.
+  /// @return the deepest node which still exists on the path.
+  ChildIndex removeChild(ChildIndex node_id, int slot);
+
+  /// @brief Recomputes the bounds of the slot of child in node_id and in its
+  /// ancestors, stopping at the first ancestor whose bounds do not change.
+  void refitUp(ChildIndex node_id);
+
+  /// @brief Updates the bounds of the node node_id and of its subtree.
+  void refitNode(ChildIndex node_id);
+
+  /// @brief Sets the bounds of the i-th child of node from the current
+  /// bounds of the child.
+  void setChildBounds(Node& node, int i) const;
+
+  std::vector<CollisionObject*> m_objects;
+  /// @brief Node containing each object.
+  std::vector<ChildIndex> m_object_parents;
+  /// @brief Index of each object in m_objects.
+  std::unordered_map<CollisionObject*, std::size_t> m_indices;
+  std::vector<std::size_t> m_order;
+  std::vector<Node> m_nodes;
+  /// @brief Unused nodes of m_nodes.
+  std::vector<ChildIndex> m_free_nodes;
+  /// @brief Whether every node is stored after its parent, which refit uses
+  /// to update the nodes without recursion. Reusing a free node may break it.
+  bool m_children_after_parents;
+};
+
+}  // namespace detail
+}  // namespace coal
+
+#endif  // COAL_BROADPHASE_DETAIL_WIDE_AABB_TREE_H
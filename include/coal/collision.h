@@ -44,6 +44,8 @@
 #include "coal/collision_data.h"
 #include "coal/collision_func_matrix.h"
 #include "coal/timings.h"
+#include "coal/query_context.h"
+#include "coal/BVH/BVH_front.h"
 
 namespace coal {
 
@@ -68,6 +70,51 @@ COAL_DLLAPI std::size_t collide(const CollisionGeometry* o1,
                                 const CollisionRequest& request,
                                 CollisionResult& result);
 
+/// @brief Collision between two collision objects which reuses the GJK
+/// warm starts stored in warm_start_cache by the previous queries between the
+/// same objects, and stores the new ones.
+/// Only the pairs of shapes are warm started, ignoring the request's
+/// gjk_initial_guess: the other pairs are queried as without cache.
+COAL_DLLAPI std::size_t collide(const CollisionObject* o1,
+                                const CollisionObject* o2,
+                                const CollisionRequest& request,
+                                CollisionResult& result,
+                                GJKWarmStartCache& warm_start_cache);
+
+/// @brief Collision between two collision objects which restarts the
+/// traversal of their hierarchies from the front stored in front_cache by the
+/// previous query between the same objects, and stores the new front (see
+/// TraversalFrontCache).
+/// As with the other front lists, the traversal does not stop once
+/// request.num_max_contacts contacts are found, so that the front covers
+/// both hierarchies: the result still holds at most num_max_contacts
+/// contacts, but the query costs as much as a query for all the contacts.
+COAL_DLLAPI std::size_t collide(const CollisionObject* o1,
+                                const CollisionObject* o2,
+                                const CollisionRequest& request,
+                                CollisionResult& result,
+                                TraversalFrontCache& front_cache);
+
+/// @brief Collision between two geometries which uses the narrow phase solver
+/// of context instead of constructing one (see QueryContext).
+/// As for \ref collide, the result is not cleared before the query.
+COAL_DLLAPI std::size_t collide(const CollisionGeometry* o1,
+                                const Transform3s& tf1,
+                                const CollisionGeometry* o2,
+                                const Transform3s& tf2,
+                                const CollisionRequest& request,
+                                CollisionResult& result,
+                                QueryContext& context);
+
+/// @copydoc collide(const CollisionGeometry*, const Transform3s&, const
+/// CollisionGeometry*, const Transform3s&, const CollisionRequest&,
+/// CollisionResult&, QueryContext&)
+COAL_DLLAPI std::size_t collide(const CollisionObject* o1,
+                                const CollisionObject* o2,
+                                const CollisionRequest& request,
+                                CollisionResult& result,
+                                QueryContext& context);
+
 /// @brief This class reduces the cost of identifying the geometry pair.
 /// This is mostly useful for repeated shape-shape queries.
 ///
@@ -115,6 +162,89 @@ class COAL_DLLAPI ComputeCollision {
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
 
+/// @brief Batched collision interface: performs the collision between many
+/// pairs of geometries at once.
+///
+/// Contrary to calling \ref collide for each pair, the narrow phase solver
+/// and the internal buffers are kept between calls, which avoids reallocating
+/// the EPA storage for each pair. The pairs are grouped by node types so that
+/// the lookup in the CollisionFunctionMatrix is done once per group.
+///
+/// As for \ref collide, the results are not cleared before the queries: the
+/// results vector is resized to the number of pairs, which keeps its first
+/// elements.
+/// An instance of this class is not thread safe: use one instance per thread.
+///
+/// \code
+///   BatchCollision batch_collide;
+///   std::vector<CollisionResult> results(pairs.size());
+///   std::size_t ncolliding = batch_collide(pairs, request, results);
+/// \endcode
+class COAL_DLLAPI BatchCollision {
+ public:
+  BatchCollision() {}
+
+  /// @brief Performs the collision between each pair of geometries with the
+  /// same request.
+  ///
+  /// \param[in] pairs the pairs of geometries with their placements.
+  /// \param[in] request the collision request used for every pair.
+  /// \param[out] results vector of results, resized to the number of pairs.
+  /// results[i] contains the result of the collision of pairs[i].
+  /// \return the number of pairs in collision.
+  std::size_t operator()(const std::vector<GeometryPair>& pairs,
+                         const CollisionRequest& request,
+                         std::vector<CollisionResult>& results) const;
+
+  /// @brief Performs the collision between each pair of geometries, using
+  /// requests[i] for pairs[i].
+  ///
+  /// \param[in] pairs the pairs of geometries with their placements.
+  /// \param[in] requests the collision requests, of the same size as pairs.
+  /// \param[out] results vector of results, resized to the number of pairs.
+  /// results[i] contains the result of the collision of pairs[i].
+  /// \return the number of pairs in collision.
+  std::size_t operator()(const std::vector<GeometryPair>& pairs,
+                         const std::vector<CollisionRequest>& requests,
+                         std::vector<CollisionResult>& results) const;
+
+  virtual ~BatchCollision() {};
+
+ protected:
+  /// @brief Narrow phase solver, reused for every pair.
+  mutable GJKSolver solver;
+
+  /// @brief Indices of the pairs, sorted by pair of node types.
+  mutable std::vector<std::size_t> order;
+
+  /// @brief Pair of node types of each pair (workspace).
+  mutable std::vector<std::size_t> keys;
+
+  /// @brief Offset of each group of node types in order (workspace).
+  mutable std::vector<std::size_t> offsets;
+
+  std::size_t run(const std::vector<GeometryPair>& pairs,
+                  const CollisionRequest* requests, std::size_t request_stride,
+                  std::vector<CollisionResult>& results) const;
+
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/// @brief Batched collision interface, see BatchCollision.
+/// The narrow phase solver and the internal buffers are stored per thread and
+/// reused between calls.
+/// Return value is the number of pairs in collision.
+COAL_DLLAPI std::size_t collide(const std::vector<GeometryPair>& pairs,
+                                const CollisionRequest& request,
+                                std::vector<CollisionResult>& results);
+
+/// @copydoc collide(const std::vector<GeometryPair>&, const
+/// CollisionRequest&, std::vector<CollisionResult>&)
+COAL_DLLAPI std::size_t collide(const std::vector<GeometryPair>& pairs,
+                                const std::vector<CollisionRequest>& requests,
+                                std::vector<CollisionResult>& results);
+
 }  // namespace coal
 
 #endif
@@ -166,6 +166,85 @@ struct COAL_DLLAPI Contact {
 
 struct QueryResult;
 
+/// @brief Reason why a query stopped, see QueryStatistics.
+enum QueryStopReason {
+  /// @brief The query did not run.
+  QUERY_NOT_RUN,
+  /// @brief All the candidate pairs of primitives were tested.
+  QUERY_COMPLETED,
+  /// @brief The collision query stopped once num_max_contacts contacts were
+  /// found.
+  QUERY_MAX_CONTACTS_REACHED,
+  /// @brief Nothing was tested because the security margin is -infinity.
+  QUERY_SKIPPED
+};
+
+/// @brief Statistics of a query, filled when
+/// QueryRequest::enable_statistics is set.
+///
+/// The counts and times accumulate over the queries which use the same
+/// result, until the result is cleared. The times are in microseconds.
+struct COAL_DLLAPI QueryStatistics {
+  /// @brief Number of tests between pairs of bounding volumes (nodes of the
+  /// BVH models, height fields and octrees).
+  std::size_t num_bv_tests;
+
+  /// @brief Number of tests between pairs of primitives (leaves of the
+  /// traversals).
+  std::size_t num_leaf_tests;
+
+  /// @brief Number of runs of GJK.
+  std::size_t num_gjk_calls;
+
+  /// @brief Total number of iterations of GJK.
+  std::size_t num_gjk_iterations;
+
+  /// @brief Number of runs of EPA.
+  std::size_t num_epa_calls;
+
+  /// @brief Total number of iterations of EPA.
+  std::size_t num_epa_iterations;
+
+  /// @brief Total number of faces of the EPA polytopes when EPA stopped.
+  std::size_t num_epa_faces;
+
+  /// @brief Why the last query stopped.
+  QueryStopReason stop_reason;
+
+  /// @brief Time spent out of the other stages: lookup of the query
+  /// function, setup of the solver and of the traversal.
+  double dispatch_time;
+
+  /// @brief Time spent in the traversals of the BVH models, height fields
+  /// and octrees, without the tests between primitives.
+  double traversal_time;
+
+  /// @brief Time spent in the tests between primitives, or between the
+  /// shapes for a query between two shapes.
+  double narrowphase_time;
+
+  /// @brief Time spent in the computation of the contact patches.
+  double patch_time;
+
+  QueryStatistics() { clear(); }
+
+  /// @brief Resets the counts and times.
+  void clear() {
+    num_bv_tests = 0;
+    num_leaf_tests = 0;
+    num_gjk_calls = 0;
+    num_gjk_iterations = 0;
+    num_epa_calls = 0;
+    num_epa_iterations = 0;
+    num_epa_faces = 0;
+    stop_reason = QUERY_NOT_RUN;
+    dispatch_time = 0;
+    traversal_time = 0;
+    narrowphase_time = 0;
+    patch_time = 0;
+  }
+};
+
 /// @brief base class for all query requests
 struct COAL_DLLAPI QueryRequest {
   // @brief Initial guess to use for the GJK algorithm
@@ -213,6 +292,10 @@ struct COAL_DLLAPI QueryRequest {
   /// @brief enable timings when performing collision/distance request
   bool enable_timings;
 
+  /// @brief fill QueryResult::statistics when performing collision/distance
+  /// request
+  bool enable_statistics;
+
   /// @brief threshold below which a collision is considered.
   Scalar collision_distance_threshold;
 
@@ -232,6 +315,7 @@ struct COAL_DLLAPI QueryRequest {
         epa_max_iterations(EPA_DEFAULT_MAX_ITERATIONS),
         epa_tolerance(EPA_DEFAULT_TOLERANCE),
         enable_timings(false),
+        enable_statistics(false),
         collision_distance_threshold(
             Eigen::NumTraits<Scalar>::dummy_precision()) {}
 
@@ -266,6 +350,7 @@ struct COAL_DLLAPI QueryRequest {
            epa_max_iterations == other.epa_max_iterations &&
            epa_tolerance == other.epa_tolerance &&
            enable_timings == other.enable_timings &&
+           enable_statistics == other.enable_statistics &&
            collision_distance_threshold == other.collision_distance_threshold;
     COAL_COMPILER_DIAGNOSTIC_POP
   }
@@ -282,6 +367,9 @@ struct COAL_DLLAPI QueryResult {
   /// @brief timings for the given request
   CPUTimes timings;
 
+  /// @brief statistics of the query, see QueryRequest::enable_statistics
+  QueryStatistics statistics;
+
   QueryResult()
       : cached_gjk_guess(Vec3s::Zero()),
         cached_support_func_guess(support_func_guess_t::Constant(-1)) {}
@@ -483,6 +571,7 @@ struct COAL_DLLAPI CollisionResult : QueryResult {
     distance_lower_bound = (std::numeric_limits<Scalar>::max)();
     contacts.clear();
     timings.clear();
+    statistics.clear();
     nearest_points[0] = nearest_points[1] = normal =
         Vec3s::Constant(std::numeric_limits<Scalar>::quiet_NaN());
   }
@@ -724,6 +813,9 @@ struct COAL_DLLAPI ContactPatchRequest {
   /// @brief Maximum number of contact patches that will be computed.
   size_t max_num_patch;
 
+  /// @brief Whether to fill ContactPatchResult::statistics.
+  bool enable_statistics;
+
  protected:
   /// @brief Maximum samples to compute the support sets of curved shapes,
   /// i.e. when the normal is perpendicular to the base of a cylinder. For
@@ -761,7 +853,7 @@ struct COAL_DLLAPI ContactPatchRequest {
                                size_t num_samples_curved_shapes =
                                    ContactPatch::default_preallocated_size,
                                Scalar patch_tolerance = Scalar(1e-3))
-      : max_num_patch(max_num_patch) {
+      : max_num_patch(max_num_patch), enable_statistics(false) {
     this->setNumSamplesCurvedShapes(num_samples_curved_shapes);
     this->setPatchTolerance(patch_tolerance);
   }
@@ -771,7 +863,8 @@ struct COAL_DLLAPI ContactPatchRequest {
                                size_t num_samples_curved_shapes =
                                    ContactPatch::default_preallocated_size,
                                Scalar patch_tolerance = Scalar(1e-3))
-      : max_num_patch(collision_request.num_max_contacts) {
+      : max_num_patch(collision_request.num_max_contacts),
+        enable_statistics(collision_request.enable_statistics) {
     this->setNumSamplesCurvedShapes(num_samples_curved_shapes);
     this->setPatchTolerance(patch_tolerance);
   }
@@ -813,7 +906,8 @@ struct COAL_DLLAPI ContactPatchRequest {
     return this->max_num_patch == other.max_num_patch &&
            this->getNumSamplesCurvedShapes() ==
                other.getNumSamplesCurvedShapes() &&
-           this->getPatchTolerance() == other.getPatchTolerance();
+           this->getPatchTolerance() == other.getPatchTolerance() &&
+           this->enable_statistics == other.enable_statistics;
   }
 };
 
@@ -841,6 +935,10 @@ struct COAL_DLLAPI ContactPatchResult {
   ContactPatchRefVector m_contact_patches;
 
  public:
+  /// @brief Statistics of the computation, see
+  /// ContactPatchRequest::enable_statistics. Only the times are filled.
+  QueryStatistics statistics;
+
   /// @brief Default constructor.
   ContactPatchResult() : m_id_available_patch(0) {
     const size_t max_num_patch = 1;
@@ -909,6 +1007,7 @@ struct COAL_DLLAPI ContactPatchResult {
   void clear() {
     this->m_contact_patches.clear();
     this->m_id_available_patch = 0;
+    this->statistics.clear();
     for (ContactPatch& patch : this->m_contact_patches_data) {
       patch.clear();
     }
@@ -1142,6 +1241,7 @@ struct COAL_DLLAPI DistanceResult : QueryResult {
     b2 = NONE;
     nearest_points[0] = nearest_points[1] = normal = nan;
     timings.clear();
+    statistics.clear();
   }
 
   /// @brief whether two DistanceResult are the same or not
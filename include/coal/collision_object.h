@@ -48,19 +48,21 @@
 
 namespace coal {
 
-/// @brief object type: BVH (mesh, points), basic geometry, octree
+/// @brief object type: BVH (mesh, points), basic geometry, octree, height
+/// field, compound
 enum OBJECT_TYPE {
   OT_UNKNOWN,
   OT_BVH,
   OT_GEOM,
   OT_OCTREE,
   OT_HFIELD,
+  OT_COMPOUND,
   OT_COUNT
 };
 
 /// @brief traversal node type: bounding volume (AABB, OBB, RSS, kIOS, OBBRSS,
 /// KDOP16, KDOP18, kDOP24), basic shape (box, sphere, ellipsoid, capsule, cone,
-/// cylinder, convex, plane, triangle), and octree
+/// cylinder, convex, plane, triangle), octree, height field and compound
 enum NODE_TYPE {
   BV_UNKNOWN,
   BV_AABB,
@@ -86,6 +88,7 @@ enum NODE_TYPE {
   GEOM_ELLIPSOID,
   HF_AABB,
   HF_OBBRSS,
+  GEOM_COMPOUND,
   NODE_COUNT
 };
 
@@ -357,6 +360,43 @@ class COAL_DLLAPI CollisionObject {
   void* user_data;
 };
 
+/// @brief A pair of collision geometries together with their placements in
+/// the world frame. It is the elementary input of the batched collision and
+/// distance interfaces.
+struct COAL_DLLAPI GeometryPair {
+  /// @brief first geometry
+  const CollisionGeometry* o1;
+  /// @brief placement of the first geometry
+  Transform3s tf1;
+  /// @brief second geometry
+  const CollisionGeometry* o2;
+  /// @brief placement of the second geometry
+  Transform3s tf2;
+
+  GeometryPair() : o1(nullptr), o2(nullptr) {}
+
+  GeometryPair(const CollisionGeometry* o1, const Transform3s& tf1,
+               const CollisionGeometry* o2, const Transform3s& tf2)
+      : o1(o1), tf1(tf1), o2(o2), tf2(tf2) {}
+
+  /// @brief Build a pair from two collision objects, using their current
+  /// transforms.
+  GeometryPair(const CollisionObject* co1, const CollisionObject* co2)
+      : o1(co1->collisionGeometryPtr()),
+        tf1(co1->getTransform()),
+        o2(co2->collisionGeometryPtr()),
+        tf2(co2->getTransform()) {}
+
+  bool operator==(const GeometryPair& other) const {
+    return o1 == other.o1 && tf1 == other.tf1 && o2 == other.o2 &&
+           tf2 == other.tf2;
+  }
+
+  bool operator!=(const GeometryPair& other) const {
+    return !(*this == other);
+  }
+};
+
 }  // namespace coal
 
 #endif
@@ -0,0 +1,147 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of INRIA nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COAL_COMPOUND_H
+#define COAL_COMPOUND_H
+
+#include <vector>
+
+#include "coal/fwd.hh"
+#include "coal/collision_object.h"
+#include "coal/math/transform.h"
+
+namespace coal {
+
+/// @addtogroup Construction_Of_BVH
+/// @{
+
+/// @brief Rigid union of collision geometries, each one placed in the frame of
+/// the compound.
+///
+/// The collision and distance queries against a compound run the query of
+/// each part whose AABB is close enough to the other geometry, and report
+/// the compound as the object of the contacts and the index of the part as
+/// the primitive id (Contact::b1 or Contact::b2).
+/// A compound typically holds the convex parts returned by
+/// computeConvexDecomposition, but any geometry can be a part, including
+/// another compound.
+/// @note The parts are shared and not copied, except by clone().
+class COAL_DLLAPI Compound : public CollisionGeometry {
+ public:
+  /// @brief Construct an empty compound.
+  Compound() {}
+
+  /// @brief Construct a compound from geometries expressed in the frame of the
+  /// compound.
+  template <typename GeometryT>
+  explicit Compound(const std::vector<shared_ptr<GeometryT>>& geometries) {
+    for (const shared_ptr<GeometryT>& geometry : geometries)
+      addPart(geometry);
+  }
+
+  /// @brief Copy constructor. The parts are shared with other.
+  Compound(const Compound& other) = default;
+
+  virtual ~Compound() {}
+
+  /// @brief Clone *this and the parts into a new Compound.
+  virtual Compound* clone() const;
+
+  /// @brief Add a part to the compound and update the AABB of the compound.
+  /// \param[in] geometry the geometry of the part. Its local AABB is computed.
+  /// \param[in] placement placement of the part in the frame of the compound.
+  void addPart(const CollisionGeometryPtr_t& geometry,
+               const Transform3s& placement = Transform3s());
+
+  /// @brief Remove all the parts.
+  void clear();
+
+  /// @brief Number of parts.
+  std::size_t numParts() const { return parts.size(); }
+
+  /// @brief Geometry of the i-th part.
+  const CollisionGeometryPtr_t& getPart(std::size_t i) const {
+    return parts[i];
+  }
+
+  /// @brief Placement of the i-th part in the frame of the compound.
+  const Transform3s& getPartPlacement(std::size_t i) const {
+    return placements[i];
+  }
+
+  /// @brief AABB of the i-th part in the frame of the compound.
+  const AABB& getPartAABB(std::size_t i) const { return part_aabbs[i]; }
+
+  /// @brief Compute the AABB of the compound from the AABBs of the parts.
+  void computeLocalAABB();
+
+  /// @brief Compute the AABB of a geometry placed at tf in the frame of the
+  /// compound, used to cull the parts.
+  /// \return false if the local AABB of the geometry is not computed or not
+  ///         bounded, in which case no part can be culled.
+  static bool computeRelativeAABB(const CollisionGeometry& geometry,
+                                  const Transform3s& tf, AABB& aabb);
+
+  OBJECT_TYPE getObjectType() const { return OT_COMPOUND; }
+
+  NODE_TYPE getNodeType() const { return GEOM_COMPOUND; }
+
+  /// @brief Sum of the volumes of the parts.
+  /// @note Overlapping parts are counted several times.
+  Scalar computeVolume() const;
+
+  /// @brief Center of mass of the parts, weighted by their volumes.
+  Vec3s computeCOM() const;
+
+ protected:
+  /// @brief Geometries of the parts.
+  std::vector<CollisionGeometryPtr_t> parts;
+
+  /// @brief Placements of the parts in the frame of the compound.
+  std::vector<Transform3s> placements;
+
+  /// @brief AABBs of the parts in the frame of the compound.
+  std::vector<AABB> part_aabbs;
+
+ private:
+  virtual bool isEqual(const CollisionGeometry& other) const;
+
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/// @}
+
+}  // namespace coal
+
+#endif  // COAL_COMPOUND_H
@@ -41,6 +41,7 @@
 #include "coal/collision_data.h"
 #include "coal/contact_patch/contact_patch_solver.h"
 #include "coal/contact_patch_func_matrix.h"
+#include "coal/query_context.h"
 
 namespace coal {
 
@@ -66,6 +67,27 @@ COAL_DLLAPI void computeContactPatch(const CollisionObject* o1,
                                      const ContactPatchRequest& request,
                                      ContactPatchResult& result);
 
+/// @brief Contact patch computation which uses the contact patch solver of
+/// context instead of constructing one (see QueryContext).
+COAL_DLLAPI void computeContactPatch(const CollisionGeometry* o1,
+                                     const Transform3s& tf1,
+                                     const CollisionGeometry* o2,
+                                     const Transform3s& tf2,
+                                     const CollisionResult& collision_result,
+                                     const ContactPatchRequest& request,
+                                     ContactPatchResult& result,
+                                     QueryContext& context);
+
+/// @copydoc computeContactPatch(const CollisionGeometry*, const Transform3s&,
+/// const CollisionGeometry*, const Transform3s&, const CollisionResult&, const
+/// ContactPatchRequest&, ContactPatchResult&, QueryContext&)
+COAL_DLLAPI void computeContactPatch(const CollisionObject* o1,
+                                     const CollisionObject* o2,
+                                     const CollisionResult& collision_result,
+                                     const ContactPatchRequest& request,
+                                     ContactPatchResult& result,
+                                     QueryContext& context);
+
 /// @brief This class reduces the cost of identifying the geometry pair.
 /// This is usefull for repeated shape-shape queries.
 /// @note This needs to be called after `collide` or after `ComputeCollision`.
@@ -42,6 +42,8 @@
 
 namespace coal {
 
+class BVHModelBase;
+
 /// @brief Solver to compute contact patches, i.e. the intersection between two
 /// contact surfaces projected onto the shapes' separating plane.
 /// Otherwise said, a contact patch is simply the intersection between two
@@ -128,6 +130,18 @@ struct COAL_DLLAPI ContactPatchSolver {
   /// `max_patch_size`.
   mutable std::vector<bool> added_to_patch;
 
+  /// @brief Cluster of each contact between two meshes, see @ref
+  /// computeMeshPatches.
+  mutable std::vector<size_t> mesh_contact_clusters;
+
+  /// @brief Vertices of a mesh which belong to the support set of a cluster of
+  /// contacts, see @ref computeMeshPatches.
+  mutable std::vector<Triangle32::IndexType> mesh_support_vertices;
+
+  /// @brief Cosine of the maximum angle between the normals of the contacts
+  /// merged into the same contact patch by @ref computeMeshPatches.
+  static constexpr Scalar mesh_patch_normal_cos_tolerance = Scalar(0.9998);
+
   /// @brief Default constructor.
   explicit ContactPatchSolver() {
     const size_t num_contact_patch = 1;
@@ -163,12 +177,42 @@ struct COAL_DLLAPI ContactPatchSolver {
                     const ShapeType2& s2, const Transform3s& tf2,
                     const Contact& contact, ContactPatch& contact_patch) const;
 
+  /// @brief Contact patches between two meshes, from the contacts between
+  /// their triangles.
+  /// The contacts are clustered: the contacts of a cluster have about the same
+  /// normal (see @ref mesh_patch_normal_cos_tolerance) and lie on the same
+  /// plane, up to @ref patch_tolerance. Each cluster yields one contact patch,
+  /// whose frame is given by its deepest contact. The support set of each mesh
+  /// is the convex hull of the support sets of its triangles in the cluster;
+  /// the two support sets are then clipped once, with @ref
+  /// computePatchFromSupportSets, instead of once per pair of triangles.
+  /// @note The contact patch of a cluster is convex: it over-approximates
+  /// non-convex contact regions.
+  void computeMeshPatches(const BVHModelBase& mesh1, const Transform3s& tf1,
+                          const BVHModelBase& mesh2, const Transform3s& tf2,
+                          const CollisionResult& collision_result,
+                          const ContactPatchRequest& request,
+                          ContactPatchResult& result) const;
+
+  /// @brief Computes the contact patch from the support sets of the shapes,
+  /// `support_set_shape1` and `support_set_shape2`. This is the last step of
+  /// @ref computePatch, which clips one support set with the other.
+  /// The support sets must be convex polygons ranked counter-clockwise, in
+  /// the frame of `contact_patch`.
+  void computePatchFromSupportSets(const Contact& contact,
+                                   ContactPatch& contact_patch) const;
+
   /// @brief Reset the internal quantities of the solver.
   template <typename ShapeType1, typename ShapeType2>
   void reset(const ShapeType1& shape1, const Transform3s& tf1,
              const ShapeType2& shape2, const Transform3s& tf2,
              const ContactPatch& contact_patch) const;
 
+  /// @brief Clears the support sets of the shapes and sets their frames and
+  /// directions from the frame of `contact_patch`.
+  void setSupportSetFrames(const Transform3s& tf1, const Transform3s& tf2,
+                           const ContactPatch& contact_patch) const;
+
   /// @brief Retrieve result, adds a post-processing step if result has bigger
   /// size than `this->max_patch_size`.
   void getResult(const Contact& contact, const ContactPatch::Polygon* result,
@@ -194,6 +238,8 @@ struct COAL_DLLAPI ContactPatchSolver {
            this->support_set_shape2 == other.support_set_shape2 &&
            this->support_set_buffer == other.support_set_buffer &&
            this->added_to_patch == other.added_to_patch &&
+           this->mesh_contact_clusters == other.mesh_contact_clusters &&
+           this->mesh_support_vertices == other.mesh_support_vertices &&
            this->supportFuncShape1 == other.supportFuncShape1 &&
            this->supportFuncShape2 == other.supportFuncShape2;
   }
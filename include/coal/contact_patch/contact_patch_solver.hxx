@@ -123,6 +123,12 @@ void ContactPatchSolver::computePatch(const ShapeType1& s1,
                           this->num_samples_curved_shapes,
                           this->patch_tolerance);
 
+  this->computePatchFromSupportSets(contact, contact_patch);
+}
+
+// ============================================================================
+inline void ContactPatchSolver::computePatchFromSupportSets(
+    const Contact& contact, ContactPatch& contact_patch) const {
   // We can immediatly return if one of the support set has only
   // one point.
   if (this->support_set_shape1.size() <= 1 ||
@@ -379,12 +385,22 @@ inline void ContactPatchSolver::reset(const ShapeType1& shape1,
                                       const ShapeType2& shape2,
                                       const Transform3s& tf2,
                                       const ContactPatch& contact_patch) const {
+  this->setSupportSetFrames(tf1, tf2, contact_patch);
+  this->supportFuncShape1 =
+      this->makeSupportSetFunction(&shape1, this->supports_data[0]);
+  this->supportFuncShape2 =
+      this->makeSupportSetFunction(&shape2, this->supports_data[1]);
+}
+
+// ============================================================================
+inline void ContactPatchSolver::setSupportSetFrames(
+    const Transform3s& tf1, const Transform3s& tf2,
+    const ContactPatch& contact_patch) const {
   // Reset internal quantities
   this->support_set_shape1.clear();
   this->support_set_shape2.clear();
   this->support_set_buffer.clear();
 
-  // Get the support function of each shape
   const Transform3s& tfc = contact_patch.tf;
 
   this->support_set_shape1.direction = SupportSetDirection::DEFAULT;
@@ -394,8 +410,6 @@ inline void ContactPatchSolver::reset(const ShapeType1& shape1,
   tf1c.rotation().noalias() = tf1.rotation().transpose() * tfc.rotation();
   tf1c.translation().noalias() =
       tf1.rotation().transpose() * (tfc.translation() - tf1.translation());
-  this->supportFuncShape1 =
-      this->makeSupportSetFunction(&shape1, this->supports_data[0]);
 
   this->support_set_shape2.direction = SupportSetDirection::INVERTED;
   // Set the reference frame of the support set of the second shape to be the
@@ -404,8 +418,6 @@ inline void ContactPatchSolver::reset(const ShapeType1& shape1,
   tf2c.rotation().noalias() = tf2.rotation().transpose() * tfc.rotation();
   tf2c.translation().noalias() =
       tf2.rotation().transpose() * (tfc.translation() - tf2.translation());
-  this->supportFuncShape2 =
-      this->makeSupportSetFunction(&shape2, this->supports_data[1]);
 }
 
 // ==========================================================================
@@ -42,6 +42,7 @@
 #include "coal/collision_data.h"
 #include "coal/distance_func_matrix.h"
 #include "coal/timings.h"
+#include "coal/query_context.h"
 
 namespace coal {
 
@@ -61,6 +62,32 @@ COAL_DLLAPI Scalar distance(const CollisionGeometry* o1, const Transform3s& tf1,
                             const DistanceRequest& request,
                             DistanceResult& result);
 
+/// @brief Distance between two collision objects which reuses the GJK warm
+/// starts stored in warm_start_cache by the previous queries between the same
+/// objects, and stores the new ones.
+/// Only the pairs of shapes are warm started, ignoring the request's
+/// gjk_initial_guess: the other pairs are queried as without cache.
+COAL_DLLAPI Scalar distance(const CollisionObject* o1,
+                            const CollisionObject* o2,
+                            const DistanceRequest& request,
+                            DistanceResult& result,
+                            GJKWarmStartCache& warm_start_cache);
+
+/// @brief Distance between two geometries which uses the narrow phase solver
+/// of context instead of constructing one (see QueryContext).
+COAL_DLLAPI Scalar distance(const CollisionGeometry* o1, const Transform3s& tf1,
+                            const CollisionGeometry* o2, const Transform3s& tf2,
+                            const DistanceRequest& request,
+                            DistanceResult& result, QueryContext& context);
+
+/// @copydoc distance(const CollisionGeometry*, const Transform3s&, const
+/// CollisionGeometry*, const Transform3s&, const DistanceRequest&,
+/// DistanceResult&, QueryContext&)
+COAL_DLLAPI Scalar distance(const CollisionObject* o1,
+                            const CollisionObject* o2,
+                            const DistanceRequest& request,
+                            DistanceResult& result, QueryContext& context);
+
 /// This class reduces the cost of identifying the geometry pair.
 /// This is mostly useful for repeated shape-shape queries.
 ///
@@ -108,6 +135,86 @@ class COAL_DLLAPI ComputeDistance {
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
 
+/// @brief Batched distance interface: computes the distance between many
+/// pairs of geometries at once.
+///
+/// Contrary to calling \ref distance for each pair, the narrow phase solver
+/// and the internal buffers are kept between calls, which avoids reallocating
+/// the EPA storage for each pair. The pairs are grouped by node types so that
+/// the lookup in the DistanceFunctionMatrix is done once per group.
+///
+/// As for \ref distance, the results are not cleared before the queries: the
+/// results vector is resized to the number of pairs, which keeps its first
+/// elements.
+/// An instance of this class is not thread safe: use one instance per thread.
+///
+/// \code
+///   BatchDistance batch_distance;
+///   std::vector<DistanceResult> results(pairs.size());
+///   batch_distance(pairs, request, results);
+/// \endcode
+class COAL_DLLAPI BatchDistance {
+ public:
+  BatchDistance() {}
+
+  /// @brief Computes the distance between each pair of geometries with the
+  /// same request.
+  ///
+  /// \param[in] pairs the pairs of geometries with their placements.
+  /// \param[in] request the distance request used for every pair.
+  /// \param[out] results vector of results, resized to the number of pairs.
+  /// results[i] contains the result of the distance of pairs[i].
+  void operator()(const std::vector<GeometryPair>& pairs,
+                  const DistanceRequest& request,
+                  std::vector<DistanceResult>& results) const;
+
+  /// @brief Computes the distance between each pair of geometries, using
+  /// requests[i] for pairs[i].
+  ///
+  /// \param[in] pairs the pairs of geometries with their placements.
+  /// \param[in] requests the distance requests, of the same size as pairs.
+  /// \param[out] results vector of results, resized to the number of pairs.
+  /// results[i] contains the result of the distance of pairs[i].
+  void operator()(const std::vector<GeometryPair>& pairs,
+                  const std::vector<DistanceRequest>& requests,
+                  std::vector<DistanceResult>& results) const;
+
+  virtual ~BatchDistance() {};
+
+ protected:
+  /// @brief Narrow phase solver, reused for every pair.
+  mutable GJKSolver solver;
+
+  /// @brief Indices of the pairs, sorted by pair of node types.
+  mutable std::vector<std::size_t> order;
+
+  /// @brief Pair of node types of each pair (workspace).
+  mutable std::vector<std::size_t> keys;
+
+  /// @brief Offset of each group of node types in order (workspace).
+  mutable std::vector<std::size_t> offsets;
+
+  void run(const std::vector<GeometryPair>& pairs,
+           const DistanceRequest* requests, std::size_t request_stride,
+           std::vector<DistanceResult>& results) const;
+
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/// @brief Batched distance interface, see BatchDistance.
+/// The narrow phase solver and the internal buffers are stored per thread and
+/// reused between calls.
+COAL_DLLAPI void distance(const std::vector<GeometryPair>& pairs,
+                          const DistanceRequest& request,
+                          std::vector<DistanceResult>& results);
+
+/// @copydoc distance(const std::vector<GeometryPair>&, const
+/// DistanceRequest&, std::vector<DistanceResult>&)
+COAL_DLLAPI void distance(const std::vector<GeometryPair>& pairs,
+                          const std::vector<DistanceRequest>& requests,
+                          std::vector<DistanceResult>& results);
+
 }  // namespace coal
 
 #endif
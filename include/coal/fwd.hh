@@ -130,6 +130,7 @@ using std::shared_ptr;
 class CollisionObject;
 typedef shared_ptr<CollisionObject> CollisionObjectPtr_t;
 typedef shared_ptr<const CollisionObject> CollisionObjectConstPtr_t;
+class ContinuousCollisionObject;
 class CollisionGeometry;
 typedef shared_ptr<CollisionGeometry> CollisionGeometryPtr_t;
 typedef shared_ptr<const CollisionGeometry> CollisionGeometryConstPtr_t;
@@ -143,6 +144,9 @@ typedef shared_ptr<BVHModelBase> BVHModelPtr_t;
 class OcTree;
 typedef shared_ptr<OcTree> OcTreePtr_t;
 typedef shared_ptr<const OcTree> OcTreeConstPtr_t;
+
+class Compound;
+typedef shared_ptr<Compound> CompoundPtr_t;
 }  // namespace coal
 
 #ifdef COAL_BACKWARD_COMPATIBILITY_WITH_HPP_FCL
@@ -43,6 +43,7 @@
 #include "coal/BV/BV_node.h"
 #include "coal/BVH/BVH_internal.h"
 
+#include <algorithm>
 #include <vector>
 
 namespace coal {
@@ -303,6 +304,97 @@ class COAL_DLLAPI HeightField : public CollisionGeometry {
     assert(this->max_height == heights.maxCoeff());
   }
 
+  /// @brief Update a block of the Height Field heights, and refit only the
+  /// bounding volumes covering the modified heights.
+  ///
+  /// \param[in] block New values of the heights
+  /// \param[in] row Row of the first height of the block
+  /// \param[in] col Column of the first height of the block
+  ///
+  void updateHeights(const MatrixXs& block, const Eigen::DenseIndex row,
+                     const Eigen::DenseIndex col) {
+    if (row < 0 || col < 0 || row + block.rows() > heights.rows() ||
+        col + block.cols() > heights.cols())
+      COAL_THROW_PRETTY(
+          "The block of new heights values does not fit in the height "
+          "field.\n"
+              << "\tinput values - row: " << row << " - col: " << col
+              << " - rows: " << block.rows() << " - cols: " << block.cols()
+              << "\n"
+              << "\texpected values - rows: " << heights.rows()
+              << " - cols: " << heights.cols() << "\n",
+          std::invalid_argument);
+    if (block.size() == 0) return;
+
+    heights.block(row, col, block.rows(), block.cols()) =
+        block.cwiseMax(min_height);
+    this->max_height =
+        recursiveUpdateHeight(0, col, col + block.cols() - 1, row,
+                              row + block.rows() - 1);
+    assert(this->max_height == heights.maxCoeff());
+  }
+
+  /// @brief Scroll the Height Field by a whole number of cells, as done by
+  /// rolling elevation maps which follow a robot.
+  ///
+  /// The grid moves by x_shift cells along the X axis and y_shift cells along
+  /// the Y axis, in the frame of the Height Field. The heights which remain in
+  /// the grid keep their position in this frame, and the heights of the cells
+  /// entering the grid are set to fill_height. They can then be written with
+  /// updateHeights(block, row, col).
+  /// The bounding volume hierarchy is refitted, not rebuilt.
+  ///
+  /// \note The Height Field is then no longer centered at the origin of its
+  /// frame: see getXGrid() and getYGrid().
+  ///
+  /// \param[in] x_shift Number of cells the grid moves along the X axis
+  /// \param[in] y_shift Number of cells the grid moves along the Y axis
+  /// \param[in] fill_height Height of the cells entering the grid
+  ///
+  void scroll(const Eigen::DenseIndex x_shift, const Eigen::DenseIndex y_shift,
+              const Scalar fill_height) {
+    const Eigen::DenseIndex NX = heights.cols(), NY = heights.rows();
+    const Scalar fill = (std::max)(fill_height, min_height);
+
+    // Along X, the columns move towards the first one when x_shift > 0. Along
+    // Y, the rows move towards the last one when y_shift > 0, as the Y grid
+    // is decreasing.
+    const Eigen::DenseIndex kept_cols =
+        (std::max)(Eigen::DenseIndex(0), NX - std::abs(x_shift));
+    const Eigen::DenseIndex kept_rows =
+        (std::max)(Eigen::DenseIndex(0), NY - std::abs(y_shift));
+    const Eigen::DenseIndex src_row = y_shift > 0 ? 0 : NY - kept_rows,
+                            dst_row = y_shift > 0 ? NY - kept_rows : 0;
+    for (Eigen::DenseIndex k = 0; k < kept_cols; ++k) {
+      // Visit the columns so that a column is read before being overwritten.
+      const Eigen::DenseIndex dst_col = x_shift > 0 ? k : NX - 1 - k;
+      const Eigen::DenseIndex src_col = dst_col + x_shift;
+      const Scalar* src = heights.col(src_col).data() + src_row;
+      Scalar* dst = heights.col(dst_col).data() + dst_row;
+      if (dst > src)
+        std::copy_backward(src, src + kept_rows, dst + kept_rows);
+      else
+        std::copy(src, src + kept_rows, dst);
+    }
+
+    // Fill the cells entering the grid.
+    if (x_shift > 0)
+      heights.rightCols(NX - kept_cols).setConstant(fill);
+    else
+      heights.leftCols(NX - kept_cols).setConstant(fill);
+    if (y_shift > 0)
+      heights.topRows(NY - kept_rows).setConstant(fill);
+    else
+      heights.bottomRows(NY - kept_rows).setConstant(fill);
+
+    const Scalar dx = x_dim / Scalar(NX - 1), dy = y_dim / Scalar(NY - 1);
+    x_grid.array() += Scalar(x_shift) * dx;
+    y_grid.array() += Scalar(y_shift) * dy;
+
+    this->max_height = recursiveUpdateHeight(0);
+    assert(this->max_height == heights.maxCoeff());
+  }
+
  protected:
   void init(const Scalar x_dim, const Scalar y_dim, const MatrixXs& heights,
             const Scalar min_height) {
@@ -372,14 +464,34 @@ class COAL_DLLAPI HeightField : public CollisionGeometry {
   }
 
   Scalar recursiveUpdateHeight(const size_t bv_id) {
+    return recursiveUpdateHeight(bv_id, 0, heights.cols() - 1, 0,
+                                 heights.rows() - 1);
+  }
+
+  /// @brief Refit the bounding volumes of the subtree rooted at bv_id which
+  /// cover some heights of columns [x_min, x_max] and rows [y_min, y_max].
+  /// @return the maximal height of the subtree.
+  Scalar recursiveUpdateHeight(const size_t bv_id,
+                               const Eigen::DenseIndex x_min,
+                               const Eigen::DenseIndex x_max,
+                               const Eigen::DenseIndex y_min,
+                               const Eigen::DenseIndex y_max) {
     HFNode<BV>& bv_node = bvs[bv_id];
 
+    // The node covers the heights of columns [x_id, x_id + x_size] and rows
+    // [y_id, y_id + y_size].
+    if (bv_node.x_id > x_max || bv_node.x_id + bv_node.x_size < x_min ||
+        bv_node.y_id > y_max || bv_node.y_id + bv_node.y_size < y_min)
+      return bv_node.max_height;
+
     Scalar max_height;
     if (bv_node.isLeaf()) {
       max_height = heights.block<2, 2>(bv_node.y_id, bv_node.x_id).maxCoeff();
     } else {
-      Scalar max_left_height = recursiveUpdateHeight(bv_node.leftChild()),
-             max_right_height = recursiveUpdateHeight(bv_node.rightChild());
+      Scalar max_left_height = recursiveUpdateHeight(
+                 bv_node.leftChild(), x_min, x_max, y_min, y_max),
+             max_right_height = recursiveUpdateHeight(
+                 bv_node.rightChild(), x_min, x_max, y_min, y_max);
 
       max_height = (std::max)(max_left_height, max_right_height);
     }
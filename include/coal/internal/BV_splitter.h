@@ -46,13 +46,32 @@
 
 namespace coal {
 
-/// @brief Three types of split algorithms are provided in FCL as default
+/// @brief Four types of split algorithms are provided as default
 enum SplitMethodType {
   SPLIT_METHOD_MEAN,
   SPLIT_METHOD_MEDIAN,
-  SPLIT_METHOD_BV_CENTER
+  SPLIT_METHOD_BV_CENTER,
+  SPLIT_METHOD_BINNED_SAH
 };
 
+/// @brief Binned surface area heuristic (SAH) split rule.
+///
+/// The centroids of the primitives are projected on each column of axes and
+/// sorted into bins of equal width. The split plane is chosen among the
+/// bin boundaries of the three axes so as to minimize the SAH cost
+/// area(left) * num(left) + area(right) * num(right), where the areas are the
+/// ones of the boxes, aligned with axes, containing the primitives of each
+/// side.
+///
+/// @param[in] axes the candidate split directions, as columns.
+/// @param[out] split_value the position of the split plane along the chosen
+/// axis.
+/// @return the index of the chosen axis.
+COAL_DLLAPI int computeSplitRule_binnedSAH(
+    const Matrix3s& axes, const Vec3s* vertices, const Triangle32* triangles,
+    const unsigned int* primitive_indices, unsigned int num_primitives,
+    BVHModelType type, Scalar& split_value);
+
 /// @brief A class describing the split rule that splits each BV node
 template <typename BV>
 class BVSplitter {
@@ -84,6 +103,9 @@ class BVSplitter {
       case SPLIT_METHOD_BV_CENTER:
         computeRule_bvcenter(bv, primitive_indices, num_primitives);
         break;
+      case SPLIT_METHOD_BINNED_SAH:
+        computeRule_binnedSAH(bv, primitive_indices, num_primitives);
+        break;
       default:
         std::cerr << "Split method not supported" << std::endl;
     }
@@ -204,6 +226,16 @@ class BVSplitter {
           (proj[num_primitives / 2] + proj[num_primitives / 2 - 1]) / 2;
     }
   }
+
+  /// @brief Split algorithm 4: Split the node along one of the world axes
+  /// according to the binned surface area heuristic
+  void computeRule_binnedSAH(const BV&, unsigned int* primitive_indices,
+                             unsigned int num_primitives) {
+    split_axis = computeSplitRule_binnedSAH(
+        Matrix3s::Identity(), vertices, tri_indices, primitive_indices,
+        num_primitives, type, split_value);
+    split_vector = Vec3s::Unit(split_axis);
+  }
 };
 
 template <>
@@ -233,6 +265,11 @@ void COAL_DLLAPI BVSplitter<OBB>::computeRule_median(
     const OBB& bv, unsigned int* primitive_indices,
     unsigned int num_primitives);
 
+template <>
+void COAL_DLLAPI BVSplitter<OBB>::computeRule_binnedSAH(
+    const OBB& bv, unsigned int* primitive_indices,
+    unsigned int num_primitives);
+
 template <>
 void COAL_DLLAPI BVSplitter<RSS>::computeRule_bvcenter(
     const RSS& bv, unsigned int* primitive_indices,
@@ -248,6 +285,11 @@ void COAL_DLLAPI BVSplitter<RSS>::computeRule_median(
     const RSS& bv, unsigned int* primitive_indices,
     unsigned int num_primitives);
 
+template <>
+void COAL_DLLAPI BVSplitter<RSS>::computeRule_binnedSAH(
+    const RSS& bv, unsigned int* primitive_indices,
+    unsigned int num_primitives);
+
 template <>
 void COAL_DLLAPI BVSplitter<kIOS>::computeRule_bvcenter(
     const kIOS& bv, unsigned int* primitive_indices,
@@ -263,6 +305,11 @@ void COAL_DLLAPI BVSplitter<kIOS>::computeRule_median(
     const kIOS& bv, unsigned int* primitive_indices,
     unsigned int num_primitives);
 
+template <>
+void COAL_DLLAPI BVSplitter<kIOS>::computeRule_binnedSAH(
+    const kIOS& bv, unsigned int* primitive_indices,
+    unsigned int num_primitives);
+
 template <>
 void COAL_DLLAPI BVSplitter<OBBRSS>::computeRule_bvcenter(
     const OBBRSS& bv, unsigned int* primitive_indices,
@@ -278,6 +325,11 @@ void COAL_DLLAPI BVSplitter<OBBRSS>::computeRule_median(
     const OBBRSS& bv, unsigned int* primitive_indices,
     unsigned int num_primitives);
 
+template <>
+void COAL_DLLAPI BVSplitter<OBBRSS>::computeRule_binnedSAH(
+    const OBBRSS& bv, unsigned int* primitive_indices,
+    unsigned int num_primitives);
+
 }  // namespace coal
 
 #endif
@@ -49,6 +49,26 @@ class COAL_DLLAPI Intersect {
  public:
   static bool buildTrianglePlane(const Vec3s& v1, const Vec3s& v2,
                                  const Vec3s& v3, Vec3s* n, Scalar* t);
+
+  /// @brief Exact overlap test between triangles (P1, P2, P3) and
+  /// (Q1, Q2, Q3), expressed in the same frame.
+  ///
+  /// This is the interval overlap test of Moller: each triangle is first
+  /// tested against the plane of the other one, then the intervals cut by
+  /// the triangles on the intersection line of the two planes are compared.
+  ///
+  /// @param[out] distLowerBound when the triangles do not overlap, a lower
+  /// bound of their distance: the distance between one triangle and the plane
+  /// of the other one if it lies strictly on one side of this plane, 0 if the
+  /// triangles are separated on the intersection line of their planes. It is
+  /// set to -1 if the triangles are degenerate or (nearly) coplanar: nothing
+  /// is concluded and their distance must be computed, e.g. with
+  /// TriangleDistance::sqrTriDistance.
+  /// @return true if the triangles overlap.
+  static bool intersectTriangles(const Vec3s& P1, const Vec3s& P2,
+                                 const Vec3s& P3, const Vec3s& Q1,
+                                 const Vec3s& Q2, const Vec3s& Q3,
+                                 Scalar& distLowerBound);
 };  // class Intersect
 
 /// @brief Project functions
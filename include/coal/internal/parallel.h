@@ -0,0 +1,98 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of INRIA nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COAL_INTERNAL_PARALLEL_H
+#define COAL_INTERNAL_PARALLEL_H
+
+#include <functional>
+#include <thread>
+
+#include "coal/fwd.hh"
+
+namespace coal {
+namespace internal {
+
+/// @brief Returns the number of threads to use for a parallel query.
+/// A value of 0 means "use all the hardware threads".
+inline std::size_t getNumThreads(std::size_t num_threads) {
+  if (num_threads == 0) {
+    num_threads = static_cast<std::size_t>(std::thread::hardware_concurrency());
+    if (num_threads == 0) num_threads = 1;
+  }
+  return num_threads;
+}
+
+/// @brief Function run by parallelFor, called as f(task_id, thread_id).
+typedef std::function<void(std::size_t, std::size_t)> ParallelTaskFunction;
+
+/// @brief Non-template part of parallelFor, running the tasks on the
+/// threads of a pool shared by the whole library.
+COAL_DLLAPI void runParallelFor(std::size_t num_tasks, std::size_t num_threads,
+                                const ParallelTaskFunction& f);
+
+/// @brief Runs `f(task_id, thread_id)` for every task_id in [0, num_tasks),
+/// using num_threads threads (the calling thread being one of them).
+///
+/// The tasks are not statically assigned to the threads: each thread picks
+/// the next pending task as soon as it is done with its current one. This
+/// balances the load when the tasks have very different costs, which is
+/// typically the case of the subtrees of a bounding volume hierarchy.
+///
+/// The other threads are taken from a pool which is created on the first
+/// parallel call and grows up to the largest number of threads requested,
+/// so that calling parallelFor many times (e.g. once per level of a tree)
+/// does not create threads each time. thread_id is in [0, num_threads) and
+/// no two threads running tasks of the same call share it. parallelFor may be
+/// called from several threads at once and from within a task: the calling
+/// thread always runs tasks itself, so a call completes even when every
+/// thread of the pool is busy.
+///
+/// If a task throws, the remaining tasks are skipped and the first exception
+/// is rethrown in the calling thread.
+template <typename TaskFunction>
+void parallelFor(std::size_t num_tasks, std::size_t num_threads,
+                 TaskFunction f) {
+  num_threads = getNumThreads(num_threads);
+  if (num_threads > num_tasks) num_threads = num_tasks;
+  if (num_threads <= 1) {
+    for (std::size_t task_id = 0; task_id < num_tasks; ++task_id)
+      f(task_id, std::size_t(0));
+    return;
+  }
+  runParallelFor(num_tasks, num_threads, ParallelTaskFunction(f));
+}
+
+}  // namespace internal
+}  // namespace coal
+
+#endif
@@ -0,0 +1,143 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COAL_INTERNAL_QUERY_STATISTICS_H
+#define COAL_INTERNAL_QUERY_STATISTICS_H
+
+#include <algorithm>
+
+#include "coal/collision_data.h"
+#include "coal/metrics.h"
+#include "coal/narrowphase/narrowphase.h"
+#include "coal/timings.h"
+
+/// @cond INTERNAL
+
+namespace coal {
+namespace internal {
+
+/// @brief Adds the time spent in its scope to one of the stages of
+/// statistics. Does nothing if statistics is NULL.
+class StageTimer {
+ public:
+  StageTimer(QueryStatistics* statistics, double QueryStatistics::*stage)
+      : statistics(statistics), stage(stage), timer(false) {
+    if (statistics) timer.start();
+  }
+
+  ~StageTimer() {
+    if (statistics) statistics->*stage += timer.elapsed().user;
+  }
+
+ private:
+  QueryStatistics* statistics;
+  double QueryStatistics::*stage;
+  Timer timer;
+};
+
+/// @brief Records the statistics of a query between two geometries, if
+/// request.enable_statistics is set.
+///
+/// While it exists, the runs of GJK and EPA of solver are counted in
+/// result.statistics. The time spent in its scope and not in the traversal
+/// and narrow phase stages is counted as dispatch time.
+class QueryStatisticsRecorder {
+ public:
+  QueryStatisticsRecorder(const QueryRequest& request, QueryResult& result,
+                          const GJKSolver& solver)
+      : statistics(request.enable_statistics ? &result.statistics : NULL),
+        solver(solver),
+        previous(solver.statistics),
+        stages_time(0),
+        timer(false) {
+    if (!statistics) return;
+    solver.statistics = statistics;
+    statistics->stop_reason = QUERY_COMPLETED;
+    stages_time = statistics->traversal_time + statistics->narrowphase_time;
+    timer.start();
+  }
+
+  ~QueryStatisticsRecorder() {
+    if (!statistics) return;
+    const double total_time = timer.elapsed().user;
+    stages_time = statistics->traversal_time + statistics->narrowphase_time -
+                  stages_time;
+    statistics->dispatch_time += (std::max)(total_time - stages_time, 0.);
+    solver.statistics = previous;
+  }
+
+  /// @brief The statistics of the query, NULL if they are disabled.
+  QueryStatistics* const statistics;
+
+ private:
+  const GJKSolver& solver;
+  QueryStatistics* const previous;
+  double stages_time;
+  Timer timer;
+};
+
+/// @brief Records the time spent in its scope as a call of the entry
+/// (node_type1, node_type2) of a function matrix in the MetricsRegistry, if it
+/// is enabled. Otherwise, the timer is not started.
+class CallMetricsRecorder {
+ public:
+  CallMetricsRecorder(MetricsQueryType type, NODE_TYPE node_type1,
+                      NODE_TYPE node_type2)
+      : registry(MetricsRegistry::instance()),
+        type(type),
+        node_type1(node_type1),
+        node_type2(node_type2),
+        timer(false) {
+    if (registry.isEnabled()) timer.start();
+  }
+
+  ~CallMetricsRecorder() {
+    if (!timer.is_stopped())
+      registry.record(type, node_type1, node_type2, timer.elapsed().user);
+  }
+
+ private:
+  MetricsRegistry& registry;
+  const MetricsQueryType type;
+  const NODE_TYPE node_type1;
+  const NODE_TYPE node_type2;
+  Timer timer;
+};
+
+}  // namespace internal
+}  // namespace coal
+
+/// @endcond
+
+#endif  // COAL_INTERNAL_QUERY_STATISTICS_H
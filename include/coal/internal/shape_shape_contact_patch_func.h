@@ -71,15 +71,16 @@ struct ComputeShapeShapeContactPatch {
 
     const ShapeType1& s1 = static_cast<const ShapeType1&>(*o1);
     const ShapeType2& s2 = static_cast<const ShapeType2&>(*o2);
-    for (size_t i = 0; i < collision_result.numContacts(); ++i) {
-      if (i >= request.max_num_patch) {
-        break;
-      }
-      csolver->setSupportGuess(collision_result.cached_support_func_guess);
-      const Contact& contact = collision_result.getContact(i);
-      ContactPatch& contact_patch = result.getUnusedContactPatch();
-      csolver->computePatch(s1, tf1, s2, tf2, contact, contact_patch);
+    // Two convex shapes touch along a single patch. When the narrow phase
+    // returns several contacts (e.g. the manifold of a box-box pair), they all
+    // lie in this patch: it is computed from the first, deepest, contact.
+    if (request.max_num_patch == 0) {
+      return;
     }
+    csolver->setSupportGuess(collision_result.cached_support_func_guess);
+    const Contact& contact = collision_result.getContact(0);
+    ContactPatch& contact_patch = result.getUnusedContactPatch();
+    csolver->computePatch(s1, tf1, s2, tf2, contact, contact_patch);
   }
 };
 
@@ -165,6 +165,20 @@ struct ShapeShapeCollider {
   }
 };
 
+/// @brief Box-box collision, based on the separating axis test.
+/// When the boxes overlap, up to four contacts are returned (within the limit
+/// of CollisionRequest::num_max_contacts), which are the points of the face
+/// of one box clipped against the face of the other box, the deepest one
+/// first.
+template <>
+struct COAL_DLLAPI ShapeShapeCollider<Box, Box> {
+  static std::size_t run(const CollisionGeometry* o1, const Transform3s& tf1,
+                         const CollisionGeometry* o2, const Transform3s& tf2,
+                         const GJKSolver* nsolver,
+                         const CollisionRequest& request,
+                         CollisionResult& result);
+};
+
 template <typename ShapeType1, typename ShapeType2>
 std::size_t ShapeShapeCollide(const CollisionGeometry* o1,
                               const Transform3s& tf1,
@@ -188,7 +202,7 @@ std::size_t ShapeShapeCollide(const CollisionGeometry* o1,
 // +------------+-----+--------+---------+------+----------+-------+------------+----------+-----------+--------+
 // |            | box | sphere | capsule | cone | cylinder | plane | half-space | triangle | ellipsoid | convex |
 // +------------+-----+--------+---------+------+----------+-------+------------+----------+-----------+--------+
-// | box        |  1  |   0    |    1    |   1  |    1     |   0   |      0     |    1     |    1      |    1   |
+// | box        |  0  |   0    |    1    |   1  |    1     |   0   |      0     |    1     |    1      |    1   |
 // +------------+-----+--------+---------+------+----------+-------+------------+----------+-----------+--------+
 // | sphere     |/////|   0    |    0    |   1  |    0     |   0   |      0     |    0     |    1      |    1   |
 // +------------+-----+--------+---------+------+----------+-------+------------+----------+-----------+--------+
@@ -210,8 +224,8 @@ std::size_t ShapeShapeCollide(const CollisionGeometry* o1,
 // +------------+-----+--------+---------+------+----------+-------+------------+----------+-----------+--------+
 //
 // Number of pairs: 55
-//   - Specialized: 26
-//   - GJK:         29
+//   - Specialized: 27
+//   - GJK:         28
 // clang-format on
 
 #define SHAPE_SHAPE_DISTANCE_SPECIALIZATION(T1, T2)                            \
@@ -281,6 +295,7 @@ std::size_t ShapeShapeCollide(const CollisionGeometry* o1,
     return result.min_distance;                                                \
   }
 
+SHAPE_SELF_DISTANCE_SPECIALIZATION(Box)
 SHAPE_SHAPE_DISTANCE_SPECIALIZATION(Box, Halfspace)
 SHAPE_SHAPE_DISTANCE_SPECIALIZATION(Box, Plane)
 SHAPE_SHAPE_DISTANCE_SPECIALIZATION(Box, Sphere)
@@ -84,6 +84,11 @@ class TraversalNodeBase {
   /// @brief Whether store some statistics information during traversal
   void enableStatistics(bool enable) { enable_statistics = enable; }
 
+  /// @brief Whether the leaf tests are tests between primitives.
+  /// This is not the case of the octree nodes, whose single leaf test
+  /// traverses the octree.
+  virtual bool leafTestsArePrimitiveTests() const { return true; }
+
   /// @brief configuation of first object
   Transform3s tf1;
 
@@ -121,6 +126,11 @@ class CollisionTraversalNodeBase : public TraversalNodeBase {
   /// @brief Check whether the traversal can stop
   bool canStop() const { return this->request.isSatisfied(*(this->result)); }
 
+  /// @brief Statistics of the query, NULL if they are disabled.
+  QueryStatistics* queryStatistics() const {
+    return (request.enable_statistics && result) ? &result->statistics : NULL;
+  }
+
   /// @brief request setting for collision
   const CollisionRequest& request;
 
@@ -156,6 +166,11 @@ class DistanceTraversalNodeBase : public TraversalNodeBase {
   /// @brief Check whether the traversal can stop
   virtual bool canStop(Scalar /*c*/) const { return false; }
 
+  /// @brief Statistics of the query, NULL if they are disabled.
+  QueryStatistics* queryStatistics() const {
+    return (request.enable_statistics && result) ? &result->statistics : NULL;
+  }
+
   /// @brief request setting for distance
   DistanceRequest request;
 
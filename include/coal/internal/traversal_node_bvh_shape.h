@@ -92,6 +92,25 @@ class BVHShapeCollisionTraversalNode : public CollisionTraversalNodeBase {
   mutable Scalar query_time_seconds;
 };
 
+namespace details {
+/// @brief Whether the BV of the shape is computed in the frame of the mesh
+/// when their frames differ, instead of transforming the BVs of the mesh in
+/// each test. It is the case of the BVs aligned with the axes of their frame,
+/// for which a transform can only be bounded.
+template <typename BV>
+struct ShapeBVInMeshFrame {
+  enum { value = false };
+};
+template <>
+struct ShapeBVInMeshFrame<AABB> {
+  enum { value = true };
+};
+template <short N>
+struct ShapeBVInMeshFrame<KDOP<N> > {
+  enum { value = true };
+};
+}  // namespace details
+
 /// @brief Traversal node for collision between mesh and shape
 template <typename BV, typename S,
           int _Options = RelativeTransformationIsIdentity>
@@ -120,7 +139,7 @@ class MeshShapeCollisionTraversalNode
                    Scalar& sqrDistLowerBound) const {
     if (this->enable_statistics) this->num_bv_tests++;
     bool disjoint;
-    if (RTIsIdentity)
+    if (RTIsIdentity || details::ShapeBVInMeshFrame<BV>::value)
       disjoint = !this->model1->getBV(b1).bv.overlap(
           this->model2_bv, this->request, sqrDistLowerBound);
     else
@@ -142,6 +142,7 @@ class MeshCollisionTraversalNode : public BVHCollisionTraversalNode<BV> {
     vertices2 = NULL;
     tri_indices1 = NULL;
     tri_indices2 = NULL;
+    nsolver = NULL;
   }
 
   /// BV test between b1 and b2
@@ -180,6 +181,12 @@ class MeshCollisionTraversalNode : public BVHCollisionTraversalNode<BV> {
   /// @note If the distance between objects is less than the security margin,
   ///       and the object are not colliding, the penetration depth is
   ///       negative.
+  ///
+  /// @note When neither the contact information nor a security margin are
+  ///       requested, GJK is replaced by the exact overlap test
+  ///       Intersect::intersectTriangles. The distance between the triangles
+  ///       is then only computed when the lower bound given by this test
+  ///       does not suffice to update the CollisionResult.
   void leafCollides(unsigned int b1, unsigned int b2,
                     Scalar& sqrDistLowerBound) const {
     if (this->enable_statistics) this->num_leaf_tests++;
@@ -200,19 +207,55 @@ class MeshCollisionTraversalNode : public BVHCollisionTraversalNode<BV> {
     const Vec3s& Q2 = vertices2[tri_id2[1]];
     const Vec3s& Q3 = vertices2[tri_id2[2]];
 
-    TriangleP tri1(P1, P2, P3);
-    TriangleP tri2(Q1, Q2, Q3);
-
-    // TODO(louis): MeshCollisionTraversalNode should have its own GJKSolver.
-    GJKSolver solver(this->request);
-
-    const bool compute_penetration =
-        this->request.enable_contact || (this->request.security_margin < 0);
     Vec3s p1, p2, normal;
-    DistanceResult distanceResult;
-    Scalar distance = internal::ShapeShapeDistance<TriangleP, TriangleP>(
-        &tri1, this->tf1, &tri2, this->tf2, &solver, compute_penetration, p1,
-        p2, normal);
+    Scalar distance;
+    if (!this->request.enable_contact && this->request.security_margin == 0) {
+      const Vec3s T1[3] = {this->tf1.transform(P1), this->tf1.transform(P2),
+                           this->tf1.transform(P3)};
+      const Vec3s T2[3] = {this->tf2.transform(Q1), this->tf2.transform(Q2),
+                           this->tf2.transform(Q3)};
+      if (Intersect::intersectTriangles(T1[0], T1[1], T1[2], T2[0], T2[1],
+                                        T2[2], distance)) {
+        // Same output as GJK when the penetration is not computed.
+        distance = 0;
+        p1 = p2 = normal =
+            Vec3s::Constant(std::numeric_limits<Scalar>::quiet_NaN());
+      } else if (distance >= this->result->distance_lower_bound &&
+                 (distance > this->request.collision_distance_threshold ||
+                  (distance == 0 && this->result->distance_lower_bound == 0))) {
+        // The lower bound can neither change the result nor the collision
+        // status. Once the objects are in collision, the triangles separated
+        // on the intersection line of their planes are not tested against
+        // the collision distance threshold.
+        sqrDistLowerBound = distance * distance;
+        return;
+      } else {
+        distance =
+            std::sqrt(TriangleDistance::sqrTriDistance(T1, T2, p1, p2));
+        if (distance > 0)
+          normal = (p2 - p1) / distance;
+        else
+          normal = Vec3s::Constant(std::numeric_limits<Scalar>::quiet_NaN());
+      }
+    } else {
+      TriangleP tri1(P1, P2, P3);
+      TriangleP tri2(Q1, Q2, Q3);
+
+      const bool compute_penetration =
+          this->request.enable_contact || (this->request.security_margin < 0);
+      if (nsolver != NULL) {
+        // The solver of the query is shared by all the pairs of triangles, so
+        // that its EPA storage is allocated once.
+        distance = internal::ShapeShapeDistance<TriangleP, TriangleP>(
+            &tri1, this->tf1, &tri2, this->tf2, nsolver, compute_penetration,
+            p1, p2, normal);
+      } else {
+        GJKSolver solver(this->request);
+        distance = internal::ShapeShapeDistance<TriangleP, TriangleP>(
+            &tri1, this->tf1, &tri2, this->tf2, &solver, compute_penetration,
+            p1, p2, normal);
+      }
+    }
 
     const Scalar distToCollision = distance - this->request.security_margin;
 
@@ -237,6 +280,11 @@ class MeshCollisionTraversalNode : public BVHCollisionTraversalNode<BV> {
   Triangle32* tri_indices1;
   Triangle32* tri_indices2;
 
+  /// @brief Solver of the query, used for the pairs of triangles which are
+  /// not handled by the triangle tests. It may be null, in which case a solver
+  /// is constructed for each pair.
+  const GJKSolver* nsolver;
+
   details::RelativeTransformation<!bool(RTIsIdentity)> RT;
 };
 
@@ -0,0 +1,944 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of INRIA nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COAL_TRAVERSAL_NODE_HFIELDS_H
+#define COAL_TRAVERSAL_NODE_HFIELDS_H
+
+/// @cond INTERNAL
+
+#include "coal/collision_data.h"
+#include "coal/BV/BV.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/hfield.h"
+#include "coal/shape/geometric_shapes.h"
+#include "coal/narrowphase/narrowphase.h"
+#include "coal/internal/shape_shape_func.h"
+#include "coal/internal/intersect.h"
+#include "coal/internal/traversal_node_base.h"
+#include "coal/internal/traversal_node_hfield_shape.h"
+
+namespace coal {
+
+namespace details {
+
+/// @brief Overlap test between the bounding volume bv1 of a height field node
+/// and a bounding volume bv2 placed at tf in the frame of the height field.
+/// Both are converted to OBB.
+template <typename BV1, typename BV2>
+inline bool hfieldBVOverlap(const BV1& bv1, const Transform3s& tf,
+                            const BV2& bv2, const CollisionRequest& request,
+                            Scalar& sqrDistLowerBound) {
+  OBB obb1, obb2;
+  convertBV(bv1, obb1);
+  convertBV(bv2, tf, obb2);
+  return obb1.overlap(obb2, request, sqrDistLowerBound);
+}
+
+inline bool hfieldBVOverlap(const OBBRSS& bv1, const Transform3s& tf,
+                            const OBBRSS& bv2, const CollisionRequest& request,
+                            Scalar& sqrDistLowerBound) {
+  return overlap(tf.getRotation(), tf.getTranslation(), bv2, bv1, request,
+                 sqrDistLowerBound);
+}
+
+/// @brief Swept sphere rectangle containing the box obb of a height field
+/// node. The RSS of the nodes, converted from their AABB, does not contain
+/// the box: the largest face of the box is swept instead. The rectangle of a
+/// RSS starts at its origin Tr.
+inline RSS hfieldNodeRSS(const OBB& obb) {
+  Eigen::DenseIndex k;
+  obb.extent.minCoeff(&k);
+  const Eigen::DenseIndex i = (k + 1) % 3, j = (k + 2) % 3;
+  RSS rss;
+  rss.Tr = obb.To - obb.extent[i] * obb.axes.col(i) -
+           obb.extent[j] * obb.axes.col(j);
+  rss.axes.col(0) = obb.axes.col(i);
+  rss.axes.col(1) = obb.axes.col(j);
+  rss.axes.col(2) = obb.axes.col(k);
+  rss.length[0] = 2 * obb.extent[i];
+  rss.length[1] = 2 * obb.extent[j];
+  rss.radius = obb.extent[k];
+  return rss;
+}
+
+/// @brief Lower bound of the distance between the bounding volume bv1 of a
+/// height field node and a bounding volume bv2 placed at tf in the frame of
+/// the height field. Returns -1 if they overlap. OBBRSS pairs use the
+/// distance between swept sphere rectangles, which is much tighter
+/// (see hfieldNodeRSS).
+template <typename BV1, typename BV2>
+inline Scalar hfieldBVDistanceLowerBound(const BV1& bv1, const Transform3s& tf,
+                                         const BV2& bv2) {
+  Scalar sqrDistLowerBound;
+  CollisionRequest request(DISTANCE_LOWER_BOUND, 0);
+  if (hfieldBVOverlap(bv1, tf, bv2, request, sqrDistLowerBound)) return -1;
+  return std::sqrt(sqrDistLowerBound);
+}
+
+inline Scalar hfieldBVDistanceLowerBound(const OBBRSS& bv1,
+                                         const Transform3s& tf,
+                                         const OBBRSS& bv2) {
+  return distance(tf.getRotation(), tf.getTranslation(),
+                  hfieldNodeRSS(bv1.obb), bv2.rss);
+}
+
+/// @brief Lower bound of the distance between the bounding volumes of two
+/// height field nodes, bv2 being placed at tf in the frame of bv1.
+/// Returns -1 if they overlap.
+template <typename BV1, typename BV2>
+inline Scalar hfieldsBVDistanceLowerBound(const BV1& bv1,
+                                          const Transform3s& tf,
+                                          const BV2& bv2) {
+  return hfieldBVDistanceLowerBound(bv1, tf, bv2);
+}
+
+inline Scalar hfieldsBVDistanceLowerBound(const OBBRSS& bv1,
+                                          const Transform3s& tf,
+                                          const OBBRSS& bv2) {
+  return distance(tf.getRotation(), tf.getTranslation(),
+                  hfieldNodeRSS(bv1.obb), hfieldNodeRSS(bv2.obb));
+}
+
+/// @brief Corners of the top of the bin of a height field leaf, in the frame
+/// of the height field: the top is made of the triangles (top[0], top[1],
+/// top[2]) and (top[1], top[3], top[2]), as in buildConvexTriangles.
+template <typename BV>
+void hfieldBinTop(const HFNode<BV>& node, const HeightField<BV>& model,
+                  Vec3s top[4]) {
+  const MatrixXs& heights = model.getHeights();
+  const VecXs& x_grid = model.getXGrid();
+  const VecXs& y_grid = model.getYGrid();
+  const Scalar x0 = x_grid[node.x_id], x1 = x_grid[node.x_id + 1],
+               y0 = y_grid[node.y_id], y1 = y_grid[node.y_id + 1];
+  top[0] = Vec3s(x0, y0, heights(node.y_id, node.x_id));
+  top[1] = Vec3s(x0, y1, heights(node.y_id + 1, node.x_id));
+  top[2] = Vec3s(x1, y0, heights(node.y_id, node.x_id + 1));
+  top[3] = Vec3s(x1, y1, heights(node.y_id + 1, node.x_id + 1));
+}
+
+/// @brief Whether the points all lie strictly above the given height.
+inline bool hfieldPointsAbove(const Vec3s* points, const int num_points,
+                              const Scalar height) {
+  for (int i = 0; i < num_points; ++i)
+    if (points[i][2] <= height) return false;
+  return true;
+}
+
+/// @brief Whether the triangle tri, in the frame of the height field, lies
+/// above the bin of a leaf whose top is given by hfieldBinTop: strictly above
+/// the planes of the two triangles of the top and above the bottom of the
+/// height field, the bin having no side face on the border of the height
+/// field.
+/// The triangle is then disjoint from the bin. If the point of the height
+/// field closest to the triangle lies in this bin, it lies on its top: the
+/// traversals, which keep the smallest distance over the bins, can use the
+/// distance to the top (see hfieldBinTopDistance) instead of building the two
+/// prisms of the bin.
+template <typename BV>
+bool hfieldTriangleAboveBin(const HFNode<BV>& node,
+                            const HeightField<BV>& model, const Vec3s top[4],
+                            const Vec3s tri[3]) {
+  typedef HFNodeBase::FaceOrientation FaceOrientation;
+  if (node.contact_active_faces &
+      ~(int(FaceOrientation::TOP) | int(FaceOrientation::BOTTOM)))
+    return false;
+  if (!hfieldPointsAbove(tri, 3, model.getMinHeight())) return false;
+  // Upward normals of the two triangles of the top. The y grid of the height
+  // fields is decreasing, which flips both cross products.
+  Vec3s n1 = (top[2] - top[0]).cross(top[1] - top[0]),
+        n2 = (top[2] - top[1]).cross(top[3] - top[1]);
+  if (n1[2] < 0) {
+    n1 = -n1;
+    n2 = -n2;
+  }
+  for (int i = 0; i < 3; ++i) {
+    if (n1.dot(tri[i] - top[0]) <= 0 || n2.dot(tri[i] - top[3]) <= 0)
+      return false;
+  }
+  return true;
+}
+
+/// @brief Distance between the top of a bin (see hfieldBinTop) and the
+/// triangle tri, both in the frame of the height field, with the witness
+/// points and the normal. The triangle must not touch the top, see
+/// hfieldTriangleAboveBin.
+inline Scalar hfieldBinTopDistance(const Vec3s top[4], const Vec3s tri[3],
+                                   Vec3s& p1, Vec3s& p2, Vec3s& normal) {
+  Vec3s q1, q2;
+  Scalar sqr_distance = TriangleDistance::sqrTriDistance(
+      top[0], top[1], top[2], tri[0], tri[1], tri[2], p1, p2);
+  const Scalar sqr_distance2 = TriangleDistance::sqrTriDistance(
+      top[1], top[3], top[2], tri[0], tri[1], tri[2], q1, q2);
+  if (sqr_distance2 < sqr_distance) {
+    sqr_distance = sqr_distance2;
+    p1 = q1;
+    p2 = q2;
+  }
+  const Scalar distance = std::sqrt(sqr_distance);
+  // The distance only vanishes through rounding errors, the triangle lying
+  // above the top.
+  if (distance > 0)
+    normal = (p2 - p1) / distance;
+  else
+    normal = Vec3s::UnitZ();
+  return distance;
+}
+
+/// @brief Distance between the bins of two height field leaves, the second
+/// one being placed at tf in the frame of the first one, computed from their
+/// tops only (see hfieldBinTopDistance).
+/// This holds when each bin lies above the highest corner of the other one,
+/// e.g. for a height field facing another one upside down.
+/// @return false if the bins do not lie above each other, in which case they
+/// must be built as prisms.
+template <typename BV1, typename BV2>
+bool hfieldsBinTopsDistance(const HFNode<BV1>& node1,
+                            const HeightField<BV1>& model1,
+                            const HFNode<BV2>& node2,
+                            const HeightField<BV2>& model2,
+                            const Transform3s& tf, Scalar& distance,
+                            Vec3s& p1, Vec3s& p2, Vec3s& normal) {
+  Vec3s top1[4], top2[4], corners2[8];
+  hfieldBinTop(node1, model1, top1);
+  hfieldBinTop(node2, model2, top2);
+  for (int i = 0; i < 4; ++i) {
+    corners2[i] = tf.transform(top2[i]);
+    corners2[4 + i] = tf.transform(
+        Vec3s(top2[i][0], top2[i][1], model2.getMinHeight()));
+  }
+  if (!hfieldPointsAbove(corners2, 8, node1.max_height)) return false;
+  Vec3s top1_in_2[4];
+  for (int i = 0; i < 4; ++i) top1_in_2[i] = tf.inverseTransform(top1[i]);
+  if (!hfieldPointsAbove(top1_in_2, 4, node2.max_height)) return false;
+
+  const Vec3s tri2[2][3] = {{corners2[0], corners2[1], corners2[2]},
+                            {corners2[1], corners2[3], corners2[2]}};
+  Vec3s q1, q2, n;
+  distance = hfieldBinTopDistance(top1, tri2[0], p1, p2, normal);
+  const Scalar distance2 = hfieldBinTopDistance(top1, tri2[1], q1, q2, n);
+  if (distance2 < distance) {
+    distance = distance2;
+    p1 = q1;
+    p2 = q2;
+    normal = n;
+  }
+  return true;
+}
+
+/// @brief Collision between a bin of a height field, split into the two
+/// prisms convex1 and convex2, and a shape placed at tf in the frame of the
+/// height field. The bin correction is applied to the faces of the bin.
+/// The witness points and the normal are expressed in the frame of the height
+/// field.
+/// @return whether the normal can be used to report a contact.
+template <typename Shape>
+bool hfieldBinCollides(const GJKSolver* nsolver,
+                       const CollisionRequest& request,
+                       const ConvexTpl<Triangle32>& convex1,
+                       const int convex1_active_faces,
+                       const ConvexTpl<Triangle32>& convex2,
+                       const int convex2_active_faces, const Shape& shape,
+                       const Transform3s& tf, Scalar& distance, Vec3s& c1,
+                       Vec3s& c2, Vec3s& normal, bool& collision) {
+  Vec3s normal_face;
+  bool hfield_witness_is_on_bin_side;
+  collision =
+      shapeDistance<Triangle32, Shape, RelativeTransformationIsIdentity>(
+          nsolver, request, convex1, convex1_active_faces, convex2,
+          convex2_active_faces, tf, shape, tf, distance, c1, c2, normal,
+          normal_face, hfield_witness_is_on_bin_side);
+  return normal_face.isApprox(normal) &&
+         (collision || !hfield_witness_is_on_bin_side);
+}
+
+/// @brief Reports the result of a leaf test between a bin of a height field
+/// and a primitive, whose witness points and normal are expressed in the frame
+/// tf1 of the height field.
+template <typename Model1, typename Model2>
+void hfieldReportLeafCollision(const CollisionRequest& request,
+                               CollisionResult& result, const Model1* model1,
+                               const Model2* model2, const Transform3s& tf1,
+                               int b1, int b2, const Scalar distance,
+                               const Vec3s& c1, const Vec3s& c2,
+                               const Vec3s& normal, const bool valid_normal,
+                               Scalar& sqrDistLowerBound) {
+  const Vec3s p1(tf1.transform(c1)), p2(tf1.transform(c2));
+  const Vec3s n(tf1.getRotation() * normal);
+
+  const Scalar distToCollision = distance - request.security_margin;
+  if (distToCollision <= request.collision_distance_threshold) {
+    sqrDistLowerBound = 0;
+    if (result.numContacts() < request.num_max_contacts && valid_normal)
+      result.addContact(Contact(model1, model2, b1, b2, p1, p2, n, distance));
+  } else
+    sqrDistLowerBound = distToCollision * distToCollision;
+
+  internal::updateDistanceLowerBoundFromLeaf(request, result, distToCollision,
+                                             p1, p2, n);
+}
+
+/// @brief Distance between the bin convex1, convex2 of a height field and a
+/// shape placed at tf in the frame of the height field.
+/// The witness points and the normal are expressed in the frame of the height
+/// field.
+template <typename Shape>
+Scalar hfieldBinDistance(const GJKSolver* nsolver, const bool signed_distance,
+                         const ConvexTpl<Triangle32>& convex1,
+                         const ConvexTpl<Triangle32>& convex2,
+                         const Shape& shape, const Transform3s& tf, Vec3s& p1,
+                         Vec3s& p2, Vec3s& normal) {
+  const Transform3s Id;
+  Vec3s q1, q2, n;
+  const Scalar d1 = internal::ShapeShapeDistance<ConvexTpl<Triangle32>, Shape>(
+      &convex1, Id, &shape, tf, nsolver, signed_distance, p1, p2, normal);
+  const Scalar d2 = internal::ShapeShapeDistance<ConvexTpl<Triangle32>, Shape>(
+      &convex2, Id, &shape, tf, nsolver, signed_distance, q1, q2, n);
+  if (d2 < d1) {
+    p1 = q1;
+    p2 = q2;
+    normal = n;
+    return d2;
+  }
+  return d1;
+}
+
+}  // namespace details
+
+/// @addtogroup Traversal_For_Collision
+/// @{
+
+/// @brief Traversal node for collision between a height field and a mesh.
+/// A triangle above a bin is tested against the two triangles of its top
+/// (see details::hfieldBinTopDistance). Otherwise, the bin is split into two
+/// prisms, as for the collision with a shape.
+/// The bounding volumes and the leaf tests are computed in the frame of the
+/// height field.
+template <typename BV1, typename BV2>
+class HeightFieldMeshCollisionTraversalNode
+    : public CollisionTraversalNodeBase {
+ public:
+  HeightFieldMeshCollisionTraversalNode(const CollisionRequest& request)
+      : CollisionTraversalNodeBase(request) {
+    model1 = NULL;
+    model2 = NULL;
+    vertices2 = NULL;
+    tri_indices2 = NULL;
+    nsolver = NULL;
+
+    num_bv_tests = 0;
+    num_leaf_tests = 0;
+    query_time_seconds = 0.0;
+  }
+
+  /// @brief Whether the BV node in the height field is leaf
+  bool isFirstNodeLeaf(unsigned int b) const {
+    return model1->getBV(b).isLeaf();
+  }
+
+  /// @brief Whether the BV node in the mesh is leaf
+  bool isSecondNodeLeaf(unsigned int b) const {
+    return model2->getBV(b).isLeaf();
+  }
+
+  /// @brief Determine the traversal order, is the first BVTT subtree better
+  bool firstOverSecond(unsigned int b1, unsigned int b2) const {
+    Scalar sz1 = model1->getBV(b1).bv.size();
+    Scalar sz2 = model2->getBV(b2).bv.size();
+
+    bool l1 = model1->getBV(b1).isLeaf();
+    bool l2 = model2->getBV(b2).isLeaf();
+
+    if (l2 || (!l1 && (sz1 > sz2))) return true;
+    return false;
+  }
+
+  /// @brief Obtain the left child of BV node in the height field
+  int getFirstLeftChild(unsigned int b) const {
+    return static_cast<int>(model1->getBV(b).leftChild());
+  }
+
+  /// @brief Obtain the right child of BV node in the height field
+  int getFirstRightChild(unsigned int b) const {
+    return static_cast<int>(model1->getBV(b).rightChild());
+  }
+
+  /// @brief Obtain the left child of BV node in the mesh
+  int getSecondLeftChild(unsigned int b) const {
+    return model2->getBV(b).leftChild();
+  }
+
+  /// @brief Obtain the right child of BV node in the mesh
+  int getSecondRightChild(unsigned int b) const {
+    return model2->getBV(b).rightChild();
+  }
+
+  /// @brief BV culling test in one BVTT node
+  bool BVDisjoints(unsigned int b1, unsigned int b2,
+                   Scalar& sqrDistLowerBound) const {
+    if (this->enable_statistics) this->num_bv_tests++;
+    const bool disjoint = !details::hfieldBVOverlap(
+        model1->getBV(b1).bv, tf, model2->getBV(b2).bv, this->request,
+        sqrDistLowerBound);
+    if (disjoint)
+      internal::updateDistanceLowerBoundFromBV(this->request, *this->result,
+                                               sqrDistLowerBound);
+    return disjoint;
+  }
+
+  /// @brief Intersection testing between leaves (one bin of the height field
+  /// and one triangle)
+  void leafCollides(unsigned int b1, unsigned int b2,
+                    Scalar& sqrDistLowerBound) const {
+    if (this->enable_statistics) this->num_leaf_tests++;
+
+    const HFNode<BV1>& node1 = model1->getBV(b1);
+    const int primitive_id2 = model2->getBV(b2).primitiveId();
+    const Triangle32& tri_id2 = tri_indices2[primitive_id2];
+
+    // A triangle above the bin is tested against its top only. Without
+    // contact information nor security margin, as for the meshes, a triangle
+    // crossing the top is in collision. The prisms are only needed in the
+    // other cases.
+    {
+      Vec3s top[4];
+      details::hfieldBinTop(node1, *model1, top);
+      const Vec3s tri[3] = {tf.transform(vertices2[tri_id2[0]]),
+                            tf.transform(vertices2[tri_id2[1]]),
+                            tf.transform(vertices2[tri_id2[2]])};
+      if (details::hfieldTriangleAboveBin(node1, *model1, top, tri)) {
+        Vec3s c1, c2, normal;
+        const Scalar distance =
+            details::hfieldBinTopDistance(top, tri, c1, c2, normal);
+        if (distance - this->request.security_margin >
+            this->request.collision_distance_threshold) {
+          details::hfieldReportLeafCollision(
+              this->request, *this->result, model1, model2, this->tf1,
+              (int)b1, primitive_id2, distance, c1, c2, normal, true,
+              sqrDistLowerBound);
+          return;
+        }
+      } else if (!this->request.enable_contact &&
+                 this->request.security_margin == 0) {
+        Scalar distance;
+        if (Intersect::intersectTriangles(top[0], top[1], top[2], tri[0],
+                                          tri[1], tri[2], distance) ||
+            Intersect::intersectTriangles(top[1], top[3], top[2], tri[0],
+                                          tri[1], tri[2], distance)) {
+          // Same output as GJK when the penetration is not computed.
+          const Vec3s nan(
+              Vec3s::Constant(std::numeric_limits<Scalar>::quiet_NaN()));
+          details::hfieldReportLeafCollision(
+              this->request, *this->result, model1, model2, this->tf1,
+              (int)b1, primitive_id2, 0, nan, nan, nan, true,
+              sqrDistLowerBound);
+          return;
+        }
+      }
+    }
+
+    TriangleP triangle(vertices2[tri_id2[0]], vertices2[tri_id2[1]],
+                       vertices2[tri_id2[2]]);
+    typedef ConvexTpl<Triangle32> ConvexTriangle32;
+    ConvexTriangle32 convex1, convex2;
+    int convex1_active_faces, convex2_active_faces;
+    details::buildConvexTriangles(node1, *model1, convex1,
+                                  convex1_active_faces, convex2,
+                                  convex2_active_faces);
+    if (nsolver->gjk_initial_guess == GJKInitialGuess::BoundingVolumeGuess) {
+      convex1.computeLocalAABB();
+      convex2.computeLocalAABB();
+      triangle.computeLocalAABB();
+    }
+
+    Scalar distance;
+    Vec3s c1, c2, normal;
+    bool collision;
+    const bool valid_normal = details::hfieldBinCollides(
+        nsolver, this->request, convex1, convex1_active_faces, convex2,
+        convex2_active_faces, triangle, tf, distance, c1, c2, normal,
+        collision);
+    details::hfieldReportLeafCollision(
+        this->request, *this->result, model1, model2, this->tf1, (int)b1,
+        primitive_id2, distance, c1, c2, normal, valid_normal,
+        sqrDistLowerBound);
+  }
+
+  const HeightField<BV1>* model1;
+  const BVHModel<BV2>* model2;
+
+  Vec3s* vertices2;
+  Triangle32* tri_indices2;
+
+  const GJKSolver* nsolver;
+
+  /// @brief Pose of the mesh in the frame of the height field
+  Transform3s tf;
+
+  mutable int num_bv_tests;
+  mutable int num_leaf_tests;
+  mutable Scalar query_time_seconds;
+};
+
+/// @brief Traversal node for collision between two height fields.
+/// The bins of the first height field are corrected as for the collision with
+/// a shape, while the two prisms of the bins of the second height field are
+/// handled as convex shapes. Bins lying above each other are tested from
+/// their tops only (see details::hfieldsBinTopsDistance).
+template <typename BV1, typename BV2>
+class HeightFieldCollisionTraversalNode : public CollisionTraversalNodeBase {
+ public:
+  HeightFieldCollisionTraversalNode(const CollisionRequest& request)
+      : CollisionTraversalNodeBase(request) {
+    model1 = NULL;
+    model2 = NULL;
+    nsolver = NULL;
+
+    num_bv_tests = 0;
+    num_leaf_tests = 0;
+    query_time_seconds = 0.0;
+  }
+
+  /// @brief Whether the BV node in the first height field is leaf
+  bool isFirstNodeLeaf(unsigned int b) const {
+    return model1->getBV(b).isLeaf();
+  }
+
+  /// @brief Whether the BV node in the second height field is leaf
+  bool isSecondNodeLeaf(unsigned int b) const {
+    return model2->getBV(b).isLeaf();
+  }
+
+  /// @brief Determine the traversal order, is the first BVTT subtree better
+  bool firstOverSecond(unsigned int b1, unsigned int b2) const {
+    Scalar sz1 = model1->getBV(b1).bv.size();
+    Scalar sz2 = model2->getBV(b2).bv.size();
+
+    bool l1 = model1->getBV(b1).isLeaf();
+    bool l2 = model2->getBV(b2).isLeaf();
+
+    if (l2 || (!l1 && (sz1 > sz2))) return true;
+    return false;
+  }
+
+  /// @brief Obtain the left child of BV node in the first height field
+  int getFirstLeftChild(unsigned int b) const {
+    return static_cast<int>(model1->getBV(b).leftChild());
+  }
+
+  /// @brief Obtain the right child of BV node in the first height field
+  int getFirstRightChild(unsigned int b) const {
+    return static_cast<int>(model1->getBV(b).rightChild());
+  }
+
+  /// @brief Obtain the left child of BV node in the second height field
+  int getSecondLeftChild(unsigned int b) const {
+    return static_cast<int>(model2->getBV(b).leftChild());
+  }
+
+  /// @brief Obtain the right child of BV node in the second height field
+  int getSecondRightChild(unsigned int b) const {
+    return static_cast<int>(model2->getBV(b).rightChild());
+  }
+
+  /// @brief BV culling test in one BVTT node
+  bool BVDisjoints(unsigned int b1, unsigned int b2,
+                   Scalar& sqrDistLowerBound) const {
+    if (this->enable_statistics) this->num_bv_tests++;
+    const bool disjoint = !details::hfieldBVOverlap(
+        model1->getBV(b1).bv, tf, model2->getBV(b2).bv, this->request,
+        sqrDistLowerBound);
+    if (disjoint)
+      internal::updateDistanceLowerBoundFromBV(this->request, *this->result,
+                                               sqrDistLowerBound);
+    return disjoint;
+  }
+
+  /// @brief Intersection testing between leaves (two bins)
+  void leafCollides(unsigned int b1, unsigned int b2,
+                    Scalar& sqrDistLowerBound) const {
+    if (this->enable_statistics) this->num_leaf_tests++;
+
+    {
+      Scalar distance;
+      Vec3s c1, c2, normal;
+      if (details::hfieldsBinTopsDistance(model1->getBV(b1), *model1,
+                                          model2->getBV(b2), *model2, tf,
+                                          distance, c1, c2, normal) &&
+          distance - this->request.security_margin >
+              this->request.collision_distance_threshold) {
+        details::hfieldReportLeafCollision(
+            this->request, *this->result, model1, model2, this->tf1, (int)b1,
+            (int)b2, distance, c1, c2, normal, true, sqrDistLowerBound);
+        return;
+      }
+    }
+
+    typedef ConvexTpl<Triangle32> ConvexTriangle32;
+    ConvexTriangle32 convex1, convex2, convex3, convex4;
+    int convex1_active_faces, convex2_active_faces, convex3_active_faces,
+        convex4_active_faces;
+    details::buildConvexTriangles(model1->getBV(b1), *model1, convex1,
+                                  convex1_active_faces, convex2,
+                                  convex2_active_faces);
+    details::buildConvexTriangles(model2->getBV(b2), *model2, convex3,
+                                  convex3_active_faces, convex4,
+                                  convex4_active_faces);
+    if (nsolver->gjk_initial_guess == GJKInitialGuess::BoundingVolumeGuess) {
+      convex1.computeLocalAABB();
+      convex2.computeLocalAABB();
+      convex3.computeLocalAABB();
+      convex4.computeLocalAABB();
+    }
+
+    Scalar distance, distance4;
+    Vec3s c1, c2, normal, c1_4, c2_4, normal4;
+    bool collision, collision4;
+    bool valid_normal = details::hfieldBinCollides(
+        nsolver, this->request, convex1, convex1_active_faces, convex2,
+        convex2_active_faces, convex3, tf, distance, c1, c2, normal,
+        collision);
+    const bool valid_normal4 = details::hfieldBinCollides(
+        nsolver, this->request, convex1, convex1_active_faces, convex2,
+        convex2_active_faces, convex4, tf, distance4, c1_4, c2_4, normal4,
+        collision4);
+    // Keep the deepest collision, or the closest prism if none collides.
+    if ((collision4 && (!collision || distance4 < distance)) ||
+        (!collision && !collision4 && distance4 < distance)) {
+      distance = distance4;
+      c1 = c1_4;
+      c2 = c2_4;
+      normal = normal4;
+      valid_normal = valid_normal4;
+      collision = collision4;
+    }
+    details::hfieldReportLeafCollision(
+        this->request, *this->result, model1, model2, this->tf1, (int)b1,
+        (int)b2, distance, c1, c2, normal, valid_normal,
+        sqrDistLowerBound);
+  }
+
+  const HeightField<BV1>* model1;
+  const HeightField<BV2>* model2;
+
+  const GJKSolver* nsolver;
+
+  /// @brief Pose of the second height field in the frame of the first one
+  Transform3s tf;
+
+  mutable int num_bv_tests;
+  mutable int num_leaf_tests;
+  mutable Scalar query_time_seconds;
+};
+
+/// @}
+
+/// @addtogroup Traversal_For_Distance
+/// @{
+
+/// @brief Traversal node for distance between a height field and a mesh.
+/// The distance to a bin is the distance to the closest of its two prisms,
+/// or to its top for the triangles above it.
+template <typename BV1, typename BV2>
+class HeightFieldMeshDistanceTraversalNode : public DistanceTraversalNodeBase {
+ public:
+  HeightFieldMeshDistanceTraversalNode() : DistanceTraversalNodeBase() {
+    model1 = NULL;
+    model2 = NULL;
+    vertices2 = NULL;
+    tri_indices2 = NULL;
+    nsolver = NULL;
+
+    rel_err = 0;
+    abs_err = 0;
+
+    num_bv_tests = 0;
+    num_leaf_tests = 0;
+    query_time_seconds = 0.0;
+  }
+
+  /// @brief Whether the BV node in the height field is leaf
+  bool isFirstNodeLeaf(unsigned int b) const {
+    return model1->getBV(b).isLeaf();
+  }
+
+  /// @brief Whether the BV node in the mesh is leaf
+  bool isSecondNodeLeaf(unsigned int b) const {
+    return model2->getBV(b).isLeaf();
+  }
+
+  /// @brief Determine the traversal order, is the first BVTT subtree better
+  bool firstOverSecond(unsigned int b1, unsigned int b2) const {
+    Scalar sz1 = model1->getBV(b1).bv.size();
+    Scalar sz2 = model2->getBV(b2).bv.size();
+
+    bool l1 = model1->getBV(b1).isLeaf();
+    bool l2 = model2->getBV(b2).isLeaf();
+
+    if (l2 || (!l1 && (sz1 > sz2))) return true;
+    return false;
+  }
+
+  /// @brief Obtain the left child of BV node in the height field
+  int getFirstLeftChild(unsigned int b) const {
+    return static_cast<int>(model1->getBV(b).leftChild());
+  }
+
+  /// @brief Obtain the right child of BV node in the height field
+  int getFirstRightChild(unsigned int b) const {
+    return static_cast<int>(model1->getBV(b).rightChild());
+  }
+
+  /// @brief Obtain the left child of BV node in the mesh
+  int getSecondLeftChild(unsigned int b) const {
+    return model2->getBV(b).leftChild();
+  }
+
+  /// @brief Obtain the right child of BV node in the mesh
+  int getSecondRightChild(unsigned int b) const {
+    return model2->getBV(b).rightChild();
+  }
+
+  /// @brief BV culling test in one BVTT node
+  Scalar BVDistanceLowerBound(unsigned int b1, unsigned int b2) const {
+    if (this->enable_statistics) this->num_bv_tests++;
+    return details::hfieldBVDistanceLowerBound(model1->getBV(b1).bv, tf,
+                                               model2->getBV(b2).bv);
+  }
+
+  /// @brief Distance testing between leaves (one bin of the height field and
+  /// one triangle)
+  void leafComputeDistance(unsigned int b1, unsigned int b2) const {
+    if (this->enable_statistics) this->num_leaf_tests++;
+
+    const HFNode<BV1>& node1 = model1->getBV(b1);
+    const int primitive_id2 = model2->getBV(b2).primitiveId();
+    const Triangle32& tri_id2 = tri_indices2[primitive_id2];
+
+    Vec3s p1, p2, normal;
+    Scalar distance;
+    const Vec3s tri[3] = {tf.transform(vertices2[tri_id2[0]]),
+                          tf.transform(vertices2[tri_id2[1]]),
+                          tf.transform(vertices2[tri_id2[2]])};
+    Vec3s top[4];
+    details::hfieldBinTop(node1, *model1, top);
+    if (details::hfieldTriangleAboveBin(node1, *model1, top, tri)) {
+      distance = details::hfieldBinTopDistance(top, tri, p1, p2, normal);
+    } else {
+      const TriangleP triangle(vertices2[tri_id2[0]], vertices2[tri_id2[1]],
+                               vertices2[tri_id2[2]]);
+      ConvexTpl<Triangle32> convex1, convex2;
+      int convex1_active_faces, convex2_active_faces;
+      details::buildConvexTriangles(node1, *model1, convex1,
+                                    convex1_active_faces, convex2,
+                                    convex2_active_faces);
+      distance = details::hfieldBinDistance(
+          nsolver, this->request.enable_signed_distance, convex1, convex2,
+          triangle, tf, p1, p2, normal);
+    }
+
+    this->result->update(distance, model1, model2, b1, primitive_id2,
+                         this->tf1.transform(p1), this->tf1.transform(p2),
+                         this->tf1.getRotation() * normal);
+  }
+
+  /// @brief Whether the traversal process can stop early
+  bool canStop(Scalar c) const {
+    if ((c >= this->result->min_distance - abs_err) &&
+        (c * (1 + rel_err) >= this->result->min_distance))
+      return true;
+    return false;
+  }
+
+  Scalar rel_err;
+  Scalar abs_err;
+
+  const GJKSolver* nsolver;
+
+  const HeightField<BV1>* model1;
+  const BVHModel<BV2>* model2;
+
+  Vec3s* vertices2;
+  Triangle32* tri_indices2;
+
+  /// @brief Pose of the mesh in the frame of the height field
+  Transform3s tf;
+
+  mutable int num_bv_tests;
+  mutable int num_leaf_tests;
+  mutable Scalar query_time_seconds;
+};
+
+/// @brief Traversal node for distance between two height fields.
+template <typename BV1, typename BV2>
+class HeightFieldDistanceTraversalNode : public DistanceTraversalNodeBase {
+ public:
+  HeightFieldDistanceTraversalNode() : DistanceTraversalNodeBase() {
+    model1 = NULL;
+    model2 = NULL;
+    nsolver = NULL;
+
+    rel_err = 0;
+    abs_err = 0;
+
+    num_bv_tests = 0;
+    num_leaf_tests = 0;
+    query_time_seconds = 0.0;
+  }
+
+  /// @brief Whether the BV node in the first height field is leaf
+  bool isFirstNodeLeaf(unsigned int b) const {
+    return model1->getBV(b).isLeaf();
+  }
+
+  /// @brief Whether the BV node in the second height field is leaf
+  bool isSecondNodeLeaf(unsigned int b) const {
+    return model2->getBV(b).isLeaf();
+  }
+
+  /// @brief Determine the traversal order, is the first BVTT subtree better
+  bool firstOverSecond(unsigned int b1, unsigned int b2) const {
+    Scalar sz1 = model1->getBV(b1).bv.size();
+    Scalar sz2 = model2->getBV(b2).bv.size();
+
+    bool l1 = model1->getBV(b1).isLeaf();
+    bool l2 = model2->getBV(b2).isLeaf();
+
+    if (l2 || (!l1 && (sz1 > sz2))) return true;
+    return false;
+  }
+
+  /// @brief Obtain the left child of BV node in the first height field
+  int getFirstLeftChild(unsigned int b) const {
+    return static_cast<int>(model1->getBV(b).leftChild());
+  }
+
+  /// @brief Obtain the right child of BV node in the first height field
+  int getFirstRightChild(unsigned int b) const {
+    return static_cast<int>(model1->getBV(b).rightChild());
+  }
+
+  /// @brief Obtain the left child of BV node in the second height field
+  int getSecondLeftChild(unsigned int b) const {
+    return static_cast<int>(model2->getBV(b).leftChild());
+  }
+
+  /// @brief Obtain the right child of BV node in the second height field
+  int getSecondRightChild(unsigned int b) const {
+    return static_cast<int>(model2->getBV(b).rightChild());
+  }
+
+  /// @brief BV culling test in one BVTT node
+  Scalar BVDistanceLowerBound(unsigned int b1, unsigned int b2) const {
+    if (this->enable_statistics) this->num_bv_tests++;
+    return details::hfieldsBVDistanceLowerBound(model1->getBV(b1).bv, tf,
+                                                model2->getBV(b2).bv);
+  }
+
+  /// @brief Distance testing between leaves (two bins)
+  void leafComputeDistance(unsigned int b1, unsigned int b2) const {
+    if (this->enable_statistics) this->num_leaf_tests++;
+
+    {
+      Scalar distance;
+      Vec3s p1, p2, normal;
+      if (details::hfieldsBinTopsDistance(model1->getBV(b1), *model1,
+                                          model2->getBV(b2), *model2, tf,
+                                          distance, p1, p2, normal)) {
+        this->result->update(distance, model1, model2, b1, b2,
+                             this->tf1.transform(p1), this->tf1.transform(p2),
+                             this->tf1.getRotation() * normal);
+        return;
+      }
+    }
+
+    ConvexTpl<Triangle32> convex1, convex2, convex3, convex4;
+    int convex1_active_faces, convex2_active_faces, convex3_active_faces,
+        convex4_active_faces;
+    details::buildConvexTriangles(model1->getBV(b1), *model1, convex1,
+                                  convex1_active_faces, convex2,
+                                  convex2_active_faces);
+    details::buildConvexTriangles(model2->getBV(b2), *model2, convex3,
+                                  convex3_active_faces, convex4,
+                                  convex4_active_faces);
+
+    const bool signed_distance = this->request.enable_signed_distance;
+    Vec3s p1, p2, normal, q1, q2, n;
+    Scalar distance = details::hfieldBinDistance(
+        nsolver, signed_distance, convex1, convex2, convex3, tf, p1, p2,
+        normal);
+    const Scalar distance4 = details::hfieldBinDistance(
+        nsolver, signed_distance, convex1, convex2, convex4, tf, q1, q2, n);
+    if (distance4 < distance) {
+      distance = distance4;
+      p1 = q1;
+      p2 = q2;
+      normal = n;
+    }
+
+    this->result->update(distance, model1, model2, b1, b2,
+                         this->tf1.transform(p1), this->tf1.transform(p2),
+                         this->tf1.getRotation() * normal);
+  }
+
+  /// @brief Whether the traversal process can stop early
+  bool canStop(Scalar c) const {
+    if ((c >= this->result->min_distance - abs_err) &&
+        (c * (1 + rel_err) >= this->result->min_distance))
+      return true;
+    return false;
+  }
+
+  Scalar rel_err;
+  Scalar abs_err;
+
+  const GJKSolver* nsolver;
+
+  const HeightField<BV1>* model1;
+  const HeightField<BV2>* model2;
+
+  /// @brief Pose of the second height field in the frame of the first one
+  Transform3s tf;
+
+  mutable int num_bv_tests;
+  mutable int num_leaf_tests;
+  mutable Scalar query_time_seconds;
+};
+
+/// @}
+
+}  // namespace coal
+
+/// @endcond
+
+#endif
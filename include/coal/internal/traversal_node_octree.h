@@ -50,6 +50,7 @@
 #include "coal/BVH/BVH_model.h"
 #include "coal/shape/geometric_shapes_utility.h"
 #include "coal/internal/shape_shape_func.h"
+#include "coal/internal/query_statistics.h"
 
 namespace coal {
 
@@ -64,13 +65,21 @@ class COAL_DLLAPI OcTreeSolver {
   mutable CollisionResult* cresult;
   mutable DistanceResult* dresult;
 
+  /// @brief Front of the collision query, NULL if it is not recorded (see
+  /// restartFromFront).
+  mutable BVHFrontList* front_list;
+
+  /// @brief Front of the previous query, from which the traversal restarts.
+  mutable BVHFrontList previous_front;
+
  public:
   OcTreeSolver(const GJKSolver* solver_)
       : solver(solver_),
         crequest(NULL),
         drequest(NULL),
         cresult(NULL),
-        dresult(NULL) {}
+        dresult(NULL),
+        front_list(NULL) {}
 
   /// @brief collision between two octrees
   void OcTreeIntersect(const OcTree* tree1, const OcTree* tree2,
@@ -80,8 +89,28 @@ class COAL_DLLAPI OcTreeSolver {
     crequest = &request_;
     cresult = &result_;
 
-    OcTreeIntersectRecurse(tree1, tree1->getRoot(), tree1->getRootBV(), tree2,
-                           tree2->getRoot(), tree2->getRootBV(), tf1, tf2);
+    if (restartFromFront(tree1->hasFlatTree() && tree2->hasFlatTree())) {
+      for (const BVHFrontNode& front_node : previous_front) {
+        const OcTree::FlatNode* root1 = flatNode(tree1, front_node.left);
+        const OcTree::FlatNode* root2 = flatNode(tree2, front_node.right);
+        OcTreeIntersectRecurse(tree1, root1, root1->bv, tree2, root2,
+                               root2->bv, tf1, tf2);
+      }
+    } else if (tree1->hasFlatTree() && tree2->hasFlatTree())
+      OcTreeIntersectRecurse(tree1, tree1->getFlatRoot(), tree1->getRootBV(),
+                             tree2, tree2->getFlatRoot(), tree2->getRootBV(),
+                             tf1, tf2);
+    else if (tree1->hasFlatTree())
+      OcTreeIntersectRecurse(tree1, tree1->getFlatRoot(), tree1->getRootBV(),
+                             tree2, tree2->getRoot(), tree2->getRootBV(), tf1,
+                             tf2);
+    else if (tree2->hasFlatTree())
+      OcTreeIntersectRecurse(tree1, tree1->getRoot(), tree1->getRootBV(), tree2,
+                             tree2->getFlatRoot(), tree2->getRootBV(), tf1,
+                             tf2);
+    else
+      OcTreeIntersectRecurse(tree1, tree1->getRoot(), tree1->getRootBV(), tree2,
+                             tree2->getRoot(), tree2->getRootBV(), tf1, tf2);
   }
 
   /// @brief distance between two octrees
@@ -92,8 +121,20 @@ class COAL_DLLAPI OcTreeSolver {
     drequest = &request_;
     dresult = &result_;
 
-    OcTreeDistanceRecurse(tree1, tree1->getRoot(), tree1->getRootBV(), tree2,
-                          tree2->getRoot(), tree2->getRootBV(), tf1, tf2);
+    if (tree1->hasFlatTree() && tree2->hasFlatTree())
+      OcTreeDistanceRecurse(tree1, tree1->getFlatRoot(), tree1->getRootBV(),
+                            tree2, tree2->getFlatRoot(), tree2->getRootBV(),
+                            tf1, tf2);
+    else if (tree1->hasFlatTree())
+      OcTreeDistanceRecurse(tree1, tree1->getFlatRoot(), tree1->getRootBV(),
+                            tree2, tree2->getRoot(), tree2->getRootBV(), tf1,
+                            tf2);
+    else if (tree2->hasFlatTree())
+      OcTreeDistanceRecurse(tree1, tree1->getRoot(), tree1->getRootBV(), tree2,
+                            tree2->getFlatRoot(), tree2->getRootBV(), tf1, tf2);
+    else
+      OcTreeDistanceRecurse(tree1, tree1->getRoot(), tree1->getRootBV(), tree2,
+                            tree2->getRoot(), tree2->getRootBV(), tf1, tf2);
   }
 
   /// @brief collision between octree and mesh
@@ -105,8 +146,18 @@ class COAL_DLLAPI OcTreeSolver {
     crequest = &request_;
     cresult = &result_;
 
-    OcTreeMeshIntersectRecurse(tree1, tree1->getRoot(), tree1->getRootBV(),
-                               tree2, 0, tf1, tf2);
+    if (restartFromFront(tree1->hasFlatTree())) {
+      for (const BVHFrontNode& front_node : previous_front) {
+        const OcTree::FlatNode* root1 = flatNode(tree1, front_node.left);
+        OcTreeMeshIntersectRecurse(tree1, root1, root1->bv, tree2,
+                                   front_node.right, tf1, tf2);
+      }
+    } else if (tree1->hasFlatTree())
+      OcTreeMeshIntersectRecurse(tree1, tree1->getFlatRoot(),
+                                 tree1->getRootBV(), tree2, 0, tf1, tf2);
+    else
+      OcTreeMeshIntersectRecurse(tree1, tree1->getRoot(), tree1->getRootBV(),
+                                 tree2, 0, tf1, tf2);
   }
 
   /// @brief distance between octree and mesh
@@ -118,8 +169,12 @@ class COAL_DLLAPI OcTreeSolver {
     drequest = &request_;
     dresult = &result_;
 
-    OcTreeMeshDistanceRecurse(tree1, tree1->getRoot(), tree1->getRootBV(),
-                              tree2, 0, tf1, tf2);
+    if (tree1->hasFlatTree())
+      OcTreeMeshDistanceRecurse(tree1, tree1->getFlatRoot(), tree1->getRootBV(),
+                                tree2, 0, tf1, tf2);
+    else
+      OcTreeMeshDistanceRecurse(tree1, tree1->getRoot(), tree1->getRootBV(),
+                                tree2, 0, tf1, tf2);
   }
 
   /// @brief collision between mesh and octree
@@ -133,8 +188,18 @@ class COAL_DLLAPI OcTreeSolver {
     crequest = &request_;
     cresult = &result_;
 
-    OcTreeMeshIntersectRecurse(tree2, tree2->getRoot(), tree2->getRootBV(),
-                               tree1, 0, tf2, tf1);
+    if (restartFromFront(tree2->hasFlatTree())) {
+      for (const BVHFrontNode& front_node : previous_front) {
+        const OcTree::FlatNode* root2 = flatNode(tree2, front_node.left);
+        OcTreeMeshIntersectRecurse(tree2, root2, root2->bv, tree1,
+                                   front_node.right, tf2, tf1);
+      }
+    } else if (tree2->hasFlatTree())
+      OcTreeMeshIntersectRecurse(tree2, tree2->getFlatRoot(),
+                                 tree2->getRootBV(), tree1, 0, tf2, tf1);
+    else
+      OcTreeMeshIntersectRecurse(tree2, tree2->getRoot(), tree2->getRootBV(),
+                                 tree1, 0, tf2, tf1);
   }
 
   /// @brief distance between mesh and octree
@@ -146,8 +211,12 @@ class COAL_DLLAPI OcTreeSolver {
     drequest = &request_;
     dresult = &result_;
 
-    OcTreeMeshDistanceRecurse(tree1, 0, tree2, tree2->getRoot(),
-                              tree2->getRootBV(), tf1, tf2);
+    if (tree2->hasFlatTree())
+      OcTreeMeshDistanceRecurse(tree2, tree2->getFlatRoot(), tree2->getRootBV(),
+                                tree1, 0, tf2, tf1);
+    else
+      OcTreeMeshDistanceRecurse(tree2, tree2->getRoot(), tree2->getRootBV(),
+                                tree1, 0, tf2, tf1);
   }
 
   template <typename BV>
@@ -158,9 +227,21 @@ class COAL_DLLAPI OcTreeSolver {
     crequest = &request_;
     cresult = &result_;
 
-    OcTreeHeightFieldIntersectRecurse(tree1, tree1->getRoot(),
-                                      tree1->getRootBV(), tree2, 0, tf1, tf2,
-                                      sqrDistLowerBound);
+    if (restartFromFront(tree1->hasFlatTree())) {
+      for (const BVHFrontNode& front_node : previous_front) {
+        const OcTree::FlatNode* root1 = flatNode(tree1, front_node.left);
+        OcTreeHeightFieldIntersectRecurse(tree1, root1, root1->bv, tree2,
+                                          front_node.right, tf1, tf2,
+                                          sqrDistLowerBound);
+      }
+    } else if (tree1->hasFlatTree())
+      OcTreeHeightFieldIntersectRecurse(tree1, tree1->getFlatRoot(),
+                                        tree1->getRootBV(), tree2, 0, tf1, tf2,
+                                        sqrDistLowerBound);
+    else
+      OcTreeHeightFieldIntersectRecurse(tree1, tree1->getRoot(),
+                                        tree1->getRootBV(), tree2, 0, tf1, tf2,
+                                        sqrDistLowerBound);
   }
 
   template <typename BV>
@@ -173,9 +254,21 @@ class COAL_DLLAPI OcTreeSolver {
     crequest = &request_;
     cresult = &result_;
 
-    HeightFieldOcTreeIntersectRecurse(tree1, 0, tree2, tree2->getRoot(),
-                                      tree2->getRootBV(), tf1, tf2,
-                                      sqrDistLowerBound);
+    if (restartFromFront(tree2->hasFlatTree())) {
+      for (const BVHFrontNode& front_node : previous_front) {
+        const OcTree::FlatNode* root2 = flatNode(tree2, front_node.right);
+        HeightFieldOcTreeIntersectRecurse(tree1, front_node.left, tree2, root2,
+                                          root2->bv, tf1, tf2,
+                                          sqrDistLowerBound);
+      }
+    } else if (tree2->hasFlatTree())
+      HeightFieldOcTreeIntersectRecurse(tree1, 0, tree2, tree2->getFlatRoot(),
+                                        tree2->getRootBV(), tf1, tf2,
+                                        sqrDistLowerBound);
+    else
+      HeightFieldOcTreeIntersectRecurse(tree1, 0, tree2, tree2->getRoot(),
+                                        tree2->getRootBV(), tf1, tf2,
+                                        sqrDistLowerBound);
   }
 
   /// @brief collision between octree and shape
@@ -191,8 +284,17 @@ class COAL_DLLAPI OcTreeSolver {
     computeBV<AABB>(s, Transform3s(), bv2);
     OBB obb2;
     convertBV(bv2, tf2, obb2);
-    OcTreeShapeIntersectRecurse(tree, tree->getRoot(), tree->getRootBV(), s,
-                                obb2, tf1, tf2);
+    if (restartFromFront(tree->hasFlatTree())) {
+      for (const BVHFrontNode& front_node : previous_front) {
+        const OcTree::FlatNode* root = flatNode(tree, front_node.left);
+        OcTreeShapeIntersectRecurse(tree, root, root->bv, s, obb2, tf1, tf2);
+      }
+    } else if (tree->hasFlatTree())
+      OcTreeShapeIntersectRecurse(tree, tree->getFlatRoot(), tree->getRootBV(),
+                                  s, obb2, tf1, tf2);
+    else
+      OcTreeShapeIntersectRecurse(tree, tree->getRoot(), tree->getRootBV(), s,
+                                  obb2, tf1, tf2);
   }
 
   /// @brief collision between shape and octree
@@ -208,8 +310,17 @@ class COAL_DLLAPI OcTreeSolver {
     computeBV<AABB>(s, Transform3s(), bv1);
     OBB obb1;
     convertBV(bv1, tf1, obb1);
-    OcTreeShapeIntersectRecurse(tree, tree->getRoot(), tree->getRootBV(), s,
-                                obb1, tf2, tf1);
+    if (restartFromFront(tree->hasFlatTree())) {
+      for (const BVHFrontNode& front_node : previous_front) {
+        const OcTree::FlatNode* root = flatNode(tree, front_node.left);
+        OcTreeShapeIntersectRecurse(tree, root, root->bv, s, obb1, tf2, tf1);
+      }
+    } else if (tree->hasFlatTree())
+      OcTreeShapeIntersectRecurse(tree, tree->getFlatRoot(), tree->getRootBV(),
+                                  s, obb1, tf2, tf1);
+    else
+      OcTreeShapeIntersectRecurse(tree, tree->getRoot(), tree->getRootBV(), s,
+                                  obb1, tf2, tf1);
   }
 
   /// @brief distance between octree and shape
@@ -223,8 +334,12 @@ class COAL_DLLAPI OcTreeSolver {
 
     AABB aabb2;
     computeBV<AABB>(s, tf2, aabb2);
-    OcTreeShapeDistanceRecurse(tree, tree->getRoot(), tree->getRootBV(), s,
-                               aabb2, tf1, tf2);
+    if (tree->hasFlatTree())
+      OcTreeShapeDistanceRecurse(tree, tree->getFlatRoot(), tree->getRootBV(),
+                                 s, aabb2, tf1, tf2);
+    else
+      OcTreeShapeDistanceRecurse(tree, tree->getRoot(), tree->getRootBV(), s,
+                                 aabb2, tf1, tf2);
   }
 
   /// @brief distance between shape and octree
@@ -238,19 +353,108 @@ class COAL_DLLAPI OcTreeSolver {
 
     AABB aabb1;
     computeBV<AABB>(s, tf1, aabb1);
-    OcTreeShapeDistanceRecurse(tree, tree->getRoot(), tree->getRootBV(), s,
-                               aabb1, tf2, tf1);
+    if (tree->hasFlatTree())
+      OcTreeShapeDistanceRecurse(tree, tree->getFlatRoot(), tree->getRootBV(),
+                                 s, aabb1, tf2, tf1);
+    else
+      OcTreeShapeDistanceRecurse(tree, tree->getRoot(), tree->getRootBV(), s,
+                                 aabb1, tf2, tf1);
   }
 
  private:
-  template <typename S>
-  bool OcTreeShapeDistanceRecurse(const OcTree* tree1,
-                                  const OcTree::OcTreeNode* root1,
+  /// @brief Counts a test between bounding volumes in the statistics of the
+  /// query, if they are enabled.
+  void countBVTest() const {
+    if (solver->statistics) ++solver->statistics->num_bv_tests;
+  }
+
+  /// @brief Counts a test between primitives in the statistics of the query.
+  /// @return the statistics, NULL if they are disabled.
+  QueryStatistics* countLeafTest() const {
+    if (solver->statistics) ++solver->statistics->num_leaf_tests;
+    return solver->statistics;
+  }
+
+  /// @brief Sets up the front of a collision query. The front is recorded if
+  /// the narrow phase solver has one and the octrees have a flat copy, whose
+  /// nodes have stable indices.
+  /// @return whether the traversal restarts from the front of the previous
+  /// query, which is then moved to previous_front.
+  bool restartFromFront(const bool flat) const {
+    front_list = flat ? solver->front_list : NULL;
+    if (front_list == NULL || front_list->empty()) return false;
+    previous_front.clear();
+    previous_front.swap(*front_list);
+    return true;
+  }
+
+  /// @brief Whether the collision traversal can stop. It never stops early
+  /// when it records a front, which must cover the whole hierarchies.
+  bool canStop() const {
+    return front_list == NULL && crequest->isSatisfied(*cresult);
+  }
+
+  /// @brief Node of the flat copy of an octree with index i.
+  static const OcTree::FlatNode* flatNode(const OcTree* tree,
+                                          unsigned int i) {
+    return tree->getFlatRoot() + i;
+  }
+
+  /// @brief Index of an octree node in the front.
+  template <typename Node>
+  static unsigned int frontIndex(const OcTree* tree, const Node* node) {
+    return static_cast<unsigned int>(nodeIndex(tree, node));
+  }
+
+  /// @brief Id of an octree node, reported in the contacts and distance
+  /// results.
+  static int nodeIndex(const OcTree* tree, const OcTree::OcTreeNode* node) {
+    return static_cast<int>(node - tree->getRoot());
+  }
+
+  /// @brief Id of a node of the flat copy of an octree: its index in the
+  /// array of nodes.
+  static int nodeIndex(const OcTree* tree, const OcTree::FlatNode* node) {
+    return static_cast<int>(node - tree->getFlatRoot());
+  }
+
+  /// @brief Whether the traversal must visit the i-th child of node.
+  static bool visitChild(const OcTree* tree, const OcTree::OcTreeNode* node,
+                         unsigned int i) {
+    return tree->nodeChildExists(node, i);
+  }
+
+  /// @brief Whether the traversal must visit the i-th child of node.
+  /// Non-occupied children are pruned with the occupied-child mask, without
+  /// loading them: they never collide nor contribute to the distance.
+  static bool visitChild(const OcTree*, const OcTree::FlatNode* node,
+                         unsigned int i) {
+    return (node->occupied_child_mask >> i) & 1;
+  }
+
+  /// @brief Bounding volume of the i-th child of an octree node.
+  static const AABB& childBV(const OcTree::OcTreeNode*, const AABB& bv,
+                             unsigned int i, AABB& child_bv) {
+    computeChildBV(bv, i, child_bv);
+    return child_bv;
+  }
+
+  /// @brief Bounding volume of a child of a flat octree node: it is stored
+  /// in the node.
+  static const AABB& childBV(const OcTree::FlatNode* child, const AABB&,
+                             unsigned int, AABB&) {
+    return child->bv;
+  }
+
+  template <typename Node1, typename S>
+  bool OcTreeShapeDistanceRecurse(const OcTree* tree1, const Node1* root1,
                                   const AABB& bv1, const S& s,
                                   const AABB& aabb2, const Transform3s& tf1,
                                   const Transform3s& tf2) const {
     if (!tree1->nodeHasChildren(root1)) {
       if (tree1->isNodeOccupied(root1)) {
+        internal::StageTimer narrowphase_timer(
+            countLeafTest(), &QueryStatistics::narrowphase_time);
         Box box;
         Transform3s box_tf;
         constructBox(bv1, tf1, box, box_tf);
@@ -264,8 +468,7 @@ class COAL_DLLAPI OcTreeSolver {
             &box, box_tf, &s, tf2, this->solver,
             this->drequest->enable_signed_distance, p1, p2, normal);
 
-        this->dresult->update(distance, tree1, &s,
-                              (int)(root1 - tree1->getRoot()),
+        this->dresult->update(distance, tree1, &s, nodeIndex(tree1, root1),
                               DistanceResult::NONE, p1, p2, normal);
 
         return drequest->isSatisfied(*dresult);
@@ -276,13 +479,14 @@ class COAL_DLLAPI OcTreeSolver {
     if (!tree1->isNodeOccupied(root1)) return false;
 
     for (unsigned int i = 0; i < 8; ++i) {
-      if (tree1->nodeChildExists(root1, i)) {
-        const OcTree::OcTreeNode* child = tree1->getNodeChild(root1, i);
-        AABB child_bv;
-        computeChildBV(bv1, i, child_bv);
+      if (visitChild(tree1, root1, i)) {
+        const Node1* child = tree1->getNodeChild(root1, i);
+        AABB child_bv_storage;
+        const AABB& child_bv = childBV(child, bv1, i, child_bv_storage);
 
         AABB aabb1;
         convertBV(child_bv, tf1, aabb1);
+        countBVTest();
         Scalar d = aabb1.distance(aabb2);
         if (d < dresult->min_distance) {
           if (OcTreeShapeDistanceRecurse(tree1, child, child_bv, s, aabb2, tf1,
@@ -295,9 +499,8 @@ class COAL_DLLAPI OcTreeSolver {
     return false;
   }
 
-  template <typename S>
-  bool OcTreeShapeIntersectRecurse(const OcTree* tree1,
-                                   const OcTree::OcTreeNode* root1,
+  template <typename Node1, typename S>
+  bool OcTreeShapeIntersectRecurse(const OcTree* tree1, const Node1* root1,
                                    const AABB& bv1, const S& s, const OBB& obb2,
                                    const Transform3s& tf1,
                                    const Transform3s& tf2) const {
@@ -316,15 +519,19 @@ class COAL_DLLAPI OcTreeSolver {
       OBB obb1;
       convertBV(bv1, tf1, obb1);
       Scalar sqrDistLowerBound;
+      countBVTest();
       if (!obb1.overlap(obb2, *crequest, sqrDistLowerBound)) {
         internal::updateDistanceLowerBoundFromBV(*crequest, *cresult,
                                                  sqrDistLowerBound);
+        updateFrontList(front_list, frontIndex(tree1, root1), 0);
         return false;
       }
     }
 
     if (!tree1->nodeHasChildren(root1)) {
       assert(tree1->isNodeOccupied(root1));  // it isn't free nor uncertain.
+      internal::StageTimer narrowphase_timer(
+          countLeafTest(), &QueryStatistics::narrowphase_time);
 
       Box box;
       Transform3s box_tf;
@@ -333,30 +540,30 @@ class COAL_DLLAPI OcTreeSolver {
         box.computeLocalAABB();
       }
 
-      bool contactNotAdded =
-          (cresult->numContacts() >= crequest->num_max_contacts);
-      std::size_t ncontact = ShapeShapeCollide<Box, S>(
-          &box, box_tf, &s, tf2, solver, *crequest, *cresult);
-      assert(ncontact == 0 || ncontact == 1);
-      if (!contactNotAdded && ncontact == 1) {
+      // The narrow phase may add several contacts (e.g. the manifold of a
+      // box-box pair): all of them refer to this node.
+      const std::size_t num_contacts = cresult->numContacts();
+      ShapeShapeCollide<Box, S>(&box, box_tf, &s, tf2, solver, *crequest,
+                                *cresult);
+      for (std::size_t k = num_contacts; k < cresult->numContacts(); ++k) {
         // Update contact information.
-        const Contact& c = cresult->getContact(cresult->numContacts() - 1);
-        cresult->setContact(
-            cresult->numContacts() - 1,
-            Contact(tree1, c.o2, static_cast<int>(root1 - tree1->getRoot()),
-                    c.b2, c.pos, c.normal, c.penetration_depth));
+        const Contact& c = cresult->getContact(k);
+        cresult->setContact(k, Contact(tree1, c.o2, nodeIndex(tree1, root1),
+                                       c.b2, c.pos, c.normal,
+                                       c.penetration_depth));
       }
 
       // no need to call `internal::updateDistanceLowerBoundFromLeaf` here
       // as it is already done internally in `ShapeShapeCollide` above.
-      return crequest->isSatisfied(*cresult);
+      updateFrontList(front_list, frontIndex(tree1, root1), 0);
+      return canStop();
     }
 
     for (unsigned int i = 0; i < 8; ++i) {
-      if (tree1->nodeChildExists(root1, i)) {
-        const OcTree::OcTreeNode* child = tree1->getNodeChild(root1, i);
-        AABB child_bv;
-        computeChildBV(bv1, i, child_bv);
+      if (visitChild(tree1, root1, i)) {
+        const Node1* child = tree1->getNodeChild(root1, i);
+        AABB child_bv_storage;
+        const AABB& child_bv = childBV(child, bv1, i, child_bv_storage);
 
         if (OcTreeShapeIntersectRecurse(tree1, child, child_bv, s, obb2, tf1,
                                         tf2))
@@ -367,14 +574,15 @@ class COAL_DLLAPI OcTreeSolver {
     return false;
   }
 
-  template <typename BV>
-  bool OcTreeMeshDistanceRecurse(const OcTree* tree1,
-                                 const OcTree::OcTreeNode* root1,
+  template <typename Node1, typename BV>
+  bool OcTreeMeshDistanceRecurse(const OcTree* tree1, const Node1* root1,
                                  const AABB& bv1, const BVHModel<BV>* tree2,
                                  unsigned int root2, const Transform3s& tf1,
                                  const Transform3s& tf2) const {
     if (!tree1->nodeHasChildren(root1) && tree2->getBV(root2).isLeaf()) {
       if (tree1->isNodeOccupied(root1)) {
+        internal::StageTimer narrowphase_timer(
+            countLeafTest(), &QueryStatistics::narrowphase_time);
         Box box;
         Transform3s box_tf;
         constructBox(bv1, tf1, box, box_tf);
@@ -396,7 +604,7 @@ class COAL_DLLAPI OcTreeSolver {
             this->drequest->enable_signed_distance, p1, p2, normal);
 
         this->dresult->update(distance, tree1, tree2,
-                              (int)(root1 - tree1->getRoot()),
+                              nodeIndex(tree1, root1),
                               static_cast<int>(primitive_id), p1, p2, normal);
 
         return this->drequest->isSatisfied(*dresult);
@@ -410,15 +618,16 @@ class COAL_DLLAPI OcTreeSolver {
         (tree1->nodeHasChildren(root1) &&
          (bv1.size() > tree2->getBV(root2).bv.size()))) {
       for (unsigned int i = 0; i < 8; ++i) {
-        if (tree1->nodeChildExists(root1, i)) {
-          const OcTree::OcTreeNode* child = tree1->getNodeChild(root1, i);
-          AABB child_bv;
-          computeChildBV(bv1, i, child_bv);
+        if (visitChild(tree1, root1, i)) {
+          const Node1* child = tree1->getNodeChild(root1, i);
+          AABB child_bv_storage;
+          const AABB& child_bv = childBV(child, bv1, i, child_bv_storage);
 
           Scalar d;
           AABB aabb1, aabb2;
           convertBV(child_bv, tf1, aabb1);
           convertBV(tree2->getBV(root2).bv, tf2, aabb2);
+          countBVTest();
           d = aabb1.distance(aabb2);
 
           if (d < dresult->min_distance) {
@@ -434,6 +643,7 @@ class COAL_DLLAPI OcTreeSolver {
       convertBV(bv1, tf1, aabb1);
       unsigned int child = (unsigned int)tree2->getBV(root2).leftChild();
       convertBV(tree2->getBV(child).bv, tf2, aabb2);
+      countBVTest();
       d = aabb1.distance(aabb2);
 
       if (d < dresult->min_distance) {
@@ -444,6 +654,7 @@ class COAL_DLLAPI OcTreeSolver {
 
       child = (unsigned int)tree2->getBV(root2).rightChild();
       convertBV(tree2->getBV(child).bv, tf2, aabb2);
+      countBVTest();
       d = aabb1.distance(aabb2);
 
       if (d < dresult->min_distance) {
@@ -457,9 +668,8 @@ class COAL_DLLAPI OcTreeSolver {
   }
 
   /// \return True if the request is satisfied.
-  template <typename BV>
-  bool OcTreeMeshIntersectRecurse(const OcTree* tree1,
-                                  const OcTree::OcTreeNode* root1,
+  template <typename Node1, typename BV>
+  bool OcTreeMeshIntersectRecurse(const OcTree* tree1, const Node1* root1,
                                   const AABB& bv1, const BVHModel<BV>* tree2,
                                   unsigned int root2, const Transform3s& tf1,
                                   const Transform3s& tf2) const {
@@ -484,9 +694,11 @@ class COAL_DLLAPI OcTreeSolver {
       convertBV(bv1, tf1, obb1);
       convertBV(bvn2.bv, tf2, obb2);
       Scalar sqrDistLowerBound;
+      countBVTest();
       if (!obb1.overlap(obb2, *crequest, sqrDistLowerBound)) {
         internal::updateDistanceLowerBoundFromBV(*crequest, *cresult,
                                                  sqrDistLowerBound);
+        updateFrontList(front_list, frontIndex(tree1, root1), root2);
         return false;
       }
     }
@@ -494,6 +706,8 @@ class COAL_DLLAPI OcTreeSolver {
     // Check if leaf collides.
     if (!tree1->nodeHasChildren(root1) && bvn2.isLeaf()) {
       assert(tree1->isNodeOccupied(root1));  // it isn't free nor uncertain.
+      internal::StageTimer narrowphase_timer(
+          countLeafTest(), &QueryStatistics::narrowphase_time);
       Box box;
       Transform3s box_tf;
       constructBox(bv1, tf1, box, box_tf);
@@ -525,22 +739,23 @@ class COAL_DLLAPI OcTreeSolver {
 
       if (cresult->numContacts() < crequest->num_max_contacts) {
         if (distToCollision <= crequest->collision_distance_threshold) {
-          cresult->addContact(Contact(
-              tree1, tree2, (int)(root1 - tree1->getRoot()),
-              static_cast<int>(primitive_id), c1, c2, normal, distance));
+          cresult->addContact(Contact(tree1, tree2, nodeIndex(tree1, root1),
+                                      static_cast<int>(primitive_id), c1, c2,
+                                      normal, distance));
         }
       }
-      return crequest->isSatisfied(*cresult);
+      updateFrontList(front_list, frontIndex(tree1, root1), root2);
+      return canStop();
     }
 
     // Determine which tree to traverse first.
     if (bvn2.isLeaf() ||
         (tree1->nodeHasChildren(root1) && (bv1.size() > bvn2.bv.size()))) {
       for (unsigned int i = 0; i < 8; ++i) {
-        if (tree1->nodeChildExists(root1, i)) {
-          const OcTree::OcTreeNode* child = tree1->getNodeChild(root1, i);
-          AABB child_bv;
-          computeChildBV(bv1, i, child_bv);
+        if (visitChild(tree1, root1, i)) {
+          const Node1* child = tree1->getNodeChild(root1, i);
+          AABB child_bv_storage;
+          const AABB& child_bv = childBV(child, bv1, i, child_bv_storage);
 
           if (OcTreeMeshIntersectRecurse(tree1, child, child_bv, tree2, root2,
                                          tf1, tf2))
@@ -561,9 +776,9 @@ class COAL_DLLAPI OcTreeSolver {
   }
 
   /// \return True if the request is satisfied.
-  template <typename BV>
+  template <typename Node1, typename BV>
   bool OcTreeHeightFieldIntersectRecurse(
-      const OcTree* tree1, const OcTree::OcTreeNode* root1, const AABB& bv1,
+      const OcTree* tree1, const Node1* root1, const AABB& bv1,
       const HeightField<BV>* tree2, unsigned int root2, const Transform3s& tf1,
       const Transform3s& tf2, Scalar& sqrDistLowerBound) const {
     // FIXME(jmirabel) I do not understand why the BVHModel was traversed. The
@@ -587,11 +802,13 @@ class COAL_DLLAPI OcTreeSolver {
       convertBV(bv1, tf1, obb1);
       convertBV(bvn2.bv, tf2, obb2);
       Scalar sqrDistLowerBound_;
+      countBVTest();
       if (!obb1.overlap(obb2, *crequest, sqrDistLowerBound_)) {
         if (sqrDistLowerBound_ < sqrDistLowerBound)
           sqrDistLowerBound = sqrDistLowerBound_;
         internal::updateDistanceLowerBoundFromBV(*crequest, *cresult,
                                                  sqrDistLowerBound);
+        updateFrontList(front_list, frontIndex(tree1, root1), root2);
         return false;
       }
     }
@@ -599,6 +816,8 @@ class COAL_DLLAPI OcTreeSolver {
     // Check if leaf collides.
     if (!tree1->nodeHasChildren(root1) && bvn2.isLeaf()) {
       assert(tree1->isNodeOccupied(root1));  // it isn't free nor uncertain.
+      internal::StageTimer narrowphase_timer(
+          countLeafTest(), &QueryStatistics::narrowphase_time);
       Box box;
       Transform3s box_tf;
       constructBox(bv1, tf1, box, box_tf);
@@ -633,9 +852,9 @@ class COAL_DLLAPI OcTreeSolver {
         if (crequest->num_max_contacts > cresult->numContacts()) {
           if (normal_top.isApprox(normal) &&
               (collision || !hfield_witness_is_on_bin_side)) {
-            cresult->addContact(
-                Contact(tree1, tree2, (int)(root1 - tree1->getRoot()),
-                        (int)Contact::NONE, c1, c2, -normal, distance));
+            cresult->addContact(Contact(tree1, tree2, nodeIndex(tree1, root1),
+                                        (int)Contact::NONE, c1, c2, -normal,
+                                        distance));
           }
         }
       } else
@@ -647,17 +866,18 @@ class COAL_DLLAPI OcTreeSolver {
           *crequest, *cresult, distToCollision, c1, c2, -normal);
 
       assert(cresult->isCollision() || sqrDistLowerBound > 0);
-      return crequest->isSatisfied(*cresult);
+      updateFrontList(front_list, frontIndex(tree1, root1), root2);
+      return canStop();
     }
 
     // Determine which tree to traverse first.
     if (bvn2.isLeaf() ||
         (tree1->nodeHasChildren(root1) && (bv1.size() > bvn2.bv.size()))) {
       for (unsigned int i = 0; i < 8; ++i) {
-        if (tree1->nodeChildExists(root1, i)) {
-          const OcTree::OcTreeNode* child = tree1->getNodeChild(root1, i);
-          AABB child_bv;
-          computeChildBV(bv1, i, child_bv);
+        if (visitChild(tree1, root1, i)) {
+          const Node1* child = tree1->getNodeChild(root1, i);
+          AABB child_bv_storage;
+          const AABB& child_bv = childBV(child, bv1, i, child_bv_storage);
 
           if (OcTreeHeightFieldIntersectRecurse(tree1, child, child_bv, tree2,
                                                 root2, tf1, tf2,
@@ -681,10 +901,10 @@ class COAL_DLLAPI OcTreeSolver {
   }
 
   /// \return True if the request is satisfied.
-  template <typename BV>
+  template <typename BV, typename Node2>
   bool HeightFieldOcTreeIntersectRecurse(
       const HeightField<BV>* tree1, unsigned int root1, const OcTree* tree2,
-      const OcTree::OcTreeNode* root2, const AABB& bv2, const Transform3s& tf1,
+      const Node2* root2, const AABB& bv2, const Transform3s& tf1,
       const Transform3s& tf2, Scalar& sqrDistLowerBound) const {
     // FIXME(jmirabel) I do not understand why the BVHModel was traversed. The
     // code in this if(!root1) did not output anything so the empty OcTree is
@@ -707,11 +927,13 @@ class COAL_DLLAPI OcTreeSolver {
       convertBV(bvn1.bv, tf1, obb1);
       convertBV(bv2, tf2, obb2);
       Scalar sqrDistLowerBound_;
+      countBVTest();
       if (!obb2.overlap(obb1, *crequest, sqrDistLowerBound_)) {
         if (sqrDistLowerBound_ < sqrDistLowerBound)
           sqrDistLowerBound = sqrDistLowerBound_;
         internal::updateDistanceLowerBoundFromBV(*crequest, *cresult,
                                                  sqrDistLowerBound);
+        updateFrontList(front_list, root1, frontIndex(tree2, root2));
         return false;
       }
     }
@@ -719,6 +941,8 @@ class COAL_DLLAPI OcTreeSolver {
     // Check if leaf collides.
     if (!tree2->nodeHasChildren(root2) && bvn1.isLeaf()) {
       assert(tree2->isNodeOccupied(root2));  // it isn't free nor uncertain.
+      internal::StageTimer narrowphase_timer(
+          countLeafTest(), &QueryStatistics::narrowphase_time);
       Box box;
       Transform3s box_tf;
       constructBox(bv2, tf2, box, box_tf);
@@ -754,7 +978,7 @@ class COAL_DLLAPI OcTreeSolver {
           if (normal_top.isApprox(normal) &&
               (collision || !hfield_witness_is_on_bin_side)) {
             cresult->addContact(Contact(tree1, tree2, (int)Contact::NONE,
-                                        (int)(root2 - tree2->getRoot()), c1, c2,
+                                        nodeIndex(tree2, root2), c1, c2,
                                         normal, distance));
           }
         }
@@ -767,17 +991,18 @@ class COAL_DLLAPI OcTreeSolver {
           *crequest, *cresult, distToCollision, c1, c2, normal);
 
       assert(cresult->isCollision() || sqrDistLowerBound > 0);
-      return crequest->isSatisfied(*cresult);
+      updateFrontList(front_list, root1, frontIndex(tree2, root2));
+      return canStop();
     }
 
     // Determine which tree to traverse first.
     if (bvn1.isLeaf() ||
         (tree2->nodeHasChildren(root2) && (bv2.size() > bvn1.bv.size()))) {
       for (unsigned int i = 0; i < 8; ++i) {
-        if (tree2->nodeChildExists(root2, i)) {
-          const OcTree::OcTreeNode* child = tree2->getNodeChild(root2, i);
-          AABB child_bv;
-          computeChildBV(bv2, i, child_bv);
+        if (visitChild(tree2, root2, i)) {
+          const Node2* child = tree2->getNodeChild(root2, i);
+          AABB child_bv_storage;
+          const AABB& child_bv = childBV(child, bv2, i, child_bv_storage);
 
           if (HeightFieldOcTreeIntersectRecurse(tree1, root1, tree2, child,
                                                 child_bv, tf1, tf2,
@@ -800,14 +1025,16 @@ class COAL_DLLAPI OcTreeSolver {
     return false;
   }
 
-  bool OcTreeDistanceRecurse(const OcTree* tree1,
-                             const OcTree::OcTreeNode* root1, const AABB& bv1,
-                             const OcTree* tree2,
-                             const OcTree::OcTreeNode* root2, const AABB& bv2,
+  template <typename Node1, typename Node2>
+  bool OcTreeDistanceRecurse(const OcTree* tree1, const Node1* root1,
+                             const AABB& bv1, const OcTree* tree2,
+                             const Node2* root2, const AABB& bv2,
                              const Transform3s& tf1,
                              const Transform3s& tf2) const {
     if (!tree1->nodeHasChildren(root1) && !tree2->nodeHasChildren(root2)) {
       if (tree1->isNodeOccupied(root1) && tree2->isNodeOccupied(root2)) {
+        internal::StageTimer narrowphase_timer(
+            countLeafTest(), &QueryStatistics::narrowphase_time);
         Box box1, box2;
         Transform3s box1_tf, box2_tf;
         constructBox(bv1, tf1, box1, box1_tf);
@@ -823,9 +1050,8 @@ class COAL_DLLAPI OcTreeSolver {
             &box1, box1_tf, &box2, box2_tf, this->solver,
             this->drequest->enable_signed_distance, p1, p2, normal);
 
-        this->dresult->update(distance, tree1, tree2,
-                              (int)(root1 - tree1->getRoot()),
-                              (int)(root2 - tree2->getRoot()), p1, p2, normal);
+        this->dresult->update(distance, tree1, tree2, nodeIndex(tree1, root1),
+                              nodeIndex(tree2, root2), p1, p2, normal);
 
         return drequest->isSatisfied(*dresult);
       } else
@@ -838,15 +1064,16 @@ class COAL_DLLAPI OcTreeSolver {
     if (!tree2->nodeHasChildren(root2) ||
         (tree1->nodeHasChildren(root1) && (bv1.size() > bv2.size()))) {
       for (unsigned int i = 0; i < 8; ++i) {
-        if (tree1->nodeChildExists(root1, i)) {
-          const OcTree::OcTreeNode* child = tree1->getNodeChild(root1, i);
-          AABB child_bv;
-          computeChildBV(bv1, i, child_bv);
+        if (visitChild(tree1, root1, i)) {
+          const Node1* child = tree1->getNodeChild(root1, i);
+          AABB child_bv_storage;
+          const AABB& child_bv = childBV(child, bv1, i, child_bv_storage);
 
           Scalar d;
           AABB aabb1, aabb2;
           convertBV(bv1, tf1, aabb1);
           convertBV(bv2, tf2, aabb2);
+          countBVTest();
           d = aabb1.distance(aabb2);
 
           if (d < dresult->min_distance) {
@@ -858,15 +1085,16 @@ class COAL_DLLAPI OcTreeSolver {
       }
     } else {
       for (unsigned int i = 0; i < 8; ++i) {
-        if (tree2->nodeChildExists(root2, i)) {
-          const OcTree::OcTreeNode* child = tree2->getNodeChild(root2, i);
-          AABB child_bv;
-          computeChildBV(bv2, i, child_bv);
+        if (visitChild(tree2, root2, i)) {
+          const Node2* child = tree2->getNodeChild(root2, i);
+          AABB child_bv_storage;
+          const AABB& child_bv = childBV(child, bv2, i, child_bv_storage);
 
           Scalar d;
           AABB aabb1, aabb2;
           convertBV(bv1, tf1, aabb1);
           convertBV(bv2, tf2, aabb2);
+          countBVTest();
           d = aabb1.distance(aabb2);
 
           if (d < dresult->min_distance) {
@@ -881,10 +1109,10 @@ class COAL_DLLAPI OcTreeSolver {
     return false;
   }
 
-  bool OcTreeIntersectRecurse(const OcTree* tree1,
-                              const OcTree::OcTreeNode* root1, const AABB& bv1,
-                              const OcTree* tree2,
-                              const OcTree::OcTreeNode* root2, const AABB& bv2,
+  template <typename Node1, typename Node2>
+  bool OcTreeIntersectRecurse(const OcTree* tree1, const Node1* root1,
+                              const AABB& bv1, const OcTree* tree2,
+                              const Node2* root2, const AABB& bv2,
                               const Transform3s& tf1,
                               const Transform3s& tf2) const {
     // Empty OcTree is considered free.
@@ -900,33 +1128,31 @@ class COAL_DLLAPI OcTreeSolver {
     else if ((tree1->isNodeUncertain(root1) || tree2->isNodeUncertain(root2)))
       return false;
 
-    bool bothAreLeaves =
-        (!tree1->nodeHasChildren(root1) && !tree2->nodeHasChildren(root2));
-    if (!bothAreLeaves || !crequest->enable_contact) {
+    {
       OBB obb1, obb2;
       convertBV(bv1, tf1, obb1);
       convertBV(bv2, tf2, obb2);
       Scalar sqrDistLowerBound;
+      countBVTest();
       if (!obb1.overlap(obb2, *crequest, sqrDistLowerBound)) {
         if (cresult->distance_lower_bound > 0 &&
             sqrDistLowerBound <
                 cresult->distance_lower_bound * cresult->distance_lower_bound)
           cresult->distance_lower_bound =
               sqrt(sqrDistLowerBound) - crequest->security_margin;
+        updateFrontList(front_list, frontIndex(tree1, root1),
+                        frontIndex(tree2, root2));
         return false;
       }
-      if (crequest->enable_contact) {  // Overlap
-        if (cresult->numContacts() < crequest->num_max_contacts)
-          cresult->addContact(
-              Contact(tree1, tree2, static_cast<int>(root1 - tree1->getRoot()),
-                      static_cast<int>(root2 - tree2->getRoot())));
-        return crequest->isSatisfied(*cresult);
-      }
     }
 
-    // Both node are leaves
-    if (bothAreLeaves) {
+    // Both node are leaves. As for the other pairs, the contacts are only
+    // reported between leaves, with their witness points and normal: two
+    // overlapping inner nodes may well contain no pair of colliding leaves.
+    if (!tree1->nodeHasChildren(root1) && !tree2->nodeHasChildren(root2)) {
       assert(tree1->isNodeOccupied(root1) && tree2->isNodeOccupied(root2));
+      internal::StageTimer narrowphase_timer(
+          countLeafTest(), &QueryStatistics::narrowphase_time);
 
       Box box1, box2;
       Transform3s box1_tf, box2_tf;
@@ -959,22 +1185,23 @@ class COAL_DLLAPI OcTreeSolver {
       if (this->cresult->numContacts() < this->crequest->num_max_contacts) {
         if (distToCollision <= this->crequest->collision_distance_threshold)
           this->cresult->addContact(
-              Contact(tree1, tree2, static_cast<int>(root1 - tree1->getRoot()),
-                      static_cast<int>(root2 - tree2->getRoot()), c1, c2,
-                      normal, distance));
+              Contact(tree1, tree2, nodeIndex(tree1, root1),
+                      nodeIndex(tree2, root2), c1, c2, normal, distance));
       }
 
-      return crequest->isSatisfied(*cresult);
+      updateFrontList(front_list, frontIndex(tree1, root1),
+                      frontIndex(tree2, root2));
+      return canStop();
     }
 
     // Determine which tree to traverse first.
     if (!tree2->nodeHasChildren(root2) ||
         (tree1->nodeHasChildren(root1) && (bv1.size() > bv2.size()))) {
       for (unsigned int i = 0; i < 8; ++i) {
-        if (tree1->nodeChildExists(root1, i)) {
-          const OcTree::OcTreeNode* child = tree1->getNodeChild(root1, i);
-          AABB child_bv;
-          computeChildBV(bv1, i, child_bv);
+        if (visitChild(tree1, root1, i)) {
+          const Node1* child = tree1->getNodeChild(root1, i);
+          AABB child_bv_storage;
+          const AABB& child_bv = childBV(child, bv1, i, child_bv_storage);
 
           if (OcTreeIntersectRecurse(tree1, child, child_bv, tree2, root2, bv2,
                                      tf1, tf2))
@@ -983,10 +1210,10 @@ class COAL_DLLAPI OcTreeSolver {
       }
     } else {
       for (unsigned int i = 0; i < 8; ++i) {
-        if (tree2->nodeChildExists(root2, i)) {
-          const OcTree::OcTreeNode* child = tree2->getNodeChild(root2, i);
-          AABB child_bv;
-          computeChildBV(bv2, i, child_bv);
+        if (visitChild(tree2, root2, i)) {
+          const Node2* child = tree2->getNodeChild(root2, i);
+          AABB child_bv_storage;
+          const AABB& child_bv = childBV(child, bv2, i, child_bv_storage);
 
           if (OcTreeIntersectRecurse(tree1, root1, bv1, tree2, child, child_bv,
                                      tf1, tf2))
@@ -1016,6 +1243,8 @@ class COAL_DLLAPI OcTreeCollisionTraversalNode
 
   bool BVDisjoints(unsigned, unsigned, Scalar&) const { return false; }
 
+  bool leafTestsArePrimitiveTests() const { return false; }
+
   void leafCollides(unsigned, unsigned, Scalar& sqrDistLowerBound) const {
     otsolver->OcTreeIntersect(model1, model2, tf1, tf2, request, *result);
     sqrDistLowerBound = std::max((Scalar)0, result->distance_lower_bound);
@@ -1045,6 +1274,8 @@ class COAL_DLLAPI ShapeOcTreeCollisionTraversalNode
 
   bool BVDisjoints(unsigned int, unsigned int, Scalar&) const { return false; }
 
+  bool leafTestsArePrimitiveTests() const { return false; }
+
   void leafCollides(unsigned int, unsigned int,
                     Scalar& sqrDistLowerBound) const {
     otsolver->OcTreeShapeIntersect(model2, *model1, tf2, tf1, request, *result);
@@ -1078,6 +1309,8 @@ class COAL_DLLAPI OcTreeShapeCollisionTraversalNode
     return false;
   }
 
+  bool leafTestsArePrimitiveTests() const { return false; }
+
   void leafCollides(unsigned int, unsigned int,
                     Scalar& sqrDistLowerBound) const {
     otsolver->OcTreeShapeIntersect(model1, *model2, tf1, tf2, request, *result);
@@ -1108,6 +1341,8 @@ class COAL_DLLAPI MeshOcTreeCollisionTraversalNode
 
   bool BVDisjoints(unsigned int, unsigned int, Scalar&) const { return false; }
 
+  bool leafTestsArePrimitiveTests() const { return false; }
+
   void leafCollides(unsigned int, unsigned int,
                     Scalar& sqrDistLowerBound) const {
     otsolver->OcTreeMeshIntersect(model2, model1, tf2, tf1, request, *result);
@@ -1138,6 +1373,8 @@ class COAL_DLLAPI OcTreeMeshCollisionTraversalNode
 
   bool BVDisjoints(unsigned int, unsigned int, Scalar&) const { return false; }
 
+  bool leafTestsArePrimitiveTests() const { return false; }
+
   void leafCollides(unsigned int, unsigned int,
                     Scalar& sqrDistLowerBound) const {
     otsolver->OcTreeMeshIntersect(model1, model2, tf1, tf2, request, *result);
@@ -1168,6 +1405,8 @@ class COAL_DLLAPI OcTreeHeightFieldCollisionTraversalNode
 
   bool BVDisjoints(unsigned int, unsigned int, Scalar&) const { return false; }
 
+  bool leafTestsArePrimitiveTests() const { return false; }
+
   void leafCollides(unsigned int, unsigned int,
                     Scalar& sqrDistLowerBound) const {
     otsolver->OcTreeHeightFieldIntersect(model1, model2, tf1, tf2, request,
@@ -1197,6 +1436,8 @@ class COAL_DLLAPI HeightFieldOcTreeCollisionTraversalNode
 
   bool BVDisjoints(unsigned int, unsigned int, Scalar&) const { return false; }
 
+  bool leafTestsArePrimitiveTests() const { return false; }
+
   void leafCollides(unsigned int, unsigned int,
                     Scalar& sqrDistLowerBound) const {
     otsolver->HeightFieldOcTreeIntersect(model1, model2, tf1, tf2, request,
@@ -1231,6 +1472,8 @@ class COAL_DLLAPI OcTreeDistanceTraversalNode
 
   bool BVDistanceLowerBound(unsigned, unsigned, Scalar&) const { return false; }
 
+  bool leafTestsArePrimitiveTests() const { return false; }
+
   void leafComputeDistance(unsigned, unsigned int) const {
     otsolver->OcTreeDistance(model1, model2, tf1, tf2, request, *result);
   }
@@ -1255,6 +1498,8 @@ class COAL_DLLAPI ShapeOcTreeDistanceTraversalNode
 
   Scalar BVDistanceLowerBound(unsigned int, unsigned int) const { return -1; }
 
+  bool leafTestsArePrimitiveTests() const { return false; }
+
   void leafComputeDistance(unsigned int, unsigned int) const {
     otsolver->OcTreeShapeDistance(model2, *model1, tf2, tf1, request, *result);
   }
@@ -1279,6 +1524,8 @@ class COAL_DLLAPI OcTreeShapeDistanceTraversalNode
 
   Scalar BVDistanceLowerBound(unsigned int, unsigned int) const { return -1; }
 
+  bool leafTestsArePrimitiveTests() const { return false; }
+
   void leafComputeDistance(unsigned int, unsigned int) const {
     otsolver->OcTreeShapeDistance(model1, *model2, tf1, tf2, request, *result);
   }
@@ -1303,6 +1550,8 @@ class COAL_DLLAPI MeshOcTreeDistanceTraversalNode
 
   Scalar BVDistanceLowerBound(unsigned int, unsigned int) const { return -1; }
 
+  bool leafTestsArePrimitiveTests() const { return false; }
+
   void leafComputeDistance(unsigned int, unsigned int) const {
     otsolver->OcTreeMeshDistance(model2, model1, tf2, tf1, request, *result);
   }
@@ -1327,6 +1576,8 @@ class COAL_DLLAPI OcTreeMeshDistanceTraversalNode
 
   Scalar BVDistanceLowerBound(unsigned int, unsigned int) const { return -1; }
 
+  bool leafTestsArePrimitiveTests() const { return false; }
+
   void leafComputeDistance(unsigned int, unsigned int) const {
     otsolver->OcTreeMeshDistance(model1, model2, tf1, tf2, request, *result);
   }
@@ -46,7 +46,7 @@
 #include "coal/internal/traversal_node_bvhs.h"
 #include "coal/internal/traversal_node_bvh_shape.h"
 
-// #include <hpp/fcl/internal/traversal_node_hfields.h>
+#include "coal/internal/traversal_node_hfields.h"
 #include "coal/internal/traversal_node_hfield_shape.h"
 
 #ifdef COAL_HAS_OCTOMAP
@@ -390,7 +390,10 @@ bool initialize(MeshShapeCollisionTraversalNode<BV, S, 0>& node,
   node.tf2 = tf2;
   node.nsolver = nsolver;
 
-  computeBV(model2, tf2, node.model2_bv);
+  if (details::ShapeBVInMeshFrame<BV>::value)
+    computeBV(model2, tf1.inverseTimes(tf2), node.model2_bv);
+  else
+    computeBV(model2, tf2, node.model2_bv);
 
   node.vertices = model1.vertices.get() ? model1.vertices->data() : NULL;
   node.tri_indices =
@@ -430,6 +433,54 @@ bool initialize(HeightFieldShapeCollisionTraversalNode<BV, S, 0>& node,
   return true;
 }
 
+/// @brief Initialize traversal node for collision between one height field
+/// and one mesh
+template <typename BV1, typename BV2>
+bool initialize(HeightFieldMeshCollisionTraversalNode<BV1, BV2>& node,
+                const HeightField<BV1>& model1, const Transform3s& tf1,
+                const BVHModel<BV2>& model2, const Transform3s& tf2,
+                const GJKSolver* nsolver, CollisionResult& result) {
+  if (model2.getModelType() != BVH_MODEL_TRIANGLES)
+    COAL_THROW_PRETTY(
+        "model2 should be of type BVHModelType::BVH_MODEL_TRIANGLES.",
+        std::invalid_argument)
+
+  node.model1 = &model1;
+  node.tf1 = tf1;
+  node.model2 = &model2;
+  node.tf2 = tf2;
+  node.nsolver = nsolver;
+
+  node.vertices2 = model2.vertices.get() ? model2.vertices->data() : NULL;
+  node.tri_indices2 =
+      model2.tri_indices.get() ? model2.tri_indices->data() : NULL;
+
+  node.tf = tf1.inverseTimes(tf2);
+
+  node.result = &result;
+
+  return true;
+}
+
+/// @brief Initialize traversal node for collision between two height fields
+template <typename BV1, typename BV2>
+bool initialize(HeightFieldCollisionTraversalNode<BV1, BV2>& node,
+                const HeightField<BV1>& model1, const Transform3s& tf1,
+                const HeightField<BV2>& model2, const Transform3s& tf2,
+                const GJKSolver* nsolver, CollisionResult& result) {
+  node.model1 = &model1;
+  node.tf1 = tf1;
+  node.model2 = &model2;
+  node.tf2 = tf2;
+  node.nsolver = nsolver;
+
+  node.tf = tf1.inverseTimes(tf2);
+
+  node.result = &result;
+
+  return true;
+}
+
 /// @cond IGNORE
 namespace details {
 template <typename S, typename BV, template <typename> class OrientedNode>
@@ -808,6 +859,63 @@ bool initialize(MeshShapeDistanceTraversalNodeOBBRSS<S>& node,
       node, model1, tf1, model2, tf2, nsolver, request, result);
 }
 
+/// @brief Initialize traversal node for distance computation between one
+/// height field and one mesh
+template <typename BV1, typename BV2>
+bool initialize(HeightFieldMeshDistanceTraversalNode<BV1, BV2>& node,
+                const HeightField<BV1>& model1, const Transform3s& tf1,
+                const BVHModel<BV2>& model2, const Transform3s& tf2,
+                const GJKSolver* nsolver, const DistanceRequest& request,
+                DistanceResult& result) {
+  if (model2.getModelType() != BVH_MODEL_TRIANGLES)
+    COAL_THROW_PRETTY(
+        "model2 should be of type BVHModelType::BVH_MODEL_TRIANGLES.",
+        std::invalid_argument)
+
+  node.request = request;
+  node.result = &result;
+  node.rel_err = request.rel_err;
+  node.abs_err = request.abs_err;
+
+  node.model1 = &model1;
+  node.tf1 = tf1;
+  node.model2 = &model2;
+  node.tf2 = tf2;
+  node.nsolver = nsolver;
+
+  node.vertices2 = model2.vertices.get() ? model2.vertices->data() : NULL;
+  node.tri_indices2 =
+      model2.tri_indices.get() ? model2.tri_indices->data() : NULL;
+
+  node.tf = tf1.inverseTimes(tf2);
+
+  return true;
+}
+
+/// @brief Initialize traversal node for distance computation between two
+/// height fields
+template <typename BV1, typename BV2>
+bool initialize(HeightFieldDistanceTraversalNode<BV1, BV2>& node,
+                const HeightField<BV1>& model1, const Transform3s& tf1,
+                const HeightField<BV2>& model2, const Transform3s& tf2,
+                const GJKSolver* nsolver, const DistanceRequest& request,
+                DistanceResult& result) {
+  node.request = request;
+  node.result = &result;
+  node.rel_err = request.rel_err;
+  node.abs_err = request.abs_err;
+
+  node.model1 = &model1;
+  node.tf1 = tf1;
+  node.model2 = &model2;
+  node.tf2 = tf2;
+  node.nsolver = nsolver;
+
+  node.tf = tf1.inverseTimes(tf2);
+
+  return true;
+}
+
 }  // namespace coal
 
 /// @endcond
@@ -0,0 +1,208 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef COAL_METRICS_H
+#define COAL_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "coal/collision_object.h"
+
+namespace coal {
+
+/// @brief Kind of query counted by the MetricsRegistry.
+enum MetricsQueryType {
+  COLLISION_METRICS,
+  DISTANCE_METRICS,
+  CONTACT_PATCH_METRICS,
+  METRICS_QUERY_TYPE_COUNT
+};
+
+/// @brief Call count, cumulative time and latency histogram of one entry of
+/// the collision, distance or contact patch function matrices.
+struct COAL_DLLAPI CallMetrics {
+  /// @brief Number of bins of the latency histogram. Bin 0 counts the calls
+  /// shorter than 1 microsecond, bin i the calls between 2^(i-1) and 2^i
+  /// microseconds, and the last bin all the longer calls.
+  static constexpr std::size_t num_histogram_bins = 16;
+
+  /// @brief Number of calls.
+  std::size_t num_calls;
+
+  /// @brief Total time spent in the calls, in microseconds.
+  double total_time;
+
+  /// @brief Latency histogram, see num_histogram_bins.
+  std::array<std::size_t, num_histogram_bins> histogram;
+
+  CallMetrics() : num_calls(0), total_time(0) { histogram.fill(0); }
+
+  /// @brief Mean time of a call, in microseconds.
+  double meanTime() const {
+    return num_calls > 0 ? total_time / static_cast<double>(num_calls) : 0;
+  }
+
+  /// @brief Upper bound of the latencies counted in a bin of the histogram,
+  /// in microseconds. It is infinite for the last bin.
+  static double binUpperBound(std::size_t bin);
+
+  /// @brief Bin of the histogram of a latency in microseconds.
+  static std::size_t bin(double time);
+};
+
+/// @brief Metrics of one pair of node types for one kind of query.
+struct COAL_DLLAPI CallMetricsEntry {
+  MetricsQueryType type;
+  NODE_TYPE node_type1;
+  NODE_TYPE node_type2;
+  CallMetrics metrics;
+};
+
+/// @brief Metrics of all the entries of the function matrices, as returned by
+/// MetricsRegistry::snapshot.
+///
+/// The node types are the ones of the entry of the function matrix which was
+/// called: a query between a shape and a BVH model is counted as a query
+/// between the BVH model and the shape.
+struct COAL_DLLAPI MetricsSnapshot {
+  MetricsSnapshot()
+      : calls(METRICS_QUERY_TYPE_COUNT * NODE_COUNT * NODE_COUNT) {}
+
+  const CallMetrics& get(MetricsQueryType type, NODE_TYPE node_type1,
+                         NODE_TYPE node_type2) const {
+    return calls[index(type, node_type1, node_type2)];
+  }
+
+  CallMetrics& get(MetricsQueryType type, NODE_TYPE node_type1,
+                   NODE_TYPE node_type2) {
+    return calls[index(type, node_type1, node_type2)];
+  }
+
+  /// @brief The entries which were called at least once, sorted by
+  /// decreasing total time.
+  std::vector<CallMetricsEntry> calledEntries() const;
+
+  /// @brief Metrics of each entry, see index.
+  std::vector<CallMetrics> calls;
+
+  static std::size_t index(MetricsQueryType type, NODE_TYPE node_type1,
+                           NODE_TYPE node_type2) {
+    return (static_cast<std::size_t>(type) * NODE_COUNT +
+            static_cast<std::size_t>(node_type1)) *
+               NODE_COUNT +
+           static_cast<std::size_t>(node_type2);
+  }
+};
+
+/// @brief Registry of the call counts, times and latency histograms of the
+/// entries of the collision, distance and contact patch function matrices.
+///
+/// Unlike the Tracy zones, these metrics need no profiler: they are collected
+/// once enabled with setEnabled, and can be read at any time with snapshot.
+/// Each thread accumulates its metrics in its own storage without locking. A
+/// mutex is only taken the first time a thread records a call, and by
+/// snapshot and reset.
+///
+/// Recording is disabled by default: timing a call costs about 100 ns, which
+/// is of the order of a query between two primitive shapes (see
+/// benchmark-metrics). When disabled, a call only reads an atomic flag.
+///
+/// \code
+///   MetricsRegistry::instance().setEnabled(true);
+///   // Queries...
+///   const MetricsSnapshot snapshot = MetricsRegistry::instance().snapshot();
+///   for (const CallMetricsEntry& entry : snapshot.calledEntries())
+///     std::cout << get_node_type_name(entry.node_type1) << " - "
+///               << get_node_type_name(entry.node_type2) << ": "
+///               << entry.metrics.total_time << " us" << std::endl;
+/// \endcode
+class COAL_DLLAPI MetricsRegistry {
+ public:
+  /// @brief The registry used by collide, distance and computeContactPatch.
+  static MetricsRegistry& instance();
+
+  ~MetricsRegistry();
+
+  /// @brief Enables or disables the recording of the calls. Disabled by
+  /// default.
+  void setEnabled(bool enabled) {
+    m_enabled.store(enabled, std::memory_order_relaxed);
+  }
+
+  bool isEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+  /// @brief Counts a call of the entry (node_type1, node_type2) of the
+  /// function matrix of a kind of query, which took time microseconds.
+  void record(MetricsQueryType type, NODE_TYPE node_type1,
+              NODE_TYPE node_type2, double time);
+
+  /// @brief Sum of the metrics of all the threads since the creation of the
+  /// registry or the last call to reset.
+  MetricsSnapshot snapshot() const;
+
+  /// @brief Restarts the metrics from zero.
+  void reset();
+
+  /// @brief Storage of the metrics of a thread.
+  struct ThreadMetrics;
+
+ private:
+  MetricsRegistry();
+  MetricsRegistry(const MetricsRegistry&) = delete;
+  MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+  /// @brief Sum of the metrics of all the threads. The mutex must be locked.
+  MetricsSnapshot accumulate() const;
+
+  /// @brief Storage of the calling thread, acquired on the first call.
+  ThreadMetrics& threadMetrics();
+
+  std::atomic<bool> m_enabled;
+  /// @brief Storages of the threads. The storage of a thread which exited is
+  /// reused by the next new thread.
+  std::vector<std::unique_ptr<ThreadMetrics> > m_threads;
+  /// @brief Metrics at the last call to reset, subtracted from the sums of
+  /// the threads.
+  MetricsSnapshot m_baseline;
+  mutable std::mutex m_mutex;
+};
+
+}  // namespace coal
+
+#endif
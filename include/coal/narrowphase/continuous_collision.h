@@ -0,0 +1,158 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COAL_NARROWPHASE_CONTINUOUS_COLLISION_H
+#define COAL_NARROWPHASE_CONTINUOUS_COLLISION_H
+
+#include "coal/collision_data.h"
+#include "coal/narrowphase/continuous_collision_object.h"
+
+namespace coal {
+
+/// @brief Request to the continuous collision algorithm.
+struct COAL_DLLAPI ContinuousCollisionRequest {
+  /// @brief maximum number of conservative advancement steps.
+  /// If the time of contact is not found after this number of steps, the
+  /// geometries are reported in collision at the last reached time, so that
+  /// the result stays conservative.
+  size_t num_max_iterations;
+
+  /// @brief distance below which the geometries are considered in contact.
+  /// It must be strictly positive for the conservative advancement to
+  /// terminate.
+  Scalar toc_err;
+
+  /// @brief request of the distance queries performed at each step.
+  /// To keep the advancement conservative, `rel_err` and `abs_err` should be
+  /// left to zero.
+  DistanceRequest distance_request;
+
+  ContinuousCollisionRequest(size_t num_max_iterations_ = 100,
+                             Scalar toc_err_ = Scalar(1e-4))
+      : num_max_iterations(num_max_iterations_), toc_err(toc_err_) {}
+
+  bool operator==(const ContinuousCollisionRequest& other) const {
+    return num_max_iterations == other.num_max_iterations &&
+           toc_err == other.toc_err &&
+           distance_request == other.distance_request;
+  }
+};
+
+/// @brief Result of the continuous collision algorithm.
+struct COAL_DLLAPI ContinuousCollisionResult {
+  /// @brief whether the geometries collide during the motion
+  bool is_collide;
+
+  /// @brief time of contact in [0, 1]. It is equal to 1 when the geometries do
+  /// not collide during the motion.
+  Scalar time_of_contact;
+
+  /// @brief placements of the geometries at the time of contact
+  Transform3s contact_tf1, contact_tf2;
+
+  /// @brief contact point in world frame at the time of contact (middle of the
+  /// nearest points of the geometries)
+  Vec3s contact_point;
+
+  /// @brief contact normal in world frame, pointing from the first geometry to
+  /// the second one
+  Vec3s normal;
+
+  /// @brief number of conservative advancement steps performed
+  size_t num_iterations;
+
+  ContinuousCollisionResult() { clear(); }
+
+  /// @brief clear the result
+  void clear() {
+    is_collide = false;
+    time_of_contact = Scalar(1);
+    contact_tf1.setIdentity();
+    contact_tf2.setIdentity();
+    contact_point.setZero();
+    normal.setZero();
+    num_iterations = 0;
+  }
+};
+
+/// @brief Continuous collision between two geometries moving between two
+/// placements (see interpolateTransform), computed by conservative
+/// advancement.
+///
+/// At each step, the distance d between the geometries is computed with the
+/// distance function of the pair (GJKSolver::shapeDistance for a pair of
+/// shapes, the BVH traversal for a BVH). No point of the geometries can get
+/// closer to the other geometry faster than
+///   mu = |(dT2 - dT1).n| + theta1 r1 + theta2 r2,
+/// where dTi is the translation of the motion, n the direction between the
+/// nearest points, thetai the rotation angle of the motion and ri the radius
+/// of the geometry around its origin. Time can thus safely be advanced by
+/// d / mu until d falls below ContinuousCollisionRequest::toc_err.
+///
+/// The local AABB of the geometries must be up to date (see
+/// CollisionGeometry::computeLocalAABB). The result is cleared before the
+/// query.
+///
+/// @return the time of contact, equal to 1 if there is no collision.
+COAL_DLLAPI Scalar continuousCollide(const CollisionGeometry* o1,
+                                     const Transform3s& tf1_beg,
+                                     const Transform3s& tf1_end,
+                                     const CollisionGeometry* o2,
+                                     const Transform3s& tf2_beg,
+                                     const Transform3s& tf2_end,
+                                     const ContinuousCollisionRequest& request,
+                                     ContinuousCollisionResult& result);
+
+/// @copydoc continuousCollide(const CollisionGeometry*, const Transform3s&,
+/// const Transform3s&, const CollisionGeometry*, const Transform3s&, const
+/// Transform3s&, const ContinuousCollisionRequest&,
+/// ContinuousCollisionResult&)
+COAL_DLLAPI Scalar continuousCollide(const ContinuousCollisionObject* o1,
+                                     const ContinuousCollisionObject* o2,
+                                     const ContinuousCollisionRequest& request,
+                                     ContinuousCollisionResult& result);
+
+/// @brief Continuous collision between a moving geometry and a geometry at a
+/// fixed placement.
+COAL_DLLAPI Scalar continuousCollide(const CollisionGeometry* o1,
+                                     const Transform3s& tf1_beg,
+                                     const Transform3s& tf1_end,
+                                     const CollisionGeometry* o2,
+                                     const Transform3s& tf2,
+                                     const ContinuousCollisionRequest& request,
+                                     ContinuousCollisionResult& result);
+
+}  // namespace coal
+
+#endif
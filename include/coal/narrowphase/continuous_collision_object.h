@@ -0,0 +1,181 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COAL_NARROWPHASE_CONTINUOUS_COLLISION_OBJECT_H
+#define COAL_NARROWPHASE_CONTINUOUS_COLLISION_OBJECT_H
+
+#include "coal/collision_object.h"
+
+namespace coal {
+
+/// @brief Interpolates between two placements: the translation is linearly
+/// interpolated and the rotation follows the shortest geodesic (slerp).
+///
+/// @param[in] tf_beg placement at t = 0.
+/// @param[in] tf_end placement at t = 1.
+/// @param[in] t interpolation parameter in [0, 1].
+inline Transform3s interpolateTransform(const Transform3s& tf_beg,
+                                        const Transform3s& tf_end, Scalar t) {
+  const Quats q_beg(tf_beg.getQuatRotation());
+  const Quats q_end(tf_end.getQuatRotation());
+  return Transform3s(q_beg.slerp(t, q_end),
+                     tf_beg.getTranslation() +
+                         t * (tf_end.getTranslation() -
+                              tf_beg.getTranslation()));
+}
+
+/// @brief Radius of the smallest sphere centered at the origin of the
+/// geometry frame which contains the local AABB.
+inline Scalar boundingRadiusAroundOrigin(const AABB& aabb_local) {
+  return aabb_local.min_.cwiseAbs().cwiseMax(aabb_local.max_.cwiseAbs()).norm();
+}
+
+/// @brief The object for continuous collision checking: a collision geometry
+/// moving between two placements during a time step.
+///
+/// The motion is parameterized by t in [0, 1]. The translation is linearly
+/// interpolated and the rotation follows the shortest geodesic between the
+/// two placements (see interpolateTransform).
+class COAL_DLLAPI ContinuousCollisionObject {
+ public:
+  ContinuousCollisionObject(const shared_ptr<CollisionGeometry>& cgeom_,
+                            bool compute_local_aabb = true)
+      : cgeom(cgeom_), user_data(nullptr) {
+    init(compute_local_aabb);
+  }
+
+  ContinuousCollisionObject(const shared_ptr<CollisionGeometry>& cgeom_,
+                            const Transform3s& tf_beg_,
+                            const Transform3s& tf_end_,
+                            bool compute_local_aabb = true)
+      : cgeom(cgeom_), tf_beg(tf_beg_), tf_end(tf_end_), user_data(nullptr) {
+    init(compute_local_aabb);
+  }
+
+  bool operator==(const ContinuousCollisionObject& other) const {
+    return cgeom == other.cgeom && tf_beg == other.tf_beg &&
+           tf_end == other.tf_end && user_data == other.user_data;
+  }
+
+  bool operator!=(const ContinuousCollisionObject& other) const {
+    return !(*this == other);
+  }
+
+  ~ContinuousCollisionObject() {}
+
+  /// @brief get the type of the object
+  OBJECT_TYPE getObjectType() const { return cgeom->getObjectType(); }
+
+  /// @brief get the node type
+  NODE_TYPE getNodeType() const { return cgeom->getNodeType(); }
+
+  /// @brief get the AABB in world space of the whole motion
+  const AABB& getAABB() const { return aabb; }
+
+  /// @brief get the AABB in world space of the whole motion
+  AABB& getAABB() { return aabb; }
+
+  /// @brief compute the AABB in world space which bounds the geometry during
+  /// the whole motion.
+  ///
+  /// For a pure translation, it is the union of the AABBs at both placements.
+  /// Otherwise, each point of the geometry stays in the sphere centered at
+  /// the (linearly interpolated) origin of the geometry and of radius
+  /// boundingRadiusAroundOrigin, and the AABB bounds the two extreme spheres.
+  void computeAABB();
+
+  /// @brief get user data in object
+  void* getUserData() const { return user_data; }
+
+  /// @brief set user data in object
+  void setUserData(void* data) { user_data = data; }
+
+  /// @brief get the placement of the object at the beginning of the motion
+  inline const Transform3s& getStartTransform() const { return tf_beg; }
+
+  /// @brief get the placement of the object at the end of the motion
+  inline const Transform3s& getEndTransform() const { return tf_end; }
+
+  /// @brief get the placement of the object at time t in [0, 1]
+  inline Transform3s getTransform(Scalar t) const {
+    return interpolateTransform(tf_beg, tf_end, t);
+  }
+
+  /// @brief set the motion of the object and update its AABB.
+  void setMotion(const Transform3s& tf_beg_, const Transform3s& tf_end_) {
+    tf_beg = tf_beg_;
+    tf_end = tf_end_;
+    if (cgeom) computeAABB();
+  }
+
+  /// @brief get shared pointer to collision geometry of the object instance
+  const shared_ptr<const CollisionGeometry> collisionGeometry() const {
+    return cgeom;
+  }
+
+  /// @brief get shared pointer to collision geometry of the object instance
+  const shared_ptr<CollisionGeometry>& collisionGeometry() { return cgeom; }
+
+  /// @brief get raw pointer to collision geometry of the object instance
+  const CollisionGeometry* collisionGeometryPtr() const { return cgeom.get(); }
+
+  /// @brief get raw pointer to collision geometry of the object instance
+  CollisionGeometry* collisionGeometryPtr() { return cgeom.get(); }
+
+ protected:
+  void init(bool compute_local_aabb = true) {
+    if (cgeom) {
+      if (compute_local_aabb) cgeom->computeLocalAABB();
+      computeAABB();
+    }
+  }
+
+  shared_ptr<CollisionGeometry> cgeom;
+
+  /// @brief placements at the beginning and at the end of the motion
+  Transform3s tf_beg, tf_end;
+
+  /// @brief AABB in global coordinate of the whole motion
+  AABB aabb;
+
+  /// @brief pointer to user defined data specific to this object
+  void* user_data;
+
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+}  // namespace coal
+
+#endif
@@ -157,6 +157,18 @@ struct COAL_DLLAPI GJK {
       const MinkowskiDiff& shape, const Vec3ps& guess,
       const support_func_guess_t& supportHint = support_func_guess_t::Zero());
 
+  /// @brief Same as @ref evaluate(const MinkowskiDiff&, const Vec3ps&, const
+  /// support_func_guess_t&), with the support function of the Minkowski
+  /// difference known at compile time. It is inlined in the iterations of
+  /// GJK instead of being called through `MinkowskiDiff::getSupportFunc`.
+  /// @tparam GetSupportFunc the support function that `shape.set` selected,
+  /// i.e. an instance of @ref getSupportFuncTpl. The library instantiates
+  /// it for the pairs of shapes listed by @ref HasSpecializedGJK.
+  template <MinkowskiDiff::GetSupportFunction GetSupportFunc>
+  Status evaluate(
+      const MinkowskiDiff& shape, const Vec3ps& guess,
+      const support_func_guess_t& supportHint = support_func_guess_t::Zero());
+
   /// @brief apply the support function along a direction, the result is return
   /// in sv
   inline void getSupport(const Vec3ps& d, SimplexV& sv,
@@ -168,6 +180,19 @@ struct COAL_DLLAPI GJK {
     sv.w = sv.w0 - sv.w1;
   }
 
+  /// @brief Same as @ref getSupport, with the support function of the
+  /// Minkowski difference known at compile time.
+  template <MinkowskiDiff::GetSupportFunction GetSupportFunc>
+  inline void getSupport(const Vec3ps& d, SimplexV& sv,
+                         support_func_guess_t& hint) const {
+    Vec3s w0, w1;
+    GetSupportFunc(*shape, d.cast<Scalar>(), w0, w1, hint,
+                   const_cast<ShapeSupportData*>(shape->data));
+    sv.w0 = w0.cast<SolverScalar>();
+    sv.w1 = w1.cast<SolverScalar>();
+    sv.w = sv.w0 - sv.w1;
+  }
+
   /// @brief whether the simplex enclose the origin
   bool encloseOrigin();
 
@@ -231,6 +256,12 @@ struct COAL_DLLAPI GJK {
   inline void appendVertex(Simplex& simplex, const Vec3ps& v,
                            support_func_guess_t& hint);
 
+  /// @brief Same as @ref appendVertex, with the support function of the
+  /// Minkowski difference known at compile time.
+  template <MinkowskiDiff::GetSupportFunction GetSupportFunc>
+  inline void appendVertex(Simplex& simplex, const Vec3ps& v,
+                           support_func_guess_t& hint);
+
   /// @brief Project origin (0) onto line a-b
   /// For a detailed explanation of how to efficiently project onto a simplex,
   /// check out Ericson's book, page 403:
@@ -414,6 +445,12 @@ struct COAL_DLLAPI EPA {
   ///         status
   Status evaluate(GJK& gjk, const Vec3ps& guess);
 
+  /// @brief Same as @ref evaluate(GJK&, const Vec3ps&), with the support
+  /// function of the Minkowski difference known at compile time, see
+  /// @ref GJK::evaluate.
+  template <MinkowskiDiff::GetSupportFunction GetSupportFunc>
+  Status evaluate(GJK& gjk, const Vec3ps& guess);
+
   /// Get the witness points on each object, and the corresponding normal.
   /// @param[in] shape is the Minkowski difference of the two shapes.
   /// @param[out] w0 is the witness point on shape0.
@@ -450,6 +487,110 @@ struct COAL_DLLAPI EPA {
   // void PrintExpandLooping(const SimplexFace* f, const SimplexVertex& w);
 };
 
+/// @brief Whether a shape is one of the primitive shapes for which the
+/// library instantiates GJK and EPA with a support function known at compile
+/// time: triangle, box, sphere, ellipsoid, capsule, cone and cylinder.
+template <typename Shape>
+struct IsGJKPrimitive {
+  enum { value = false };
+};
+template <>
+struct IsGJKPrimitive<TriangleP> {
+  enum { value = true };
+};
+template <>
+struct IsGJKPrimitive<Box> {
+  enum { value = true };
+};
+template <>
+struct IsGJKPrimitive<Sphere> {
+  enum { value = true };
+};
+template <>
+struct IsGJKPrimitive<Ellipsoid> {
+  enum { value = true };
+};
+template <>
+struct IsGJKPrimitive<Capsule> {
+  enum { value = true };
+};
+template <>
+struct IsGJKPrimitive<Cone> {
+  enum { value = true };
+};
+template <>
+struct IsGJKPrimitive<Cylinder> {
+  enum { value = true };
+};
+
+/// @brief Whether the library instantiates @ref GJK::evaluate and @ref
+/// EPA::evaluate with the support function of a MinkowskiDiff of a Shape0 and
+/// a Shape1 (see @ref getSupportFuncTpl).
+/// It is the case for the pairs of primitive shapes, when the support
+/// function ignores the swept-sphere radii, as in @ref GJKSolver.
+template <typename Shape0, typename Shape1, int _SupportOptions>
+struct HasSpecializedGJK {
+  enum {
+    value = IsGJKPrimitive<Shape0>::value && IsGJKPrimitive<Shape1>::value &&
+            _SupportOptions == SupportOptions::NoSweptSphere
+  };
+};
+
+/// @brief Runs GJK and EPA on a MinkowskiDiff of a Shape0 and a Shape1 set
+/// with `MinkowskiDiff::set<_SupportOptions>`.
+/// This generic version calls the support function through
+/// `MinkowskiDiff::getSupportFunc`. The specialization for the pairs listed
+/// by @ref HasSpecializedGJK uses the instantiations of GJK and EPA for this
+/// pair, in which the support function is inlined.
+template <typename Shape0, typename Shape1, int _SupportOptions,
+          bool Specialized =
+              HasSpecializedGJK<Shape0, Shape1, _SupportOptions>::value>
+struct GJKAndEPAEvaluator {
+  /// @param transform_is_identity whether `shape.set` was called without the
+  /// transformations of the shapes.
+  static GJK::Status evaluate(GJK& gjk, const MinkowskiDiff& shape,
+                              const Vec3ps& guess,
+                              const support_func_guess_t& support_hint,
+                              bool /*transform_is_identity*/) {
+    return gjk.evaluate(shape, guess, support_hint);
+  }
+
+  static EPA::Status evaluate(EPA& epa, GJK& gjk, const Vec3ps& guess,
+                              bool /*transform_is_identity*/) {
+    return epa.evaluate(gjk, guess);
+  }
+};
+
+template <typename Shape0, typename Shape1, int _SupportOptions>
+struct GJKAndEPAEvaluator<Shape0, Shape1, _SupportOptions, true> {
+  static GJK::Status evaluate(GJK& gjk, const MinkowskiDiff& shape,
+                              const Vec3ps& guess,
+                              const support_func_guess_t& support_hint,
+                              bool transform_is_identity) {
+    // When `set` is given the transformations of the shapes, it selects the
+    // support function for an identity transformation if the shapes have the
+    // same pose. The general one gives the same supports in this case.
+    if (transform_is_identity)
+      return gjk.evaluate<
+          getSupportFuncTpl<Shape0, Shape1, true, _SupportOptions> >(
+          shape, guess, support_hint);
+    return gjk.evaluate<
+        getSupportFuncTpl<Shape0, Shape1, false, _SupportOptions> >(
+        shape, guess, support_hint);
+  }
+
+  static EPA::Status evaluate(EPA& epa, GJK& gjk, const Vec3ps& guess,
+                              bool transform_is_identity) {
+    if (transform_is_identity)
+      return epa.evaluate<
+          getSupportFuncTpl<Shape0, Shape1, true, _SupportOptions> >(gjk,
+                                                                     guess);
+    return epa.evaluate<
+        getSupportFuncTpl<Shape0, Shape1, false, _SupportOptions> >(gjk,
+                                                                    guess);
+  }
+};
+
 }  // namespace details
 
 }  // namespace coal
@@ -0,0 +1,153 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of INRIA nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COAL_NARROWPHASE_GJK_BATCH_H
+#define COAL_NARROWPHASE_GJK_BATCH_H
+
+#include <limits>
+
+#include "coal/narrowphase/gjk.h"
+
+namespace coal {
+
+namespace details {
+
+/// @brief Number of GJK problems solved together by @ref BatchGJK.
+/// A lane holds a double: 4 lanes fill an AVX register. The number of lanes
+/// does not depend on the instruction set enabled by the compiler flags, so
+/// that the layout of @ref BatchGJK is the same in the library and in the
+/// code which includes this header.
+constexpr int GJK_BATCH_LANES = 4;
+
+/// @brief One scalar per lane.
+typedef Eigen::Array<SolverScalar, GJK_BATCH_LANES, 1> GJKLaneScalar;
+/// @brief One 3d vector per lane; each column is a coordinate.
+typedef Eigen::Array<SolverScalar, GJK_BATCH_LANES, 3> GJKLaneVec3;
+
+/// @brief GJK on @ref GJK_BATCH_LANES independent problems involving the same
+/// pair of shapes, at different relative poses.
+///
+/// The problems are solved in lockstep: each iteration computes the supports
+/// of all the lanes at once, in loops over the lanes which the compiler
+/// vectorizes, then tests the convergence of each lane and updates its
+/// simplex. A lane stops when its own problem has converged; the others carry
+/// on.
+///
+/// This is the default variant of GJK (see @ref GJKVariant) with the default
+/// convergence criterion (see @ref GJKConvergenceCriterion). The lanes in
+/// which the shapes are found in collision end with status GJK::Collision:
+/// the penetration depth requires EPA, which is not batched. So do the lanes
+/// which ran into a numerical issue, with status GJK::Failed. @ref GJKSolver
+/// runs the scalar GJK and EPA on them.
+///
+/// It is instantiated for the pairs of primitive shapes, see @ref
+/// HasBatchGJK.
+template <typename Shape0, typename Shape1>
+struct COAL_DLLAPI BatchGJK {
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  enum { Lanes = GJK_BATCH_LANES };
+
+  /// @brief Maximum number of iterations of each lane.
+  size_t max_iterations;
+
+  /// @brief Tolerance of GJK, see GJK::getTolerance.
+  SolverScalar tolerance;
+
+  /// @brief The lanes stop as soon as the distance is proven to be above
+  /// this value, see GJK::setDistanceEarlyBreak.
+  SolverScalar distance_upper_bound;
+
+  /// @brief Status of each lane, after @ref evaluate.
+  GJK::Status status[GJK_BATCH_LANES];
+
+  /// @brief Distance between the shapes, swept-sphere radii included, when
+  /// the status is GJK::NoCollision, GJK::NoCollisionEarlyStopped or
+  /// GJK::CollisionWithPenetrationInformation.
+  GJKLaneScalar distance;
+
+  /// @brief Current approximation of the closest point of the Minkowski
+  /// difference to the origin, in the frame of Shape0.
+  GJKLaneVec3 ray;
+
+  /// @brief Number of iterations of each lane.
+  Eigen::Array<int, GJK_BATCH_LANES, 1> iterations;
+
+  BatchGJK(size_t max_iterations_, SolverScalar tolerance_)
+      : max_iterations(max_iterations_),
+        tolerance(tolerance_),
+        distance_upper_bound((std::numeric_limits<SolverScalar>::max)()) {}
+
+  /// @brief Runs GJK on `num_lanes` problems.
+  /// @param shape0, shape1 the shapes.
+  /// @param oM1 the pose of shape1 in the frame of shape0, for each problem.
+  /// @param guesses the initial guess of each problem.
+  /// @param num_lanes the number of problems, at most @ref GJK_BATCH_LANES.
+  /// The remaining lanes are left with status GJK::DidNotRun.
+  void evaluate(const Shape0& shape0, const Shape1& shape1,
+                const Transform3s* oM1, const Vec3ps* guesses, int num_lanes);
+
+  /// @brief Witness points and normal of a lane, in the frame of Shape0.
+  /// Same as GJK::getWitnessPointsAndNormal.
+  void getWitnessPointsAndNormal(int lane, Vec3ps& w0, Vec3ps& w1,
+                                 Vec3ps& normal) const;
+
+ private:
+  /// @brief Vertices of the simplex of each lane: the support points of the
+  /// Minkowski difference and of the two shapes.
+  Vec3ps w[GJK_BATCH_LANES][4], w0[GJK_BATCH_LANES][4], w1[GJK_BATCH_LANES][4];
+
+  /// @brief Barycentric coordinates of @ref ray in the simplex of each lane.
+  SolverScalar lambda[GJK_BATCH_LANES][4];
+
+  /// @brief Number of vertices of the simplex of each lane.
+  int rank[GJK_BATCH_LANES];
+
+  /// @brief Swept-sphere radii of the shapes, which the supports ignore.
+  SolverScalar swept_sphere_radius[2];
+};
+
+/// @brief Whether @ref BatchGJK is instantiated for a Shape0 and a Shape1.
+template <typename Shape0, typename Shape1>
+struct HasBatchGJK {
+  enum {
+    value = IsGJKPrimitive<Shape0>::value && IsGJKPrimitive<Shape1>::value
+  };
+};
+
+}  // namespace details
+
+}  // namespace coal
+
+#endif  // COAL_NARROWPHASE_GJK_BATCH_H
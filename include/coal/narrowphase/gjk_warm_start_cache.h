@@ -0,0 +1,170 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COAL_NARROWPHASE_GJK_WARM_START_CACHE_H
+#define COAL_NARROWPHASE_GJK_WARM_START_CACHE_H
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "coal/data_types.h"
+
+namespace coal {
+
+/// @brief Persistent cache of GJK warm starts, keyed by pair of objects.
+///
+/// Warm starting GJK with the separating direction and the support hints of
+/// the previous query on the same pair of objects greatly reduces the number
+/// of GJK iterations when the objects move smoothly between two queries.
+/// QueryRequest::cached_gjk_guess lets the caller carry this warm start by
+/// hand. This cache stores it automatically, for each pair of shapes.
+///
+/// Pairs involving a BVH model, a height field or an octree are not cached:
+/// their traversal runs GJK on many pairs of primitives, which converge in a
+/// few iterations anyway, and one lookup per pair of primitives would cost
+/// more than it saves.
+///
+/// The memory is bounded: when the cache holds \ref capacity entries, the
+/// least recently used entry is evicted. The cache can be shared between
+/// threads.
+///
+/// \code
+///   GJKWarmStartCache cache;
+///   // At each frame:
+///   collide(o1, o2, request, result, cache);
+/// \endcode
+class COAL_DLLAPI GJKWarmStartCache {
+ public:
+  /// @brief Key of an entry: the pair of objects as seen by the narrow phase
+  /// solver.
+  struct Key {
+    const void* o1;
+    const void* o2;
+
+    bool operator==(const Key& other) const {
+      return o1 == other.o1 && o2 == other.o2;
+    }
+  };
+
+  struct KeyHash {
+    std::size_t operator()(const Key& key) const;
+  };
+
+  /// @brief Warm start of GJK: initial direction and support hints.
+  struct Entry {
+    Key key;
+    Vec3s guess;
+    support_func_guess_t support_hint;
+  };
+
+  /// @brief Statistics on the use of the cache.
+  struct Statistics {
+    /// @brief number of successful lookups
+    std::size_t num_hits;
+    /// @brief number of lookups which did not find an entry
+    std::size_t num_misses;
+    /// @brief number of entries evicted to bound the memory
+    std::size_t num_evictions;
+    /// @brief total number of GJK iterations of the queries using the cache
+    std::size_t num_gjk_iterations;
+    /// @brief number of GJK runs using the cache
+    std::size_t num_gjk_calls;
+
+    Statistics()
+        : num_hits(0),
+          num_misses(0),
+          num_evictions(0),
+          num_gjk_iterations(0),
+          num_gjk_calls(0) {}
+  };
+
+  /// @param capacity maximum number of entries. A null capacity disables the
+  /// warm start but keeps the statistics up to date.
+  explicit GJKWarmStartCache(std::size_t capacity = 65536)
+      : m_capacity(capacity) {}
+
+  /// @brief Looks up the warm start of a pair and marks it as the most
+  /// recently used entry.
+  /// @return whether an entry was found. Otherwise, guess and support_hint are
+  /// not modified.
+  bool find(const Key& key, Vec3s& guess, support_func_guess_t& support_hint);
+
+  /// @brief Stores the warm start of a pair, evicting the least recently used
+  /// entry if the cache is full.
+  /// @param num_gjk_iterations number of iterations of the GJK run which
+  /// produced this warm start, accumulated in the statistics.
+  void insert(const Key& key, const Vec3s& guess,
+              const support_func_guess_t& support_hint,
+              std::size_t num_gjk_iterations = 0);
+
+  /// @brief Removes the entries of the pairs involving obj, e.g. when the
+  /// object is destroyed.
+  void erase(const void* obj);
+
+  /// @brief Removes all the entries. The statistics are kept.
+  void clear();
+
+  /// @brief Number of entries in the cache.
+  std::size_t size() const;
+
+  /// @brief Maximum number of entries.
+  std::size_t capacity() const;
+
+  /// @brief Changes the maximum number of entries, evicting the least recently
+  /// used entries if needed.
+  void setCapacity(std::size_t capacity);
+
+  /// @brief Statistics since the creation of the cache or the last call to
+  /// resetStatistics.
+  Statistics getStatistics() const;
+
+  void resetStatistics();
+
+ private:
+  typedef std::list<Entry> EntryList;
+
+  void evict(std::size_t capacity);
+
+  std::size_t m_capacity;
+  /// @brief Entries, from the most to the least recently used.
+  EntryList m_entries;
+  std::unordered_map<Key, EntryList::iterator, KeyHash> m_index;
+  Statistics m_statistics;
+  mutable std::mutex m_mutex;
+};
+
+}  // namespace coal
+
+#endif
@@ -177,8 +177,49 @@ struct COAL_DLLAPI MinkowskiDiff {
     getSupportFunc(*this, dir, supp0, supp1, hint,
                    const_cast<ShapeSupportData*>(data));
   }
+
+  /// @brief Same as @ref support, with the types of the shapes known at
+  /// compile time instead of calling `getSupportFunc`.
+  /// @tparam Shape0, Shape1 the types of `shapes[0]` and `shapes[1]`.
+  /// @tparam TransformIsIdentity whether `set` was called without the
+  /// transformations of the shapes.
+  /// @note The definitions of the support functions of the shapes must be
+  /// visible (see coal/narrowphase/support_functions.hxx) for them to be
+  /// inlined.
+  template <typename Shape0, typename Shape1, bool TransformIsIdentity,
+            int _SupportOptions = SupportOptions::NoSweptSphere>
+  inline void support(const Vec3s& dir, Vec3s& supp0, Vec3s& supp1,
+                      support_func_guess_t& hint) const {
+    assert(dir.norm() > Eigen::NumTraits<Scalar>::epsilon());
+    ShapeSupportData* data_ = const_cast<ShapeSupportData*>(data);
+    getShapeSupport<_SupportOptions>(static_cast<const Shape0*>(shapes[0]),
+                                     dir, supp0, hint[0], data_[0]);
+    if (TransformIsIdentity) {
+      getShapeSupport<_SupportOptions>(static_cast<const Shape1*>(shapes[1]),
+                                       -dir, supp1, hint[1], data_[1]);
+    } else {
+      getShapeSupport<_SupportOptions>(static_cast<const Shape1*>(shapes[1]),
+                                       -oR1.transpose() * dir, supp1, hint[1],
+                                       data_[1]);
+      supp1 = oR1 * supp1 + ot1;
+    }
+  }
 };
 
+/// @brief The support function of a MinkowskiDiff of a Shape0 and a Shape1,
+/// which `MinkowskiDiff::set` stores in `getSupportFunc`.
+/// It is also a template argument of @ref GJK::evaluate and
+/// @ref EPA::evaluate, which then call it directly.
+template <typename Shape0, typename Shape1, bool TransformIsIdentity,
+          int _SupportOptions>
+void getSupportFuncTpl(const MinkowskiDiff& md, const Vec3s& dir,
+                       Vec3s& support0, Vec3s& support1,
+                       support_func_guess_t& hint,
+                       ShapeSupportData* /*unused*/) {
+  md.support<Shape0, Shape1, TransformIsIdentity, _SupportOptions>(
+      dir, support0, support1, hint);
+}
+
 }  // namespace details
 
 }  // namespace coal
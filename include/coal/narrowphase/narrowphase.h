@@ -40,11 +40,17 @@
 #ifndef COAL_NARROWPHASE_H
 #define COAL_NARROWPHASE_H
 
+#include <algorithm>
 #include <limits>
+#include <type_traits>
+#include <vector>
 
 #include "coal/narrowphase/gjk.h"
+#include "coal/narrowphase/gjk_batch.h"
 #include "coal/collision_data.h"
 #include "coal/narrowphase/narrowphase_defaults.h"
+#include "coal/narrowphase/gjk_warm_start_cache.h"
+#include "coal/BVH/BVH_front.h"
 #include "coal/logging.h"
 
 namespace coal {
@@ -81,6 +87,31 @@ struct COAL_DLLAPI GJKSolver {
   /// @brief smart guess for the support function
   mutable support_func_guess_t support_func_cached_guess;
 
+  /// @brief Optional persistent cache of warm starts (not owned).
+  /// When set, the queries warm start GJK from the cache entry of the pair
+  /// (see loadWarmStart) and store the result back (see storeWarmStart).
+  GJKWarmStartCache* warm_start_cache{nullptr};
+
+  /// @brief Objects of the pair being queried, used as the keys of
+  /// warm_start_cache.
+  const void* warm_start_objects[2]{nullptr, nullptr};
+
+  /// @brief Optional statistics (not owned) to which the runs of GJK and EPA
+  /// are reported, see QueryRequest::enable_statistics.
+  mutable QueryStatistics* statistics{nullptr};
+
+  /// @brief Whether the batch `shapeDistance` runs details::BatchGJK on the
+  /// pairs of primitive shapes. Off by default: the lanes of a group run in
+  /// lockstep until the slowest one converges, which is slower than the
+  /// scalar GJK on unrelated poses (0.73x to 1.08x on random poses, see
+  /// benchmark-gjk-batch). It pays off on poses close to each other, e.g.
+  /// along a trajectory (up to 1.8x).
+  bool enable_batch_gjk{false};
+
+  /// @brief Optional persistent front list (not owned) from which the
+  /// traversals of the hierarchies restart, see TraversalFrontCache.
+  BVHFrontList* front_list{nullptr};
+
   /// @brief If GJK can guarantee that the distance between the shapes is
   /// greater than this value, it will early stop.
   Scalar distance_upper_bound;
@@ -246,6 +277,45 @@ struct COAL_DLLAPI GJKSolver {
   /// @brief Copy constructor
   GJKSolver(const GJKSolver& other) = default;
 
+  /// @brief Attaches a persistent cache of warm starts for the queries between
+  /// objects o1 and o2 (see GJKWarmStartCache). The initial guess of GJK is
+  /// then always the cached one.
+  void setWarmStartCache(GJKWarmStartCache* cache, const void* o1,
+                         const void* o2) {
+    this->warm_start_cache = cache;
+    this->warm_start_objects[0] = o1;
+    this->warm_start_objects[1] = o2;
+    if (cache != nullptr)
+      this->gjk_initial_guess = GJKInitialGuess::CachedGuess;
+  }
+
+  /// @brief Warm starts the next GJK call with the entry of warm_start_cache
+  /// for warm_start_objects, if any.
+  void loadWarmStart() const {
+    if (this->warm_start_cache == nullptr) return;
+    // Lets storeWarmStart know whether GJK has run since this call.
+    this->gjk.status = details::GJK::Status::DidNotRun;
+    const GJKWarmStartCache::Key key = {this->warm_start_objects[0],
+                                        this->warm_start_objects[1]};
+    this->warm_start_cache->find(key, this->cached_guess,
+                                 this->support_func_cached_guess);
+  }
+
+  /// @brief Stores the warm start computed by the last GJK call in
+  /// warm_start_cache. Nothing is stored if GJK did not run since the last
+  /// call to loadWarmStart (e.g. for the pairs of shapes with an analytic
+  /// solution).
+  void storeWarmStart() const {
+    if (this->warm_start_cache == nullptr ||
+        this->gjk.status == details::GJK::Status::DidNotRun)
+      return;
+    const GJKWarmStartCache::Key key = {this->warm_start_objects[0],
+                                        this->warm_start_objects[1]};
+    this->warm_start_cache->insert(key, this->cached_guess,
+                                   this->support_func_cached_guess,
+                                   this->gjk.getNumIterations());
+  }
+
   COAL_COMPILER_DIAGNOSTIC_PUSH
   COAL_COMPILER_DIAGNOSTIC_IGNORED_DEPRECECATED_DECLARATIONS
   bool operator==(const GJKSolver& other) const {
@@ -261,6 +331,7 @@ struct COAL_DLLAPI GJKSolver {
            this->gjk_convergence_criterion_type ==
                other.gjk_convergence_criterion_type &&
            this->gjk_initial_guess == other.gjk_initial_guess &&
+           this->enable_batch_gjk == other.enable_batch_gjk &&
            this->epa_max_iterations == other.epa_max_iterations &&
            this->epa_tolerance == other.epa_tolerance;
   }
@@ -347,6 +418,52 @@ struct COAL_DLLAPI GJKSolver {
     return distance;
   }
 
+  /// @brief Batch version of `shapeDistance`: the distances between `s1` at
+  /// `tf1` and `s2` at each of the poses `tfs2`, e.g. between a gripper and
+  /// the candidate poses of an object.
+  ///
+  /// When `enable_batch_gjk` is set, for the pairs of primitive shapes (see
+  /// details::HasBatchGJK), with the default GJK variant and convergence
+  /// criterion, the poses are processed by groups of
+  /// details::GJK_BATCH_LANES, in lockstep (see details::BatchGJK). The poses
+  /// for which the shapes are in collision then go through the scalar GJK and
+  /// EPA, as do all the poses otherwise.
+  ///
+  /// @param[out] `distances`, `p1s`, `p2s`, `normals` the outputs of
+  /// `shapeDistance` for each pose. They are resized to the number of poses.
+  ///
+  /// @note: `this->gjk.status` and `this->epa.status` only relate to the last
+  /// pose which went through the scalar GJK.
+  template <typename S1, typename S2>
+  void shapeDistance(const S1& s1, const Transform3s& tf1, const S2& s2,
+                     const std::vector<Transform3s>& tfs2,
+                     const bool compute_penetration,
+                     std::vector<Scalar>& distances, std::vector<Vec3s>& p1s,
+                     std::vector<Vec3s>& p2s,
+                     std::vector<Vec3s>& normals) const {
+    const size_t n = tfs2.size();
+    distances.resize(n);
+    p1s.resize(n);
+    p2s.resize(n);
+    normals.resize(n);
+    if (n == 0) return;
+
+    typedef std::integral_constant<bool, details::HasBatchGJK<S1, S2>::value>
+        HasBatchGJK;
+    if (HasBatchGJK::value && this->enable_batch_gjk &&
+        this->gjk_variant == GJKVariant::DefaultGJK &&
+        this->gjk_convergence_criterion == GJKConvergenceCriterion::Default) {
+      this->batchShapeDistance(s1, tf1, s2, tfs2, compute_penetration,
+                               distances, p1s, p2s, normals, HasBatchGJK());
+      return;
+    }
+    for (size_t i = 0; i < n; ++i) {
+      distances[i] = this->shapeDistance<S1, S2>(s1, tf1, s2, tfs2[i],
+                                                 compute_penetration, p1s[i],
+                                                 p2s[i], normals[i]);
+    }
+  }
+
  protected:
   /// @brief initialize GJK.
   /// This method assumes `minkowski_difference` has been set.
@@ -390,6 +507,90 @@ struct COAL_DLLAPI GJKSolver {
     COAL_COMPILER_DIAGNOSTIC_POP
   }
 
+  /// @brief Batch `shapeDistance` with details::BatchGJK.
+  template <typename S1, typename S2>
+  void batchShapeDistance(const S1& s1, const Transform3s& tf1, const S2& s2,
+                          const std::vector<Transform3s>& tfs2,
+                          const bool compute_penetration,
+                          std::vector<Scalar>& distances,
+                          std::vector<Vec3s>& p1s, std::vector<Vec3s>& p2s,
+                          std::vector<Vec3s>& normals,
+                          std::true_type /*has_batch_gjk*/) const {
+    const int lanes = details::GJK_BATCH_LANES;
+    details::BatchGJK<S1, S2> batch(this->gjk_max_iterations,
+                                    SolverScalar(this->gjk_tolerance));
+    batch.distance_upper_bound = SolverScalar(this->distance_upper_bound);
+    Transform3s oM1[details::GJK_BATCH_LANES];
+    Vec3ps guesses[details::GJK_BATCH_LANES];
+    Vec3s guess;
+    support_func_guess_t support_hint;
+
+    for (size_t begin = 0; begin < tfs2.size(); begin += lanes) {
+      const int num_lanes = int(std::min(tfs2.size() - begin, size_t(lanes)));
+      for (int k = 0; k < num_lanes; ++k) {
+        // The Minkowski difference provides the relative pose used by the
+        // bounding volume guess.
+        this->minkowski_difference.set(&s1, &s2, tf1, tfs2[begin + k]);
+        getGJKInitialGuess(s1, s2, guess, support_hint);
+        oM1[k] = Transform3s(this->minkowski_difference.oR1,
+                             this->minkowski_difference.ot1);
+        guesses[k] = guess.cast<SolverScalar>();
+      }
+      batch.evaluate(s1, s2, oM1, guesses, num_lanes);
+      if (this->statistics) {
+        this->statistics->num_gjk_calls += size_t(num_lanes);
+        this->statistics->num_gjk_iterations +=
+            size_t(batch.iterations.sum());
+      }
+
+      for (int k = 0; k < num_lanes; ++k) {
+        const size_t i = begin + k;
+        switch (batch.status[k]) {
+          case details::GJK::NoCollisionEarlyStopped:
+            this->cached_guess =
+                batch.ray.row(k).matrix().transpose().template cast<Scalar>();
+            distances[i] = Scalar(batch.distance[k]);
+            p1s[i] = p2s[i] = normals[i] =
+                Vec3s::Constant(std::numeric_limits<Scalar>::quiet_NaN());
+            break;
+          case details::GJK::NoCollision:
+          case details::GJK::CollisionWithPenetrationInformation: {
+            // Same as GJKExtractWitnessPointsAndNormal.
+            this->cached_guess =
+                batch.ray.row(k).matrix().transpose().template cast<Scalar>();
+            const Scalar distance = Scalar(batch.distance[k]);
+            Vec3ps p1_, p2_, normal_;
+            batch.getWitnessPointsAndNormal(k, p1_, p2_, normal_);
+            const Vec3s p =
+                tf1.transform(0.5 * (p1_ + p2_).template cast<Scalar>());
+            normals[i].noalias() =
+                tf1.getRotation() * normal_.template cast<Scalar>();
+            p1s[i].noalias() = p - 0.5 * distance * normals[i];
+            p2s[i].noalias() = p + 0.5 * distance * normals[i];
+            distances[i] = distance;
+          } break;
+          default:
+            // The shapes are in collision, or the batch ran into a numerical
+            // issue: the scalar GJK and EPA take over.
+            distances[i] = this->shapeDistance<S1, S2>(
+                s1, tf1, s2, tfs2[i], compute_penetration, p1s[i], p2s[i],
+                normals[i]);
+        }
+      }
+    }
+  }
+
+  /// @brief No details::BatchGJK for this pair of shapes.
+  template <typename S1, typename S2>
+  void batchShapeDistance(const S1&, const Transform3s&, const S2&,
+                          const std::vector<Transform3s>&, const bool,
+                          std::vector<Scalar>&, std::vector<Vec3s>&,
+                          std::vector<Vec3s>&, std::vector<Vec3s>&,
+                          std::false_type /*has_batch_gjk*/) const {
+    COAL_THROW_PRETTY("No batch GJK for this pair of shapes.",
+                      std::logic_error);
+  }
+
   /// @brief Runs the GJK algorithm.
   /// @param `s1` the first shape.
   /// @param `tf1` the transformation of the first shape.
@@ -443,8 +644,16 @@ struct COAL_DLLAPI GJKSolver {
                        *(this->minkowski_difference.shapes[1]), guess,
                        support_hint);
 
-    this->gjk.evaluate(this->minkowski_difference, guess.cast<SolverScalar>(),
-                       support_hint);
+    // For the pairs of primitive shapes, GJK and EPA are instantiated with
+    // the support function of the pair, see details::HasSpecializedGJK.
+    typedef details::GJKAndEPAEvaluator<S1, S2, _SupportOptions> Evaluator;
+    Evaluator::evaluate(this->gjk, this->minkowski_difference,
+                        guess.cast<SolverScalar>(), support_hint,
+                        relative_transformation_already_computed);
+    if (this->statistics) {
+      ++this->statistics->num_gjk_calls;
+      this->statistics->num_gjk_iterations += this->gjk.getNumIterations();
+    }
 
     switch (this->gjk.status) {
       case details::GJK::DidNotRun:
@@ -516,7 +725,15 @@ struct COAL_DLLAPI GJKSolver {
 
           // TODO: understand why EPA's performance is so bad on cylinders and
           // cones.
-          this->epa.evaluate(this->gjk, (-guess).cast<SolverScalar>());
+          Evaluator::evaluate(this->epa, this->gjk,
+                              (-guess).cast<SolverScalar>(),
+                              relative_transformation_already_computed);
+          if (this->statistics) {
+            ++this->statistics->num_epa_calls;
+            this->statistics->num_epa_iterations +=
+                this->epa.getNumIterations();
+            this->statistics->num_epa_faces += this->epa.getNumFaces();
+          }
 
           switch (epa.status) {
             //
@@ -0,0 +1,249 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2015, Open Source Robotics Foundation
+ *  Copyright (c) 2021-2024, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \authors Jia Pan, Florent Lamiraux, Josef Mirabel, Louis Montaut */
+
+#ifndef COAL_SUPPORT_FUNCTIONS_HXX
+#define COAL_SUPPORT_FUNCTIONS_HXX
+
+#include <cmath>
+#include <limits>
+
+#include "coal/narrowphase/support_functions.h"
+
+/// @file
+/// @brief Definitions of the support functions of the primitive shapes.
+///
+/// They are explicitly instantiated in the library. This file is only needed
+/// to inline them, e.g. in the instantiations of GJK and EPA specialized for
+/// a pair of shapes (see @ref details::GJK::evaluate).
+
+namespace coal {
+namespace details {
+
+// ============================================================================
+template <int _SupportOptions>
+void getShapeSupport(const TriangleP* triangle, const Vec3s& dir,
+                     Vec3s& support, int& /*unused*/,
+                     ShapeSupportData& /*unused*/) {
+  Scalar dota = dir.dot(triangle->a);
+  Scalar dotb = dir.dot(triangle->b);
+  Scalar dotc = dir.dot(triangle->c);
+  if (dota > dotb) {
+    if (dotc > dota) {
+      support = triangle->c;
+    } else {
+      support = triangle->a;
+    }
+  } else {
+    if (dotc > dotb) {
+      support = triangle->c;
+    } else {
+      support = triangle->b;
+    }
+  }
+
+  if (_SupportOptions == SupportOptions::WithSweptSphere) {
+    support += triangle->getSweptSphereRadius() * dir.normalized();
+  }
+}
+
+// ============================================================================
+template <int _SupportOptions>
+void getShapeSupport(const Box* box, const Vec3s& dir, Vec3s& support,
+                     int& /*unused*/, ShapeSupportData& /*unused*/) {
+  // The inflate value is simply to make the specialized functions with box
+  // have a preferred side for edge cases.
+  static const Scalar inflate =
+      (dir.array() == 0).any() ? 1 + Scalar(1e-10) : 1;
+  static const Scalar dummy_precision =
+      Eigen::NumTraits<Scalar>::dummy_precision();
+  Vec3s support1 = (dir.array() > dummy_precision).select(box->halfSide, 0);
+  Vec3s support2 =
+      (dir.array() < -dummy_precision).select(-inflate * box->halfSide, 0);
+  support.noalias() = support1 + support2;
+
+  if (_SupportOptions == SupportOptions::WithSweptSphere) {
+    support += box->getSweptSphereRadius() * dir.normalized();
+  }
+}
+
+// ============================================================================
+template <int _SupportOptions>
+void getShapeSupport(const Sphere* sphere, const Vec3s& dir, Vec3s& support,
+                     int& /*unused*/, ShapeSupportData& /*unused*/) {
+  if (_SupportOptions == SupportOptions::WithSweptSphere) {
+    support.noalias() =
+        (sphere->radius + sphere->getSweptSphereRadius()) * dir.normalized();
+  } else {
+    support.setZero();
+  }
+
+  COAL_UNUSED_VARIABLE(sphere);
+  COAL_UNUSED_VARIABLE(dir);
+}
+
+// ============================================================================
+template <int _SupportOptions>
+void getShapeSupport(const Ellipsoid* ellipsoid, const Vec3s& dir,
+                     Vec3s& support, int& /*unused*/,
+                     ShapeSupportData& /*unused*/) {
+  Scalar a2 = ellipsoid->radii[0] * ellipsoid->radii[0];
+  Scalar b2 = ellipsoid->radii[1] * ellipsoid->radii[1];
+  Scalar c2 = ellipsoid->radii[2] * ellipsoid->radii[2];
+
+  Vec3s v(a2 * dir[0], b2 * dir[1], c2 * dir[2]);
+
+  Scalar d = std::sqrt(v.dot(dir));
+
+  support = v / d;
+
+  if (_SupportOptions == SupportOptions::WithSweptSphere) {
+    support += ellipsoid->getSweptSphereRadius() * dir.normalized();
+  }
+}
+
+// ============================================================================
+template <int _SupportOptions>
+void getShapeSupport(const Capsule* capsule, const Vec3s& dir, Vec3s& support,
+                     int& /*unused*/, ShapeSupportData& /*unused*/) {
+  static const Scalar dummy_precision =
+      Eigen::NumTraits<Scalar>::dummy_precision();
+  support.setZero();
+  if (dir[2] > dummy_precision) {
+    support[2] = capsule->halfLength;
+  } else if (dir[2] < -dummy_precision) {
+    support[2] = -capsule->halfLength;
+  }
+
+  if (_SupportOptions == SupportOptions::WithSweptSphere) {
+    support +=
+        (capsule->radius + capsule->getSweptSphereRadius()) * dir.normalized();
+  }
+}
+
+// ============================================================================
+template <int _SupportOptions>
+void getShapeSupport(const Cone* cone, const Vec3s& dir, Vec3s& support,
+                     int& /*unused*/, ShapeSupportData& /*unused*/) {
+  static const Scalar dummy_precision =
+      Eigen::NumTraits<Scalar>::dummy_precision();
+
+  // The cone radius is, for -h < z < h, (h - z) * r / (2*h)
+  // The inflate value is simply to make the specialized functions with cone
+  // have a preferred side for edge cases.
+  static const Scalar inflate = 1 + Scalar(1e-10);
+  Scalar h = cone->halfLength;
+  Scalar r = cone->radius;
+
+  if (dir.head<2>().isZero(dummy_precision)) {
+    support.head<2>().setZero();
+    if (dir[2] > dummy_precision) {
+      support[2] = h;
+    } else {
+      support[2] = -inflate * h;
+    }
+  } else {
+    Scalar zdist = dir[0] * dir[0] + dir[1] * dir[1];
+    Scalar len = zdist + dir[2] * dir[2];
+    zdist = std::sqrt(zdist);
+
+    if (dir[2] <= 0) {
+      Scalar rad = r / zdist;
+      support.head<2>() = rad * dir.head<2>();
+      support[2] = -h;
+    } else {
+      len = std::sqrt(len);
+      Scalar sin_a = r / std::sqrt(r * r + 4 * h * h);
+
+      if (dir[2] > len * sin_a)
+        support << 0, 0, h;
+      else {
+        Scalar rad = r / zdist;
+        support.head<2>() = rad * dir.head<2>();
+        support[2] = -h;
+      }
+    }
+  }
+
+  if (_SupportOptions == SupportOptions::WithSweptSphere) {
+    support += cone->getSweptSphereRadius() * dir.normalized();
+  }
+}
+
+// ============================================================================
+template <int _SupportOptions>
+void getShapeSupport(const Cylinder* cylinder, const Vec3s& dir, Vec3s& support,
+                     int& /*unused*/, ShapeSupportData& /*unused*/) {
+  static const Scalar dummy_precision =
+      Eigen::NumTraits<Scalar>::dummy_precision();
+
+  // The inflate value is simply to make the specialized functions with cylinder
+  // have a preferred side for edge cases.
+  static const Scalar inflate = 1 + Scalar(1e-10);
+  Scalar half_h = cylinder->halfLength;
+  Scalar r = cylinder->radius;
+
+  const bool dir_is_aligned_with_z = dir.head<2>().isZero(dummy_precision);
+  if (dir_is_aligned_with_z) half_h *= inflate;
+
+  if (dir[2] > dummy_precision) {
+    support[2] = half_h;
+  } else if (dir[2] < -dummy_precision) {
+    support[2] = -half_h;
+  } else {
+    support[2] = 0;
+    r *= inflate;
+  }
+
+  if (dir_is_aligned_with_z) {
+    support.head<2>().setZero();
+  } else {
+    support.head<2>() = dir.head<2>().normalized() * r;
+  }
+
+  assert(fabs(support[0] * dir[1] - support[1] * dir[0]) <
+         sqrt(std::numeric_limits<Scalar>::epsilon()));
+
+  if (_SupportOptions == SupportOptions::WithSweptSphere) {
+    support += cylinder->getSweptSphereRadius() * dir.normalized();
+  }
+}
+
+}  // namespace details
+}  // namespace coal
+
+#endif  // COAL_SUPPORT_FUNCTIONS_HXX
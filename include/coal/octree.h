@@ -40,6 +40,7 @@
 #define COAL_OCTREE_H
 
 #include <algorithm>
+#include <vector>
 
 #include <octomap/octomap.h>
 #include "coal/fwd.hh"
@@ -62,6 +63,35 @@ class COAL_DLLAPI OcTree : public CollisionGeometry {
  public:
   typedef octomap::OcTreeNode OcTreeNode;
 
+  /// @brief Node of the flat copy of the octree built by buildFlatTree().
+  ///
+  /// The nodes are stored in breadth-first order in a single array, so that
+  /// the children of a node are contiguous, and each node stores all that the
+  /// traversal needs: its bounding volume, its state and which of its children
+  /// exist and are occupied.
+  struct FlatNode {
+    /// @brief Bounding volume of the node, in the frame of the octree.
+    AABB bv;
+    /// @brief Index of the first child of the node in the array. The children
+    /// are stored in increasing child number.
+    unsigned int first_child;
+    /// @brief Bit i is set if the i-th child exists.
+    unsigned char child_mask;
+    /// @brief Bit i is set if the i-th child exists and is occupied.
+    unsigned char occupied_child_mask;
+    /// @brief Combination of FlatNode::OCCUPIED and FlatNode::FREE, for the
+    /// thresholds the flat tree was built with.
+    unsigned char state;
+
+    enum { OCCUPIED = 0x1, FREE = 0x2 };
+  };
+
+ protected:
+  /// @brief Flat copy of the tree, empty if it was not built.
+  shared_ptr<const std::vector<FlatNode> > flat_tree;
+
+ public:
+
   /// @brief construct octree with a given resolution
   explicit OcTree(Scalar resolution)
       : tree(shared_ptr<const octomap::OcTree>(
@@ -91,7 +121,8 @@ class COAL_DLLAPI OcTree : public CollisionGeometry {
         tree(other.tree),
         default_occupancy(other.default_occupancy),
         occupancy_threshold(other.occupancy_threshold),
-        free_threshold(other.free_threshold) {}
+        free_threshold(other.free_threshold),
+        flat_tree(other.flat_tree) {}
 
   /// \brief Clone *this into a new Octree
   OcTree* clone() const { return new OcTree(*this); }
@@ -232,9 +263,15 @@ class COAL_DLLAPI OcTree : public CollisionGeometry {
 
   void setCellDefaultOccupancy(Scalar d) { default_occupancy = d; }
 
-  void setOccupancyThres(Scalar d) { occupancy_threshold = d; }
+  void setOccupancyThres(Scalar d) {
+    occupancy_threshold = d;
+    if (hasFlatTree()) buildFlatTree();
+  }
 
-  void setFreeThres(Scalar d) { free_threshold = d; }
+  void setFreeThres(Scalar d) {
+    free_threshold = d;
+    if (hasFlatTree()) buildFlatTree();
+  }
 
   /// @return ptr to child number childIdx of node
   OcTreeNode* getNodeChild(OcTreeNode* node, unsigned int childIdx) {
@@ -257,6 +294,73 @@ class COAL_DLLAPI OcTree : public CollisionGeometry {
     return tree->nodeHasChildren(node);
   }
 
+  /// @brief Compile the octree into a flat array of nodes, with precomputed
+  /// bounding volumes and occupied-child masks.
+  ///
+  /// Once built, all the collision and distance queries involving this octree
+  /// traverse the flat copy instead of the octomap tree, which avoids the
+  /// pointer chasing and the recomputation of the children bounding volumes.
+  /// The node ids reported in the contacts and distance results are then
+  /// indices in the flat array.
+  ///
+  /// @note The flat copy is rebuilt when the occupancy or free threshold
+  /// changes, but not when the underlying octomap tree is modified: call this
+  /// method again in that case.
+  void buildFlatTree();
+
+  /// @brief Discard the flat copy of the octree, queries go back to the
+  /// octomap tree.
+  void clearFlatTree() { flat_tree.reset(); }
+
+  /// @brief Whether the flat copy of the octree was built.
+  bool hasFlatTree() const { return flat_tree.get() != NULL; }
+
+  /// @brief Returns the number of nodes of the flat copy of the octree.
+  std::size_t getFlatTreeSize() const {
+    return hasFlatTree() ? flat_tree->size() : 0;
+  }
+
+  /// @brief get the root node of the flat copy of the octree, NULL if it was
+  /// not built or the octree is empty.
+  const FlatNode* getFlatRoot() const {
+    return (hasFlatTree() && !flat_tree->empty()) ? flat_tree->data() : NULL;
+  }
+
+  /// @brief whether one node of the flat tree is completely occupied
+  bool isNodeOccupied(const FlatNode* node) const {
+    return (node->state & FlatNode::OCCUPIED) != 0;
+  }
+
+  /// @brief whether one node of the flat tree is completely free
+  bool isNodeFree(const FlatNode* node) const {
+    return (node->state & FlatNode::FREE) != 0;
+  }
+
+  /// @brief whether one node of the flat tree is uncertain
+  bool isNodeUncertain(const FlatNode* node) const { return node->state == 0; }
+
+  /// @return const ptr to child number childIdx of a node of the flat tree
+  const FlatNode* getNodeChild(const FlatNode* node,
+                               unsigned int childIdx) const {
+    // Children are stored contiguously: skip the ones before childIdx.
+    unsigned int before = node->child_mask & ((1u << childIdx) - 1);
+    before = before - ((before >> 1) & 0x55);
+    before = (before & 0x33) + ((before >> 2) & 0x33);
+    before = (before + (before >> 4)) & 0x0F;
+    return flat_tree->data() + node->first_child + before;
+  }
+
+  /// @brief return true if the child at childIdx of a node of the flat tree
+  /// exists
+  bool nodeChildExists(const FlatNode* node, unsigned int childIdx) const {
+    return (node->child_mask >> childIdx) & 1;
+  }
+
+  /// @brief return true if a node of the flat tree has at least one child
+  bool nodeHasChildren(const FlatNode* node) const {
+    return node->child_mask != 0;
+  }
+
   /// @brief return object type, it is an octree
   OBJECT_TYPE getObjectType() const { return OT_OCTREE; }
 
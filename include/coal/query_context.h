@@ -0,0 +1,93 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COAL_QUERY_CONTEXT_H
+#define COAL_QUERY_CONTEXT_H
+
+#include "coal/collision_data.h"
+#include "coal/narrowphase/narrowphase.h"
+#include "coal/contact_patch/contact_patch_solver.h"
+
+namespace coal {
+
+/// @brief Solvers and results reused by the successive queries of a thread.
+///
+/// \ref collide, \ref distance and \ref computeContactPatch construct their
+/// narrow phase solver at each call, which allocates the EPA and support set
+/// storages. The overloads taking a QueryContext use the solvers of the
+/// context instead, and the results stored in the context keep their capacity
+/// when they are cleared. Once the buffers have reached the size required by
+/// the queries, the queries between shapes and between BVH models with
+/// oriented bounding volumes (OBB, RSS, kIOS, OBBRSS) do not allocate memory
+/// anymore.
+///
+/// An instance of this class is not thread safe: use one instance per thread.
+///
+/// \code
+///   QueryContext context;
+///   // In the control loop:
+///   context.collision_result.clear();
+///   collide(o1, o2, request, context.collision_result, context);
+/// \endcode
+struct COAL_DLLAPI QueryContext {
+  /// @brief Narrow phase solver of the collision and distance queries.
+  GJKSolver solver;
+
+  /// @brief Solver of the contact patch queries.
+  ContactPatchSolver contact_patch_solver;
+
+  /// @brief Storage of the result of the collision queries.
+  CollisionResult collision_result;
+
+  /// @brief Storage of the result of the distance queries.
+  DistanceResult distance_result;
+
+  /// @brief Storage of the result of the contact patch queries.
+  ContactPatchResult contact_patch_result;
+
+  QueryContext() {}
+
+  /// @brief Clears the results stored in the context.
+  void clear() {
+    collision_result.clear();
+    distance_result.clear();
+    contact_patch_result.clear();
+  }
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+}  // namespace coal
+
+#endif  // COAL_QUERY_CONTEXT_H
@@ -20,6 +20,7 @@ namespace serialization {
 namespace internal {
 struct BVHModelBaseAccessor : coal::BVHModelBase {
   typedef coal::BVHModelBase Base;
+  using Base::last_updated_vertices;
   using Base::num_tris_allocated;
   using Base::num_vertices_allocated;
 };
@@ -81,6 +82,8 @@ void load(Archive &ar, coal::BVHModelBase &bvh_model,
   ar >> make_nvp("build_state", bvh_model.build_state);
 
   ar >> make_nvp("prev_vertices", bvh_model.prev_vertices);
+  reinterpret_cast<internal::BVHModelBaseAccessor &>(bvh_model)
+      .last_updated_vertices.clear();
 
   //      bool has_convex = true;
   //      ar >> make_nvp("has_convex",has_convex);
@@ -96,6 +99,7 @@ struct BVHModelAccessor : coal::BVHModel<BV> {
   using Base::num_bvs;
   using Base::num_bvs_allocated;
   using Base::primitive_indices;
+  using Base::refit_topology;
 };
 }  // namespace internal
 
@@ -200,6 +204,7 @@ void load(Archive &ar, coal::BVHModel<BV> &bvh_model_,
   //          bvh_model.primitive_indices = NULL;
   //      }
 
+  bvh_model.refit_topology.reset();
   bool with_bvs;
   ar >> make_nvp("with_bvs", with_bvs);
   if (with_bvs) {
@@ -64,6 +64,7 @@ void serialize(Archive& ar, coal::QueryRequest& query_request,
   ar& make_nvp("collision_distance_threshold",
                query_request.collision_distance_threshold);
   ar& make_nvp("enable_timings", query_request.enable_timings);
+  ar& make_nvp("enable_statistics", query_request.enable_statistics);
 }
 
 template <class Archive>
@@ -0,0 +1,82 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of INRIA nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COAL_SERIALIZATION_COMPOUND_H
+#define COAL_SERIALIZATION_COMPOUND_H
+
+#include "coal/compound.h"
+
+#include "coal/serialization/fwd.h"
+#include "coal/serialization/collision_object.h"
+#include "coal/serialization/transform.h"
+#include "coal/serialization/AABB.h"
+#include "coal/serialization/geometric_shapes.h"
+#include "coal/serialization/convex.h"
+#include "coal/serialization/hfield.h"
+#include "coal/serialization/BVH_model.h"
+
+#include <boost/serialization/vector.hpp>
+
+namespace boost {
+namespace serialization {
+
+namespace internal {
+struct CompoundAccessor : coal::Compound {
+  typedef coal::Compound Base;
+  using Base::part_aabbs;
+  using Base::parts;
+  using Base::placements;
+};
+}  // namespace internal
+
+template <class Archive>
+void serialize(Archive &ar, coal::Compound &compound,
+               const unsigned int /*version*/) {
+  ar &make_nvp(
+      "base",
+      boost::serialization::base_object<coal::CollisionGeometry>(compound));
+
+  typedef internal::CompoundAccessor Accessor;
+  Accessor &access = reinterpret_cast<Accessor &>(compound);
+
+  ar &make_nvp("parts", access.parts);
+  ar &make_nvp("placements", access.placements);
+  ar &make_nvp("part_aabbs", access.part_aabbs);
+}
+
+}  // namespace serialization
+}  // namespace boost
+
+COAL_SERIALIZATION_DECLARE_EXPORT(::coal::Compound)
+
+#endif  // ifndef COAL_SERIALIZATION_COMPOUND_H
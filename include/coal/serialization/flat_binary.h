@@ -0,0 +1,201 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COAL_SERIALIZATION_FLAT_BINARY_H
+#define COAL_SERIALIZATION_FLAT_BINARY_H
+
+#include <cstdint>
+#include <string>
+
+#include "coal/fwd.hh"
+#include "coal/BVH/BVH_model.h"
+#include "coal/hfield.h"
+
+namespace coal {
+namespace serialization {
+
+/// @brief Kind of object stored in a flat binary file.
+enum FlatBinaryObjectType {
+  FLAT_BINARY_BVH_MODEL = 1,
+  FLAT_BINARY_HEIGHT_FIELD = 2
+};
+
+/// @brief Header of a flat binary file.
+///
+/// A flat binary file is made of this header, followed by a table of
+/// FlatBinarySection and by the sections themselves. Each section is a
+/// contiguous array stored with the memory layout of the running platform and
+/// starts at an offset which is a multiple of FlatBinaryHeader::alignment,
+/// so that a memory mapping of the file can be used in place.
+///
+/// The sections of a BVHModel are, in this order: metadata, vertices,
+/// triangles, BV nodes and primitive indices.
+/// The sections of a HeightField are, in this order: metadata, heights
+/// (column major), x grid, y grid and BV nodes.
+struct FlatBinaryHeader {
+  /// @brief Version of the format written by this library.
+  static const std::uint32_t current_version = 1;
+  /// @brief Alignment, in bytes, of the sections in the file.
+  static const std::uint64_t alignment = 64;
+
+  /// @brief "COALFLAT", not null terminated.
+  char magic[8];
+  std::uint32_t version;
+  /// @brief 0x01020304, written in the byte order of the platform.
+  std::uint32_t byte_order_mark;
+  /// @brief One of FlatBinaryObjectType.
+  std::uint32_t object_type;
+  /// @brief The NODE_TYPE of the stored object.
+  std::int32_t node_type;
+  /// @brief sizeof(Scalar) of the platform which wrote the file.
+  std::uint32_t scalar_size;
+  /// @brief Size of one BV node, in bytes.
+  std::uint32_t node_size;
+  std::uint32_t num_sections;
+  std::uint32_t reserved;
+  /// @brief Total size of the file, in bytes.
+  std::uint64_t file_size;
+};
+
+/// @brief Location of a section in a flat binary file.
+struct FlatBinarySection {
+  /// @brief Offset of the section from the beginning of the file, in bytes.
+  std::uint64_t offset;
+  /// @brief Size of the section, in bytes.
+  std::uint64_t size;
+};
+
+/// @brief Read-only memory mapping of a flat binary file.
+///
+/// The constructor maps the file and checks that it was written with the
+/// current version of the format, on a platform with the same byte order and
+/// scalar type, and that all the sections lie within the file. The sections
+/// can then be accessed in place, without any copy, for as long as the
+/// FlatBinaryFile is alive. The mapping is shared with the other processes
+/// reading the same file.
+class COAL_DLLAPI FlatBinaryFile {
+ public:
+  /// @brief Maps the file.
+  /// @throw std::invalid_argument if the file cannot be read or is not a
+  /// valid flat binary file.
+  explicit FlatBinaryFile(const std::string& filename);
+
+  ~FlatBinaryFile();
+
+  /// @brief Header of the file.
+  const FlatBinaryHeader& header() const {
+    return *reinterpret_cast<const FlatBinaryHeader*>(data_);
+  }
+
+  /// @brief Number of sections in the file.
+  std::size_t numSections() const { return header().num_sections; }
+
+  /// @brief Location of the i-th section.
+  const FlatBinarySection& section(std::size_t i) const;
+
+  /// @brief Pointer to the beginning of the i-th section.
+  const void* sectionData(std::size_t i) const {
+    return data_ + section(i).offset;
+  }
+
+  /// @brief Pointer to the beginning of the file.
+  const unsigned char* data() const { return data_; }
+
+  /// @brief Size of the file, in bytes.
+  std::size_t size() const { return size_; }
+
+ private:
+  FlatBinaryFile(const FlatBinaryFile&);
+  FlatBinaryFile& operator=(const FlatBinaryFile&);
+
+  /// @brief Unmaps the file.
+  void release();
+
+  const unsigned char* data_;
+  std::size_t size_;
+  /// @brief Whether data_ is a memory mapping or a heap buffer.
+  bool mapped_;
+};
+
+/// @brief Saves a BVHModel in a flat binary file.
+///
+/// The vertices, triangles, BV nodes and primitive indices are written as
+/// raw arrays, so that the hierarchy does not need to be rebuilt when the
+/// file is loaded. The file can only be read back on a platform with the
+/// same byte order, scalar type and memory layout of the BV nodes.
+///
+/// @throw std::invalid_argument if the hierarchy of the model is not built
+/// or if the file cannot be written.
+template <typename BV>
+COAL_DLLAPI void saveToFlatBinary(const BVHModel<BV>& model,
+                                  const std::string& filename);
+
+/// @brief Loads a BVHModel from a flat binary file written by
+/// saveToFlatBinary.
+///
+/// The hierarchy is not rebuilt: each array of the model is filled with a
+/// single copy of the corresponding section, since the model owns its
+/// arrays. Use FlatBinaryFile to read the sections in place instead.
+/// The indices of the triangles and of the nodes are checked before the
+/// model is modified.
+///
+/// @throw std::invalid_argument if the file is not a valid flat binary file
+/// of a BVHModel<BV>, or if one of its indices is out of range.
+template <typename BV>
+COAL_DLLAPI void loadFromFlatBinary(BVHModel<BV>& model,
+                                    const std::string& filename);
+
+/// @brief Saves a HeightField in a flat binary file.
+///
+/// @throw std::invalid_argument if the file cannot be written.
+template <typename BV>
+COAL_DLLAPI void saveToFlatBinary(const HeightField<BV>& hfield,
+                                  const std::string& filename);
+
+/// @brief Loads a HeightField from a flat binary file written by
+/// saveToFlatBinary.
+///
+/// As for a BVHModel, the sections are copied into the height field, after
+/// checking that the nodes match the grid.
+///
+/// @throw std::invalid_argument if the file is not a valid flat binary file
+/// of a HeightField<BV>, or if its nodes do not match the grid.
+template <typename BV>
+COAL_DLLAPI void loadFromFlatBinary(HeightField<BV>& hfield,
+                                    const std::string& filename);
+
+}  // namespace serialization
+}  // namespace coal
+
+#endif  // COAL_SERIALIZATION_FLAT_BINARY_H
@@ -86,6 +86,9 @@ void load(Archive &ar, coal::OcTree &octree, const unsigned int /*version*/) {
   ar >> make_nvp("default_occupancy", access.default_occupancy);
   ar >> make_nvp("occupancy_threshold", access.occupancy_threshold);
   ar >> make_nvp("free_threshold", access.free_threshold);
+
+  // The flat copy is not serialized: refresh it from the loaded tree.
+  if (octree.hasFlatTree()) octree.buildFlatTree();
 }
 
 template <class Archive>
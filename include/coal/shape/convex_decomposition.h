@@ -0,0 +1,110 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of INRIA nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COAL_SHAPE_CONVEX_DECOMPOSITION_H
+#define COAL_SHAPE_CONVEX_DECOMPOSITION_H
+
+#include <string>
+#include <vector>
+
+#include "coal/fwd.hh"
+#include "coal/data_types.h"
+#include "coal/shape/geometric_shapes.h"
+
+namespace coal {
+
+/// @brief Parameters of computeConvexDecomposition.
+struct COAL_DLLAPI ConvexDecompositionParameters {
+  /// @brief Maximal concavity of a part, relative to the diagonal of the AABB
+  /// of the model. The concavity of a part is the largest distance between
+  /// its surface and the boundary of its convex hull, measured from the
+  /// vertices of the surface and from the centers of the faces of the hull.
+  Scalar concavity_threshold;
+
+  /// @brief Maximal number of parts.
+  std::size_t max_num_parts;
+
+  /// @brief Maximal number of successive cuts of a part of the model.
+  std::size_t max_depth;
+
+  /// @brief Number of cutting planes evaluated along each axis of a part.
+  std::size_t num_candidate_planes;
+
+  /// @brief Number of threads evaluating the cuts. 0 means one per hardware
+  /// thread. It does not change the result.
+  std::size_t num_threads;
+
+  ConvexDecompositionParameters()
+      : concavity_threshold(Scalar(0.02)),
+        max_num_parts(32),
+        max_depth(10),
+        num_candidate_planes(8),
+        num_threads(1) {}
+};
+
+/// @brief Approximate convex decomposition of a triangle mesh.
+///
+/// The mesh is recursively cut by axis-aligned planes. Each cut clips the
+/// triangles of a part, and the plane kept among the candidates is the one
+/// which minimizes the largest concavity of the two resulting parts. A part is
+/// no longer cut when its concavity is below
+/// ConvexDecompositionParameters::concavity_threshold, when it has been cut
+/// ConvexDecompositionParameters::max_depth times, or when the number of
+/// parts reaches ConvexDecompositionParameters::max_num_parts.
+/// Each part is replaced by its convex hull, computed without qhull.
+///
+/// \param[in] model a mesh of triangles. For a closed mesh, the union of the
+///            parts covers the volume of the mesh.
+/// \param[in] params parameters of the decomposition.
+/// \return the convex hulls of the parts, in the frame of the model.
+/// @note Flat parts are kept as two-sided polygons and are never cut.
+COAL_DLLAPI std::vector<shared_ptr<ConvexBase32>> computeConvexDecomposition(
+    const BVHModelBase& model, const ConvexDecompositionParameters& params =
+                                   ConvexDecompositionParameters());
+
+/// @brief Same as computeConvexDecomposition, with the parts gathered in a
+/// Compound and cached on disk.
+///
+/// The cache file is named after a hash of the mesh and of the parameters. It
+/// is loaded if it exists and written otherwise, so that the decomposition can
+/// be computed offline.
+/// \param[in] model a mesh of triangles.
+/// \param[in] params parameters of the decomposition.
+/// \param[in] cache_directory existing directory of the cache files.
+COAL_DLLAPI CompoundPtr_t loadOrComputeConvexDecomposition(
+    const BVHModelBase& model, const ConvexDecompositionParameters& params,
+    const std::string& cache_directory);
+
+}  // namespace coal
+
+#endif  // COAL_SHAPE_CONVEX_DECOMPOSITION_H
@@ -792,6 +792,24 @@ class ConvexBaseTpl : public ShapeBase {
   /// This influcences the way the support function is computed.
   static constexpr size_t num_vertices_large_convex_threshold = 32;
 
+  /// @brief When the vertices are also stored as a structure of arrays (see
+  /// buildPointsSoA) and the library is compiled with AVX or AVX-512
+  /// instructions, the support function scans all the vertices up to this
+  /// number of vertices, instead of hill climbing on the neighbors.
+  static constexpr size_t num_vertices_soa_support_threshold = 128;
+
+  /// @brief The coordinate arrays of points_soa are padded to a multiple of
+  /// this number of elements.
+  static constexpr size_t points_soa_block_size = 16;
+
+  /// @brief Whether the support function should hill climb on the neighbors
+  /// (see LargeConvex) rather than scan all the vertices (see SmallConvex).
+  bool COAL_DLLAPI useLogSupport() const;
+
+  /// @brief Builds points_soa from points. It must be called again whenever
+  /// the points are modified.
+  void buildPointsSoA();
+
   /// @brief An array of the points of the polygon.
   std::shared_ptr<std::vector<Vec3s>> points;
   unsigned int num_points;
@@ -821,6 +839,12 @@ class ConvexBaseTpl : public ShapeBase {
   /// @brief Support warm start polytopes.
   SupportWarmStartPolytope support_warm_starts;
 
+  /// @brief Optional copy of the points stored as a structure of arrays: the
+  /// x coordinates of all the points, then the y and the z coordinates. Each
+  /// array is padded to a multiple of points_soa_block_size by repeating the
+  /// last point. Null unless buildPointsSoA has been called.
+  std::shared_ptr<std::vector<Scalar>> points_soa;
+
  protected:
   /// @brief Construct an uninitialized convex object
   /// Initialization is done with ConvexBase::initialize.
@@ -75,6 +75,7 @@ void ConvexBaseTpl<IndexType>::initialize(
   this->num_normals_and_offsets = 0;
   this->normals.reset();
   this->offsets.reset();
+  this->points_soa.reset();
   this->computeCenter();
 }
 
@@ -101,6 +102,7 @@ ConvexBaseTpl<IndexType>& ConvexBaseTpl<IndexType>::operator=(
     this->nneighbors_ = other.nneighbors_;
     this->center = other.center;
     this->support_warm_starts = other.support_warm_starts;
+    this->points_soa = other.points_soa;
   }
 
   return *this;
@@ -143,6 +145,11 @@ void ConvexBaseTpl<IndexType>::deepcopy(const ConvexBaseTpl<IndexType>* source,
   copy->center = source->center;
   copy->support_warm_starts =
       source->support_warm_starts.template cast<OtherIndexType>();
+  if (source->points_soa != nullptr) {
+    copy->points_soa.reset(new std::vector<Scalar>(*source->points_soa));
+  } else {
+    copy->points_soa.reset();
+  }
 
   // Convert neighbors to new type
   if (source->points->size() >=
@@ -189,6 +196,25 @@ void ConvexBaseTpl<IndexType>::computeCenter() {
   center /= Scalar(num_points);
 }
 
+template <typename IndexType>
+void ConvexBaseTpl<IndexType>::buildPointsSoA() {
+  if (num_points == 0) {
+    points_soa.reset();
+    return;
+  }
+  const std::vector<Vec3s>& points_ = *points;
+  const std::size_t stride =
+      (num_points + points_soa_block_size - 1) / points_soa_block_size *
+      points_soa_block_size;
+  points_soa.reset(new std::vector<Scalar>(3 * stride));
+  std::vector<Scalar>& soa = *points_soa;
+  for (std::size_t i = 0; i < stride; ++i) {
+    // The padding repeats the last point, which never changes the support.
+    const Vec3s& p = points_[(std::min)(i, std::size_t(num_points - 1))];
+    for (int k = 0; k < 3; ++k) soa[std::size_t(k) * stride + i] = p[k];
+  }
+}
+
 // forward declaration for ConvexBase
 template <typename BV, typename S>
 void computeBV(const S& s, const Transform3s& tf, BV& bv);
@@ -48,30 +48,41 @@ namespace coal {
 /// @cond IGNORE
 namespace details {
 /// @brief get the vertices of some convex shape which can bound the given shape
-/// in a specific configuration
-COAL_DLLAPI std::vector<Vec3s> getBoundVertices(const Box& box,
-                                                const Transform3s& tf);
-COAL_DLLAPI std::vector<Vec3s> getBoundVertices(const Sphere& sphere,
-                                                const Transform3s& tf);
-COAL_DLLAPI std::vector<Vec3s> getBoundVertices(const Ellipsoid& ellipsoid,
-                                                const Transform3s& tf);
-COAL_DLLAPI std::vector<Vec3s> getBoundVertices(const Capsule& capsule,
-                                                const Transform3s& tf);
-COAL_DLLAPI std::vector<Vec3s> getBoundVertices(const Cone& cone,
-                                                const Transform3s& tf);
-COAL_DLLAPI std::vector<Vec3s> getBoundVertices(const Cylinder& cylinder,
-                                                const Transform3s& tf);
-COAL_DLLAPI std::vector<Vec3s> getBoundVertices(const TriangleP& triangle,
-                                                const Transform3s& tf);
+/// in a specific configuration. The vertices are written in result, whose
+/// memory is reused.
+COAL_DLLAPI void getBoundVertices(const Box& box, const Transform3s& tf,
+                                  std::vector<Vec3s>& result);
+COAL_DLLAPI void getBoundVertices(const Sphere& sphere, const Transform3s& tf,
+                                  std::vector<Vec3s>& result);
+COAL_DLLAPI void getBoundVertices(const Ellipsoid& ellipsoid,
+                                  const Transform3s& tf,
+                                  std::vector<Vec3s>& result);
+COAL_DLLAPI void getBoundVertices(const Capsule& capsule, const Transform3s& tf,
+                                  std::vector<Vec3s>& result);
+COAL_DLLAPI void getBoundVertices(const Cone& cone, const Transform3s& tf,
+                                  std::vector<Vec3s>& result);
+COAL_DLLAPI void getBoundVertices(const Cylinder& cylinder,
+                                  const Transform3s& tf,
+                                  std::vector<Vec3s>& result);
+COAL_DLLAPI void getBoundVertices(const TriangleP& triangle,
+                                  const Transform3s& tf,
+                                  std::vector<Vec3s>& result);
 template <typename IndexType>
-std::vector<Vec3s> getBoundVertices(const ConvexBaseTpl<IndexType>& convex,
-                                    const Transform3s& tf) {
-  std::vector<Vec3s> result(convex.num_points);
+void getBoundVertices(const ConvexBaseTpl<IndexType>& convex,
+                      const Transform3s& tf, std::vector<Vec3s>& result) {
+  result.resize(convex.num_points);
   const std::vector<Vec3s>& points_ = *(convex.points);
   for (std::size_t i = 0; i < convex.num_points; ++i) {
     result[i] = tf.transform(points_[i]);
   }
+}
 
+/// @brief get the vertices of some convex shape which can bound the given shape
+/// in a specific configuration
+template <typename S>
+std::vector<Vec3s> getBoundVertices(const S& s, const Transform3s& tf) {
+  std::vector<Vec3s> result;
+  getBoundVertices(s, tf, result);
   return result;
 }
 }  // namespace details
@@ -84,7 +95,10 @@ inline void computeBV(const S& s, const Transform3s& tf, BV& bv) {
     COAL_THROW_PRETTY("Swept-sphere radius not yet supported.",
                       std::runtime_error);
   }
-  std::vector<Vec3s> convex_bound_vertices = details::getBoundVertices(s, tf);
+  // The vertices are stored per thread, so that the shapes of the BVH-shape
+  // queries do not allocate memory at each query.
+  static thread_local std::vector<Vec3s> convex_bound_vertices;
+  details::getBoundVertices(s, tf, convex_bound_vertices);
   fit(&convex_bound_vertices[0], (unsigned int)convex_bound_vertices.size(),
       bv);
 }
@@ -0,0 +1,248 @@
+//
+// Software License Agreement (BSD License)
+//
+//  Copyright (c) 2026 INRIA
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//   * Neither the name of INRIA nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+//  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+//  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+//  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+//  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+//  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//  POSSIBILITY OF SUCH DAMAGE.
+
+#include <eigenpy/eigenpy.hpp>
+
+#include <limits>
+#include <vector>
+
+#include "coal/fwd.hh"
+COAL_COMPILER_DIAGNOSTIC_PUSH
+COAL_COMPILER_DIAGNOSTIC_IGNORED_DEPRECECATED_DECLARATIONS
+#include "coal/collision.h"
+#include "coal/distance.h"
+COAL_COMPILER_DIAGNOSTIC_POP
+#include "coal/internal/parallel.h"
+
+#include "coal.hh"
+#include "gil.hh"
+
+using namespace boost::python;
+using namespace coal;
+using namespace coal::python;
+
+namespace {
+
+typedef Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
+    RowMatrixXs;
+typedef Eigen::Matrix<bool, Eigen::Dynamic, 1> VecXb;
+
+/// Number of consecutive poses handled by a task of the thread pool. It
+/// amortizes the scheduling cost over queries which take a few microseconds.
+const std::size_t batch_task_size = 32;
+
+/// @brief Converts an array of poses into transforms.
+///
+/// A pose is either a 4x4 homogeneous matrix or 7 coefficients: the
+/// translation followed by the quaternion (x, y, z, w). The accepted shapes
+/// are (4, 4) and (7,) for a single pose, (N, 4, 4) and (N, 7) for N poses.
+std::vector<Transform3s> toTransforms(const object& poses, const char* name) {
+  object numpy = import("numpy");
+  object array = numpy.attr("ascontiguousarray")(
+      poses,
+      numpy.attr(sizeof(Scalar) == sizeof(double) ? "float64" : "float32"));
+
+  const long ndim = extract<long>(array.attr("ndim"));
+  const tuple shape(array.attr("shape"));
+  std::vector<long> dims;
+  for (long i = 0; i < ndim; ++i) dims.push_back(extract<long>(shape[i]));
+
+  bool homogeneous;
+  long num_poses;
+  if ((ndim == 2 || ndim == 3) && dims[ndim - 2] == 4 && dims[ndim - 1] == 4) {
+    homogeneous = true;
+    num_poses = (ndim == 3) ? dims[0] : 1;
+  } else if ((ndim == 1 || ndim == 2) && dims[ndim - 1] == 7) {
+    homogeneous = false;
+    num_poses = (ndim == 2) ? dims[0] : 1;
+  } else {
+    COAL_THROW_PRETTY(name << " must be an array of shape (4, 4), (N, 4, 4), "
+                           << "(7,) or (N, 7).",
+                      std::invalid_argument);
+  }
+
+  const long num_coeffs = homogeneous ? 16 : 7;
+  const RowMatrixXs coeffs =
+      extract<RowMatrixXs>(array.attr("reshape")(num_poses, num_coeffs));
+
+  std::vector<Transform3s> transforms;
+  transforms.reserve(static_cast<std::size_t>(num_poses));
+  for (long i = 0; i < num_poses; ++i) {
+    const Scalar* pose = coeffs.data() + i * num_coeffs;
+    if (homogeneous) {
+      const Eigen::Map<const Eigen::Matrix<Scalar, 4, 4, Eigen::RowMajor> > M(
+          pose);
+      transforms.push_back(Transform3s(M.topLeftCorner<3, 3>(),
+                                       M.topRightCorner<3, 1>()));
+    } else {
+      Quats q(pose[6], pose[3], pose[4], pose[5]);
+      q.normalize();
+      transforms.push_back(Transform3s(q, Vec3s(pose[0], pose[1], pose[2])));
+    }
+  }
+  return transforms;
+}
+
+/// @brief Number of queries of a batch. A single pose is used for all the
+/// poses of the other geometry.
+std::size_t batchSize(const std::vector<Transform3s>& tf1,
+                      const std::vector<Transform3s>& tf2) {
+  if (tf1.size() == 1) return tf2.size();
+  if (tf2.size() == 1 || tf1.size() == tf2.size()) return tf1.size();
+  COAL_THROW_PRETTY("poses1 and poses2 must contain the same number of poses, "
+                        << "or a single pose. Got " << tf1.size() << " and "
+                        << tf2.size() << ".",
+                    std::invalid_argument);
+}
+
+/// @brief Runs query(compute, tf1, tf2, i) for each pose of the batch.
+///
+/// The GIL is released and the poses are split in tasks shared by
+/// num_threads threads (0 meaning all the hardware threads). Each thread
+/// owns a copy of the functor, since its narrow phase solver is not thread
+/// safe.
+template <typename Functor, typename Query>
+void runBatch(const Functor& functor, const std::vector<Transform3s>& tf1,
+              const std::vector<Transform3s>& tf2, std::size_t num_threads,
+              Query query) {
+  const std::size_t size = batchSize(tf1, tf2);
+  const std::size_t num_tasks =
+      (size + batch_task_size - 1) / batch_task_size;
+  num_threads = internal::getNumThreads(num_threads);
+  if (num_threads > num_tasks) num_threads = (std::max)(num_tasks, size_t(1));
+  std::vector<Functor, Eigen::aligned_allocator<Functor> > functors(
+      num_threads, functor);
+
+  ReleaseGIL release_gil;
+  internal::parallelFor(
+      num_tasks, num_threads, [&](std::size_t task_id, std::size_t thread_id) {
+        const std::size_t end =
+            (std::min)(size, (task_id + 1) * batch_task_size);
+        for (std::size_t i = task_id * batch_task_size; i < end; ++i)
+          query(functors[thread_id], tf1[tf1.size() == 1 ? 0 : i],
+                tf2[tf2.size() == 1 ? 0 : i], i);
+      });
+}
+
+tuple distanceBatch(const CollisionGeometry* o1, const object& poses1,
+                    const CollisionGeometry* o2, const object& poses2,
+                    const DistanceRequest& request, std::size_t num_threads) {
+  const std::vector<Transform3s> tf1 = toTransforms(poses1, "poses1");
+  const std::vector<Transform3s> tf2 = toTransforms(poses2, "poses2");
+  const Eigen::DenseIndex size =
+      static_cast<Eigen::DenseIndex>(batchSize(tf1, tf2));
+
+  VecXs distances(size);
+  MatrixX3s normals(size, 3), points1(size, 3), points2(size, 3);
+  runBatch(ComputeDistance(o1, o2), tf1, tf2, num_threads,
+           [&](const ComputeDistance& compute_distance, const Transform3s& M1,
+               const Transform3s& M2, std::size_t i) {
+             DistanceResult result;
+             distances[i] = compute_distance(M1, M2, request, result);
+             normals.row(i) = result.normal.transpose();
+             points1.row(i) = result.nearest_points[0].transpose();
+             points2.row(i) = result.nearest_points[1].transpose();
+           });
+  return make_tuple(distances, normals, points1, points2);
+}
+
+tuple collideBatch(const CollisionGeometry* o1, const object& poses1,
+                   const CollisionGeometry* o2, const object& poses2,
+                   const CollisionRequest& request, std::size_t num_threads) {
+  const std::vector<Transform3s> tf1 = toTransforms(poses1, "poses1");
+  const std::vector<Transform3s> tf2 = toTransforms(poses2, "poses2");
+  const Eigen::DenseIndex size =
+      static_cast<Eigen::DenseIndex>(batchSize(tf1, tf2));
+
+  VecXb collisions(size);
+  VecXs distances(size);
+  MatrixX3s normals(size, 3), points1(size, 3), points2(size, 3);
+  runBatch(ComputeCollision(o1, o2), tf1, tf2, num_threads,
+           [&](const ComputeCollision& compute_collision, const Transform3s& M1,
+               const Transform3s& M2, std::size_t i) {
+             CollisionResult result;
+             compute_collision(M1, M2, request, result);
+             collisions[i] = result.isCollision();
+             if (result.isCollision()) {
+               const Contact& contact = result.getContact(0);
+               distances[i] = contact.penetration_depth;
+               normals.row(i) = contact.normal.transpose();
+               points1.row(i) = contact.nearest_points[0].transpose();
+               points2.row(i) = contact.nearest_points[1].transpose();
+             } else {
+               distances[i] = result.distance_lower_bound;
+               normals.row(i).setConstant(
+                   std::numeric_limits<Scalar>::quiet_NaN());
+               points1.row(i) = normals.row(i);
+               points2.row(i) = normals.row(i);
+             }
+           });
+  return make_tuple(collisions, distances, normals, points1, points2);
+}
+
+}  // namespace
+
+void exposeBatchAPI() {
+  eigenpy::enableEigenPySpecific<RowMatrixXs>();
+  eigenpy::enableEigenPySpecific<MatrixX3s>();
+  eigenpy::enableEigenPySpecific<VecXs>();
+  eigenpy::enableEigenPySpecific<VecXb>();
+
+  def("distanceBatch", &distanceBatch,
+      (arg("geometry1"), arg("poses1"), arg("geometry2"), arg("poses2"),
+       arg("request") = DistanceRequest(), arg("num_threads") = 1),
+      "Computes the distance between geometry1 and geometry2 for a batch of "
+      "poses.\n\n"
+      "The poses are arrays of shape (N, 4, 4) (homogeneous matrices) or "
+      "(N, 7) (translation followed by the quaternion x, y, z, w). A single "
+      "pose of shape (4, 4) or (7,) is used for all the poses of the other "
+      "geometry. The GIL is released during the computation, which is split "
+      "between num_threads threads (0 for all the hardware threads).\n\n"
+      "Returns the tuple (distances, normals, nearest_points1, "
+      "nearest_points2) of arrays of shape (N,), (N, 3), (N, 3) and (N, 3).");
+
+  def("collideBatch", &collideBatch,
+      (arg("geometry1"), arg("poses1"), arg("geometry2"), arg("poses2"),
+       arg("request") = CollisionRequest(), arg("num_threads") = 1),
+      "Checks the collision between geometry1 and geometry2 for a batch of "
+      "poses.\n\n"
+      "The poses are given as in distanceBatch. The GIL is released during the "
+      "computation, which is split between num_threads threads (0 for all the "
+      "hardware threads).\n\n"
+      "Returns the tuple (collisions, distances, normals, nearest_points1, "
+      "nearest_points2) of arrays of shape (N,), (N,), (N, 3), (N, 3) and "
+      "(N, 3). For the poses in collision, they describe the first contact "
+      "and the distance is its signed distance. Otherwise, the distance is "
+      "the lower bound of the collision result and the normals and points "
+      "are NaN.");
+}
@@ -43,6 +43,7 @@
 #include "coal/broadphase/broadphase_SSaP.h"
 #include "coal/broadphase/broadphase_interval_tree.h"
 #include "coal/broadphase/broadphase_spatialhash.h"
+#include "coal/broadphase/broadphase_wide_AABB_tree.h"
 
 COAL_COMPILER_DIAGNOSTIC_PUSH
 COAL_COMPILER_DIAGNOSTIC_IGNORED_DEPRECECATED_DECLARATIONS
@@ -126,6 +127,8 @@ void exposeBroadPhase() {
   BroadPhaseCollisionManagerWrapper::exposeDerived<SSaPCollisionManager>();
   BroadPhaseCollisionManagerWrapper::exposeDerived<SaPCollisionManager>();
   BroadPhaseCollisionManagerWrapper::exposeDerived<NaiveCollisionManager>();
+  BroadPhaseCollisionManagerWrapper::exposeDerived<
+      WideAABBTreeCollisionManager>();
 
   // Specific case of SpatialHashingCollisionManager
   {
@@ -41,6 +41,7 @@
 #include "coal/broadphase/broadphase_callbacks.h"
 
 #include "../coal.hh"
+#include "../gil.hh"
 
 #ifdef COAL_HAS_DOXYGEN_AUTODOC
 #include "doxygen_autodoc/functions.h"
@@ -53,8 +54,12 @@ struct CollisionCallBackBaseWrapper : CollisionCallBackBase,
                                       bp::wrapper<CollisionCallBackBase> {
   typedef CollisionCallBackBase Base;
 
-  void init() { this->get_override("init")(); }
+  void init() {
+    python::AcquireGIL acquire_gil;
+    this->get_override("init")();
+  }
   bool collide(CollisionObject* o1, CollisionObject* o2) {
+    python::AcquireGIL acquire_gil;
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wconversion"
     return this->get_override("collide")(o1, o2);
@@ -78,13 +83,17 @@ struct DistanceCallBackBaseWrapper : DistanceCallBackBase,
   typedef DistanceCallBackBase Base;
   typedef DistanceCallBackBaseWrapper Self;
 
-  void init() { this->get_override("init")(); }
+  void init() {
+    python::AcquireGIL acquire_gil;
+    this->get_override("init")();
+  }
   bool distance(CollisionObject* o1, CollisionObject* o2,
                 Eigen::Matrix<Scalar, 1, 1>& dist) {
     return distance(o1, o2, dist.coeffRef(0, 0));
   }
 
   bool distance(CollisionObject* o1, CollisionObject* o2, Scalar& dist) {
+    python::AcquireGIL acquire_gil;
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wconversion"
     return this->get_override("distance")(o1, o2, dist);
@@ -42,6 +42,7 @@
 #include "coal/broadphase/default_broadphase_callbacks.h"
 
 #include "../coal.hh"
+#include "../gil.hh"
 
 #ifdef COAL_HAS_DOXYGEN_AUTODOC
 #include "doxygen_autodoc/functions.h"
@@ -59,25 +60,42 @@ struct BroadPhaseCollisionManagerWrapper
   typedef BroadPhaseCollisionManager Base;
 
   void registerObjects(const std::vector<CollisionObject *> &other_objs) {
+    python::AcquireGIL acquire_gil;
     this->get_override("registerObjects")(other_objs);
   }
   void registerObject(CollisionObject *obj) {
+    python::AcquireGIL acquire_gil;
     this->get_override("registerObjects")(obj);
   }
   void unregisterObject(CollisionObject *obj) {
+    python::AcquireGIL acquire_gil;
     this->get_override("unregisterObject")(obj);
   }
 
   void update(const std::vector<CollisionObject *> &other_objs) {
+    python::AcquireGIL acquire_gil;
     this->get_override("update")(other_objs);
   }
-  void update(CollisionObject *obj) { this->get_override("update")(obj); }
-  void update() { this->get_override("update")(); }
+  void update(CollisionObject *obj) {
+    python::AcquireGIL acquire_gil;
+    this->get_override("update")(obj);
+  }
+  void update() {
+    python::AcquireGIL acquire_gil;
+    this->get_override("update")();
+  }
 
-  void setup() { this->get_override("setup")(); }
-  void clear() { this->get_override("clear")(); }
+  void setup() {
+    python::AcquireGIL acquire_gil;
+    this->get_override("setup")();
+  }
+  void clear() {
+    python::AcquireGIL acquire_gil;
+    this->get_override("clear")();
+  }
 
   std::vector<CollisionObject *> getObjects() const {
+    python::AcquireGIL acquire_gil;
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wconversion"
     return this->get_override("getObjects")();
@@ -85,40 +103,82 @@ struct BroadPhaseCollisionManagerWrapper
   }
 
   void collide(CollisionCallBackBase *callback) const {
+    python::AcquireGIL acquire_gil;
     this->get_override("collide")(callback);
   }
   void collide(CollisionObject *obj, CollisionCallBackBase *callback) const {
+    python::AcquireGIL acquire_gil;
     this->get_override("collide")(obj, callback);
   }
   void collide(BroadPhaseCollisionManager *other_manager,
                CollisionCallBackBase *callback) const {
+    python::AcquireGIL acquire_gil;
     this->get_override("collide")(other_manager, callback);
   }
 
   void distance(DistanceCallBackBase *callback) const {
+    python::AcquireGIL acquire_gil;
     this->get_override("distance")(callback);
   }
   void distance(CollisionObject *obj, DistanceCallBackBase *callback) const {
+    python::AcquireGIL acquire_gil;
     this->get_override("collide")(obj, callback);
   }
   void distance(BroadPhaseCollisionManager *other_manager,
                 DistanceCallBackBase *callback) const {
+    python::AcquireGIL acquire_gil;
     this->get_override("collide")(other_manager, callback);
   }
 
   bool empty() const {
+    python::AcquireGIL acquire_gil;
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wconversion"
     return this->get_override("empty")();
 #pragma GCC diagnostic pop
   }
   size_t size() const {
+    python::AcquireGIL acquire_gil;
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wconversion"
     return this->get_override("size")();
 #pragma GCC diagnostic pop
   }
 
+  // The queries release the GIL. The methods and the callbacks implemented in
+  // Python take it back when they are called.
+  static void collideAll(const Base &self, CollisionCallBackBase *callback) {
+    python::ReleaseGIL release_gil;
+    self.collide(callback);
+  }
+  static void collideObject(const Base &self, CollisionObject *obj,
+                            CollisionCallBackBase *callback) {
+    python::ReleaseGIL release_gil;
+    self.collide(obj, callback);
+  }
+  static void collideManager(const Base &self,
+                             BroadPhaseCollisionManager *other_manager,
+                             CollisionCallBackBase *callback) {
+    python::ReleaseGIL release_gil;
+    self.collide(other_manager, callback);
+  }
+
+  static void distanceAll(const Base &self, DistanceCallBackBase *callback) {
+    python::ReleaseGIL release_gil;
+    self.distance(callback);
+  }
+  static void distanceObject(const Base &self, CollisionObject *obj,
+                             DistanceCallBackBase *callback) {
+    python::ReleaseGIL release_gil;
+    self.distance(obj, callback);
+  }
+  static void distanceManager(const Base &self,
+                              BroadPhaseCollisionManager *other_manager,
+                              DistanceCallBackBase *callback) {
+    python::ReleaseGIL release_gil;
+    self.distance(other_manager, callback);
+  }
+
   static void expose() {
     bp::class_<BroadPhaseCollisionManagerWrapper, boost::noncopyable>(
         "BroadPhaseCollisionManager", bp::no_init)
@@ -164,47 +224,31 @@ struct BroadPhaseCollisionManagerWrapper
                  Base::getObjects),
              bp::with_custodian_and_ward_postcall<0, 1>())
 
-        .def("collide",
-             bp::pure_virtual((void (Base::*)(CollisionCallBackBase *) const) &
-                              Base::collide),
+        .def("collide", &collideAll,
              doxygen::member_func_doc(
                  (void (Base::*)(CollisionCallBackBase *) const) &
                  Base::collide))
-        .def("collide",
-             bp::pure_virtual((void (Base::*)(CollisionObject *,
-                                              CollisionCallBackBase *) const) &
-                              Base::collide),
+        .def("collide", &collideObject,
              doxygen::member_func_doc(
                  (void (Base::*)(CollisionObject *, CollisionCallBackBase *)
                       const) &
                  Base::collide))
-        .def("collide",
-             bp::pure_virtual((void (Base::*)(BroadPhaseCollisionManager *,
-                                              CollisionCallBackBase *) const) &
-                              Base::collide),
+        .def("collide", &collideManager,
              doxygen::member_func_doc(
                  (void (Base::*)(BroadPhaseCollisionManager *,
                                  CollisionCallBackBase *) const) &
                  Base::collide))
 
-        .def("distance",
-             bp::pure_virtual((void (Base::*)(DistanceCallBackBase *) const) &
-                              Base::distance),
+        .def("distance", &distanceAll,
              doxygen::member_func_doc(
                  (void (Base::*)(DistanceCallBackBase *) const) &
                  Base::distance))
-        .def("distance",
-             bp::pure_virtual((void (Base::*)(CollisionObject *,
-                                              DistanceCallBackBase *) const) &
-                              Base::distance),
+        .def("distance", &distanceObject,
              doxygen::member_func_doc(
                  (void (Base::*)(CollisionObject *, DistanceCallBackBase *)
                       const) &
                  Base::distance))
-        .def("distance",
-             bp::pure_virtual((void (Base::*)(BroadPhaseCollisionManager *,
-                                              DistanceCallBackBase *) const) &
-                              Base::distance),
+        .def("distance", &distanceManager,
              doxygen::member_func_doc(
                  (void (Base::*)(BroadPhaseCollisionManager *,
                                  DistanceCallBackBase *) const) &
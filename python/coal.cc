@@ -97,7 +97,9 @@ BOOST_PYTHON_MODULE(coal_pywrap) {
   exposeCollisionAPI();
   exposeContactPatchAPI();
   exposeDistanceAPI();
+  exposeBatchAPI();
   exposeGJK();
+  exposeMetrics();
 #ifdef COAL_HAS_OCTOMAP
   exposeOctree();
 #endif
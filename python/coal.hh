@@ -16,8 +16,12 @@ void exposeContactPatchAPI();
 
 void exposeDistanceAPI();
 
+void exposeBatchAPI();
+
 void exposeGJK();
 
+void exposeMetrics();
+
 #ifdef COAL_HAS_OCTOMAP
 void exposeOctree();
 #endif
@@ -145,7 +145,16 @@ void exposeHeightField(const std::string& bvname) {
       .DEF_CLASS_FUNC(Geometry, getMinHeight)
       .DEF_CLASS_FUNC(Geometry, getMaxHeight)
       .DEF_CLASS_FUNC(Geometry, getNodeType)
-      .DEF_CLASS_FUNC(Geometry, updateHeights)
+      .def(dv::member_func(
+          "updateHeights",
+          static_cast<void (Geometry::*)(const MatrixXs&)>(
+              &Geometry::updateHeights)))
+      .def(dv::member_func(
+          "updateHeights",
+          static_cast<void (Geometry::*)(const MatrixXs&, Eigen::DenseIndex,
+                                         Eigen::DenseIndex)>(
+              &Geometry::updateHeights)))
+      .DEF_CLASS_FUNC(Geometry, scroll)
 
       .def("clone", &Geometry::clone,
            doxygen::member_func_doc(&Geometry::clone),
@@ -539,6 +548,7 @@ void exposeCollisionGeometries() {
         .value("OT_GEOM", OT_GEOM)
         .value("OT_OCTREE", OT_OCTREE)
         .value("OT_HFIELD", OT_HFIELD)
+        .value("OT_COMPOUND", OT_COMPOUND)
         .export_values();
   }
 
@@ -566,6 +576,7 @@ void exposeCollisionGeometries() {
         .value("GEOM_OCTREE", GEOM_OCTREE)
         .value("HF_AABB", HF_AABB)
         .value("HF_OBBRSS", HF_OBBRSS)
+        .value("GEOM_COMPOUND", GEOM_COMPOUND)
         .export_values();
   }
 
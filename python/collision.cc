@@ -43,6 +43,7 @@ COAL_COMPILER_DIAGNOSTIC_POP
 
 #include "coal.hh"
 #include "deprecation.hh"
+#include "gil.hh"
 #include "serializable.hh"
 
 #ifdef COAL_HAS_DOXYGEN_AUTODOC
@@ -73,6 +74,35 @@ struct ContactWrapper {
   }
 };
 
+/// The queries release the GIL so that Python threads can run concurrently.
+struct CollisionWrapper {
+  static std::size_t collideObjects(const CollisionObject* o1,
+                                    const CollisionObject* o2,
+                                    const CollisionRequest& request,
+                                    CollisionResult& result) {
+    ReleaseGIL release_gil;
+    return coal::collide(o1, o2, request, result);
+  }
+
+  static std::size_t collideGeometries(const CollisionGeometry* o1,
+                                       const Transform3s& tf1,
+                                       const CollisionGeometry* o2,
+                                       const Transform3s& tf2,
+                                       const CollisionRequest& request,
+                                       CollisionResult& result) {
+    ReleaseGIL release_gil;
+    return coal::collide(o1, tf1, o2, tf2, request, result);
+  }
+
+  static std::size_t call(const ComputeCollision& self, const Transform3s& tf1,
+                          const Transform3s& tf2,
+                          const CollisionRequest& request,
+                          CollisionResult& result) {
+    ReleaseGIL release_gil;
+    return self(tf1, tf2, request, result);
+  }
+};
+
 void exposeCollisionAPI() {
   if (!eigenpy::register_symbolic_link_to_registered_type<
           CollisionRequestFlag>()) {
@@ -94,6 +124,33 @@ void exposeCollisionAPI() {
         .def("clear", &CPUTimes::clear, arg("self"), "Reset the time values.");
   }
 
+  if (!eigenpy::register_symbolic_link_to_registered_type<QueryStopReason>()) {
+    enum_<QueryStopReason>("QueryStopReason")
+        .value("QUERY_NOT_RUN", QUERY_NOT_RUN)
+        .value("QUERY_COMPLETED", QUERY_COMPLETED)
+        .value("QUERY_MAX_CONTACTS_REACHED", QUERY_MAX_CONTACTS_REACHED)
+        .value("QUERY_SKIPPED", QUERY_SKIPPED)
+        .export_values();
+  }
+
+  if (!eigenpy::register_symbolic_link_to_registered_type<QueryStatistics>()) {
+    class_<QueryStatistics>("QueryStatistics",
+                            doxygen::class_doc<QueryStatistics>(), no_init)
+        .DEF_RO_CLASS_ATTRIB(QueryStatistics, num_bv_tests)
+        .DEF_RO_CLASS_ATTRIB(QueryStatistics, num_leaf_tests)
+        .DEF_RO_CLASS_ATTRIB(QueryStatistics, num_gjk_calls)
+        .DEF_RO_CLASS_ATTRIB(QueryStatistics, num_gjk_iterations)
+        .DEF_RO_CLASS_ATTRIB(QueryStatistics, num_epa_calls)
+        .DEF_RO_CLASS_ATTRIB(QueryStatistics, num_epa_iterations)
+        .DEF_RO_CLASS_ATTRIB(QueryStatistics, num_epa_faces)
+        .DEF_RO_CLASS_ATTRIB(QueryStatistics, stop_reason)
+        .DEF_RO_CLASS_ATTRIB(QueryStatistics, dispatch_time)
+        .DEF_RO_CLASS_ATTRIB(QueryStatistics, traversal_time)
+        .DEF_RO_CLASS_ATTRIB(QueryStatistics, narrowphase_time)
+        .DEF_RO_CLASS_ATTRIB(QueryStatistics, patch_time)
+        .DEF_CLASS_FUNC(QueryStatistics, clear);
+  }
+
   COAL_COMPILER_DIAGNOSTIC_PUSH
   COAL_COMPILER_DIAGNOSTIC_IGNORED_DEPRECECATED_DECLARATIONS
   if (!eigenpy::register_symbolic_link_to_registered_type<QueryRequest>()) {
@@ -130,6 +187,7 @@ void exposeCollisionAPI() {
         .DEF_RW_CLASS_ATTRIB(QueryRequest, epa_max_iterations)
         .DEF_RW_CLASS_ATTRIB(QueryRequest, epa_tolerance)
         .DEF_RW_CLASS_ATTRIB(QueryRequest, enable_timings)
+        .DEF_RW_CLASS_ATTRIB(QueryRequest, enable_statistics)
         .DEF_CLASS_FUNC(QueryRequest, updateGuess);
   }
   COAL_COMPILER_DIAGNOSTIC_POP
@@ -219,7 +277,8 @@ void exposeCollisionAPI() {
                         no_init)
         .DEF_RW_CLASS_ATTRIB(QueryResult, cached_gjk_guess)
         .DEF_RW_CLASS_ATTRIB(QueryResult, cached_support_func_guess)
-        .DEF_RW_CLASS_ATTRIB(QueryResult, timings);
+        .DEF_RW_CLASS_ATTRIB(QueryResult, timings)
+        .DEF_RW_CLASS_ATTRIB(QueryResult, statistics);
   }
 
   if (!eigenpy::register_symbolic_link_to_registered_type<CollisionResult>()) {
@@ -254,23 +313,27 @@ void exposeCollisionAPI() {
         .def(vector_indexing_suite<std::vector<CollisionResult> >());
   }
 
-  doxygen::def("collide",
-               static_cast<std::size_t (*)(
-                   const CollisionObject*, const CollisionObject*,
-                   const CollisionRequest&, CollisionResult&)>(&collide));
-  doxygen::def(
-      "collide",
-      static_cast<std::size_t (*)(const CollisionGeometry*, const Transform3s&,
-                                  const CollisionGeometry*, const Transform3s&,
-                                  const CollisionRequest&, CollisionResult&)>(
-          &collide));
+  def("collide", &CollisionWrapper::collideObjects,
+      doxygen::member_func_doc(
+          static_cast<std::size_t (*)(const CollisionObject*,
+                                      const CollisionObject*,
+                                      const CollisionRequest&,
+                                      CollisionResult&)>(&collide)));
+  def("collide", &CollisionWrapper::collideGeometries,
+      doxygen::member_func_doc(
+          static_cast<std::size_t (*)(
+              const CollisionGeometry*, const Transform3s&,
+              const CollisionGeometry*, const Transform3s&,
+              const CollisionRequest&, CollisionResult&)>(&collide)));
 
   class_<ComputeCollision>("ComputeCollision",
                            doxygen::class_doc<ComputeCollision>(), no_init)
       .def(dv::init<ComputeCollision, const CollisionGeometry*,
                     const CollisionGeometry*>())
-      .def("__call__",
-           static_cast<std::size_t (ComputeCollision::*)(
-               const Transform3s&, const Transform3s&, const CollisionRequest&,
-               CollisionResult&) const>(&ComputeCollision::operator()));
+      .def("__call__", &CollisionWrapper::call,
+           doxygen::member_func_doc(
+               static_cast<std::size_t (ComputeCollision::*)(
+                   const Transform3s&, const Transform3s&,
+                   const CollisionRequest&, CollisionResult&) const>(
+                   &ComputeCollision::operator())));
 }
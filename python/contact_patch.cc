@@ -40,6 +40,7 @@
 
 #include "coal.hh"
 #include "deprecation.hh"
+#include "gil.hh"
 #include "serializable.hh"
 
 #ifdef COAL_HAS_DOXYGEN_AUTODOC
@@ -56,6 +57,36 @@ using namespace coal::python;
 
 namespace dv = doxygen::visitor;
 
+/// The queries release the GIL so that Python threads can run concurrently.
+struct ContactPatchWrapper {
+  static void computeContactPatchObjects(
+      const CollisionObject* o1, const CollisionObject* o2,
+      const CollisionResult& collision_result,
+      const ContactPatchRequest& request, ContactPatchResult& result) {
+    ReleaseGIL release_gil;
+    coal::computeContactPatch(o1, o2, collision_result, request, result);
+  }
+
+  static void computeContactPatchGeometries(
+      const CollisionGeometry* o1, const Transform3s& tf1,
+      const CollisionGeometry* o2, const Transform3s& tf2,
+      const CollisionResult& collision_result,
+      const ContactPatchRequest& request, ContactPatchResult& result) {
+    ReleaseGIL release_gil;
+    coal::computeContactPatch(o1, tf1, o2, tf2, collision_result, request,
+                              result);
+  }
+
+  static void call(const ComputeContactPatch& self, const Transform3s& tf1,
+                   const Transform3s& tf2,
+                   const CollisionResult& collision_result,
+                   const ContactPatchRequest& request,
+                   ContactPatchResult& result) {
+    ReleaseGIL release_gil;
+    self(tf1, tf2, collision_result, request, result);
+  }
+};
+
 void exposeContactPatchAPI() {
   if (!eigenpy::register_symbolic_link_to_registered_type<
           ContactPatch::PatchDirection>()) {
@@ -100,6 +131,7 @@ void exposeContactPatchAPI() {
         .def(dv::init<ContactPatchRequest, const CollisionRequest&,
                       bp::optional<size_t, Scalar>>())
         .DEF_RW_CLASS_ATTRIB(ContactPatchRequest, max_num_patch)
+        .DEF_RW_CLASS_ATTRIB(ContactPatchRequest, enable_statistics)
         .DEF_CLASS_FUNC(ContactPatchRequest, getNumSamplesCurvedShapes)
         .DEF_CLASS_FUNC(ContactPatchRequest, setNumSamplesCurvedShapes)
         .DEF_CLASS_FUNC(ContactPatchRequest, getPatchTolerance)
@@ -118,6 +150,7 @@ void exposeContactPatchAPI() {
                                doxygen::class_doc<ContactPatchResult>(),
                                init<>(arg("self"), "Default constructor."))
         .def(dv::init<ContactPatchResult, ContactPatchRequest>())
+        .DEF_RW_CLASS_ATTRIB(ContactPatchResult, statistics)
         .DEF_CLASS_FUNC(ContactPatchResult, numContactPatches)
         .DEF_CLASS_FUNC(ContactPatchResult, getUnusedContactPatch)
         .DEF_CLASS_FUNC2(ContactPatchResult, getContactPatch,
@@ -133,17 +166,19 @@ void exposeContactPatchAPI() {
         .def(vector_indexing_suite<std::vector<ContactPatchResult>>());
   }
 
-  doxygen::def(
-      "computeContactPatch",
-      static_cast<void (*)(const CollisionObject*, const CollisionObject*,
-                           const CollisionResult&, const ContactPatchRequest&,
-                           ContactPatchResult&)>(&computeContactPatch));
-  doxygen::def(
-      "computeContactPatch",
-      static_cast<void (*)(const CollisionGeometry*, const Transform3s&,
-                           const CollisionGeometry*, const Transform3s&,
-                           const CollisionResult&, const ContactPatchRequest&,
-                           ContactPatchResult&)>(&computeContactPatch));
+  def("computeContactPatch",
+      &ContactPatchWrapper::computeContactPatchObjects,
+      doxygen::member_func_doc(static_cast<void (*)(
+          const CollisionObject*, const CollisionObject*,
+          const CollisionResult&, const ContactPatchRequest&,
+          ContactPatchResult&)>(&computeContactPatch)));
+  def("computeContactPatch",
+      &ContactPatchWrapper::computeContactPatchGeometries,
+      doxygen::member_func_doc(static_cast<void (*)(
+          const CollisionGeometry*, const Transform3s&,
+          const CollisionGeometry*, const Transform3s&, const CollisionResult&,
+          const ContactPatchRequest&, ContactPatchResult&)>(
+          &computeContactPatch)));
 
   if (!eigenpy::register_symbolic_link_to_registered_type<
           ComputeContactPatch>()) {
@@ -152,10 +187,12 @@ void exposeContactPatchAPI() {
                                 no_init)
         .def(dv::init<ComputeContactPatch, const CollisionGeometry*,
                       const CollisionGeometry*>())
-        .def("__call__",
-             static_cast<void (ComputeContactPatch::*)(
-                 const Transform3s&, const Transform3s&, const CollisionResult&,
-                 const ContactPatchRequest&, ContactPatchResult&) const>(
-                 &ComputeContactPatch::operator()));
+        .def("__call__", &ContactPatchWrapper::call,
+             doxygen::member_func_doc(
+                 static_cast<void (ComputeContactPatch::*)(
+                     const Transform3s&, const Transform3s&,
+                     const CollisionResult&, const ContactPatchRequest&,
+                     ContactPatchResult&) const>(
+                     &ComputeContactPatch::operator())));
   }
 }
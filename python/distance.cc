@@ -45,6 +45,7 @@ COAL_COMPILER_DIAGNOSTIC_IGNORED_DEPRECECATED_DECLARATIONS
 #include "deprecation.hh"
 COAL_COMPILER_DIAGNOSTIC_POP
 
+#include "gil.hh"
 #include "serializable.hh"
 
 #ifdef COAL_HAS_DOXYGEN_AUTODOC
@@ -67,6 +68,34 @@ struct DistanceResultWrapper {
   }
 };
 
+/// The queries release the GIL so that Python threads can run concurrently.
+struct DistanceWrapper {
+  static Scalar distanceObjects(const CollisionObject* o1,
+                                const CollisionObject* o2,
+                                const DistanceRequest& request,
+                                DistanceResult& result) {
+    ReleaseGIL release_gil;
+    return coal::distance(o1, o2, request, result);
+  }
+
+  static Scalar distanceGeometries(const CollisionGeometry* o1,
+                                   const Transform3s& tf1,
+                                   const CollisionGeometry* o2,
+                                   const Transform3s& tf2,
+                                   const DistanceRequest& request,
+                                   DistanceResult& result) {
+    ReleaseGIL release_gil;
+    return coal::distance(o1, tf1, o2, tf2, request, result);
+  }
+
+  static Scalar call(const ComputeDistance& self, const Transform3s& tf1,
+                     const Transform3s& tf2, const DistanceRequest& request,
+                     DistanceResult& result) {
+    ReleaseGIL release_gil;
+    return self(tf1, tf2, request, result);
+  }
+};
+
 void exposeDistanceAPI() {
   COAL_COMPILER_DIAGNOSTIC_PUSH
   COAL_COMPILER_DIAGNOSTIC_IGNORED_DEPRECECATED_DECLARATIONS
@@ -147,24 +176,26 @@ void exposeDistanceAPI() {
         .def(vector_indexing_suite<std::vector<DistanceResult> >());
   }
 
-  doxygen::def(
-      "distance",
-      static_cast<Scalar (*)(const CollisionObject*, const CollisionObject*,
-                             const DistanceRequest&, DistanceResult&)>(
-          &distance));
-  doxygen::def(
-      "distance",
-      static_cast<Scalar (*)(const CollisionGeometry*, const Transform3s&,
-                             const CollisionGeometry*, const Transform3s&,
-                             const DistanceRequest&, DistanceResult&)>(
-          &distance));
+  def("distance", &DistanceWrapper::distanceObjects,
+      doxygen::member_func_doc(
+          static_cast<Scalar (*)(const CollisionObject*, const CollisionObject*,
+                                 const DistanceRequest&, DistanceResult&)>(
+              &distance)));
+  def("distance", &DistanceWrapper::distanceGeometries,
+      doxygen::member_func_doc(
+          static_cast<Scalar (*)(const CollisionGeometry*, const Transform3s&,
+                                 const CollisionGeometry*, const Transform3s&,
+                                 const DistanceRequest&, DistanceResult&)>(
+              &distance)));
 
   class_<ComputeDistance>("ComputeDistance",
                           doxygen::class_doc<ComputeDistance>(), no_init)
       .def(dv::init<ComputeDistance, const CollisionGeometry*,
                     const CollisionGeometry*>())
-      .def("__call__",
-           static_cast<Scalar (ComputeDistance::*)(
-               const Transform3s&, const Transform3s&, const DistanceRequest&,
-               DistanceResult&) const>(&ComputeDistance::operator()));
+      .def("__call__", &DistanceWrapper::call,
+           doxygen::member_func_doc(
+               static_cast<Scalar (ComputeDistance::*)(
+                   const Transform3s&, const Transform3s&,
+                   const DistanceRequest&, DistanceResult&) const>(
+                   &ComputeDistance::operator())));
 }
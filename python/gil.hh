@@ -0,0 +1,48 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#ifndef COAL_PYTHON_GIL_HH
+#define COAL_PYTHON_GIL_HH
+
+#include <Python.h>
+
+namespace coal {
+namespace python {
+
+/// @brief Releases the global interpreter lock for the lifetime of the
+/// object, so that other Python threads run while a query is computed.
+///
+/// No Python object must be accessed while the lock is released. The lock is
+/// taken back in the destructor, including when the query throws.
+struct ReleaseGIL {
+  ReleaseGIL() : state(PyEval_SaveThread()) {}
+  ~ReleaseGIL() { PyEval_RestoreThread(state); }
+
+ private:
+  ReleaseGIL(const ReleaseGIL&);
+  ReleaseGIL& operator=(const ReleaseGIL&);
+
+  PyThreadState* state;
+};
+
+/// @brief Takes the global interpreter lock for the lifetime of the object.
+///
+/// It is used by the methods overridden in Python (e.g. the broadphase
+/// callbacks), which may be called from C++ code running without the lock.
+/// It can be nested and used by a thread which already holds the lock.
+struct AcquireGIL {
+  AcquireGIL() : state(PyGILState_Ensure()) {}
+  ~AcquireGIL() { PyGILState_Release(state); }
+
+ private:
+  AcquireGIL(const AcquireGIL&);
+  AcquireGIL& operator=(const AcquireGIL&);
+
+  PyGILState_STATE state;
+};
+
+}  // namespace python
+}  // namespace coal
+
+#endif  // ifndef COAL_PYTHON_GIL_HH
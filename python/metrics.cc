@@ -0,0 +1,134 @@
+//
+// Software License Agreement (BSD License)
+//
+//  Copyright (c) 2026 INRIA
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//   * Neither the name of INRIA nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+//  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+//  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+//  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+//  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+//  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//  POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <eigenpy/eigenpy.hpp>
+
+#include "coal.hh"
+
+#include "coal/fwd.hh"
+#include "coal/metrics.h"
+
+#ifdef COAL_HAS_DOXYGEN_AUTODOC
+#include "doxygen_autodoc/functions.h"
+#include "doxygen_autodoc/coal/metrics.h"
+#endif
+
+using namespace boost::python;
+using namespace coal;
+using namespace coal::python;
+
+struct CallMetricsWrapper {
+  static list histogram(const CallMetrics& metrics) {
+    list bins;
+    for (std::size_t count : metrics.histogram) bins.append(count);
+    return bins;
+  }
+
+  static list binUpperBounds() {
+    list bounds;
+    for (std::size_t bin = 0; bin < CallMetrics::num_histogram_bins; ++bin)
+      bounds.append(CallMetrics::binUpperBound(bin));
+    return bounds;
+  }
+};
+
+struct MetricsSnapshotWrapper {
+  static CallMetrics get(const MetricsSnapshot& snapshot,
+                         MetricsQueryType type, NODE_TYPE node_type1,
+                         NODE_TYPE node_type2) {
+    return snapshot.get(type, node_type1, node_type2);
+  }
+};
+
+void exposeMetrics() {
+  if (!eigenpy::register_symbolic_link_to_registered_type<
+          MetricsQueryType>()) {
+    enum_<MetricsQueryType>("MetricsQueryType")
+        .value("COLLISION_METRICS", COLLISION_METRICS)
+        .value("DISTANCE_METRICS", DISTANCE_METRICS)
+        .value("CONTACT_PATCH_METRICS", CONTACT_PATCH_METRICS)
+        .export_values();
+  }
+
+  if (!eigenpy::register_symbolic_link_to_registered_type<CallMetrics>()) {
+    class_<CallMetrics>("CallMetrics", doxygen::class_doc<CallMetrics>(),
+                        no_init)
+        .DEF_RO_CLASS_ATTRIB(CallMetrics, num_calls)
+        .DEF_RO_CLASS_ATTRIB(CallMetrics, total_time)
+        .add_property("histogram", &CallMetricsWrapper::histogram,
+                      "Latency histogram, see binUpperBounds.")
+        .DEF_CLASS_FUNC(CallMetrics, meanTime)
+        .def("binUpperBounds", &CallMetricsWrapper::binUpperBounds,
+             "Upper bound of the latencies counted in each bin of the "
+             "histogram, in microseconds.")
+        .staticmethod("binUpperBounds");
+  }
+
+  if (!eigenpy::register_symbolic_link_to_registered_type<CallMetricsEntry>()) {
+    class_<CallMetricsEntry>("CallMetricsEntry",
+                             doxygen::class_doc<CallMetricsEntry>(), no_init)
+        .DEF_RO_CLASS_ATTRIB(CallMetricsEntry, type)
+        .DEF_RO_CLASS_ATTRIB(CallMetricsEntry, node_type1)
+        .DEF_RO_CLASS_ATTRIB(CallMetricsEntry, node_type2)
+        .DEF_RO_CLASS_ATTRIB(CallMetricsEntry, metrics);
+  }
+
+  if (!eigenpy::register_symbolic_link_to_registered_type<
+          std::vector<CallMetricsEntry> >()) {
+    class_<std::vector<CallMetricsEntry> >("StdVec_CallMetricsEntry")
+        .def(vector_indexing_suite<std::vector<CallMetricsEntry> >());
+  }
+
+  if (!eigenpy::register_symbolic_link_to_registered_type<MetricsSnapshot>()) {
+    class_<MetricsSnapshot>("MetricsSnapshot",
+                            doxygen::class_doc<MetricsSnapshot>(), no_init)
+        .def("get", &MetricsSnapshotWrapper::get,
+             args("self", "type", "node_type1", "node_type2"),
+             "Metrics of an entry of the function matrix of a kind of query.")
+        .DEF_CLASS_FUNC(MetricsSnapshot, calledEntries);
+  }
+
+  if (!eigenpy::register_symbolic_link_to_registered_type<MetricsRegistry>()) {
+    class_<MetricsRegistry, boost::noncopyable>(
+        "MetricsRegistry", doxygen::class_doc<MetricsRegistry>(), no_init)
+        .def("instance", &MetricsRegistry::instance,
+             return_value_policy<reference_existing_object>())
+        .staticmethod("instance")
+        .DEF_CLASS_FUNC(MetricsRegistry, setEnabled)
+        .DEF_CLASS_FUNC(MetricsRegistry, isEnabled)
+        .DEF_CLASS_FUNC(MetricsRegistry, record)
+        .DEF_CLASS_FUNC(MetricsRegistry, snapshot)
+        .DEF_CLASS_FUNC(MetricsRegistry, reset);
+  }
+}
@@ -50,6 +50,10 @@ void exposeOctree() {
       .def(dv::member_func("setFreeThres", &OcTree::setFreeThres))
       .def(dv::member_func("getRootBV", &OcTree::getRootBV))
       .def(dv::member_func("toBoxes", &OcTree::toBoxes))
+      .def(dv::member_func("buildFlatTree", &OcTree::buildFlatTree))
+      .def(dv::member_func("clearFlatTree", &OcTree::clearFlatTree))
+      .def(dv::member_func("hasFlatTree", &OcTree::hasFlatTree))
+      .def(dv::member_func("getFlatTreeSize", &OcTree::getFlatTreeSize))
       .def("tobytes", tobytes, doxygen::member_func_doc(&OcTree::tobytes));
 
   doxygen::def("makeOctree", &makeOctree);
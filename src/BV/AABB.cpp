@@ -36,6 +36,7 @@
 /** \author Jia Pan */
 
 #include "coal/BV/AABB.h"
+#include "coal/BV/OBB.h"
 #include "coal/shape/geometric_shapes.h"
 #include "coal/collision_data.h"
 
@@ -131,17 +132,29 @@ Scalar AABB::distance(const AABB& other) const {
   return std::sqrt(result);
 }
 
+// b1 in configuration (R0, T0) is an oriented box: the separating axis test
+// between two oriented boxes is exact, whereas the AABB of the transformed b1
+// only bounds it.
 bool overlap(const Matrix3s& R0, const Vec3s& T0, const AABB& b1,
              const AABB& b2) {
-  AABB bb1(translate(rotate(b1, R0), T0));
-  return bb1.overlap(b2);
+  const Vec3s T(R0.transpose() * (b2.center() - T0) - b1.center());
+  return !obbDisjoint(R0.transpose(), T, (b1.max_ - b1.min_) / 2,
+                      (b2.max_ - b2.min_) / 2);
 }
 
 bool overlap(const Matrix3s& R0, const Vec3s& T0, const AABB& b1,
              const AABB& b2, const CollisionRequest& request,
              Scalar& sqrDistLowerBound) {
-  AABB bb1(translate(rotate(b1, R0), T0));
-  return bb1.overlap(b2, request, sqrDistLowerBound);
+  // The separating axis test cannot shrink a box by more than its extent, as
+  // a negative security margin may require.
+  if (request.security_margin < 0) {
+    AABB bb1(translate(rotate(b1, R0), T0));
+    return bb1.overlap(b2, request, sqrDistLowerBound);
+  }
+  const Vec3s T(R0.transpose() * (b2.center() - T0) - b1.center());
+  return !obbDisjointAndLowerBoundDistance(
+      R0.transpose(), T, (b1.max_ - b1.min_) / 2, (b2.max_ - b2.min_) / 2,
+      request, sqrDistLowerBound);
 }
 
 bool AABB::overlap(const Plane& p) const {
@@ -97,6 +97,30 @@ inline void getDistances<9>(const Vec3s& p, Scalar* d) {
   d[8] = p[1] + p[2] - p[0];
 }
 
+/// @brief Normals of the planes of a KDOP, in the order of its distances.
+template <short N>
+struct KDOPNormals {
+  Eigen::Matrix<Scalar, N / 2, 3> normals;
+  Eigen::Array<Scalar, N / 2, 1> inverse_norms;
+
+  KDOPNormals() {
+    // The distances are linear in the point: the normals are the distances of
+    // the vectors of the basis.
+    normals.template topRows<3>().setIdentity();
+    Scalar d[(N - 6) / 2];
+    for (Eigen::DenseIndex j = 0; j < 3; ++j) {
+      getDistances<(N - 6) / 2>(Vec3s::Unit(j), d);
+      for (short i = 0; i < (N - 6) / 2; ++i) normals(3 + i, j) = d[i];
+    }
+    inverse_norms = normals.rowwise().norm().array().inverse();
+  }
+
+  static const KDOPNormals& get() {
+    static const KDOPNormals normals;
+    return normals;
+  }
+};
+
 template <short N>
 KDOP<N>::KDOP() {
   Scalar real_max = (std::numeric_limits<Scalar>::max)();
@@ -143,24 +167,17 @@ bool KDOP<N>::overlap(const KDOP<N>& other) const {
 template <short N>
 bool KDOP<N>::overlap(const KDOP<N>& other, const CollisionRequest& request,
                       Scalar& sqrDistLowerBound) const {
-  const Scalar breakDistance(request.break_distance + request.security_margin);
-
-  Scalar a = (dist_.template head<N / 2>() - other.dist_.template tail<N / 2>())
-                 .minCoeff();
-  if (a > breakDistance) {
-    sqrDistLowerBound = a * a;
-    return false;
-  }
-
-  Scalar b = (other.dist_.template head<N / 2>() - dist_.template tail<N / 2>())
-                 .minCoeff();
-  if (b > breakDistance) {
-    sqrDistLowerBound = b * b;
-    return false;
-  }
-
-  sqrDistLowerBound = std::min(a, b);
-  return true;
+  // The gaps are divided by the norms of the normals, which are not unit
+  // vectors for the oblique planes, to bound the distance.
+  const Eigen::Array<Scalar, N / 2, 1> gap =
+      (dist_.template head<N / 2>() - other.dist_.template tail<N / 2>())
+          .max(other.dist_.template head<N / 2>() -
+               dist_.template tail<N / 2>()) *
+      KDOPNormals<N>::get().inverse_norms;
+  const Scalar distance =
+      (std::max)(gap.maxCoeff() - request.security_margin, Scalar(0));
+  sqrDistLowerBound = distance * distance;
+  return distance <= request.break_distance;
 }
 
 template <short N>
@@ -233,6 +250,53 @@ KDOP<N> translate(const KDOP<N>& bv, const Vec3s& t) {
   return res;
 }
 
+/// @brief Largest gap between the pairs of planes of kdop and the box of
+/// center c, axes A and half dimensions e, given in the frame of kdop. It is
+/// positive if a pair of planes separates the box from kdop.
+template <short N>
+Scalar separation(const KDOP<N>& kdop, const Vec3s& c, const Matrix3s& A,
+                  const Vec3s& e) {
+  const KDOPNormals<N>& n = KDOPNormals<N>::get();
+  const Eigen::Array<Scalar, N / 2, 1> center = (n.normals * c).array();
+  const Eigen::Array<Scalar, N / 2, 1> radius =
+      ((n.normals * A).cwiseAbs() * e).array();
+  Eigen::Array<Scalar, N / 2, 1> gap;
+  for (short i = 0; i < N / 2; ++i)
+    gap[i] = (std::max)(kdop.dist(i) - center[i] - radius[i],
+                        center[i] - radius[i] - kdop.dist(short(N / 2 + i)));
+  return (gap * n.inverse_norms).maxCoeff();
+}
+
+/// @brief Largest gap between b2 and the box of b1, and between b1 and the box
+/// of b2, where b1 is in configuration (R0, T0) and b2 is in identity.
+template <short N>
+Scalar separation(const Matrix3s& R0, const Vec3s& T0, const KDOP<N>& b1,
+                  const KDOP<N>& b2) {
+  const Vec3s c1(b1.center()), c2(b2.center());
+  const Vec3s e1(b1.width() / 2, b1.height() / 2, b1.depth() / 2);
+  const Vec3s e2(b2.width() / 2, b2.height() / 2, b2.depth() / 2);
+  return (std::max)(
+      separation(b2, R0 * c1 + T0, R0, e1),
+      separation(b1, R0.transpose() * (c2 - T0), R0.transpose(), e2));
+}
+
+template <short N>
+bool overlap(const Matrix3s& R0, const Vec3s& T0, const KDOP<N>& b1,
+             const KDOP<N>& b2) {
+  return separation(R0, T0, b1, b2) <= 0;
+}
+
+template <short N>
+bool overlap(const Matrix3s& R0, const Vec3s& T0, const KDOP<N>& b1,
+             const KDOP<N>& b2, const CollisionRequest& request,
+             Scalar& sqrDistLowerBound) {
+  const Scalar distance =
+      (std::max)(separation(R0, T0, b1, b2) - request.security_margin,
+                 Scalar(0));
+  sqrDistLowerBound = distance * distance;
+  return distance <= request.break_distance;
+}
+
 template class KDOP<16>;
 template class KDOP<18>;
 template class KDOP<24>;
@@ -241,4 +305,18 @@ template KDOP<16> translate<16>(const KDOP<16>&, const Vec3s&);
 template KDOP<18> translate<18>(const KDOP<18>&, const Vec3s&);
 template KDOP<24> translate<24>(const KDOP<24>&, const Vec3s&);
 
+template bool overlap<16>(const Matrix3s&, const Vec3s&, const KDOP<16>&,
+                          const KDOP<16>&);
+template bool overlap<18>(const Matrix3s&, const Vec3s&, const KDOP<18>&,
+                          const KDOP<18>&);
+template bool overlap<24>(const Matrix3s&, const Vec3s&, const KDOP<24>&,
+                          const KDOP<24>&);
+
+template bool overlap<16>(const Matrix3s&, const Vec3s&, const KDOP<16>&,
+                          const KDOP<16>&, const CollisionRequest&, Scalar&);
+template bool overlap<18>(const Matrix3s&, const Vec3s&, const KDOP<18>&,
+                          const KDOP<18>&, const CollisionRequest&, Scalar&);
+template bool overlap<24>(const Matrix3s&, const Vec3s&, const KDOP<24>&,
+                          const KDOP<24>&, const CollisionRequest&, Scalar&);
+
 }  // namespace coal
@@ -44,7 +44,9 @@
 
 #include "coal/internal/BV_splitter.h"
 #include "coal/internal/BV_fitter.h"
+#include "coal/internal/parallel.h"
 
+#include <algorithm>
 #include <iostream>
 #include <string.h>
 
@@ -64,7 +66,8 @@ BVHModelBase::BVHModelBase(const BVHModelBase& other)
       num_vertices(other.num_vertices),
       build_state(other.build_state),
       num_tris_allocated(other.num_tris),
-      num_vertices_allocated(other.num_vertices) {
+      num_vertices_allocated(other.num_vertices),
+      last_updated_vertices(other.last_updated_vertices) {
   if (other.vertices.get() && other.vertices->size() > 0) {
     vertices.reset(new std::vector<Vec3s>(*(other.vertices)));
   } else
@@ -162,7 +165,9 @@ template <typename BV>
 BVHModel<BV>::BVHModel(const BVHModel<BV>& other)
     : BVHModelBase(other),
       bv_splitter(other.bv_splitter),
-      bv_fitter(other.bv_fitter) {
+      bv_fitter(other.bv_fitter),
+      num_build_threads(other.num_build_threads),
+      refit_topology(other.refit_topology) {
   if (other.primitive_indices.get()) {
     primitive_indices.reset(
         new std::vector<unsigned int>(*(other.primitive_indices)));
@@ -217,6 +222,7 @@ int BVHModelBase::beginModel(unsigned int num_tris_,
     vertices.reset();
     prev_vertices.reset();
   };
+  last_updated_vertices.clear();
 
   if (build_state != BVH_BUILD_STATE_EMPTY) {
     std::cerr
@@ -586,6 +592,7 @@ int BVHModelBase::beginReplaceModel() {
   if (prev_vertices.get()) prev_vertices.reset();
 
   num_vertex_updated = 0;
+  last_updated_vertices.clear();
 
   build_state = BVH_BUILD_STATE_REPLACE_BEGUN;
 
@@ -690,6 +697,7 @@ int BVHModelBase::beginUpdateModel() {
   }
 
   num_vertex_updated = 0;
+  last_updated_vertices.clear();
 
   build_state = BVH_BUILD_STATE_UPDATE_BEGUN;
 
@@ -779,6 +787,55 @@ int BVHModelBase::endUpdateModel(bool refit, bool bottomup) {
   return BVH_OK;
 }
 
+int BVHModelBase::updateVertices(const std::vector<unsigned int>& indices,
+                                 const std::vector<Vec3s>& positions,
+                                 std::size_t num_threads) {
+  if (build_state != BVH_BUILD_STATE_PROCESSED &&
+      build_state != BVH_BUILD_STATE_UPDATED) {
+    std::cerr << "BVH Error! Call updateVertices() on a BVHModel that has no "
+                 "previous frame."
+              << std::endl;
+    return BVH_ERR_BUILD_EMPTY_PREVIOUS_FRAME;
+  }
+
+  if (indices.size() != positions.size()) {
+    std::cerr << "BVH Error! updateVertices() expects as many positions as "
+                 "vertex indices."
+              << std::endl;
+    return BVH_ERR_INCORRECT_DATA;
+  }
+  for (std::size_t k = 0; k < indices.size(); ++k) {
+    if (indices[k] >= num_vertices) {
+      std::cerr << "BVH Error! updateVertices() received an out of range "
+                   "vertex index."
+                << std::endl;
+      return BVH_ERR_INCORRECT_DATA;
+    }
+  }
+
+  if (!prev_vertices.get())
+    prev_vertices.reset(new std::vector<Vec3s>(*vertices));
+  std::vector<Vec3s>& vertices_ = *vertices;
+  std::vector<Vec3s>& prev_vertices_ = *prev_vertices;
+
+  // The vertices moved by the previous update are now at rest: their leaves
+  // have to be refitted as well.
+  std::vector<unsigned int> dirty_vertices(last_updated_vertices);
+  for (std::size_t k = 0; k < last_updated_vertices.size(); ++k)
+    prev_vertices_[last_updated_vertices[k]] =
+        vertices_[last_updated_vertices[k]];
+  for (std::size_t k = 0; k < indices.size(); ++k) {
+    prev_vertices_[indices[k]] = vertices_[indices[k]];
+    vertices_[indices[k]] = positions[k];
+  }
+  dirty_vertices.insert(dirty_vertices.end(), indices.begin(), indices.end());
+  last_updated_vertices = indices;
+
+  const int res = refitTree_partial(dirty_vertices, num_threads);
+  build_state = BVH_BUILD_STATE_UPDATED;
+  return res;
+}
+
 void BVHModelBase::computeLocalAABB() {
   AABB aabb_;
   const std::vector<Vec3s>& vertices_ = *vertices;
@@ -805,6 +862,7 @@ BVHModel<BV>::BVHModel()
     : BVHModelBase(),
       bv_splitter(new BVSplitter<BV>(SPLIT_METHOD_MEAN)),
       bv_fitter(new BVFitter<BV>()),
+      num_build_threads(1),
       num_bvs_allocated(0),
       num_bvs(0) {}
 
@@ -813,6 +871,7 @@ void BVHModel<BV>::deleteBVs() {
   bvs.reset();
   primitive_indices.reset();
   num_bvs_allocated = num_bvs = 0;
+  refit_topology.reset();
 }
 
 template <typename BV>
@@ -863,8 +922,7 @@ int BVHModel<BV>::buildTree() {
   bv_fitter->set(vertices_, tri_indices_, getModelType());
   // set SplitRule
   bv_splitter->set(vertices_, tri_indices_, getModelType());
-
-  num_bvs = 1;
+  refit_topology.reset();
 
   unsigned int num_primitives = 0;
   switch (getModelType()) {
@@ -881,7 +939,43 @@ int BVHModel<BV>::buildTree() {
 
   std::vector<unsigned int>& primitive_indices_ = *primitive_indices;
   for (unsigned int i = 0; i < num_primitives; ++i) primitive_indices_[i] = i;
-  recursiveBuildTree(0, 0, num_primitives);
+
+  const std::size_t num_threads = internal::getNumThreads(num_build_threads);
+  if (num_threads <= 1) {
+    num_bvs = 1;
+    recursiveBuildTree(0, 0, num_primitives);
+  } else {
+    // Build the top of the hierarchy serially, splitting the largest
+    // subtree first, until there are enough subtrees to balance the load
+    // between the threads. The subtrees do not share any node nor primitive,
+    // and their node indices are known in advance, so that the hierarchy is
+    // identical to the one built serially.
+    static const unsigned int min_parallel_build_size = 1024;
+    BuildTask root = {0, 0, num_primitives, 1};
+    std::vector<BuildTask> tasks(1, root);
+    while (tasks.size() < 4 * num_threads) {
+      std::size_t largest = 0;
+      for (std::size_t i = 1; i < tasks.size(); ++i)
+        if (tasks[i].num_primitives > tasks[largest].num_primitives)
+          largest = i;
+      if (tasks[largest].num_primitives < min_parallel_build_size) break;
+      const BuildTask task = tasks[largest];
+      tasks.erase(tasks.begin() + static_cast<std::ptrdiff_t>(largest));
+      recursiveBuildTree(*bv_splitter, task, &tasks);
+    }
+    std::sort(tasks.begin(), tasks.end(),
+              [](const BuildTask& a, const BuildTask& b) {
+                return a.num_primitives > b.num_primitives;
+              });
+
+    std::vector<BVSplitter<BV>> splitters(num_threads, *bv_splitter);
+    internal::parallelFor(tasks.size(), num_threads,
+                          [&](std::size_t task_id, std::size_t thread_id) {
+                            recursiveBuildTree(splitters[thread_id],
+                                               tasks[task_id], NULL);
+                          });
+    num_bvs = 2 * num_primitives - 1;
+  }
 
   bv_fitter->clear();
   bv_splitter->clear();
@@ -892,14 +986,25 @@ int BVHModel<BV>::buildTree() {
 template <typename BV>
 int BVHModel<BV>::recursiveBuildTree(int bv_id, unsigned int first_primitive,
                                      unsigned int num_primitives) {
+  BuildTask task = {bv_id, first_primitive, num_primitives, (int)num_bvs};
+  num_bvs += 2 * num_primitives - 2;
+  return recursiveBuildTree(*bv_splitter, task, NULL);
+}
+
+template <typename BV>
+int BVHModel<BV>::recursiveBuildTree(BVSplitter<BV>& splitter,
+                                     const BuildTask& task,
+                                     std::vector<BuildTask>* children) {
+  const unsigned int first_primitive = task.first_primitive;
+  const unsigned int num_primitives = task.num_primitives;
   BVHModelType type = getModelType();
-  BVNode<BV>* bvnode = bvs->data() + bv_id;
+  BVNode<BV>* bvnode = bvs->data() + task.bv_id;
   unsigned int* cur_primitive_indices =
       primitive_indices->data() + first_primitive;
 
   // constructing BV
   BV bv = bv_fitter->fit(cur_primitive_indices, num_primitives);
-  bv_splitter->computeRule(bv, cur_primitive_indices, num_primitives);
+  splitter.computeRule(bv, cur_primitive_indices, num_primitives);
 
   bvnode->bv = bv;
   bvnode->first_primitive = first_primitive;
@@ -908,8 +1013,7 @@ int BVHModel<BV>::recursiveBuildTree(int bv_id, unsigned int first_primitive,
   if (num_primitives == 1) {
     bvnode->first_child = -((int)(*cur_primitive_indices) + 1);
   } else {
-    bvnode->first_child = (int)num_bvs;
-    num_bvs += 2;
+    bvnode->first_child = task.first_free_bv;
 
     unsigned int c1 = 0;
     const std::vector<Vec3s>& vertices_ = *vertices;
@@ -936,7 +1040,7 @@ int BVHModel<BV>::recursiveBuildTree(int bv_id, unsigned int first_primitive,
       //  [1] [1] [1] [1] [2] [2] [2] [x] [x] ... [x]
       //                   c1          i
       //
-      if (bv_splitter->apply(p))  // in the right side
+      if (splitter.apply(p))  // in the right side
       {
         // do nothing
       } else {
@@ -951,9 +1055,21 @@ int BVHModel<BV>::recursiveBuildTree(int bv_id, unsigned int first_primitive,
 
     const unsigned int num_first_half = c1;
 
-    recursiveBuildTree(bvnode->leftChild(), first_primitive, num_first_half);
-    recursiveBuildTree(bvnode->rightChild(), first_primitive + num_first_half,
-                       num_primitives - num_first_half);
+    // The descendants of the left child come first, followed by the ones of
+    // the right child.
+    const BuildTask left = {bvnode->leftChild(), first_primitive,
+                            num_first_half, task.first_free_bv + 2};
+    const BuildTask right = {bvnode->rightChild(),
+                             first_primitive + num_first_half,
+                             num_primitives - num_first_half,
+                             task.first_free_bv + 2 * (int)num_first_half};
+    if (children) {
+      children->push_back(left);
+      children->push_back(right);
+    } else {
+      recursiveBuildTree(splitter, left, NULL);
+      recursiveBuildTree(splitter, right, NULL);
+    }
   }
 
   return BVH_OK;
@@ -984,51 +1100,7 @@ template <typename BV>
 int BVHModel<BV>::recursiveRefitTree_bottomup(int bv_id) {
   BVNode<BV>* bvnode = bvs->data() + bv_id;
   if (bvnode->isLeaf()) {
-    BVHModelType type = getModelType();
-    int primitive_id = -(bvnode->first_child + 1);
-    if (type == BVH_MODEL_POINTCLOUD) {
-      BV bv;
-
-      if (prev_vertices.get()) {
-        Vec3s v[2];
-        v[0] = (*prev_vertices)[static_cast<size_t>(primitive_id)];
-        v[1] = (*vertices)[static_cast<size_t>(primitive_id)];
-        fit(v, 2, bv);
-      } else
-        fit(vertices->data() + primitive_id, 1, bv);
-
-      bvnode->bv = bv;
-    } else if (type == BVH_MODEL_TRIANGLES) {
-      BV bv;
-      const Triangle32& triangle =
-          (*tri_indices)[static_cast<size_t>(primitive_id)];
-
-      if (prev_vertices.get()) {
-        Vec3s v[6];
-        for (Triangle32::IndexType i = 0; i < 3; ++i) {
-          v[i] = (*prev_vertices)[triangle[i]];
-          v[i + 3] = (*vertices)[triangle[i]];
-        }
-
-        fit(v, 6, bv);
-      } else {
-        // TODO use bv_fitter to build BV. See comment in refitTree_bottomup
-        // unsigned int* cur_primitive_indices = primitive_indices +
-        // bvnode->first_primitive; bv = bv_fitter->fit(cur_primitive_indices,
-        // bvnode->num_primitives);
-        Vec3s v[3];
-        for (int i = 0; i < 3; ++i) {
-          v[i] = (*vertices)[triangle[(Triangle32::IndexType)i]];
-        }
-
-        fit(v, 3, bv);
-      }
-
-      bvnode->bv = bv;
-    } else {
-      std::cerr << "BVH Error: Model type not supported!" << std::endl;
-      return BVH_ERR_UNSUPPORTED_FUNCTION;
-    }
+    return refitLeaf(bv_id);
   } else {
     recursiveRefitTree_bottomup(bvnode->leftChild());
     recursiveRefitTree_bottomup(bvnode->rightChild());
@@ -1043,6 +1115,188 @@ int BVHModel<BV>::recursiveRefitTree_bottomup(int bv_id) {
   return BVH_OK;
 }
 
+template <typename BV>
+int BVHModel<BV>::refitLeaf(int bv_id) {
+  BVNode<BV>* bvnode = bvs->data() + bv_id;
+  BVHModelType type = getModelType();
+  int primitive_id = -(bvnode->first_child + 1);
+  if (type == BVH_MODEL_POINTCLOUD) {
+    BV bv;
+
+    if (prev_vertices.get()) {
+      Vec3s v[2];
+      v[0] = (*prev_vertices)[static_cast<size_t>(primitive_id)];
+      v[1] = (*vertices)[static_cast<size_t>(primitive_id)];
+      fit(v, 2, bv);
+    } else
+      fit(vertices->data() + primitive_id, 1, bv);
+
+    bvnode->bv = bv;
+  } else if (type == BVH_MODEL_TRIANGLES) {
+    BV bv;
+    const Triangle32& triangle =
+        (*tri_indices)[static_cast<size_t>(primitive_id)];
+
+    if (prev_vertices.get()) {
+      Vec3s v[6];
+      for (Triangle32::IndexType i = 0; i < 3; ++i) {
+        v[i] = (*prev_vertices)[triangle[i]];
+        v[i + 3] = (*vertices)[triangle[i]];
+      }
+
+      fit(v, 6, bv);
+    } else {
+      // TODO use bv_fitter to build BV. See comment in refitTree_bottomup
+      // unsigned int* cur_primitive_indices = primitive_indices +
+      // bvnode->first_primitive; bv = bv_fitter->fit(cur_primitive_indices,
+      // bvnode->num_primitives);
+      Vec3s v[3];
+      for (int i = 0; i < 3; ++i) {
+        v[i] = (*vertices)[triangle[(Triangle32::IndexType)i]];
+      }
+
+      fit(v, 3, bv);
+    }
+
+    bvnode->bv = bv;
+  } else {
+    std::cerr << "BVH Error: Model type not supported!" << std::endl;
+    return BVH_ERR_UNSUPPORTED_FUNCTION;
+  }
+
+  return BVH_OK;
+}
+
+template <typename BV>
+void BVHModel<BV>::computeRefitTopology() {
+  std::shared_ptr<RefitTopology> topology(new RefitTopology);
+  const bv_node_vector_t& bvs_ = *bvs;
+
+  topology->parents.assign(num_bvs, -1);
+  topology->depths.assign(num_bvs, 0);
+  // Children always come after their parent in bvs.
+  for (unsigned int i = 0; i < num_bvs; ++i) {
+    if (bvs_[i].isLeaf()) continue;
+    for (int child = bvs_[i].leftChild(); child <= bvs_[i].rightChild();
+         ++child) {
+      topology->parents[static_cast<size_t>(child)] = static_cast<int>(i);
+      topology->depths[static_cast<size_t>(child)] = topology->depths[i] + 1;
+    }
+  }
+
+  // Compressed lists of the leaves using each vertex.
+  const bool triangles = getModelType() == BVH_MODEL_TRIANGLES;
+  const unsigned int vertices_per_leaf = triangles ? 3 : 1;
+  std::vector<unsigned int>& offsets = topology->vertex_leaf_offsets;
+  offsets.assign(num_vertices + 1, 0);
+  for (unsigned int i = 0; i < num_bvs; ++i) {
+    if (!bvs_[i].isLeaf()) continue;
+    const unsigned int primitive_id =
+        static_cast<unsigned int>(bvs_[i].primitiveId());
+    for (unsigned int k = 0; k < vertices_per_leaf; ++k) {
+      const unsigned int vertex_id =
+          triangles ? (*tri_indices)[primitive_id][k] : primitive_id;
+      ++offsets[vertex_id + 1];
+    }
+  }
+  for (unsigned int v = 0; v < num_vertices; ++v) offsets[v + 1] += offsets[v];
+
+  std::vector<unsigned int> fill(offsets.begin(), offsets.end() - 1);
+  topology->vertex_leaves.resize(offsets[num_vertices]);
+  for (unsigned int i = 0; i < num_bvs; ++i) {
+    if (!bvs_[i].isLeaf()) continue;
+    const unsigned int primitive_id =
+        static_cast<unsigned int>(bvs_[i].primitiveId());
+    for (unsigned int k = 0; k < vertices_per_leaf; ++k) {
+      const unsigned int vertex_id =
+          triangles ? (*tri_indices)[primitive_id][k] : primitive_id;
+      topology->vertex_leaves[fill[vertex_id]++] = static_cast<int>(i);
+    }
+  }
+
+  refit_topology = topology;
+}
+
+template <typename BV>
+int BVHModel<BV>::refitTree_partial(
+    const std::vector<unsigned int>& vertex_ids, std::size_t num_threads) {
+  // Below this number of nodes, refitting in parallel is not worth the cost
+  // of starting the threads.
+  static const std::size_t min_parallel_refit_size = 4096;
+
+  BVHModelType type = getModelType();
+  if (type != BVH_MODEL_TRIANGLES && type != BVH_MODEL_POINTCLOUD) {
+    std::cerr << "BVH Error: Model type not supported!" << std::endl;
+    return BVH_ERR_UNSUPPORTED_FUNCTION;
+  }
+  if (!refit_topology.get()) computeRefitTopology();
+  const RefitTopology& topology = *refit_topology;
+  if (refit_marks.size() != num_bvs) refit_marks.assign(num_bvs, 0);
+
+  // Collect the leaves using the vertices, and then their ancestors. Each
+  // node is collected once.
+  std::vector<int> leaves;
+  for (std::size_t k = 0; k < vertex_ids.size(); ++k) {
+    const unsigned int v = vertex_ids[k];
+    for (unsigned int j = topology.vertex_leaf_offsets[v];
+         j < topology.vertex_leaf_offsets[v + 1]; ++j) {
+      const int leaf = topology.vertex_leaves[j];
+      if (refit_marks[static_cast<size_t>(leaf)]) continue;
+      refit_marks[static_cast<size_t>(leaf)] = 1;
+      leaves.push_back(leaf);
+    }
+  }
+  std::vector<int> nodes;
+  for (std::size_t k = 0; k < leaves.size(); ++k) {
+    int node = topology.parents[static_cast<size_t>(leaves[k])];
+    while (node >= 0 && !refit_marks[static_cast<size_t>(node)]) {
+      refit_marks[static_cast<size_t>(node)] = 1;
+      nodes.push_back(node);
+      node = topology.parents[static_cast<size_t>(node)];
+    }
+  }
+  for (std::size_t k = 0; k < leaves.size(); ++k)
+    refit_marks[static_cast<size_t>(leaves[k])] = 0;
+  for (std::size_t k = 0; k < nodes.size(); ++k)
+    refit_marks[static_cast<size_t>(nodes[k])] = 0;
+
+  // Refit the leaves, and then the internal nodes one level at a time, from
+  // the deepest one. The nodes of a level are independent from each other.
+  const std::size_t leaf_threads =
+      leaves.size() >= min_parallel_refit_size ? num_threads : 1;
+  internal::parallelFor(leaves.size(), leaf_threads,
+                        [&](std::size_t k, std::size_t) {
+                          refitLeaf(leaves[k]);
+                        });
+
+  const std::vector<unsigned int>& depths = topology.depths;
+  std::sort(nodes.begin(), nodes.end(), [&depths](int a, int b) {
+    return depths[static_cast<size_t>(a)] > depths[static_cast<size_t>(b)];
+  });
+  bv_node_vector_t& bvs_ = *bvs;
+  std::size_t level_begin = 0;
+  while (level_begin < nodes.size()) {
+    const unsigned int depth = depths[static_cast<size_t>(nodes[level_begin])];
+    std::size_t level_end = level_begin + 1;
+    while (level_end < nodes.size() &&
+           depths[static_cast<size_t>(nodes[level_end])] == depth)
+      ++level_end;
+
+    const std::size_t level_threads =
+        level_end - level_begin >= min_parallel_refit_size ? num_threads : 1;
+    internal::parallelFor(
+        level_end - level_begin, level_threads,
+        [&](std::size_t k, std::size_t) {
+          BVNode<BV>& node = bvs_[static_cast<size_t>(nodes[level_begin + k])];
+          node.bv = bvs_[static_cast<size_t>(node.leftChild())].bv +
+                    bvs_[static_cast<size_t>(node.rightChild())].bv;
+        });
+    level_begin = level_end;
+  }
+
+  return BVH_OK;
+}
+
 template <typename BV>
 int BVHModel<BV>::refitTree_topdown() {
   Vec3s* vertices_ = vertices.get() ? vertices->data() : NULL;
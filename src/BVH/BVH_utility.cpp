@@ -269,7 +269,11 @@ void getRadiusAndOriginAndRectangleSize(Vec3s* ps, Vec3s* ps2, Triangle32* ts,
 
   unsigned int size_P = ((ps2) ? 2 : 1) * ((ts) ? 3 : 1) * n;
 
-  Scalar(*P)[3] = new Scalar[size_P][3];
+  // Small sets of points, such as the bound vertices of the shapes, are
+  // projected in a buffer on the stack.
+  const unsigned int size_P_stack = 64;
+  Scalar P_stack[size_P_stack][3];
+  Scalar(*P)[3] = (size_P <= size_P_stack) ? P_stack : new Scalar[size_P][3];
 
   int P_id = 0;
 
@@ -477,7 +481,7 @@ void getRadiusAndOriginAndRectangleSize(Vec3s* ps, Vec3s* ps2, Triangle32* ts,
   l[0] = std::max<Scalar>(maxx - minx, 0);
   l[1] = std::max<Scalar>(maxy - miny, 0);
 
-  delete[] P;
+  if (P != P_stack) delete[] P;
 }
 
 /** @brief Compute the bounding volume extent and center for a set or subset of
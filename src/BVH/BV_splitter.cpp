@@ -36,9 +36,105 @@
 /** \author Jia Pan */
 
 #include "coal/internal/BV_splitter.h"
+#include "coal/BV/AABB.h"
+
+#include <limits>
 
 namespace coal {
 
+namespace {
+/// @brief Surface area of an AABB, up to a factor 2.
+inline Scalar halfArea(const AABB& aabb) {
+  const Vec3s e(aabb.max_ - aabb.min_);
+  return e[0] * e[1] + e[1] * e[2] + e[2] * e[0];
+}
+}  // namespace
+
+int computeSplitRule_binnedSAH(const Matrix3s& axes, const Vec3s* vertices,
+                               const Triangle32* triangles,
+                               const unsigned int* primitive_indices,
+                               unsigned int num_primitives, BVHModelType type,
+                               Scalar& split_value) {
+  static const int num_bins = 16;
+
+  // Bounds and centroids of the primitives, expressed in the frame of axes.
+  std::vector<AABB> bounds(num_primitives);
+  std::vector<Vec3s> centroids(num_primitives);
+  AABB centroid_bounds;
+  for (unsigned int i = 0; i < num_primitives; ++i) {
+    if (type == BVH_MODEL_TRIANGLES) {
+      const Triangle32& t = triangles[primitive_indices[i]];
+      const Vec3s& p1 = vertices[t[0]];
+      const Vec3s& p2 = vertices[t[1]];
+      const Vec3s& p3 = vertices[t[2]];
+      bounds[i] = AABB(axes.transpose() * p1, axes.transpose() * p2,
+                       axes.transpose() * p3);
+      centroids[i].noalias() = axes.transpose() * ((p1 + p2 + p3) / 3.);
+    } else {
+      centroids[i].noalias() =
+          axes.transpose() * vertices[primitive_indices[i]];
+      bounds[i] = AABB(centroids[i]);
+    }
+    centroid_bounds += centroids[i];
+  }
+
+  // Fallback when no split plane separates the centroids: middle of the
+  // longest extent.
+  const Vec3s extent(centroid_bounds.max_ - centroid_bounds.min_);
+  int best_axis;
+  extent.maxCoeff(&best_axis);
+  split_value = centroid_bounds.center()[best_axis];
+
+  Scalar best_cost = (std::numeric_limits<Scalar>::max)();
+  AABB bin_bounds[num_bins];
+  unsigned int bin_counts[num_bins];
+  Scalar right_areas[num_bins];
+  unsigned int right_counts[num_bins];
+  for (int axis = 0; axis < 3; ++axis) {
+    if (extent[axis] <= 0) continue;
+    const Scalar scale = Scalar(num_bins) / extent[axis];
+    const Scalar origin = centroid_bounds.min_[axis];
+
+    for (int b = 0; b < num_bins; ++b) {
+      bin_bounds[b] = AABB();
+      bin_counts[b] = 0;
+    }
+    for (unsigned int i = 0; i < num_primitives; ++i) {
+      int b = static_cast<int>((centroids[i][axis] - origin) * scale);
+      if (b >= num_bins) b = num_bins - 1;
+      bin_bounds[b] += bounds[i];
+      ++bin_counts[b];
+    }
+
+    // Sweep from the right to get the cost of the right side of each plane.
+    AABB acc;
+    unsigned int count = 0;
+    for (int b = num_bins - 1; b > 0; --b) {
+      acc += bin_bounds[b];
+      count += bin_counts[b];
+      right_areas[b] = (count > 0) ? halfArea(acc) : 0;
+      right_counts[b] = count;
+    }
+
+    // Sweep from the left and evaluate the plane between bins b and b+1.
+    acc = AABB();
+    count = 0;
+    for (int b = 0; b < num_bins - 1; ++b) {
+      acc += bin_bounds[b];
+      count += bin_counts[b];
+      if (count == 0 || right_counts[b + 1] == 0) continue;
+      const Scalar cost = halfArea(acc) * Scalar(count) +
+                          right_areas[b + 1] * Scalar(right_counts[b + 1]);
+      if (cost < best_cost) {
+        best_cost = cost;
+        best_axis = axis;
+        split_value = origin + Scalar(b + 1) / scale;
+      }
+    }
+  }
+  return best_axis;
+}
+
 template <typename BV>
 void computeSplitVector(const BV& bv, Vec3s& split_vector) {
   split_vector = bv.axes.col(0);
@@ -256,6 +352,46 @@ void BVSplitter<OBBRSS>::computeRule_median(const OBBRSS& bv,
                                    split_value);
 }
 
+template <>
+void BVSplitter<OBB>::computeRule_binnedSAH(const OBB& bv,
+                                            unsigned int* primitive_indices,
+                                            unsigned int num_primitives) {
+  split_axis = computeSplitRule_binnedSAH(bv.axes, vertices, tri_indices,
+                                          primitive_indices, num_primitives,
+                                          type, split_value);
+  split_vector = bv.axes.col(split_axis);
+}
+
+template <>
+void BVSplitter<RSS>::computeRule_binnedSAH(const RSS& bv,
+                                            unsigned int* primitive_indices,
+                                            unsigned int num_primitives) {
+  split_axis = computeSplitRule_binnedSAH(bv.axes, vertices, tri_indices,
+                                          primitive_indices, num_primitives,
+                                          type, split_value);
+  split_vector = bv.axes.col(split_axis);
+}
+
+template <>
+void BVSplitter<kIOS>::computeRule_binnedSAH(const kIOS& bv,
+                                             unsigned int* primitive_indices,
+                                             unsigned int num_primitives) {
+  split_axis = computeSplitRule_binnedSAH(bv.obb.axes, vertices, tri_indices,
+                                          primitive_indices, num_primitives,
+                                          type, split_value);
+  split_vector = bv.obb.axes.col(split_axis);
+}
+
+template <>
+void BVSplitter<OBBRSS>::computeRule_binnedSAH(const OBBRSS& bv,
+                                               unsigned int* primitive_indices,
+                                               unsigned int num_primitives) {
+  split_axis = computeSplitRule_binnedSAH(bv.obb.axes, vertices, tri_indices,
+                                          primitive_indices, num_primitives,
+                                          type, split_value);
+  split_vector = bv.obb.axes.col(split_axis);
+}
+
 template <>
 bool BVSplitter<OBB>::apply(const Vec3s& q) const {
   return split_vector.dot(Vec3s(q[0], q[1], q[2])) > split_value;
@@ -36,6 +36,11 @@
 /** @author Jia Pan */
 
 #include "coal/broadphase/broadphase_collision_manager.h"
+#include "coal/internal/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
 
 namespace coal {
 
@@ -66,6 +71,84 @@ struct DistanceCallBackFunctorWrapper : DistanceCallBackBase {
 
   DistanceCallBackFunctor const* m_functor;
 };
+
+/// @brief Collects all the pairs reported by a broadphase collision query.
+struct CollisionCallBackPairCollector : CollisionCallBackBase {
+  void init() override { pairs.clear(); }
+
+  bool collide(CollisionObject* o1, CollisionObject* o2) override {
+    pairs.push_back(CollisionObjectPair(o1, o2));
+    return false;
+  }
+
+  std::vector<CollisionObjectPair> pairs;
+};
+
+/// @brief Removes the pairs which appear several times, in any order of the
+/// two objects, and keeps the first occurrence of each pair in place.
+void removeDuplicatePairs(std::vector<CollisionObjectPair>& pairs) {
+  typedef std::pair<CollisionObjectPair, std::size_t> KeyAndIndex;
+  std::vector<KeyAndIndex> keys(pairs.size());
+  for (std::size_t i = 0; i < pairs.size(); ++i) {
+    CollisionObject* a = pairs[i].first;
+    CollisionObject* b = pairs[i].second;
+    if (std::less<CollisionObject*>()(b, a)) std::swap(a, b);
+    keys[i] = KeyAndIndex(CollisionObjectPair(a, b), i);
+  }
+  std::sort(keys.begin(), keys.end());
+
+  std::vector<bool> keep(pairs.size(), true);
+  for (std::size_t i = 1; i < keys.size(); ++i)
+    if (keys[i].first == keys[i - 1].first) keep[keys[i].second] = false;
+
+  std::size_t num_kept = 0;
+  for (std::size_t i = 0; i < pairs.size(); ++i)
+    if (keep[i]) pairs[num_kept++] = pairs[i];
+  pairs.resize(num_kept);
+}
+
+/// @brief Wraps the callback of one thread of a parallel query, so that all
+/// the threads stop as soon as one of the callbacks returns true.
+struct ParallelCollisionCallBack : CollisionCallBackBase {
+  ParallelCollisionCallBack(CollisionCallBackBase* callback,
+                            std::atomic<bool>* stop)
+      : m_callback(callback), m_stop(stop) {}
+
+  bool collide(CollisionObject* o1, CollisionObject* o2) override {
+    if (m_stop->load(std::memory_order_relaxed)) return true;
+    if ((*m_callback)(o1, o2)) {
+      m_stop->store(true, std::memory_order_relaxed);
+      return true;
+    }
+    return false;
+  }
+
+  CollisionCallBackBase* m_callback;
+  std::atomic<bool>* m_stop;
+};
+
+/// @brief Task of a parallel query calling the callback on a chunk of pairs.
+struct PairsCollisionTask {
+  /// @brief Number of pairs processed by one task.
+  static const std::size_t chunk_size = 16;
+
+  explicit PairsCollisionTask(const std::vector<CollisionObjectPair>& pairs)
+      : m_pairs(&pairs) {}
+
+  std::size_t numTasks() const {
+    return (m_pairs->size() + chunk_size - 1) / chunk_size;
+  }
+
+  void operator()(std::size_t task_id, CollisionCallBackBase* callback) const {
+    const std::vector<CollisionObjectPair>& pairs = *m_pairs;
+    const std::size_t end =
+        (std::min)(pairs.size(), (task_id + 1) * chunk_size);
+    for (std::size_t i = task_id * chunk_size; i < end; ++i)
+      if ((*callback)(pairs[i].first, pairs[i].second)) return;
+  }
+
+  const std::vector<CollisionObjectPair>* m_pairs;
+};
 }  // namespace detail
 
 //==============================================================================
@@ -136,6 +219,103 @@ void BroadPhaseCollisionManager::distance(
   this->distance(other_manager, &wrapper);
 }
 
+//==============================================================================
+void BroadPhaseCollisionManager::getCandidatePairs(
+    std::vector<CollisionObjectPair>& pairs) const {
+  detail::CollisionCallBackPairCollector collector;
+  collector.pairs.swap(pairs);
+  collector.init();
+  this->collide(&collector);
+  detail::removeDuplicatePairs(collector.pairs);
+  pairs.swap(collector.pairs);
+}
+
+//==============================================================================
+void BroadPhaseCollisionManager::getCandidatePairs(
+    BroadPhaseCollisionManager* other_manager,
+    std::vector<CollisionObjectPair>& pairs) const {
+  detail::CollisionCallBackPairCollector collector;
+  collector.pairs.swap(pairs);
+  collector.init();
+  this->collide(other_manager, &collector);
+  detail::removeDuplicatePairs(collector.pairs);
+  pairs.swap(collector.pairs);
+}
+
+//==============================================================================
+void BroadPhaseCollisionManager::collideParallel(
+    CollisionCallBackBase* callback, std::size_t num_threads) const {
+  std::unique_ptr<CollisionCallBackBase> probe(callback->clone());
+  if (!probe || internal::getNumThreads(num_threads) <= 1) {
+    this->collide(callback);
+    return;
+  }
+
+  // Broad phase: gather the candidate pairs with the serial traversal.
+  detail::CollisionCallBackPairCollector collector;
+  this->collide(&collector);
+
+  // Narrow phase: run the callbacks on chunks of pairs in parallel.
+  callback->init();
+  detail::PairsCollisionTask task(collector.pairs);
+  runParallelCollisionTasks(task.numTasks(), num_threads, callback, task);
+}
+
+//==============================================================================
+void BroadPhaseCollisionManager::collideParallel(
+    BroadPhaseCollisionManager* other_manager, CollisionCallBackBase* callback,
+    std::size_t num_threads) const {
+  std::unique_ptr<CollisionCallBackBase> probe(callback->clone());
+  if (!probe || internal::getNumThreads(num_threads) <= 1) {
+    this->collide(other_manager, callback);
+    return;
+  }
+
+  // Broad phase: gather the candidate pairs with the serial traversal.
+  detail::CollisionCallBackPairCollector collector;
+  this->collide(other_manager, &collector);
+
+  // Narrow phase: run the callbacks on chunks of pairs in parallel.
+  callback->init();
+  detail::PairsCollisionTask task(collector.pairs);
+  runParallelCollisionTasks(task.numTasks(), num_threads, callback, task);
+}
+
+//==============================================================================
+bool BroadPhaseCollisionManager::runParallelCollisionTasks(
+    std::size_t num_tasks, std::size_t num_threads,
+    CollisionCallBackBase* callback, const CollisionTaskFunction& task) const {
+  num_threads = internal::getNumThreads(num_threads);
+  if (num_threads > num_tasks)
+    num_threads = (std::max)(num_tasks, std::size_t(1));
+
+  // One copy of the callback per thread.
+  std::vector<std::unique_ptr<CollisionCallBackBase> > callbacks(num_threads);
+  for (std::size_t i = 0; i < num_threads; ++i) {
+    callbacks[i].reset(callback->clone());
+    if (!callbacks[i]) return false;
+    callbacks[i]->init();
+  }
+
+  std::atomic<bool> stop(false);
+  std::vector<detail::ParallelCollisionCallBack> wrappers;
+  wrappers.reserve(num_threads);
+  for (std::size_t i = 0; i < num_threads; ++i)
+    wrappers.push_back(
+        detail::ParallelCollisionCallBack(callbacks[i].get(), &stop));
+
+  internal::parallelFor(
+      num_tasks, num_threads,
+      [&stop, &wrappers, &task](std::size_t task_id, std::size_t thread_id) {
+        if (stop.load(std::memory_order_relaxed)) return;
+        task(task_id, &wrappers[thread_id]);
+      });
+
+  // Merge in the order of the threads.
+  for (std::size_t i = 0; i < num_threads; ++i) callback->merge(*callbacks[i]);
+  return true;
+}
+
 //==============================================================================
 void BroadPhaseCollisionManager::update(
     const std::vector<CollisionObject*>& updated_objs) {
@@ -35,11 +35,7 @@
 
 /** @author Jia Pan */
 
-#ifndef COAL_BROADPHASE_BROADPHASECONTINUOUSCOLLISIONMANAGER_INL_H
-#define COAL_BROADPHASE_BROADPHASECONTINUOUSCOLLISIONMANAGER_INL_H
-
 #include "coal/broadphase/broadphase_continuous_collision_manager.h"
-#include <algorithm>
 
 namespace coal {
 
@@ -49,20 +45,17 @@ BroadPhaseContinuousCollisionManager::BroadPhaseContinuousCollisionManager() {
 }
 
 //==============================================================================
-
 BroadPhaseContinuousCollisionManager::~BroadPhaseContinuousCollisionManager() {
   // Do nothing
 }
 
 //==============================================================================
-
 void BroadPhaseContinuousCollisionManager::registerObjects(
     const std::vector<ContinuousCollisionObject*>& other_objs) {
   for (size_t i = 0; i < other_objs.size(); ++i) registerObject(other_objs[i]);
 }
 
 //==============================================================================
-
 void BroadPhaseContinuousCollisionManager::update(
     ContinuousCollisionObject* updated_obj) {
   COAL_UNUSED_VARIABLE(updated_obj);
@@ -71,7 +64,6 @@ void BroadPhaseContinuousCollisionManager::update(
 }
 
 //==============================================================================
-
 void BroadPhaseContinuousCollisionManager::update(
     const std::vector<ContinuousCollisionObject*>& updated_objs) {
   COAL_UNUSED_VARIABLE(updated_objs);
@@ -80,5 +72,3 @@ void BroadPhaseContinuousCollisionManager::update(
 }
 
 }  // namespace coal
-
-#endif
@@ -0,0 +1,311 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "coal/broadphase/broadphase_continuous_dynamic_AABB_tree.h"
+#include "coal/tracy.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace coal {
+namespace detail {
+
+namespace continuous_dynamic_AABB_tree {
+
+typedef DynamicAABBTreeContinuousCollisionManager::DynamicAABBNode
+    DynamicAABBNode;
+
+//==============================================================================
+bool collisionRecurse(DynamicAABBNode* root1, DynamicAABBNode* root2,
+                      ContinuousCollisionCallBackBase* callback) {
+  if (!root1->bv.overlap(root2->bv)) return false;
+
+  if (root1->isLeaf() && root2->isLeaf()) {
+    return (*callback)(static_cast<ContinuousCollisionObject*>(root1->data),
+                       static_cast<ContinuousCollisionObject*>(root2->data));
+  }
+
+  if (root2->isLeaf() ||
+      (!root1->isLeaf() && (root1->bv.size() > root2->bv.size()))) {
+    if (collisionRecurse(root1->children[0], root2, callback)) return true;
+    if (collisionRecurse(root1->children[1], root2, callback)) return true;
+  } else {
+    if (collisionRecurse(root1, root2->children[0], callback)) return true;
+    if (collisionRecurse(root1, root2->children[1], callback)) return true;
+  }
+  return false;
+}
+
+//==============================================================================
+bool collisionRecurse(DynamicAABBNode* root, ContinuousCollisionObject* query,
+                      ContinuousCollisionCallBackBase* callback) {
+  if (!root->bv.overlap(query->getAABB())) return false;
+
+  if (root->isLeaf()) {
+    return (*callback)(static_cast<ContinuousCollisionObject*>(root->data),
+                       query);
+  }
+
+  size_t select_res =
+      select(query->getAABB(), *(root->children[0]), *(root->children[1]));
+
+  if (collisionRecurse(root->children[select_res], query, callback))
+    return true;
+
+  if (collisionRecurse(root->children[1 - select_res], query, callback))
+    return true;
+
+  return false;
+}
+
+//==============================================================================
+bool selfCollisionRecurse(DynamicAABBNode* root,
+                          ContinuousCollisionCallBackBase* callback) {
+  if (root->isLeaf()) return false;
+
+  if (selfCollisionRecurse(root->children[0], callback)) return true;
+
+  if (selfCollisionRecurse(root->children[1], callback)) return true;
+
+  if (collisionRecurse(root->children[0], root->children[1], callback))
+    return true;
+
+  return false;
+}
+
+}  // namespace continuous_dynamic_AABB_tree
+
+}  // namespace detail
+
+//==============================================================================
+DynamicAABBTreeContinuousCollisionManager::
+    DynamicAABBTreeContinuousCollisionManager() {
+  max_tree_nonbalanced_level = 10;
+  tree_incremental_balance_pass = 10;
+  dtree.bu_threshold = 2;
+  dtree.topdown_level = 0;
+  tree_init_level = 0;
+  setup_ = false;
+}
+
+//==============================================================================
+void DynamicAABBTreeContinuousCollisionManager::registerObjects(
+    const std::vector<ContinuousCollisionObject*>& other_objs) {
+  if (other_objs.empty()) return;
+
+  if (size() > 0) {
+    Base::registerObjects(other_objs);
+  } else {
+    std::vector<DynamicAABBNode*> leaves(other_objs.size());
+    table.rehash(other_objs.size());
+    for (size_t i = 0, size = other_objs.size(); i < size; ++i) {
+      DynamicAABBNode* node =
+          new DynamicAABBNode;  // node will be managed by the dtree
+      node->bv = other_objs[i]->getAABB();
+      node->parent = nullptr;
+      node->children[1] = nullptr;
+      node->data = other_objs[i];
+      table[other_objs[i]] = node;
+      leaves[i] = node;
+    }
+
+    dtree.init(leaves, tree_init_level);
+
+    setup_ = true;
+  }
+}
+
+//==============================================================================
+void DynamicAABBTreeContinuousCollisionManager::registerObject(
+    ContinuousCollisionObject* obj) {
+  DynamicAABBNode* node = dtree.insert(obj->getAABB(), obj);
+  table[obj] = node;
+  setup_ = false;
+}
+
+//==============================================================================
+void DynamicAABBTreeContinuousCollisionManager::unregisterObject(
+    ContinuousCollisionObject* obj) {
+  const auto it = table.find(obj);
+  if (it == table.end()) return;
+  dtree.remove(it->second);
+  table.erase(it);
+  setup_ = false;
+}
+
+//==============================================================================
+void DynamicAABBTreeContinuousCollisionManager::setup() {
+  if (!setup_) {
+    size_t num = dtree.size();
+    if (num == 0) {
+      setup_ = true;
+      return;
+    }
+
+    size_t height = dtree.getMaxHeight();
+
+    if (((Scalar)height - std::log((Scalar)num) / std::log(2.0)) <
+        max_tree_nonbalanced_level)
+      dtree.balanceIncremental(tree_incremental_balance_pass);
+    else
+      dtree.balanceTopdown();
+
+    setup_ = true;
+  }
+}
+
+//==============================================================================
+void DynamicAABBTreeContinuousCollisionManager::update() {
+  for (auto it = table.cbegin(); it != table.cend(); ++it) {
+    it->second->bv = it->first->getAABB();
+  }
+
+  dtree.refit();
+  setup_ = false;
+
+  setup();
+}
+
+//==============================================================================
+void DynamicAABBTreeContinuousCollisionManager::update_(
+    ContinuousCollisionObject* updated_obj) {
+  const auto it = table.find(updated_obj);
+  if (it != table.end()) {
+    DynamicAABBNode* node = it->second;
+    if (!(node->bv == updated_obj->getAABB()))
+      dtree.update(node, updated_obj->getAABB());
+  }
+  setup_ = false;
+}
+
+//==============================================================================
+void DynamicAABBTreeContinuousCollisionManager::update(
+    ContinuousCollisionObject* updated_obj) {
+  update_(updated_obj);
+  setup();
+}
+
+//==============================================================================
+void DynamicAABBTreeContinuousCollisionManager::update(
+    const std::vector<ContinuousCollisionObject*>& updated_objs) {
+  for (size_t i = 0, size = updated_objs.size(); i < size; ++i)
+    update_(updated_objs[i]);
+  setup();
+}
+
+//==============================================================================
+void DynamicAABBTreeContinuousCollisionManager::clear() {
+  dtree.clear();
+  table.clear();
+}
+
+//==============================================================================
+void DynamicAABBTreeContinuousCollisionManager::getObjects(
+    std::vector<ContinuousCollisionObject*>& objs) const {
+  objs.resize(this->size());
+  std::transform(
+      table.begin(), table.end(), objs.begin(),
+      std::bind(&DynamicAABBTable::value_type::first, std::placeholders::_1));
+}
+
+//==============================================================================
+void DynamicAABBTreeContinuousCollisionManager::collide(
+    ContinuousCollisionObject* obj,
+    ContinuousCollisionCallBackBase* callback) const {
+  COAL_TRACY_ZONE_SCOPED_N(
+      "coal::DynamicAABBTreeContinuousCollisionManager::collide("
+      "ContinuousCollisionObject*, ContinuousCollisionCallBackBase*)");
+  callback->init();
+  if (size() == 0) return;
+  detail::continuous_dynamic_AABB_tree::collisionRecurse(dtree.getRoot(), obj,
+                                                         callback);
+}
+
+//==============================================================================
+void DynamicAABBTreeContinuousCollisionManager::collide(
+    ContinuousCollisionCallBackBase* callback) const {
+  COAL_TRACY_ZONE_SCOPED_N(
+      "coal::DynamicAABBTreeContinuousCollisionManager::collide("
+      "ContinuousCollisionCallBackBase*)");
+  callback->init();
+  if (size() == 0) return;
+  detail::continuous_dynamic_AABB_tree::selfCollisionRecurse(dtree.getRoot(),
+                                                             callback);
+}
+
+//==============================================================================
+void DynamicAABBTreeContinuousCollisionManager::collide(
+    BroadPhaseContinuousCollisionManager* other_manager_,
+    ContinuousCollisionCallBackBase* callback) const {
+  COAL_TRACY_ZONE_SCOPED_N(
+      "coal::DynamicAABBTreeContinuousCollisionManager::collide("
+      "BroadPhaseContinuousCollisionManager*, "
+      "ContinuousCollisionCallBackBase*)");
+  callback->init();
+  if ((size() == 0) || other_manager_->empty()) return;
+  const DynamicAABBTreeContinuousCollisionManager* other_manager =
+      dynamic_cast<const DynamicAABBTreeContinuousCollisionManager*>(
+          other_manager_);
+  if (other_manager) {
+    detail::continuous_dynamic_AABB_tree::collisionRecurse(
+        dtree.getRoot(), other_manager->dtree.getRoot(), callback);
+  } else {
+    std::vector<ContinuousCollisionObject*> other_objs;
+    other_manager_->getObjects(other_objs);
+    for (size_t i = 0; i < other_objs.size(); ++i) {
+      if (detail::continuous_dynamic_AABB_tree::collisionRecurse(
+              dtree.getRoot(), other_objs[i], callback))
+        return;
+    }
+  }
+}
+
+//==============================================================================
+bool DynamicAABBTreeContinuousCollisionManager::empty() const {
+  return dtree.empty();
+}
+
+//==============================================================================
+size_t DynamicAABBTreeContinuousCollisionManager::size() const {
+  return dtree.size();
+}
+
+//==============================================================================
+const detail::HierarchyTree<AABB>&
+DynamicAABBTreeContinuousCollisionManager::getTree() const {
+  return dtree;
+}
+
+}  // namespace coal
@@ -36,6 +36,7 @@
 /** @author Jia Pan */
 
 #include "coal/broadphase/broadphase_dynamic_AABB_tree.h"
+#include "coal/internal/parallel.h"
 #include "coal/tracy.hh"
 
 #ifdef COAL_HAVE_OCTOMAP
@@ -405,6 +406,66 @@ bool selfCollisionRecurse(
   return false;
 }
 
+//==============================================================================
+/// @brief Number of tasks per thread generated by splitCollisionTasks. The
+/// subtrees have very different sizes, so we need more tasks than threads to
+/// balance the load.
+const std::size_t parallel_tasks_per_thread = 16;
+
+//==============================================================================
+/// @brief Independent subtask of a collision traversal: self collision of
+/// node1 if node2 is null, collision between node1 and node2 otherwise.
+struct CollisionTask {
+  DynamicAABBTreeCollisionManager::DynamicAABBNode* node1;
+  DynamicAABBTreeCollisionManager::DynamicAABBNode* node2;
+};
+
+//==============================================================================
+/// @brief Splits the tasks breadth first, following the same rules as
+/// selfCollisionRecurse and collisionRecurse, until there are at least
+/// min_num_tasks tasks or no task can be split anymore.
+void splitCollisionTasks(std::vector<CollisionTask>& tasks,
+                         std::size_t min_num_tasks) {
+  std::vector<CollisionTask> current, next, done;
+  current.swap(tasks);
+  while (!current.empty() && current.size() + done.size() < min_num_tasks) {
+    next.clear();
+    for (const CollisionTask& task : current) {
+      DynamicAABBTreeCollisionManager::DynamicAABBNode* node1 = task.node1;
+      DynamicAABBTreeCollisionManager::DynamicAABBNode* node2 = task.node2;
+      if (node2 == nullptr) {
+        if (node1->isLeaf()) continue;
+        next.push_back({node1->children[0], nullptr});
+        next.push_back({node1->children[1], nullptr});
+        next.push_back({node1->children[0], node1->children[1]});
+      } else if (node1->isLeaf() && node2->isLeaf()) {
+        done.push_back(task);
+      } else if (nodeCollide(node1, node2)) {
+        if (node2->isLeaf() ||
+            (!node1->isLeaf() && (node1->bv.size() > node2->bv.size()))) {
+          next.push_back({node1->children[0], node2});
+          next.push_back({node1->children[1], node2});
+        } else {
+          next.push_back({node1, node2->children[0]});
+          next.push_back({node1, node2->children[1]});
+        }
+      }
+    }
+    current.swap(next);
+  }
+  tasks.swap(done);
+  tasks.insert(tasks.end(), current.begin(), current.end());
+}
+
+//==============================================================================
+/// @brief Runs one task produced by splitCollisionTasks.
+bool runCollisionTask(const CollisionTask& task,
+                      CollisionCallBackBase* callback) {
+  if (task.node2 == nullptr)
+    return selfCollisionRecurse(task.node1, callback);
+  return collisionRecurse(task.node1, task.node2, callback);
+}
+
 //==============================================================================
 bool distanceRecurse(DynamicAABBTreeCollisionManager::DynamicAABBNode* root1,
                      DynamicAABBTreeCollisionManager::DynamicAABBNode* root2,
@@ -771,6 +832,51 @@ void DynamicAABBTreeCollisionManager::distance(
       dtree.getRoot(), other_manager->dtree.getRoot(), callback, min_dist);
 }
 
+//==============================================================================
+void DynamicAABBTreeCollisionManager::collideParallel(
+    CollisionCallBackBase* callback, std::size_t num_threads) const {
+  COAL_TRACY_ZONE_SCOPED_N(
+      "coal::DynamicAABBTreeCollisionManager::collideParallel("
+      "CollisionCallBackBase*, std::size_t)");
+  callback->init();
+  if (size() == 0) return;
+  std::vector<detail::dynamic_AABB_tree::CollisionTask> tasks;
+  tasks.push_back({dtree.getRoot(), nullptr});
+  detail::dynamic_AABB_tree::splitCollisionTasks(
+      tasks, detail::dynamic_AABB_tree::parallel_tasks_per_thread *
+                 internal::getNumThreads(num_threads));
+  if (!runParallelCollisionTasks(
+          tasks.size(), num_threads, callback,
+          [&tasks](std::size_t task_id, CollisionCallBackBase* cb) {
+            detail::dynamic_AABB_tree::runCollisionTask(tasks[task_id], cb);
+          }))
+    collide(callback);
+}
+
+//==============================================================================
+void DynamicAABBTreeCollisionManager::collideParallel(
+    BroadPhaseCollisionManager* other_manager_,
+    CollisionCallBackBase* callback, std::size_t num_threads) const {
+  COAL_TRACY_ZONE_SCOPED_N(
+      "coal::DynamicAABBTreeCollisionManager::collideParallel("
+      "BroadPhaseCollisionManager*, CollisionCallBackBase*, std::size_t)");
+  callback->init();
+  DynamicAABBTreeCollisionManager* other_manager =
+      static_cast<DynamicAABBTreeCollisionManager*>(other_manager_);
+  if ((size() == 0) || (other_manager->size() == 0)) return;
+  std::vector<detail::dynamic_AABB_tree::CollisionTask> tasks;
+  tasks.push_back({dtree.getRoot(), other_manager->dtree.getRoot()});
+  detail::dynamic_AABB_tree::splitCollisionTasks(
+      tasks, detail::dynamic_AABB_tree::parallel_tasks_per_thread *
+                 internal::getNumThreads(num_threads));
+  if (!runParallelCollisionTasks(
+          tasks.size(), num_threads, callback,
+          [&tasks](std::size_t task_id, CollisionCallBackBase* cb) {
+            detail::dynamic_AABB_tree::runCollisionTask(tasks[task_id], cb);
+          }))
+    collide(other_manager_, callback);
+}
+
 //==============================================================================
 bool DynamicAABBTreeCollisionManager::empty() const { return dtree.empty(); }
 
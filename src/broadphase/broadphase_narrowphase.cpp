@@ -0,0 +1,143 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "coal/broadphase/broadphase_narrowphase.h"
+#include "coal/collision.h"
+#include "coal/distance.h"
+#include "coal/internal/parallel.h"
+#include "coal/tracy.hh"
+
+#include <algorithm>
+#include <memory>
+
+namespace coal {
+
+namespace detail {
+
+/// @brief Number of pairs processed by one task of the narrow phase driver.
+const std::size_t narrowphase_chunk_size = 32;
+
+/// @brief Buffers of one thread of the narrow phase driver.
+template <typename BatchQuery, typename Request, typename Result>
+struct NarrowPhaseWorkspace {
+  BatchQuery query;
+  std::vector<GeometryPair> pairs;
+  /// @brief One copy of the request per pair: the queries write the cached
+  /// GJK guess back into their request (QueryRequest::updateGuess).
+  std::vector<Request> requests;
+  std::vector<Result> results;
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/// @brief Runs query on the chunks of pairs in parallel. query_chunk is
+/// called as query_chunk(workspace) once the pairs of a chunk are in
+/// workspace.pairs, with a copy of request for each of them in
+/// workspace.requests, and returns the number of pairs in collision.
+template <typename BatchQuery, typename Request, typename Result,
+          typename QueryChunk>
+std::size_t runNarrowPhase(const std::vector<CollisionObjectPair>& pairs,
+                           const Request& request,
+                           std::vector<Result>& results,
+                           std::size_t num_threads, QueryChunk query_chunk) {
+  typedef NarrowPhaseWorkspace<BatchQuery, Request, Result> Workspace;
+
+  results.resize(pairs.size());
+  const std::size_t num_tasks =
+      (pairs.size() + narrowphase_chunk_size - 1) / narrowphase_chunk_size;
+  num_threads = (std::min)(internal::getNumThreads(num_threads),
+                           (std::max)(num_tasks, std::size_t(1)));
+
+  std::vector<std::unique_ptr<Workspace> > workspaces(num_threads);
+  std::vector<std::size_t> counts(num_threads, 0);
+  for (std::size_t i = 0; i < num_threads; ++i)
+    workspaces[i].reset(new Workspace());
+
+  internal::parallelFor(
+      num_tasks, num_threads,
+      [&](std::size_t task_id, std::size_t thread_id) {
+        Workspace& ws = *workspaces[thread_id];
+        const std::size_t begin = task_id * narrowphase_chunk_size;
+        const std::size_t end =
+            (std::min)(pairs.size(), begin + narrowphase_chunk_size);
+
+        ws.pairs.clear();
+        for (std::size_t i = begin; i < end; ++i)
+          ws.pairs.push_back(GeometryPair(pairs[i].first, pairs[i].second));
+        ws.requests.assign(end - begin, request);
+        ws.results.resize(end - begin);
+        for (std::size_t i = 0; i < ws.results.size(); ++i)
+          ws.results[i].clear();
+
+        counts[thread_id] += query_chunk(ws);
+        for (std::size_t i = begin; i < end; ++i)
+          results[i] = ws.results[i - begin];
+      });
+
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < num_threads; ++i) count += counts[i];
+  return count;
+}
+
+}  // namespace detail
+
+std::size_t collide(const std::vector<CollisionObjectPair>& pairs,
+                    const CollisionRequest& request,
+                    std::vector<CollisionResult>& results,
+                    std::size_t num_threads) {
+  COAL_TRACY_ZONE_SCOPED_N("coal::collide(candidate pairs)");
+  typedef detail::NarrowPhaseWorkspace<BatchCollision, CollisionRequest,
+                                       CollisionResult>
+      Workspace;
+  return detail::runNarrowPhase<BatchCollision>(
+      pairs, request, results, num_threads, [](Workspace& ws) {
+        return ws.query(ws.pairs, ws.requests, ws.results);
+      });
+}
+
+void distance(const std::vector<CollisionObjectPair>& pairs,
+              const DistanceRequest& request,
+              std::vector<DistanceResult>& results, std::size_t num_threads) {
+  COAL_TRACY_ZONE_SCOPED_N("coal::distance(candidate pairs)");
+  typedef detail::NarrowPhaseWorkspace<BatchDistance, DistanceRequest,
+                                       DistanceResult>
+      Workspace;
+  detail::runNarrowPhase<BatchDistance>(
+      pairs, request, results, num_threads, [](Workspace& ws) -> std::size_t {
+        ws.query(ws.pairs, ws.requests, ws.results);
+        return std::size_t(0);
+      });
+}
+
+}  // namespace coal
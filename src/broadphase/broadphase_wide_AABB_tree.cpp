@@ -0,0 +1,415 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "coal/broadphase/broadphase_wide_AABB_tree.h"
+#include "coal/tracy.hh"
+
+#include <algorithm>
+#include <limits>
+
+// SSE2 is part of x86-64, so the SIMD overlap test is enabled by default on
+// this architecture. AVX is used when the library is built with it (e.g.
+// with -march=native).
+#if defined(__AVX__) || defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define COAL_WIDE_AABB_TREE_HAS_SSE2
+#include <immintrin.h>
+#endif
+
+namespace coal {
+namespace detail {
+namespace wide_AABB_tree {
+
+typedef WideAABBTree::Node Node;
+typedef WideAABBTree::ChildIndex ChildIndex;
+
+//==============================================================================
+/// @brief Returns a mask whose bit i is set iff box overlaps the bounds of
+/// the i-th child of node.
+inline unsigned int overlapMask(const Node& node, const AABB& box) {
+#if defined(__AVX__) && !defined(COAL_USE_FLOAT_PRECISION)
+  __m256d mask = _mm256_castsi256_pd(_mm256_set1_epi32(-1));
+  for (int k = 0; k < 3; ++k) {
+    const __m256d box_min = _mm256_set1_pd(box.min_[k]);
+    const __m256d box_max = _mm256_set1_pd(box.max_[k]);
+    mask = _mm256_and_pd(
+        mask,
+        _mm256_cmp_pd(_mm256_loadu_pd(node.min[k]), box_max, _CMP_LE_OQ));
+    mask = _mm256_and_pd(
+        mask,
+        _mm256_cmp_pd(box_min, _mm256_loadu_pd(node.max[k]), _CMP_LE_OQ));
+  }
+  return static_cast<unsigned int>(_mm256_movemask_pd(mask));
+#elif defined(COAL_WIDE_AABB_TREE_HAS_SSE2) && \
+    !defined(COAL_USE_FLOAT_PRECISION)
+  // Two registers of 2 doubles.
+  __m128d mask01 = _mm_castsi128_pd(_mm_set1_epi32(-1));
+  __m128d mask23 = mask01;
+  for (int k = 0; k < 3; ++k) {
+    const __m128d box_min = _mm_set1_pd(box.min_[k]);
+    const __m128d box_max = _mm_set1_pd(box.max_[k]);
+    mask01 = _mm_and_pd(mask01,
+                        _mm_cmple_pd(_mm_loadu_pd(node.min[k]), box_max));
+    mask01 = _mm_and_pd(mask01,
+                        _mm_cmple_pd(box_min, _mm_loadu_pd(node.max[k])));
+    mask23 = _mm_and_pd(mask23,
+                        _mm_cmple_pd(_mm_loadu_pd(node.min[k] + 2), box_max));
+    mask23 = _mm_and_pd(mask23,
+                        _mm_cmple_pd(box_min, _mm_loadu_pd(node.max[k] + 2)));
+  }
+  return static_cast<unsigned int>(_mm_movemask_pd(mask01) |
+                                   (_mm_movemask_pd(mask23) << 2));
+#elif defined(COAL_WIDE_AABB_TREE_HAS_SSE2)
+  __m128 mask = _mm_castsi128_ps(_mm_set1_epi32(-1));
+  for (int k = 0; k < 3; ++k) {
+    const __m128 box_min = _mm_set1_ps(box.min_[k]);
+    const __m128 box_max = _mm_set1_ps(box.max_[k]);
+    mask = _mm_and_ps(mask, _mm_cmple_ps(_mm_loadu_ps(node.min[k]), box_max));
+    mask = _mm_and_ps(mask, _mm_cmple_ps(box_min, _mm_loadu_ps(node.max[k])));
+  }
+  return static_cast<unsigned int>(_mm_movemask_ps(mask));
+#else
+  unsigned int mask = 0;
+  for (int i = 0; i < WideAABBTree::width; ++i) {
+    const bool overlap =
+        node.min[0][i] <= box.max_[0] && box.min_[0] <= node.max[0][i] &&
+        node.min[1][i] <= box.max_[1] && box.min_[1] <= node.max[1][i] &&
+        node.min[2][i] <= box.max_[2] && box.min_[2] <= node.max[2][i];
+    mask |= static_cast<unsigned int>(overlap) << i;
+  }
+  return mask;
+#endif
+}
+
+//==============================================================================
+/// @brief Calls the callback on query and every object of the subtree of
+/// node_id whose AABB overlaps box, skipping the objects whose index is lower
+/// than first_object.
+bool collisionRecurse(const WideAABBTree& tree, std::size_t node_id,
+                      const AABB& box, CollisionObject* query,
+                      std::size_t first_object,
+                      CollisionCallBackBase* callback) {
+  const Node& node = tree.getNodes()[node_id];
+  unsigned int mask = overlapMask(node, box);
+  for (int i = 0; mask != 0; ++i, mask >>= 1) {
+    if (!(mask & 1)) continue;
+    const ChildIndex child = node.children[i];
+    if (WideAABBTree::isLeaf(child)) {
+      const std::size_t index = WideAABBTree::objectIndex(child);
+      if (index < first_object) continue;
+      if ((*callback)(tree.getObjects()[index], query)) return true;
+    } else if (collisionRecurse(tree, child, box, query, first_object,
+                                callback)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+//==============================================================================
+/// @brief Returns the bounds of the i-th child of node.
+AABB childBounds(const Node& node, int i) {
+  return AABB(Vec3s(node.min[0][i], node.min[1][i], node.min[2][i]),
+              Vec3s(node.max[0][i], node.max[1][i], node.max[2][i]));
+}
+
+//==============================================================================
+/// @brief Calls the callback on every pair made of one object of the subtree
+/// child1 of tree1 and one object of the subtree child2 of tree2 whose AABBs
+/// overlap. box1 and box2 are the bounds of the subtrees, which overlap.
+bool collisionRecurse(const WideAABBTree& tree1, ChildIndex child1,
+                      const AABB& box1, const WideAABBTree& tree2,
+                      ChildIndex child2, const AABB& box2,
+                      CollisionCallBackBase* callback) {
+  const bool leaf1 = WideAABBTree::isLeaf(child1);
+  const bool leaf2 = WideAABBTree::isLeaf(child2);
+  if (leaf1 && leaf2)
+    return (*callback)(
+        tree1.getObjects()[WideAABBTree::objectIndex(child1)],
+        tree2.getObjects()[WideAABBTree::objectIndex(child2)]);
+
+  if (leaf2 || (!leaf1 && box1.size() > box2.size())) {
+    const Node& node = tree1.getNodes()[child1];
+    unsigned int mask = overlapMask(node, box2);
+    for (int i = 0; mask != 0; ++i, mask >>= 1) {
+      if (!(mask & 1)) continue;
+      if (collisionRecurse(tree1, node.children[i], childBounds(node, i),
+                           tree2, child2, box2, callback))
+        return true;
+    }
+  } else {
+    const Node& node = tree2.getNodes()[child2];
+    unsigned int mask = overlapMask(node, box1);
+    for (int i = 0; mask != 0; ++i, mask >>= 1) {
+      if (!(mask & 1)) continue;
+      if (collisionRecurse(tree1, child1, box1, tree2, node.children[i],
+                           childBounds(node, i), callback))
+        return true;
+    }
+  }
+  return false;
+}
+
+//==============================================================================
+/// @brief Calls the callback on every pair of objects of the subtree node_id
+/// whose AABBs overlap.
+bool selfCollisionRecurse(const WideAABBTree& tree, std::size_t node_id,
+                          CollisionCallBackBase* callback) {
+  const Node& node = tree.getNodes()[node_id];
+  for (int i = 0; i < WideAABBTree::width; ++i) {
+    const ChildIndex child = node.children[i];
+    if (WideAABBTree::isNode(child) &&
+        selfCollisionRecurse(tree, child, callback))
+      return true;
+  }
+
+  // Pairs of overlapping children.
+  for (int i = 0; i + 1 < WideAABBTree::width; ++i) {
+    if (node.children[i] == WideAABBTree::empty_child) break;
+    const AABB box = childBounds(node, i);
+    unsigned int mask = overlapMask(node, box) >> (i + 1);
+    for (int j = i + 1; mask != 0; ++j, mask >>= 1) {
+      if (!(mask & 1)) continue;
+      if (collisionRecurse(tree, node.children[i], box, tree,
+                           node.children[j], childBounds(node, j), callback))
+        return true;
+    }
+  }
+  return false;
+}
+
+//==============================================================================
+/// @brief Calls the callback on query and the objects of the subtree of
+/// node_id which may be closer than min_dist, closest bounds first, skipping
+/// the objects whose index is lower than first_object.
+bool distanceRecurse(const WideAABBTree& tree, std::size_t node_id,
+                     const AABB& box, CollisionObject* query,
+                     std::size_t first_object, DistanceCallBackBase* callback,
+                     Scalar& min_dist) {
+  const Node& node = tree.getNodes()[node_id];
+  Scalar dist[WideAABBTree::width];
+  WideAABBTree::distances(node, box, dist);
+
+  // Visit the children by increasing distance.
+  int order[WideAABBTree::width];
+  for (int i = 0; i < WideAABBTree::width; ++i) {
+    int j = i;
+    for (; j > 0 && dist[order[j - 1]] > dist[i]; --j) order[j] = order[j - 1];
+    order[j] = i;
+  }
+
+  for (int k = 0; k < WideAABBTree::width; ++k) {
+    const int i = order[k];
+    if (!(dist[i] < min_dist)) break;
+    const ChildIndex child = node.children[i];
+    if (WideAABBTree::isLeaf(child)) {
+      const std::size_t index = WideAABBTree::objectIndex(child);
+      if (index < first_object) continue;
+      if ((*callback)(tree.getObjects()[index], query, min_dist)) return true;
+    } else if (distanceRecurse(tree, child, box, query, first_object,
+                               callback, min_dist)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace wide_AABB_tree
+}  // namespace detail
+
+//==============================================================================
+WideAABBTreeCollisionManager::WideAABBTreeCollisionManager() : setup_(false) {}
+
+//==============================================================================
+void WideAABBTreeCollisionManager::registerObjects(
+    const std::vector<CollisionObject*>& other_objs) {
+  if (other_objs.empty()) return;
+  if (tree.empty()) {
+    tree.build(other_objs);
+    setup_ = true;
+  } else {
+    for (std::size_t i = 0; i < other_objs.size(); ++i)
+      tree.insert(other_objs[i]);
+    setup_ = false;
+  }
+}
+
+//==============================================================================
+void WideAABBTreeCollisionManager::registerObject(CollisionObject* obj) {
+  tree.insert(obj);
+  setup_ = false;
+}
+
+//==============================================================================
+void WideAABBTreeCollisionManager::unregisterObject(CollisionObject* obj) {
+  tree.remove(obj);
+  setup_ = false;
+}
+
+//==============================================================================
+void WideAABBTreeCollisionManager::setup() {
+  if (!setup_) {
+    COAL_TRACY_ZONE_SCOPED_N("coal::WideAABBTreeCollisionManager::setup");
+    // Rebuild the tree, which insert and remove may have unbalanced.
+    const std::vector<CollisionObject*> objs(tree.getObjects());
+    tree.build(objs);
+    setup_ = true;
+  }
+}
+
+//==============================================================================
+void WideAABBTreeCollisionManager::update() { tree.refit(); }
+
+//==============================================================================
+void WideAABBTreeCollisionManager::update(CollisionObject* updated_obj) {
+  tree.update(updated_obj);
+}
+
+//==============================================================================
+void WideAABBTreeCollisionManager::update(
+    const std::vector<CollisionObject*>& updated_objs) {
+  for (std::size_t i = 0; i < updated_objs.size(); ++i)
+    tree.update(updated_objs[i]);
+}
+
+//==============================================================================
+void WideAABBTreeCollisionManager::clear() {
+  tree.clear();
+  setup_ = false;
+}
+
+//==============================================================================
+void WideAABBTreeCollisionManager::getObjects(
+    std::vector<CollisionObject*>& objs_) const {
+  objs_ = tree.getObjects();
+}
+
+//==============================================================================
+void WideAABBTreeCollisionManager::collide(
+    CollisionObject* obj, CollisionCallBackBase* callback) const {
+  COAL_TRACY_ZONE_SCOPED_N("coal::WideAABBTreeCollisionManager::collide");
+  callback->init();
+  if (tree.empty()) return;
+  detail::wide_AABB_tree::collisionRecurse(tree, 0, obj->getAABB(), obj, 0,
+                                           callback);
+}
+
+//==============================================================================
+void WideAABBTreeCollisionManager::distance(
+    CollisionObject* obj, DistanceCallBackBase* callback) const {
+  COAL_TRACY_ZONE_SCOPED_N("coal::WideAABBTreeCollisionManager::distance");
+  callback->init();
+  if (tree.empty()) return;
+  Scalar min_dist = (std::numeric_limits<Scalar>::max)();
+  detail::wide_AABB_tree::distanceRecurse(tree, 0, obj->getAABB(), obj, 0,
+                                          callback, min_dist);
+}
+
+//==============================================================================
+void WideAABBTreeCollisionManager::collide(
+    CollisionCallBackBase* callback) const {
+  COAL_TRACY_ZONE_SCOPED_N("coal::WideAABBTreeCollisionManager::collide");
+  callback->init();
+  if (tree.empty()) return;
+  detail::wide_AABB_tree::selfCollisionRecurse(tree, 0, callback);
+}
+
+//==============================================================================
+void WideAABBTreeCollisionManager::distance(
+    DistanceCallBackBase* callback) const {
+  COAL_TRACY_ZONE_SCOPED_N("coal::WideAABBTreeCollisionManager::distance");
+  callback->init();
+  if (tree.empty()) return;
+  Scalar min_dist = (std::numeric_limits<Scalar>::max)();
+  const std::vector<CollisionObject*>& objects = tree.getObjects();
+  for (std::size_t i = 0; i < objects.size(); ++i) {
+    if (detail::wide_AABB_tree::distanceRecurse(tree, 0,
+                                                objects[i]->getAABB(),
+                                                objects[i], i + 1, callback,
+                                                min_dist))
+      return;
+  }
+}
+
+//==============================================================================
+void WideAABBTreeCollisionManager::collide(
+    BroadPhaseCollisionManager* other_manager_,
+    CollisionCallBackBase* callback) const {
+  COAL_TRACY_ZONE_SCOPED_N("coal::WideAABBTreeCollisionManager::collide");
+  callback->init();
+  WideAABBTreeCollisionManager* other_manager =
+      static_cast<WideAABBTreeCollisionManager*>(other_manager_);
+  if (tree.empty() || other_manager->tree.empty()) return;
+  const AABB bounds1 = tree.getBounds();
+  const AABB bounds2 = other_manager->tree.getBounds();
+  if (!bounds1.overlap(bounds2)) return;
+  detail::wide_AABB_tree::collisionRecurse(
+      tree, 0, bounds1, other_manager->tree, 0, bounds2, callback);
+}
+
+//==============================================================================
+void WideAABBTreeCollisionManager::distance(
+    BroadPhaseCollisionManager* other_manager_,
+    DistanceCallBackBase* callback) const {
+  COAL_TRACY_ZONE_SCOPED_N("coal::WideAABBTreeCollisionManager::distance");
+  callback->init();
+  WideAABBTreeCollisionManager* other_manager =
+      static_cast<WideAABBTreeCollisionManager*>(other_manager_);
+  if (tree.empty() || other_manager->tree.empty()) return;
+  Scalar min_dist = (std::numeric_limits<Scalar>::max)();
+  const std::vector<CollisionObject*>& objects =
+      other_manager->tree.getObjects();
+  for (std::size_t i = 0; i < objects.size(); ++i) {
+    if (detail::wide_AABB_tree::distanceRecurse(tree, 0,
+                                                objects[i]->getAABB(),
+                                                objects[i], 0, callback,
+                                                min_dist))
+      return;
+  }
+}
+
+//==============================================================================
+bool WideAABBTreeCollisionManager::empty() const { return tree.empty(); }
+
+//==============================================================================
+size_t WideAABBTreeCollisionManager::size() const {
+  return tree.getObjects().size();
+}
+
+//==============================================================================
+const detail::WideAABBTree& WideAABBTreeCollisionManager::getTree() const {
+  return tree;
+}
+
+}  // namespace coal
@@ -48,7 +48,10 @@ bool defaultCollisionFunction(CollisionObject* o1, CollisionObject* o2,
 
   if (collision_data->done) return true;
 
-  collide(o1, o2, request, result);
+  if (collision_data->warm_start_cache)
+    collide(o1, o2, request, result, *collision_data->warm_start_cache);
+  else
+    collide(o1, o2, request, result);
 
   if (result.isCollision() &&
       result.numContacts() >= request.num_max_contacts) {
@@ -63,6 +66,65 @@ bool CollisionCallBackDefault::collide(CollisionObject* o1,
   return defaultCollisionFunction(o1, o2, &data);
 }
 
+bool defaultContinuousCollisionFunction(ContinuousCollisionObject* o1,
+                                        ContinuousCollisionObject* o2,
+                                        void* data) {
+  assert(data != nullptr);
+  auto* cdata = static_cast<ContinuousCollisionData*>(data);
+
+  if (cdata->done) return true;
+
+  ContinuousCollisionResult result;
+  continuousCollide(o1, o2, cdata->request, result);
+
+  if (result.is_collide &&
+      (!cdata->result.is_collide ||
+       result.time_of_contact < cdata->result.time_of_contact)) {
+    cdata->result = result;
+    cdata->o1 = o1;
+    cdata->o2 = o2;
+    if (result.time_of_contact <= Scalar(0)) cdata->done = true;
+  }
+
+  return cdata->done;
+}
+
+bool ContinuousCollisionCallBackDefault::collide(
+    ContinuousCollisionObject* o1, ContinuousCollisionObject* o2) {
+  return defaultContinuousCollisionFunction(o1, o2, &data);
+}
+
+CollisionCallBackBase* CollisionCallBackDefault::clone() const {
+  CollisionCallBackDefault* callback = new CollisionCallBackDefault();
+  callback->data.request = data.request;
+  callback->data.warm_start_cache = data.warm_start_cache;
+  return callback;
+}
+
+void CollisionCallBackDefault::merge(const CollisionCallBackBase& other_) {
+  const CollisionCallBackDefault& other =
+      static_cast<const CollisionCallBackDefault&>(other_);
+  const CollisionRequest& request = data.request;
+  CollisionResult& result = data.result;
+  const CollisionResult& other_result = other.data.result;
+
+  for (size_t i = 0; i < other_result.numContacts() &&
+                     result.numContacts() < request.num_max_contacts;
+       ++i)
+    result.addContact(other_result.getContact(i));
+
+  if (other_result.distance_lower_bound < result.distance_lower_bound) {
+    result.distance_lower_bound = other_result.distance_lower_bound;
+    result.nearest_points = other_result.nearest_points;
+    result.normal = other_result.normal;
+  }
+
+  if (result.isCollision() &&
+      result.numContacts() >= request.num_max_contacts) {
+    data.done = true;
+  }
+}
+
 bool defaultDistanceFunction(CollisionObject* o1, CollisionObject* o2,
                              void* data, Scalar& dist) {
   assert(data != nullptr);
@@ -75,7 +137,10 @@ bool defaultDistanceFunction(CollisionObject* o1, CollisionObject* o2,
     return true;
   }
 
-  distance(o1, o2, request, result);
+  if (cdata->warm_start_cache)
+    distance(o1, o2, request, result, *cdata->warm_start_cache);
+  else
+    distance(o1, o2, request, result);
 
   dist = result.min_distance;
 
@@ -111,6 +176,17 @@ CollisionCallBackCollect::getCollisionPairs() const {
 
 void CollisionCallBackCollect::init() { collision_pairs.clear(); }
 
+CollisionCallBackBase* CollisionCallBackCollect::clone() const {
+  return new CollisionCallBackCollect(max_size);
+}
+
+void CollisionCallBackCollect::merge(const CollisionCallBackBase& other_) {
+  const CollisionCallBackCollect& other =
+      static_cast<const CollisionCallBackCollect&>(other_);
+  collision_pairs.insert(collision_pairs.end(), other.collision_pairs.begin(),
+                         other.collision_pairs.end());
+}
+
 bool CollisionCallBackCollect::exist(CollisionObject* o1,
                                      CollisionObject* o2) const {
   return exist(std::make_pair(o1, o2));
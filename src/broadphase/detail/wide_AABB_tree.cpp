@@ -0,0 +1,364 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "coal/broadphase/detail/wide_AABB_tree.h"
+
+#include <limits>
+
+namespace coal {
+namespace detail {
+
+const WideAABBTree::ChildIndex WideAABBTree::leaf_flag;
+const WideAABBTree::ChildIndex WideAABBTree::empty_child;
+
+namespace {
+/// @brief Half of the perimeter of a box, used as insertion cost.
+Scalar halfPerimeter(const AABB& box) {
+  return (box.max_ - box.min_).sum();
+}
+}  // namespace
+
+//==============================================================================
+void WideAABBTree::build(const std::vector<CollisionObject*>& objects) {
+  clear();
+  if (objects.empty()) return;
+
+  m_objects = objects;
+  m_object_parents.assign(m_objects.size(), empty_child);
+  m_order.resize(m_objects.size());
+  std::vector<Vec3s> centers(m_objects.size());
+  m_indices.reserve(m_objects.size());
+  for (std::size_t i = 0; i < m_objects.size(); ++i) {
+    m_indices[m_objects[i]] = i;
+    m_order[i] = i;
+    centers[i] = m_objects[i]->getAABB().center();
+  }
+  m_nodes.reserve(m_objects.size() / (width - 1) + 1);
+  buildNode(centers, 0, m_objects.size());
+  refit();
+}
+
+//==============================================================================
+WideAABBTree::ChildIndex WideAABBTree::buildNode(std::vector<Vec3s>& centers,
+                                                 std::size_t begin,
+                                                 std::size_t end) {
+  const ChildIndex node_id = allocateNode(empty_child);
+
+  // Split the objects in (at most) width groups of consecutive objects.
+  std::size_t bounds[width + 1];
+  std::size_t num_groups;
+  if (end - begin <= width) {
+    num_groups = end - begin;
+    for (std::size_t i = 0; i <= num_groups; ++i) bounds[i] = begin + i;
+  } else {
+    const std::size_t mid = split(centers, begin, end);
+    bounds[0] = begin;
+    bounds[1] = split(centers, begin, mid);
+    bounds[2] = mid;
+    bounds[3] = split(centers, mid, end);
+    bounds[4] = end;
+    num_groups = width;
+  }
+
+  for (std::size_t i = 0; i < num_groups; ++i) {
+    ChildIndex child;
+    if (bounds[i + 1] - bounds[i] == 1)
+      child = static_cast<ChildIndex>(m_order[bounds[i]]) | leaf_flag;
+    else
+      child = buildNode(centers, bounds[i], bounds[i + 1]);
+    setChild(node_id, static_cast<int>(i), child);
+  }
+  return node_id;
+}
+
+//==============================================================================
+std::size_t WideAABBTree::split(std::vector<Vec3s>& centers,
+                                std::size_t begin, std::size_t end) {
+  AABB bound(centers[m_order[begin]]);
+  for (std::size_t i = begin + 1; i < end; ++i) bound += centers[m_order[i]];
+  Eigen::DenseIndex axis;
+  (bound.max_ - bound.min_).maxCoeff(&axis);
+
+  const std::size_t mid = begin + (end - begin) / 2;
+  std::nth_element(m_order.begin() + (std::ptrdiff_t)begin,
+                   m_order.begin() + (std::ptrdiff_t)mid,
+                   m_order.begin() + (std::ptrdiff_t)end,
+                   [&centers, axis](std::size_t a, std::size_t b) {
+                     return centers[a][axis] < centers[b][axis];
+                   });
+  return mid;
+}
+
+//==============================================================================
+WideAABBTree::ChildIndex WideAABBTree::allocateNode(ChildIndex parent) {
+  ChildIndex node_id;
+  if (m_free_nodes.empty()) {
+    node_id = static_cast<ChildIndex>(m_nodes.size());
+    m_nodes.push_back(Node());
+  } else {
+    node_id = m_free_nodes.back();
+    m_free_nodes.pop_back();
+    if (parent != empty_child && node_id < parent)
+      m_children_after_parents = false;
+  }
+  const Scalar inf = std::numeric_limits<Scalar>::infinity();
+  Node& node = m_nodes[node_id];
+  for (int i = 0; i < width; ++i) {
+    node.children[i] = empty_child;
+    for (int k = 0; k < 3; ++k) {
+      node.min[k][i] = inf;
+      node.max[k][i] = -inf;
+    }
+  }
+  node.parent = parent;
+  return node_id;
+}
+
+//==============================================================================
+int WideAABBTree::slotOf(ChildIndex node_id, ChildIndex child) const {
+  const Node& node = m_nodes[node_id];
+  int slot = 0;
+  while (node.children[slot] != child) ++slot;
+  return slot;
+}
+
+//==============================================================================
+void WideAABBTree::setChild(ChildIndex node_id, int slot, ChildIndex child) {
+  m_nodes[node_id].children[slot] = child;
+  if (isLeaf(child))
+    m_object_parents[objectIndex(child)] = node_id;
+  else
+    m_nodes[child].parent = node_id;
+}
+
+//==============================================================================
+WideAABBTree::ChildIndex WideAABBTree::removeChild(ChildIndex node_id,
+                                                   int slot) {
+  Node& node = m_nodes[node_id];
+  int last = width - 1;
+  while (node.children[last] == empty_child) --last;
+  if (slot != last) setChild(node_id, slot, node.children[last]);
+  node.children[last] = empty_child;
+  if (last > 0 || node.parent == empty_child) return node_id;
+
+  // The node is empty: free it and remove it from its parent.
+  const ChildIndex parent = node.parent;
+  node.parent = empty_child;
+  m_free_nodes.push_back(node_id);
+  return removeChild(parent, slotOf(parent, node_id));
+}
+
+//==============================================================================
+bool WideAABBTree::insert(CollisionObject* object) {
+  if (m_indices.find(object) != m_indices.end()) return false;
+  const std::size_t index = m_objects.size();
+  m_objects.push_back(object);
+  m_object_parents.push_back(empty_child);
+  m_indices[object] = index;
+  const ChildIndex leaf = static_cast<ChildIndex>(index) | leaf_flag;
+
+  if (m_nodes.empty()) allocateNode(empty_child);
+
+  // Go down the children whose bounds grow the least, until a node has a free
+  // slot or the chosen child is an object, which is then paired with the new
+  // object in a new node.
+  const AABB& box = object->getAABB();
+  ChildIndex node_id = 0;
+  while (true) {
+    const Node& node = m_nodes[node_id];
+    int slot = 0;
+    while (slot < width && node.children[slot] != empty_child) ++slot;
+    if (slot < width) {
+      setChild(node_id, slot, leaf);
+      break;
+    }
+
+    int best = 0;
+    Scalar best_cost = 0, best_size = 0;
+    for (int i = 0; i < width; ++i) {
+      const AABB child_box(
+          Vec3s(node.min[0][i], node.min[1][i], node.min[2][i]),
+          Vec3s(node.max[0][i], node.max[1][i], node.max[2][i]));
+      const Scalar size = halfPerimeter(child_box);
+      const Scalar cost = halfPerimeter(child_box + box) - size;
+      if (i == 0 || cost < best_cost ||
+          (cost == best_cost && size < best_size)) {
+        best = i;
+        best_cost = cost;
+        best_size = size;
+      }
+    }
+
+    const ChildIndex child = node.children[best];
+    if (isNode(child)) {
+      node_id = child;
+      continue;
+    }
+    const ChildIndex new_node = allocateNode(node_id);
+    setChild(new_node, 0, child);
+    setChild(new_node, 1, leaf);
+    setChild(node_id, best, new_node);
+    node_id = new_node;
+    break;
+  }
+  refitUp(node_id);
+  return true;
+}
+
+//==============================================================================
+bool WideAABBTree::remove(CollisionObject* object) {
+  const auto it = m_indices.find(object);
+  if (it == m_indices.end()) return false;
+  const std::size_t index = it->second;
+  m_indices.erase(it);
+  if (m_objects.size() == 1) {
+    clear();
+    return true;
+  }
+
+  const ChildIndex leaf = static_cast<ChildIndex>(index) | leaf_flag;
+  const ChildIndex parent = m_object_parents[index];
+  const ChildIndex node_id = removeChild(parent, slotOf(parent, leaf));
+
+  // The last object takes the index of the removed one.
+  const std::size_t last = m_objects.size() - 1;
+  if (index != last) {
+    const ChildIndex last_parent = m_object_parents[last];
+    const ChildIndex last_leaf = static_cast<ChildIndex>(last) | leaf_flag;
+    m_objects[index] = m_objects[last];
+    m_indices[m_objects[index]] = index;
+    setChild(last_parent, slotOf(last_parent, last_leaf), leaf);
+  }
+  m_objects.pop_back();
+  m_object_parents.pop_back();
+
+  refitUp(node_id);
+  return true;
+}
+
+//==============================================================================
+bool WideAABBTree::update(CollisionObject* object) {
+  const auto it = m_indices.find(object);
+  if (it == m_indices.end()) return false;
+  refitUp(m_object_parents[it->second]);
+  return true;
+}
+
+//==============================================================================
+void WideAABBTree::setChildBounds(Node& node, int i) const {
+  const Scalar inf = std::numeric_limits<Scalar>::infinity();
+  const ChildIndex child = node.children[i];
+  if (child == empty_child) {
+    for (int k = 0; k < 3; ++k) {
+      node.min[k][i] = inf;
+      node.max[k][i] = -inf;
+    }
+  } else if (isLeaf(child)) {
+    const AABB& aabb = m_objects[objectIndex(child)]->getAABB();
+    for (int k = 0; k < 3; ++k) {
+      node.min[k][i] = aabb.min_[k];
+      node.max[k][i] = aabb.max_[k];
+    }
+  } else {
+    const Node& c = m_nodes[child];
+    for (int k = 0; k < 3; ++k) {
+      node.min[k][i] = *std::min_element(c.min[k], c.min[k] + width);
+      node.max[k][i] = *std::max_element(c.max[k], c.max[k] + width);
+    }
+  }
+}
+
+//==============================================================================
+void WideAABBTree::refitUp(ChildIndex node_id) {
+  while (node_id != empty_child) {
+    Node& node = m_nodes[node_id];
+    Node old = node;
+    for (int i = 0; i < width; ++i) setChildBounds(node, i);
+    bool changed = false;
+    for (int k = 0; k < 3 && !changed; ++k)
+      changed = !std::equal(old.min[k], old.min[k] + width, node.min[k]) ||
+                !std::equal(old.max[k], old.max[k] + width, node.max[k]);
+    // The bounds of the node, seen from its parent, did not change either.
+    if (!changed) return;
+    node_id = node.parent;
+  }
+}
+
+//==============================================================================
+void WideAABBTree::refitNode(ChildIndex node_id) {
+  Node& node = m_nodes[node_id];
+  for (int i = 0; i < width; ++i) {
+    if (isNode(node.children[i])) refitNode(node.children[i]);
+    setChildBounds(node, i);
+  }
+}
+
+//==============================================================================
+void WideAABBTree::refit() {
+  if (m_nodes.empty()) return;
+  if (!m_children_after_parents) {
+    refitNode(0);
+    return;
+  }
+  // Refitting the nodes in reverse order updates the children before their
+  // parent. The unused nodes have no children.
+  for (std::size_t n = m_nodes.size(); n-- > 0;)
+    for (int i = 0; i < width; ++i) setChildBounds(m_nodes[n], i);
+}
+
+//==============================================================================
+AABB WideAABBTree::getBounds() const {
+  AABB bounds;
+  if (m_nodes.empty()) return bounds;
+  const Node& root = m_nodes[0];
+  for (int k = 0; k < 3; ++k) {
+    bounds.min_[k] = *std::min_element(root.min[k], root.min[k] + width);
+    bounds.max_[k] = *std::max_element(root.max[k], root.max[k] + width);
+  }
+  return bounds;
+}
+
+//==============================================================================
+void WideAABBTree::clear() {
+  m_objects.clear();
+  m_object_parents.clear();
+  m_indices.clear();
+  m_order.clear();
+  m_nodes.clear();
+  m_free_nodes.clear();
+  m_children_after_parents = true;
+}
+
+}  // namespace detail
+}  // namespace coal
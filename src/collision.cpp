@@ -39,6 +39,7 @@
 #include "coal/collision_utility.h"
 #include "coal/collision_func_matrix.h"
 #include "coal/narrowphase/narrowphase.h"
+#include "coal/internal/query_statistics.h"
 
 #include "coal/tracy.hh"
 
@@ -67,19 +68,28 @@ std::size_t collide(const CollisionObject* o1, const CollisionObject* o2,
                  result);
 }
 
+namespace {
+/// @brief Whether the narrow phase swaps the geometries, so that the BVH or
+/// the height field comes first.
+bool swapsGeometries(const CollisionGeometry* o1, const CollisionGeometry* o2) {
+  return o1->getObjectType() == OT_GEOM &&
+         (o2->getObjectType() == OT_BVH || o2->getObjectType() == OT_HFIELD);
+}
+
 std::size_t collide(const CollisionGeometry* o1, const Transform3s& tf1,
                     const CollisionGeometry* o2, const Transform3s& tf2,
-                    const CollisionRequest& request, CollisionResult& result) {
-  COAL_TRACY_ZONE_SCOPED_N("coal::collide");
+                    const GJKSolver& solver, const CollisionRequest& request,
+                    CollisionResult& result) {
   // If security margin is set to -infinity, return that there is no collision
   if (request.security_margin == -std::numeric_limits<Scalar>::infinity()) {
     result.clear();
+    if (request.enable_statistics)
+      result.statistics.stop_reason = QUERY_SKIPPED;
     return false;
   }
 
-  GJKSolver solver(request);
-
   const CollisionFunctionMatrix& looktable = getCollisionFunctionLookTable();
+  internal::QueryStatisticsRecorder recorder(request, result, solver);
   std::size_t res;
   if (request.num_max_contacts == 0) {
     COAL_THROW_PRETTY("Invalid number of max contacts (current value is 0).",
@@ -90,6 +100,12 @@ std::size_t collide(const CollisionGeometry* o1, const Transform3s& tf1,
     OBJECT_TYPE object_type2 = o2->getObjectType();
     NODE_TYPE node_type1 = o1->getNodeType();
     NODE_TYPE node_type2 = o2->getNodeType();
+    // Between two shapes, the whole call is the narrow phase.
+    internal::StageTimer narrowphase_timer(
+        (object_type1 == OT_GEOM && object_type2 == OT_GEOM)
+            ? recorder.statistics
+            : NULL,
+        &QueryStatistics::narrowphase_time);
 
     if (object_type1 == OT_GEOM &&
         (object_type2 == OT_BVH || object_type2 == OT_HFIELD)) {
@@ -102,6 +118,8 @@ std::size_t collide(const CollisionGeometry* o1, const Transform3s& tf1,
                           std::invalid_argument);
         res = 0;
       } else {
+        internal::CallMetricsRecorder metrics(COLLISION_METRICS, node_type2,
+                                              node_type1);
         res = looktable.collision_matrix[node_type2][node_type1](
             o2, tf2, o1, tf1, &solver, request, result);
         result.swapObjects();
@@ -117,9 +135,12 @@ std::size_t collide(const CollisionGeometry* o1, const Transform3s& tf1,
                               << " is not yet supported.",
                           std::invalid_argument);
         res = 0;
-      } else
+      } else {
+        internal::CallMetricsRecorder metrics(COLLISION_METRICS, node_type1,
+                                              node_type2);
         res = looktable.collision_matrix[node_type1][node_type2](
             o1, tf1, o2, tf2, &solver, request, result);
+      }
     }
   }
   // Cache narrow phase solver result. If the option in the request is selected,
@@ -130,6 +151,75 @@ std::size_t collide(const CollisionGeometry* o1, const Transform3s& tf1,
 
   return res;
 }
+}  // namespace
+
+std::size_t collide(const CollisionGeometry* o1, const Transform3s& tf1,
+                    const CollisionGeometry* o2, const Transform3s& tf2,
+                    const CollisionRequest& request, CollisionResult& result) {
+  COAL_TRACY_ZONE_SCOPED_N("coal::collide");
+  GJKSolver solver(request);
+  return collide(o1, tf1, o2, tf2, solver, request, result);
+}
+
+std::size_t collide(const CollisionObject* o1, const CollisionObject* o2,
+                    const CollisionRequest& request, CollisionResult& result,
+                    GJKWarmStartCache& warm_start_cache) {
+  COAL_TRACY_ZONE_SCOPED_N("coal::collide(warm start cache)");
+  const CollisionGeometry* g1 = o1->collisionGeometryPtr();
+  const CollisionGeometry* g2 = o2->collisionGeometryPtr();
+  // Only the pairs of shapes are cached, see GJKWarmStartCache.
+  if (g1->getObjectType() != OT_GEOM || g2->getObjectType() != OT_GEOM)
+    return collide(o1, o2, request, result);
+
+  GJKSolver solver(request);
+  solver.setWarmStartCache(&warm_start_cache, o1, o2);
+  solver.loadWarmStart();
+  const std::size_t res =
+      collide(g1, o1->getTransform(), g2, o2->getTransform(), solver, request,
+              result);
+  solver.storeWarmStart();
+  return res;
+}
+
+std::size_t collide(const CollisionObject* o1, const CollisionObject* o2,
+                    const CollisionRequest& request, CollisionResult& result,
+                    TraversalFrontCache& front_cache) {
+  COAL_TRACY_ZONE_SCOPED_N("coal::collide(front cache)");
+  const CollisionGeometry* g1 = o1->collisionGeometryPtr();
+  const CollisionGeometry* g2 = o2->collisionGeometryPtr();
+  GJKSolver solver(request);
+  // The front follows the order of the objects in the narrow phase.
+  const bool restarted = swapsGeometries(g1, g2)
+                             ? front_cache.beginQuery(g2, g1)
+                             : front_cache.beginQuery(g1, g2);
+  solver.front_list = &front_cache.front();
+  const std::size_t num_contacts = result.numContacts();
+  const std::size_t res =
+      collide(g1, o1->getTransform(), g2, o2->getTransform(), solver, request,
+              result);
+  front_cache.endQuery(restarted, res > num_contacts);
+  return res;
+}
+
+std::size_t collide(const CollisionGeometry* o1, const Transform3s& tf1,
+                    const CollisionGeometry* o2, const Transform3s& tf2,
+                    const CollisionRequest& request, CollisionResult& result,
+                    QueryContext& context) {
+  COAL_TRACY_ZONE_SCOPED_N("coal::collide(context)");
+  // The guesses of the previous query are meaningless for this one.
+  context.solver.cached_guess = Vec3s(1, 0, 0);
+  context.solver.support_func_cached_guess = support_func_guess_t::Zero();
+  context.solver.set(request);
+  return collide(o1, tf1, o2, tf2, context.solver, request, result);
+}
+
+std::size_t collide(const CollisionObject* o1, const CollisionObject* o2,
+                    const CollisionRequest& request, CollisionResult& result,
+                    QueryContext& context) {
+  return collide(o1->collisionGeometryPtr(), o1->getTransform(),
+                 o2->collisionGeometryPtr(), o2->getTransform(), request,
+                 result, context);
+}
 
 ComputeCollision::ComputeCollision(const CollisionGeometry* o1,
                                    const CollisionGeometry* o2)
@@ -167,15 +257,28 @@ std::size_t ComputeCollision::run(const Transform3s& tf1,
   // If security margin is set to -infinity, return that there is no collision
   if (request.security_margin == -std::numeric_limits<Scalar>::infinity()) {
     result.clear();
+    if (request.enable_statistics)
+      result.statistics.stop_reason = QUERY_SKIPPED;
     return false;
   }
+  internal::QueryStatisticsRecorder recorder(request, result, solver);
   std::size_t res;
   if (swap_geoms) {
+    internal::CallMetricsRecorder metrics(
+        COLLISION_METRICS, o2->getNodeType(), o1->getNodeType());
     res = func(o2, tf2, o1, tf1, &solver, request, result);
     result.swapObjects();
     result.nearest_points[0].swap(result.nearest_points[1]);
     result.normal *= -1;
   } else {
+    // Between two shapes, the whole call is the narrow phase.
+    internal::StageTimer narrowphase_timer(
+        (o1->getObjectType() == OT_GEOM && o2->getObjectType() == OT_GEOM)
+            ? recorder.statistics
+            : NULL,
+        &QueryStatistics::narrowphase_time);
+    internal::CallMetricsRecorder metrics(
+        COLLISION_METRICS, o1->getNodeType(), o2->getNodeType());
     res = func(o1, tf1, o2, tf2, &solver, request, result);
   }
   // Cache narrow phase solver result. If the option in the request is selected,
@@ -206,4 +309,160 @@ std::size_t ComputeCollision::operator()(const Transform3s& tf1,
   return res;
 }
 
+std::size_t BatchCollision::operator()(
+    const std::vector<GeometryPair>& pairs, const CollisionRequest& request,
+    std::vector<CollisionResult>& results) const {
+  return run(pairs, &request, 0, results);
+}
+
+std::size_t BatchCollision::operator()(
+    const std::vector<GeometryPair>& pairs,
+    const std::vector<CollisionRequest>& requests,
+    std::vector<CollisionResult>& results) const {
+  if (requests.size() != pairs.size()) {
+    COAL_THROW_PRETTY("The number of requests ("
+                          << requests.size()
+                          << ") does not match the number of pairs ("
+                          << pairs.size() << ").",
+                      std::invalid_argument);
+  }
+  return run(pairs, requests.data(), 1, results);
+}
+
+std::size_t BatchCollision::run(const std::vector<GeometryPair>& pairs,
+                                const CollisionRequest* requests,
+                                std::size_t request_stride,
+                                std::vector<CollisionResult>& results) const {
+  COAL_TRACY_ZONE_SCOPED_N("coal::BatchCollision::run");
+  const std::size_t num_pairs = pairs.size();
+  results.resize(num_pairs);
+
+  // Sort the pairs by node types (counting sort), so that the collision
+  // function is looked up once per group.
+  // After the sort, offsets[k] is the end of the group of key k in order.
+  const std::size_t num_keys = NODE_COUNT * NODE_COUNT;
+  keys.resize(num_pairs);
+  order.resize(num_pairs);
+  offsets.assign(num_keys + 1, 0);
+  for (std::size_t i = 0; i < num_pairs; ++i) {
+    keys[i] = pairs[i].o1->getNodeType() * NODE_COUNT +
+              pairs[i].o2->getNodeType();
+    ++offsets[keys[i] + 1];
+  }
+  for (std::size_t k = 0; k < num_keys; ++k) offsets[k + 1] += offsets[k];
+  for (std::size_t i = 0; i < num_pairs; ++i) order[offsets[keys[i]]++] = i;
+
+  const CollisionFunctionMatrix& looktable = getCollisionFunctionLookTable();
+  std::size_t num_colliding_pairs = 0;
+  std::size_t begin = 0;
+  for (std::size_t k = 0; k < num_keys; ++k) {
+    const std::size_t end = offsets[k];
+    if (begin == end) continue;
+
+    const GeometryPair& first = pairs[order[begin]];
+    NODE_TYPE node_type1 = first.o1->getNodeType();
+    NODE_TYPE node_type2 = first.o2->getNodeType();
+    OBJECT_TYPE object_type1 = first.o1->getObjectType();
+    OBJECT_TYPE object_type2 = first.o2->getObjectType();
+    const bool swap_geoms =
+        object_type1 == OT_GEOM &&
+        (object_type2 == OT_BVH || object_type2 == OT_HFIELD);
+    const bool shapes = object_type1 == OT_GEOM && object_type2 == OT_GEOM;
+    CollisionFunctionMatrix::CollisionFunc func =
+        swap_geoms ? looktable.collision_matrix[node_type2][node_type1]
+                   : looktable.collision_matrix[node_type1][node_type2];
+    if (!func) {
+      COAL_THROW_PRETTY("Collision function between node type "
+                            << std::string(get_node_type_name(node_type1))
+                            << " and node type "
+                            << std::string(get_node_type_name(node_type2))
+                            << " is not yet supported.",
+                        std::invalid_argument);
+    }
+
+    for (std::size_t j = begin; j < end; ++j) {
+      const std::size_t i = order[j];
+      const GeometryPair& pair = pairs[i];
+      const CollisionRequest& request = requests[i * request_stride];
+      CollisionResult& result = results[i];
+
+      // If security margin is set to -infinity, return that there is no
+      // collision
+      if (request.security_margin ==
+          -std::numeric_limits<Scalar>::infinity()) {
+        result.clear();
+        if (request.enable_statistics)
+          result.statistics.stop_reason = QUERY_SKIPPED;
+        continue;
+      }
+      if (request.num_max_contacts == 0) {
+        COAL_THROW_PRETTY(
+            "Invalid number of max contacts (current value is 0).",
+            std::invalid_argument);
+      }
+
+      // The guesses of the previous pair are meaningless for this one.
+      solver.cached_guess = Vec3s(1, 0, 0);
+      solver.support_func_cached_guess = support_func_guess_t::Zero();
+      solver.set(request);
+
+      Timer timer(false);
+      if (request.enable_timings) timer.start();
+      std::size_t res;
+      {
+        internal::QueryStatisticsRecorder recorder(request, result, solver);
+        // Between two shapes, the whole call is the narrow phase.
+        internal::StageTimer narrowphase_timer(
+            shapes ? recorder.statistics : NULL,
+            &QueryStatistics::narrowphase_time);
+        if (swap_geoms) {
+          internal::CallMetricsRecorder metrics(COLLISION_METRICS, node_type2,
+                                                node_type1);
+          res = func(pair.o2, pair.tf2, pair.o1, pair.tf1, &solver, request,
+                     result);
+          result.swapObjects();
+          result.nearest_points[0].swap(result.nearest_points[1]);
+          result.normal *= -1;
+        } else {
+          internal::CallMetricsRecorder metrics(COLLISION_METRICS, node_type1,
+                                                node_type2);
+          res = func(pair.o1, pair.tf1, pair.o2, pair.tf2, &solver, request,
+                     result);
+        }
+      }
+      if (request.enable_timings) result.timings = timer.elapsed();
+
+      // Cache narrow phase solver result. If the option in the request is
+      // selected, also store the solver result in the request for the next
+      // call.
+      result.cached_gjk_guess = solver.cached_guess;
+      result.cached_support_func_guess = solver.support_func_cached_guess;
+      request.updateGuess(result);
+
+      if (res > 0) ++num_colliding_pairs;
+    }
+    begin = end;
+  }
+  return num_colliding_pairs;
+}
+
+namespace {
+BatchCollision& getThreadLocalBatchCollision() {
+  static thread_local BatchCollision batch_collision;
+  return batch_collision;
+}
+}  // namespace
+
+std::size_t collide(const std::vector<GeometryPair>& pairs,
+                    const CollisionRequest& request,
+                    std::vector<CollisionResult>& results) {
+  return getThreadLocalBatchCollision()(pairs, request, results);
+}
+
+std::size_t collide(const std::vector<GeometryPair>& pairs,
+                    const std::vector<CollisionRequest>& requests,
+                    std::vector<CollisionResult>& results) {
+  return getThreadLocalBatchCollision()(pairs, requests, results);
+}
+
 }  // namespace coal
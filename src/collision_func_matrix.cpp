@@ -42,6 +42,8 @@
 #include "coal/narrowphase/narrowphase.h"
 #include "coal/internal/shape_shape_func.h"
 #include "coal/shape/geometric_shapes_traits.h"
+#include "coal/compound.h"
+#include "coal/collision_utility.h"
 #include <../src/traits_traversal.h>
 
 namespace coal {
@@ -75,20 +77,13 @@ std::size_t OctreeCollide(const CollisionGeometry* o1, const Transform3s& tf1,
 #endif
 
 namespace details {
+/// @brief All the BVs are tested in the frame of the mesh: the oriented ones
+/// with the relative transform, the axis-aligned ones against the BV of the
+/// shape in the frame of the mesh.
 template <typename T_BVH, typename T_SH>
 struct bvh_shape_traits {
-  enum { Options = RelativeTransformationIsIdentity };
+  enum { Options = 0 };
 };
-#define BVH_SHAPE_DEFAULT_TO_ORIENTED(bv) \
-  template <typename T_SH>                \
-  struct bvh_shape_traits<bv, T_SH> {     \
-    enum { Options = 0 };                 \
-  }
-BVH_SHAPE_DEFAULT_TO_ORIENTED(OBB);
-BVH_SHAPE_DEFAULT_TO_ORIENTED(RSS);
-BVH_SHAPE_DEFAULT_TO_ORIENTED(kIOS);
-BVH_SHAPE_DEFAULT_TO_ORIENTED(OBBRSS);
-#undef BVH_SHAPE_DEFAULT_TO_ORIENTED
 }  // namespace details
 
 /// \tparam _Options takes two values.
@@ -181,7 +176,59 @@ struct COAL_LOCAL HeightFieldShapeCollider {
     HeightFieldShapeCollisionTraversalNode<BV, Shape, 0> node(request);
 
     initialize(node, height_field, tf1, shape, tf2, nsolver, result);
-    coal::collide(&node, request, result);
+    coal::collide(&node, request, result, nsolver->front_list);
+    return result.numContacts();
+  }
+};
+
+/// @brief Collider functor between a height field and a mesh or a second
+/// height field
+template <typename BV1, typename T>
+struct COAL_LOCAL HeightFieldCollider {
+  typedef HeightField<BV1> HF;
+
+  static std::size_t collide(const CollisionGeometry* o1,
+                             const Transform3s& tf1,
+                             const CollisionGeometry* o2,
+                             const Transform3s& tf2, const GJKSolver* nsolver,
+                             const CollisionRequest& request,
+                             CollisionResult& result) {
+    if (request.isSatisfied(result)) return result.numContacts();
+
+    if (request.security_margin < 0)
+      COAL_THROW_PRETTY(
+          "Negative security margin are not handled yet for HeightField",
+          std::invalid_argument);
+
+    const HF& height_field = static_cast<const HF&>(*o1);
+    const T& model2 = static_cast<const T&>(*o2);
+
+    typename TraversalTraitsCollision<HF, T>::CollisionTraversal_t node(
+        request);
+
+    initialize(node, height_field, tf1, model2, tf2, nsolver, result);
+    coal::collide(&node, request, result, nsolver->front_list);
+    return result.numContacts();
+  }
+};
+
+/// @brief Collider functor between a mesh and a height field, which traverses
+/// the height field first.
+template <typename BV1, typename BV2>
+struct COAL_LOCAL BVHHeightFieldCollider {
+  static std::size_t collide(const CollisionGeometry* o1,
+                             const Transform3s& tf1,
+                             const CollisionGeometry* o2,
+                             const Transform3s& tf2, const GJKSolver* nsolver,
+                             const CollisionRequest& request,
+                             CollisionResult& result) {
+    if (request.isSatisfied(result)) return result.numContacts();
+
+    HeightFieldCollider<BV2, BVHModel<BV1> >::collide(o2, tf2, o1, tf1,
+                                                      nsolver, request, result);
+    result.swapObjects();
+    result.nearest_points[0].swap(result.nearest_points[1]);
+    result.normal *= -1;
     return result.numContacts();
   }
 };
@@ -192,11 +239,13 @@ std::size_t orientedMeshCollide(const CollisionGeometry* o1,
                                 const Transform3s& tf1,
                                 const CollisionGeometry* o2,
                                 const Transform3s& tf2,
+                                const GJKSolver* nsolver,
                                 const CollisionRequest& request,
                                 CollisionResult& result) {
   if (request.isSatisfied(result)) return result.numContacts();
 
   OrientedMeshCollisionTraversalNode node(request);
+  node.nsolver = nsolver;
   const BVHModel<T_BVH>* obj1 = static_cast<const BVHModel<T_BVH>*>(o1);
   const BVHModel<T_BVH>* obj2 = static_cast<const BVHModel<T_BVH>*>(o2);
 
@@ -208,75 +257,118 @@ std::size_t orientedMeshCollide(const CollisionGeometry* o1,
 
 }  // namespace details
 
+/// @brief Collide two meshes in their own frames: the BV tests use the
+/// relative transform, so the models are neither copied nor refitted.
 template <typename T_BVH>
 std::size_t BVHCollide(const CollisionGeometry* o1, const Transform3s& tf1,
                        const CollisionGeometry* o2, const Transform3s& tf2,
+                       const GJKSolver* nsolver,
                        const CollisionRequest& request,
                        CollisionResult& result) {
-  if (request.isSatisfied(result)) return result.numContacts();
-
-  // TODO(louis): each time we call collide on BVH-BVH, we:
-  //   - Allocate 2 new BVHs
-  //   - Copy and transform the vertices in both BVHs so that they are in the
-  //     same frame
-  //   - Recompute BVs of the BVH structure
-  // -> all that just to avoid doing (a few) rotations/translations of AABBs.
-  // Is it really worth it?
-  MeshCollisionTraversalNode<T_BVH> node(request);
-  const BVHModel<T_BVH>* obj1 = static_cast<const BVHModel<T_BVH>*>(o1);
-  const BVHModel<T_BVH>* obj2 = static_cast<const BVHModel<T_BVH>*>(o2);
-  BVHModel<T_BVH>* obj1_tmp = new BVHModel<T_BVH>(*obj1);
-  Transform3s tf1_tmp = tf1;
-  BVHModel<T_BVH>* obj2_tmp = new BVHModel<T_BVH>(*obj2);
-  Transform3s tf2_tmp = tf2;
+  return details::orientedMeshCollide<MeshCollisionTraversalNode<T_BVH, 0>,
+                                      T_BVH>(o1, tf1, o2, tf2, nsolver, request,
+                                             result);
+}
 
-  initialize(node, *obj1_tmp, tf1_tmp, *obj2_tmp, tf2_tmp, result);
-  coal::collide(&node, request, result);
+CollisionFunctionMatrix& getCollisionFunctionLookTable();
 
-  delete obj1_tmp;
-  delete obj2_tmp;
+namespace details {
+/// @brief Collide a part of a compound with another geometry, in the order of
+/// the geometries expected by the look-up table.
+std::size_t compoundPartCollide(const CollisionGeometry* o1,
+                                const Transform3s& tf1,
+                                const CollisionGeometry* o2,
+                                const Transform3s& tf2,
+                                const GJKSolver* nsolver,
+                                const CollisionRequest& request,
+                                CollisionResult& result) {
+  const CollisionFunctionMatrix& looktable = getCollisionFunctionLookTable();
+  const bool swap =
+      o1->getObjectType() == OT_GEOM &&
+      (o2->getObjectType() == OT_BVH || o2->getObjectType() == OT_HFIELD);
+  const NODE_TYPE node_type1 = o1->getNodeType();
+  const NODE_TYPE node_type2 = o2->getNodeType();
+  const CollisionFunctionMatrix::CollisionFunc func =
+      swap ? looktable.collision_matrix[node_type2][node_type1]
+           : looktable.collision_matrix[node_type1][node_type2];
+  if (!func)
+    COAL_THROW_PRETTY("Collision function between node type "
+                          << std::string(get_node_type_name(node_type1))
+                          << " and node type "
+                          << std::string(get_node_type_name(node_type2))
+                          << " is not yet supported.",
+                      std::invalid_argument);
 
-  return result.numContacts();
+  if (!swap) return func(o1, tf1, o2, tf2, nsolver, request, result);
+  const std::size_t res = func(o2, tf2, o1, tf1, nsolver, request, result);
+  result.swapObjects();
+  result.nearest_points[0].swap(result.nearest_points[1]);
+  result.normal *= -1;
+  return res;
 }
+}  // namespace details
 
-template <>
-std::size_t BVHCollide<OBB>(const CollisionGeometry* o1, const Transform3s& tf1,
+/// @brief Collide each part of a compound whose AABB overlaps the AABB of the
+/// other geometry. The contacts refer to the compound and to the index of the
+/// part.
+template <bool CompoundFirst>
+std::size_t CompoundCollide(const CollisionGeometry* o1, const Transform3s& tf1,
                             const CollisionGeometry* o2, const Transform3s& tf2,
+                            const GJKSolver* nsolver,
                             const CollisionRequest& request,
                             CollisionResult& result) {
-  return details::orientedMeshCollide<MeshCollisionTraversalNodeOBB, OBB>(
-      o1, tf1, o2, tf2, request, result);
-}
-
-template <>
-std::size_t BVHCollide<OBBRSS>(const CollisionGeometry* o1,
-                               const Transform3s& tf1,
-                               const CollisionGeometry* o2,
-                               const Transform3s& tf2,
-                               const CollisionRequest& request,
-                               CollisionResult& result) {
-  return details::orientedMeshCollide<MeshCollisionTraversalNodeOBBRSS, OBBRSS>(
-      o1, tf1, o2, tf2, request, result);
-}
-
-template <>
-std::size_t BVHCollide<kIOS>(const CollisionGeometry* o1,
-                             const Transform3s& tf1,
-                             const CollisionGeometry* o2,
-                             const Transform3s& tf2,
-                             const CollisionRequest& request,
-                             CollisionResult& result) {
-  return details::orientedMeshCollide<MeshCollisionTraversalNodekIOS, kIOS>(
-      o1, tf1, o2, tf2, request, result);
-}
+  if (request.isSatisfied(result)) return result.numContacts();
 
-template <typename T_BVH>
-std::size_t BVHCollide(const CollisionGeometry* o1, const Transform3s& tf1,
-                       const CollisionGeometry* o2, const Transform3s& tf2,
-                       const GJKSolver* /*nsolver*/,
-                       const CollisionRequest& request,
-                       CollisionResult& result) {
-  return BVHCollide<T_BVH>(o1, tf1, o2, tf2, request, result);
+  const Compound* compound =
+      static_cast<const Compound*>(CompoundFirst ? o1 : o2);
+  const CollisionGeometry* other = CompoundFirst ? o2 : o1;
+  const Transform3s& tf_compound = CompoundFirst ? tf1 : tf2;
+  const Transform3s& tf_other = CompoundFirst ? tf2 : tf1;
+
+  AABB other_aabb;
+  const bool bounded = Compound::computeRelativeAABB(
+      *other, tf_compound.inverseTimes(tf_other), other_aabb);
+
+  CollisionRequest part_request(request);
+  CollisionResult part_result;
+  for (std::size_t i = 0; i < compound->numParts(); ++i) {
+    Scalar sqrDistLowerBound;
+    if (bounded && !compound->getPartAABB(i).overlap(other_aabb, request,
+                                                     sqrDistLowerBound)) {
+      result.updateDistanceLowerBound(std::sqrt(sqrDistLowerBound));
+      continue;
+    }
+
+    const CollisionGeometry* part = compound->getPart(i).get();
+    const Transform3s tf_part = tf_compound * compound->getPartPlacement(i);
+    part_request.num_max_contacts =
+        request.num_max_contacts - result.numContacts();
+    part_result.clear();
+    if (CompoundFirst)
+      details::compoundPartCollide(part, tf_part, other, tf_other, nsolver,
+                                   part_request, part_result);
+    else
+      details::compoundPartCollide(other, tf_other, part, tf_part, nsolver,
+                                   part_request, part_result);
+
+    for (Contact contact : part_result.getContacts()) {
+      if (CompoundFirst) {
+        contact.o1 = compound;
+        contact.b1 = static_cast<int>(i);
+      } else {
+        contact.o2 = compound;
+        contact.b2 = static_cast<int>(i);
+      }
+      result.addContact(contact);
+    }
+    if (part_result.distance_lower_bound < result.distance_lower_bound) {
+      result.distance_lower_bound = part_result.distance_lower_bound;
+      result.nearest_points = part_result.nearest_points;
+      result.normal = part_result.normal;
+    }
+    if (request.isSatisfied(result)) break;
+  }
+  return result.numContacts();
 }
 
 CollisionFunctionMatrix::CollisionFunctionMatrix() {
@@ -527,6 +619,47 @@ CollisionFunctionMatrix::CollisionFunctionMatrix() {
   collision_matrix[HF_OBBRSS][GEOM_HALFSPACE]             = &HeightFieldShapeCollider<OBBRSS, Halfspace>::collide;
   collision_matrix[HF_OBBRSS][GEOM_ELLIPSOID]             = &HeightFieldShapeCollider<OBBRSS, Ellipsoid>::collide;
 
+  collision_matrix[HF_AABB][BV_AABB]                      = &HeightFieldCollider<AABB, BVHModel<AABB> >::collide;
+  collision_matrix[HF_AABB][BV_OBB]                       = &HeightFieldCollider<AABB, BVHModel<OBB> >::collide;
+  collision_matrix[HF_AABB][BV_RSS]                       = &HeightFieldCollider<AABB, BVHModel<RSS> >::collide;
+  collision_matrix[HF_AABB][BV_kIOS]                      = &HeightFieldCollider<AABB, BVHModel<kIOS> >::collide;
+  collision_matrix[HF_AABB][BV_OBBRSS]                    = &HeightFieldCollider<AABB, BVHModel<OBBRSS> >::collide;
+  collision_matrix[HF_AABB][BV_KDOP16]                    = &HeightFieldCollider<AABB, BVHModel<KDOP<16> > >::collide;
+  collision_matrix[HF_AABB][BV_KDOP18]                    = &HeightFieldCollider<AABB, BVHModel<KDOP<18> > >::collide;
+  collision_matrix[HF_AABB][BV_KDOP24]                    = &HeightFieldCollider<AABB, BVHModel<KDOP<24> > >::collide;
+
+  collision_matrix[HF_OBBRSS][BV_AABB]                    = &HeightFieldCollider<OBBRSS, BVHModel<AABB> >::collide;
+  collision_matrix[HF_OBBRSS][BV_OBB]                     = &HeightFieldCollider<OBBRSS, BVHModel<OBB> >::collide;
+  collision_matrix[HF_OBBRSS][BV_RSS]                     = &HeightFieldCollider<OBBRSS, BVHModel<RSS> >::collide;
+  collision_matrix[HF_OBBRSS][BV_kIOS]                    = &HeightFieldCollider<OBBRSS, BVHModel<kIOS> >::collide;
+  collision_matrix[HF_OBBRSS][BV_OBBRSS]                  = &HeightFieldCollider<OBBRSS, BVHModel<OBBRSS> >::collide;
+  collision_matrix[HF_OBBRSS][BV_KDOP16]                  = &HeightFieldCollider<OBBRSS, BVHModel<KDOP<16> > >::collide;
+  collision_matrix[HF_OBBRSS][BV_KDOP18]                  = &HeightFieldCollider<OBBRSS, BVHModel<KDOP<18> > >::collide;
+  collision_matrix[HF_OBBRSS][BV_KDOP24]                  = &HeightFieldCollider<OBBRSS, BVHModel<KDOP<24> > >::collide;
+
+  collision_matrix[BV_AABB][HF_AABB]                      = &BVHHeightFieldCollider<AABB, AABB>::collide;
+  collision_matrix[BV_OBB][HF_AABB]                       = &BVHHeightFieldCollider<OBB, AABB>::collide;
+  collision_matrix[BV_RSS][HF_AABB]                       = &BVHHeightFieldCollider<RSS, AABB>::collide;
+  collision_matrix[BV_kIOS][HF_AABB]                      = &BVHHeightFieldCollider<kIOS, AABB>::collide;
+  collision_matrix[BV_OBBRSS][HF_AABB]                    = &BVHHeightFieldCollider<OBBRSS, AABB>::collide;
+  collision_matrix[BV_KDOP16][HF_AABB]                    = &BVHHeightFieldCollider<KDOP<16>, AABB>::collide;
+  collision_matrix[BV_KDOP18][HF_AABB]                    = &BVHHeightFieldCollider<KDOP<18>, AABB>::collide;
+  collision_matrix[BV_KDOP24][HF_AABB]                    = &BVHHeightFieldCollider<KDOP<24>, AABB>::collide;
+
+  collision_matrix[BV_AABB][HF_OBBRSS]                    = &BVHHeightFieldCollider<AABB, OBBRSS>::collide;
+  collision_matrix[BV_OBB][HF_OBBRSS]                     = &BVHHeightFieldCollider<OBB, OBBRSS>::collide;
+  collision_matrix[BV_RSS][HF_OBBRSS]                     = &BVHHeightFieldCollider<RSS, OBBRSS>::collide;
+  collision_matrix[BV_kIOS][HF_OBBRSS]                    = &BVHHeightFieldCollider<kIOS, OBBRSS>::collide;
+  collision_matrix[BV_OBBRSS][HF_OBBRSS]                  = &BVHHeightFieldCollider<OBBRSS, OBBRSS>::collide;
+  collision_matrix[BV_KDOP16][HF_OBBRSS]                  = &BVHHeightFieldCollider<KDOP<16>, OBBRSS>::collide;
+  collision_matrix[BV_KDOP18][HF_OBBRSS]                  = &BVHHeightFieldCollider<KDOP<18>, OBBRSS>::collide;
+  collision_matrix[BV_KDOP24][HF_OBBRSS]                  = &BVHHeightFieldCollider<KDOP<24>, OBBRSS>::collide;
+
+  collision_matrix[HF_AABB][HF_AABB]                      = &HeightFieldCollider<AABB, HeightField<AABB> >::collide;
+  collision_matrix[HF_AABB][HF_OBBRSS]                    = &HeightFieldCollider<AABB, HeightField<OBBRSS> >::collide;
+  collision_matrix[HF_OBBRSS][HF_AABB]                    = &HeightFieldCollider<OBBRSS, HeightField<AABB> >::collide;
+  collision_matrix[HF_OBBRSS][HF_OBBRSS]                  = &HeightFieldCollider<OBBRSS, HeightField<OBBRSS> >::collide;
+
   collision_matrix[BV_AABB][BV_AABB]                      = &BVHCollide<AABB>;
   collision_matrix[BV_OBB][BV_OBB]                        = &BVHCollide<OBB>;
   collision_matrix[BV_RSS][BV_RSS]                        = &BVHCollide<RSS>;
@@ -583,6 +716,13 @@ CollisionFunctionMatrix::CollisionFunctionMatrix() {
   collision_matrix[HF_OBBRSS][GEOM_OCTREE]                = &OctreeCollide<HeightField<OBBRSS>, OcTree>;
 // clang-format on
 #endif
+
+  // The parts of a compound are dispatched through this table.
+  for (int i = 0; i < NODE_COUNT; ++i) {
+    collision_matrix[GEOM_COMPOUND][i] = &CompoundCollide<true>;
+    collision_matrix[i][GEOM_COMPOUND] = &CompoundCollide<false>;
+  }
+  collision_matrix[GEOM_COMPOUND][GEOM_COMPOUND] = &CompoundCollide<true>;
 }
 // template struct CollisionFunctionMatrix;
 }  // namespace coal
@@ -37,6 +37,7 @@
 
 #include <../src/collision_node.h>
 #include "coal/internal/traversal_recurse.h"
+#include "coal/timings.h"
 
 namespace coal {
 
@@ -61,6 +62,13 @@ void checkResultLowerBound(const CollisionResult& result,
 void collide(CollisionTraversalNodeBase* node, const CollisionRequest& request,
              CollisionResult& result, BVHFrontList* front_list,
              bool recursive) {
+  // The time spent in the leaf tests is counted as narrow phase time by the
+  // traversal, and removed from the traversal time.
+  QueryStatistics* statistics = node->queryStatistics();
+  const double narrowphase_time = statistics ? statistics->narrowphase_time : 0;
+  Timer timer(false);
+  if (statistics) timer.start();
+
   if (front_list && front_list->size() > 0) {
     propagateBVHFrontListCollisionRecurse(node, request, result, front_list);
   } else {
@@ -73,10 +81,23 @@ void collide(CollisionTraversalNodeBase* node, const CollisionRequest& request,
       checkResultLowerBound(result, sqrDistLowerBound);
     }
   }
+
+  if (statistics) {
+    statistics->traversal_time += timer.elapsed().user -
+                                  (statistics->narrowphase_time -
+                                   narrowphase_time);
+    statistics->stop_reason =
+        node->canStop() ? QUERY_MAX_CONTACTS_REACHED : QUERY_COMPLETED;
+  }
 }
 
 void distance(DistanceTraversalNodeBase* node, BVHFrontList* front_list,
               unsigned int qsize) {
+  QueryStatistics* statistics = node->queryStatistics();
+  const double narrowphase_time = statistics ? statistics->narrowphase_time : 0;
+  Timer timer(false);
+  if (statistics) timer.start();
+
   node->preprocess();
 
   if (qsize <= 2)
@@ -85,6 +106,13 @@ void distance(DistanceTraversalNodeBase* node, BVHFrontList* front_list,
     distanceQueueRecurse(node, 0, 0, front_list, qsize);
 
   node->postprocess();
+
+  if (statistics) {
+    statistics->traversal_time += timer.elapsed().user -
+                                  (statistics->narrowphase_time -
+                                   narrowphase_time);
+    statistics->stop_reason = QUERY_COMPLETED;
+  }
 }
 
 }  // namespace coal
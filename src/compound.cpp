@@ -0,0 +1,124 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of INRIA nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "coal/compound.h"
+
+#include "coal/BV/AABB.h"
+
+namespace coal {
+
+Compound* Compound::clone() const {
+  Compound* other = new Compound(*this);
+  for (CollisionGeometryPtr_t& part : other->parts)
+    part.reset(part->clone());
+  return other;
+}
+
+void Compound::addPart(const CollisionGeometryPtr_t& geometry,
+                       const Transform3s& placement) {
+  if (!geometry)
+    COAL_THROW_PRETTY("The geometry of a part cannot be null.",
+                      std::invalid_argument);
+  geometry->computeLocalAABB();
+  parts.push_back(geometry);
+  placements.push_back(placement);
+  part_aabbs.push_back(translate(
+      rotate(geometry->aabb_local, placement.getRotation()),
+      placement.getTranslation()));
+  computeLocalAABB();
+}
+
+void Compound::clear() {
+  parts.clear();
+  placements.clear();
+  part_aabbs.clear();
+  computeLocalAABB();
+}
+
+void Compound::computeLocalAABB() {
+  if (part_aabbs.empty()) {
+    aabb_local = AABB();
+    aabb_center.setZero();
+    aabb_radius = 0;
+    return;
+  }
+  aabb_local = part_aabbs[0];
+  for (std::size_t i = 1; i < part_aabbs.size(); ++i)
+    aabb_local += part_aabbs[i];
+  aabb_center = aabb_local.center();
+  aabb_radius = (aabb_local.min_ - aabb_center).norm();
+}
+
+bool Compound::computeRelativeAABB(const CollisionGeometry& geometry,
+                                   const Transform3s& tf, AABB& aabb) {
+  const AABB& local = geometry.aabb_local;
+  if (!local.min_.allFinite() || !local.max_.allFinite() ||
+      (local.min_.array() > local.max_.array()).any())
+    return false;
+  aabb = translate(rotate(local, tf.getRotation()), tf.getTranslation());
+  return true;
+}
+
+Scalar Compound::computeVolume() const {
+  Scalar volume = 0;
+  for (const CollisionGeometryPtr_t& part : parts)
+    volume += part->computeVolume();
+  return volume;
+}
+
+Vec3s Compound::computeCOM() const {
+  Scalar volume = 0;
+  Vec3s com(Vec3s::Zero());
+  for (std::size_t i = 0; i < parts.size(); ++i) {
+    const Scalar part_volume = parts[i]->computeVolume();
+    com += part_volume * placements[i].transform(parts[i]->computeCOM());
+    volume += part_volume;
+  }
+  if (volume > 0) com /= volume;
+  return com;
+}
+
+bool Compound::isEqual(const CollisionGeometry& _other) const {
+  const Compound* other_ptr = dynamic_cast<const Compound*>(&_other);
+  if (other_ptr == nullptr) return false;
+  const Compound& other = *other_ptr;
+
+  if (parts.size() != other.parts.size()) return false;
+  for (std::size_t i = 0; i < parts.size(); ++i) {
+    if (*parts[i] != *other.parts[i] || placements[i] != other.placements[i])
+      return false;
+  }
+  return true;
+}
+
+}  // namespace coal
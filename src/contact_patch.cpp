@@ -36,6 +36,7 @@
 
 #include "coal/contact_patch.h"
 #include "coal/collision_utility.h"
+#include "coal/internal/query_statistics.h"
 
 #include "coal/tracy.hh"
 
@@ -46,21 +47,13 @@ ContactPatchFunctionMatrix& getContactPatchFunctionLookTable() {
   return table;
 }
 
+namespace {
 void computeContactPatch(const CollisionGeometry* o1, const Transform3s& tf1,
                          const CollisionGeometry* o2, const Transform3s& tf2,
                          const CollisionResult& collision_result,
+                         const ContactPatchSolver& csolver,
                          const ContactPatchRequest& request,
                          ContactPatchResult& result) {
-  COAL_TRACY_ZONE_SCOPED_N("coal::computeContactPatch");
-  if (!collision_result.isCollision() || request.max_num_patch == 0) {
-    // do nothing
-    return;
-  }
-
-  // Before doing any computation, we initialize and clear the input result.
-  result.set(request);
-  ContactPatchSolver csolver(request);
-
   OBJECT_TYPE object_type1 = o1->getObjectType();
   OBJECT_TYPE object_type2 = o2->getObjectType();
   NODE_TYPE node_type1 = o1->getNodeType();
@@ -68,6 +61,9 @@ void computeContactPatch(const CollisionGeometry* o1, const Transform3s& tf1,
 
   const ContactPatchFunctionMatrix& looktable =
       getContactPatchFunctionLookTable();
+  internal::StageTimer patch_timer(
+      request.enable_statistics ? &result.statistics : NULL,
+      &QueryStatistics::patch_time);
 
   if (object_type1 == OT_GEOM &&
       (object_type2 == OT_BVH || object_type2 == OT_HFIELD)) {
@@ -79,8 +75,12 @@ void computeContactPatch(const CollisionGeometry* o1, const Transform3s& tf1,
                             << " is not yet supported.",
                         std::invalid_argument);
     }
-    looktable.contact_patch_matrix[node_type2][node_type1](
-        o2, tf2, o1, tf1, collision_result, &csolver, request, result);
+    {
+      internal::CallMetricsRecorder metrics(CONTACT_PATCH_METRICS, node_type2,
+                                            node_type1);
+      looktable.contact_patch_matrix[node_type2][node_type1](
+          o2, tf2, o1, tf1, collision_result, &csolver, request, result);
+    }
     result.swapObjects();
     return;
   }
@@ -94,9 +94,48 @@ void computeContactPatch(const CollisionGeometry* o1, const Transform3s& tf1,
                       std::invalid_argument);
   }
 
+  internal::CallMetricsRecorder metrics(CONTACT_PATCH_METRICS, node_type1,
+                                        node_type2);
   return looktable.contact_patch_matrix[node_type1][node_type2](
       o1, tf1, o2, tf2, collision_result, &csolver, request, result);
 }
+}  // namespace
+
+void computeContactPatch(const CollisionGeometry* o1, const Transform3s& tf1,
+                         const CollisionGeometry* o2, const Transform3s& tf2,
+                         const CollisionResult& collision_result,
+                         const ContactPatchRequest& request,
+                         ContactPatchResult& result) {
+  COAL_TRACY_ZONE_SCOPED_N("coal::computeContactPatch");
+  if (!collision_result.isCollision() || request.max_num_patch == 0) {
+    // do nothing
+    return;
+  }
+
+  // Before doing any computation, we initialize and clear the input result.
+  result.set(request);
+  ContactPatchSolver csolver(request);
+  computeContactPatch(o1, tf1, o2, tf2, collision_result, csolver, request,
+                      result);
+}
+
+void computeContactPatch(const CollisionGeometry* o1, const Transform3s& tf1,
+                         const CollisionGeometry* o2, const Transform3s& tf2,
+                         const CollisionResult& collision_result,
+                         const ContactPatchRequest& request,
+                         ContactPatchResult& result, QueryContext& context) {
+  COAL_TRACY_ZONE_SCOPED_N("coal::computeContactPatch(context)");
+  if (!collision_result.isCollision() || request.max_num_patch == 0) {
+    // do nothing
+    return;
+  }
+
+  // Before doing any computation, we initialize and clear the input result.
+  result.set(request);
+  context.contact_patch_solver.set(request);
+  computeContactPatch(o1, tf1, o2, tf2, collision_result,
+                      context.contact_patch_solver, request, result);
+}
 
 void computeContactPatch(const CollisionObject* o1, const CollisionObject* o2,
                          const CollisionResult& collision_result,
@@ -107,6 +146,15 @@ void computeContactPatch(const CollisionObject* o1, const CollisionObject* o2,
                              collision_result, request, result);
 }
 
+void computeContactPatch(const CollisionObject* o1, const CollisionObject* o2,
+                         const CollisionResult& collision_result,
+                         const ContactPatchRequest& request,
+                         ContactPatchResult& result, QueryContext& context) {
+  return computeContactPatch(o1->collisionGeometryPtr(), o1->getTransform(),
+                             o2->collisionGeometryPtr(), o2->getTransform(),
+                             collision_result, request, result, context);
+}
+
 ComputeContactPatch::ComputeContactPatch(const CollisionGeometry* o1,
                                          const CollisionGeometry* o2)
     : o1(o1), o2(o2) {
@@ -151,11 +199,20 @@ void ComputeContactPatch::run(const Transform3s& tf1, const Transform3s& tf2,
 
   // Before doing any computation, we initialize and clear the input result.
   result.set(request);
+  internal::StageTimer patch_timer(
+      request.enable_statistics ? &result.statistics : NULL,
+      &QueryStatistics::patch_time);
   if (this->swap_geoms) {
+    internal::CallMetricsRecorder metrics(CONTACT_PATCH_METRICS,
+                                          this->o2->getNodeType(),
+                                          this->o1->getNodeType());
     this->func(this->o2, tf2, this->o1, tf1, collision_result, &(this->csolver),
                request, result);
     result.swapObjects();
   } else {
+    internal::CallMetricsRecorder metrics(CONTACT_PATCH_METRICS,
+                                          this->o1->getNodeType(),
+                                          this->o2->getNodeType());
     this->func(this->o1, tf1, this->o2, tf2, collision_result, &(this->csolver),
                request, result);
   }
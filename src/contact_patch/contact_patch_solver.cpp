@@ -35,6 +35,10 @@
 /** \authors Louis Montaut */
 
 #include "coal/contact_patch/contact_patch_solver.h"
+#include "coal/BVH/BVH_model.h"
+
+#include <algorithm>
+#include <limits>
 
 namespace coal {
 
@@ -84,6 +88,51 @@ void getConvexBaseSupportSetTpl(const ShapeBase* shape, SupportSet& support_set,
   }
 }
 
+/// @brief Support set of a mesh, in the direction of `support_set`, restricted
+/// to the triangles of the contacts of a cluster: the convex hull of the
+/// support sets of these triangles. `first_mesh` tells whether the triangles
+/// of the contacts are `Contact::b1` or `Contact::b2`.
+COAL_LOCAL void getMeshSupportSet(
+    const BVHModelBase& mesh, const bool first_mesh,
+    const CollisionResult& collision_result,
+    const std::vector<size_t>& clusters, const size_t cluster,
+    const Scalar tol, std::vector<Triangle32::IndexType>& support_vertices,
+    SupportSet::Polygon& cloud, SupportSet& support_set) {
+  const std::vector<Vec3s>& vertices = *(mesh.vertices);
+  const std::vector<Triangle32>& triangles = *(mesh.tri_indices);
+  const Transform3s& tf = support_set.tf;
+  const Vec3s support_dir = support_set.getNormal();
+
+  support_vertices.clear();
+  for (size_t i = 0; i < clusters.size(); ++i) {
+    if (clusters[i] != cluster) continue;
+    const Contact& contact = collision_result.getContact(i);
+    const Triangle32& triangle =
+        triangles[size_t(first_mesh ? contact.b1 : contact.b2)];
+    Scalar dots[3];
+    for (Triangle32::IndexType k = 0; k < 3; ++k) {
+      dots[k] = support_dir.dot(vertices[triangle[k]]);
+    }
+    const Scalar support_value = (std::max)({dots[0], dots[1], dots[2]});
+    for (Triangle32::IndexType k = 0; k < 3; ++k) {
+      if (support_value - dots[k] <= tol) {
+        support_vertices.push_back(triangle[k]);
+      }
+    }
+  }
+  // The triangles of a cluster share most of their vertices.
+  std::sort(support_vertices.begin(), support_vertices.end());
+  support_vertices.erase(
+      std::unique(support_vertices.begin(), support_vertices.end()),
+      support_vertices.end());
+
+  cloud.clear();
+  for (const Triangle32::IndexType id : support_vertices) {
+    cloud.emplace_back(tf.inverseTransform(vertices[id]).head<2>());
+  }
+  computeSupportSetConvexHull(cloud, support_set.points());
+}
+
 }  // namespace details
 
 // ============================================================================
@@ -124,4 +173,69 @@ ContactPatchSolver::makeSupportSetFunction(const ShapeBase* shape,
   }
 }
 
+// ============================================================================
+void ContactPatchSolver::computeMeshPatches(
+    const BVHModelBase& mesh1, const Transform3s& tf1,
+    const BVHModelBase& mesh2, const Transform3s& tf2,
+    const CollisionResult& collision_result, const ContactPatchRequest& request,
+    ContactPatchResult& result) const {
+  COAL_TRACY_ZONE_SCOPED_N("coal::ContactPatchSolver::computeMeshPatches");
+  // Step 1 - Cluster the contacts: a contact joins the cluster of the first
+  // contact with the same normal and plane. Clusters past
+  // `request.max_num_patch` are dropped.
+  const size_t num_contacts = collision_result.numContacts();
+  const size_t no_cluster = (std::numeric_limits<size_t>::max)();
+  std::vector<size_t>& clusters = this->mesh_contact_clusters;
+  clusters.assign(num_contacts, no_cluster);
+  size_t num_clusters = 0;
+  for (size_t i = 0; i < num_contacts && num_clusters < request.max_num_patch;
+       ++i) {
+    if (clusters[i] != no_cluster) continue;
+    const Contact& contact = collision_result.getContact(i);
+    clusters[i] = num_clusters;
+    for (size_t j = i + 1; j < num_contacts; ++j) {
+      if (clusters[j] != no_cluster) continue;
+      const Contact& other = collision_result.getContact(j);
+      if (contact.normal.dot(other.normal) >=
+              mesh_patch_normal_cos_tolerance &&
+          std::abs(contact.normal.dot(other.pos - contact.pos)) <=
+              this->patch_tolerance) {
+        clusters[j] = num_clusters;
+      }
+    }
+    ++num_clusters;
+  }
+
+  for (size_t cluster = 0; cluster < num_clusters; ++cluster) {
+    // Step 2 - The deepest contact of the cluster gives the frame of the
+    // contact patch.
+    const Contact* deepest = nullptr;
+    for (size_t i = 0; i < num_contacts; ++i) {
+      const Contact& contact = collision_result.getContact(i);
+      if (clusters[i] == cluster &&
+          (deepest == nullptr ||
+           contact.penetration_depth < deepest->penetration_depth)) {
+        deepest = &contact;
+      }
+    }
+    ContactPatch& contact_patch = result.getUnusedContactPatch();
+    constructContactPatchFrameFromContact(*deepest, contact_patch);
+
+    // Step 3 - Support sets of the meshes, restricted to the triangles of the
+    // cluster, then clipping.
+    this->setSupportSetFrames(tf1, tf2, contact_patch);
+    details::getMeshSupportSet(mesh1, true, collision_result, clusters,
+                               cluster, this->patch_tolerance,
+                               this->mesh_support_vertices,
+                               this->supports_data[0].polygon,
+                               this->support_set_shape1);
+    details::getMeshSupportSet(mesh2, false, collision_result, clusters,
+                               cluster, this->patch_tolerance,
+                               this->mesh_support_vertices,
+                               this->supports_data[1].polygon,
+                               this->support_set_shape2);
+    this->computePatchFromSupportSets(*deepest, contact_patch);
+  }
+}
+
 }  // namespace coal
@@ -38,6 +38,7 @@
 #include "coal/shape/geometric_shapes.h"
 #include "coal/internal/shape_shape_contact_patch_func.h"
 #include "coal/BV/BV.h"
+#include "coal/BVH/BVH_model.h"
 
 namespace coal {
 
@@ -99,20 +100,10 @@ struct BVHComputeContactPatch {
                   const ContactPatchSolver* csolver,
                   const ContactPatchRequest& request,
                   ContactPatchResult& result) {
-    COAL_UNUSED_VARIABLE(o1);
-    COAL_UNUSED_VARIABLE(tf1);
-    COAL_UNUSED_VARIABLE(o2);
-    COAL_UNUSED_VARIABLE(tf2);
-    COAL_UNUSED_VARIABLE(csolver);
-    for (size_t i = 0; i < collision_result.numContacts(); ++i) {
-      if (i >= request.max_num_patch) {
-        break;
-      }
-      const Contact& contact = collision_result.getContact(i);
-      ContactPatch& contact_patch = result.getUnusedContactPatch();
-      constructContactPatchFrameFromContact(contact, contact_patch);
-      contact_patch.addPoint(contact.pos);
-    }
+    const BVHModel<BV>* mesh1 = static_cast<const BVHModel<BV>*>(o1);
+    const BVHModel<BV>* mesh2 = static_cast<const BVHModel<BV>*>(o2);
+    csolver->computeMeshPatches(*mesh1, tf1, *mesh2, tf2, collision_result,
+                                request, result);
   }
 };
 
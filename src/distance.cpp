@@ -39,6 +39,7 @@
 #include "coal/collision_utility.h"
 #include "coal/distance_func_matrix.h"
 #include "coal/narrowphase/narrowphase.h"
+#include "coal/internal/query_statistics.h"
 
 #include "coal/tracy.hh"
 
@@ -56,12 +57,11 @@ Scalar distance(const CollisionObject* o1, const CollisionObject* o2,
                   result);
 }
 
+namespace {
 Scalar distance(const CollisionGeometry* o1, const Transform3s& tf1,
                 const CollisionGeometry* o2, const Transform3s& tf2,
-                const DistanceRequest& request, DistanceResult& result) {
-  COAL_TRACY_ZONE_SCOPED_N("coal::distance");
-  GJKSolver solver(request);
-
+                const GJKSolver& solver, const DistanceRequest& request,
+                DistanceResult& result) {
   const DistanceFunctionMatrix& looktable = getDistanceFunctionLookTable();
 
   OBJECT_TYPE object_type1 = o1->getObjectType();
@@ -71,6 +71,13 @@ Scalar distance(const CollisionGeometry* o1, const Transform3s& tf1,
 
   Scalar res = (std::numeric_limits<Scalar>::max)();
 
+  internal::QueryStatisticsRecorder recorder(request, result, solver);
+  // Between two shapes, the whole call is the narrow phase.
+  internal::StageTimer narrowphase_timer(
+      (object_type1 == OT_GEOM && object_type2 == OT_GEOM) ? recorder.statistics
+                                                           : NULL,
+      &QueryStatistics::narrowphase_time);
+
   if (object_type1 == OT_GEOM &&
       (object_type2 == OT_BVH || object_type2 == OT_HFIELD)) {
     if (!looktable.distance_matrix[node_type2][node_type1]) {
@@ -81,6 +88,8 @@ Scalar distance(const CollisionGeometry* o1, const Transform3s& tf1,
                             << " is not yet supported.",
                         std::invalid_argument);
     } else {
+      internal::CallMetricsRecorder metrics(DISTANCE_METRICS, node_type2,
+                                            node_type1);
       res = looktable.distance_matrix[node_type2][node_type1](
           o2, tf2, o1, tf1, &solver, request, result);
       std::swap(result.o1, result.o2);
@@ -96,6 +105,8 @@ Scalar distance(const CollisionGeometry* o1, const Transform3s& tf1,
                             << " is not yet supported.",
                         std::invalid_argument);
     } else {
+      internal::CallMetricsRecorder metrics(DISTANCE_METRICS, node_type1,
+                                            node_type2);
       res = looktable.distance_matrix[node_type1][node_type2](
           o1, tf1, o2, tf2, &solver, request, result);
     }
@@ -107,6 +118,54 @@ Scalar distance(const CollisionGeometry* o1, const Transform3s& tf1,
   request.updateGuess(result);
   return res;
 }
+}  // namespace
+
+Scalar distance(const CollisionGeometry* o1, const Transform3s& tf1,
+                const CollisionGeometry* o2, const Transform3s& tf2,
+                const DistanceRequest& request, DistanceResult& result) {
+  COAL_TRACY_ZONE_SCOPED_N("coal::distance");
+  GJKSolver solver(request);
+  return distance(o1, tf1, o2, tf2, solver, request, result);
+}
+
+Scalar distance(const CollisionObject* o1, const CollisionObject* o2,
+                const DistanceRequest& request, DistanceResult& result,
+                GJKWarmStartCache& warm_start_cache) {
+  COAL_TRACY_ZONE_SCOPED_N("coal::distance(warm start cache)");
+  const CollisionGeometry* g1 = o1->collisionGeometryPtr();
+  const CollisionGeometry* g2 = o2->collisionGeometryPtr();
+  // Only the pairs of shapes are cached, see GJKWarmStartCache.
+  if (g1->getObjectType() != OT_GEOM || g2->getObjectType() != OT_GEOM)
+    return distance(o1, o2, request, result);
+
+  GJKSolver solver(request);
+  solver.setWarmStartCache(&warm_start_cache, o1, o2);
+  solver.loadWarmStart();
+  const Scalar res = distance(g1, o1->getTransform(), g2, o2->getTransform(),
+                              solver, request, result);
+  solver.storeWarmStart();
+  return res;
+}
+
+Scalar distance(const CollisionGeometry* o1, const Transform3s& tf1,
+                const CollisionGeometry* o2, const Transform3s& tf2,
+                const DistanceRequest& request, DistanceResult& result,
+                QueryContext& context) {
+  COAL_TRACY_ZONE_SCOPED_N("coal::distance(context)");
+  // The guesses of the previous query are meaningless for this one.
+  context.solver.cached_guess = Vec3s(1, 0, 0);
+  context.solver.support_func_cached_guess = support_func_guess_t::Zero();
+  context.solver.set(request);
+  return distance(o1, tf1, o2, tf2, context.solver, request, result);
+}
+
+Scalar distance(const CollisionObject* o1, const CollisionObject* o2,
+                const DistanceRequest& request, DistanceResult& result,
+                QueryContext& context) {
+  return distance(o1->collisionGeometryPtr(), o1->getTransform(),
+                  o2->collisionGeometryPtr(), o2->getTransform(), request,
+                  result, context);
+}
 
 ComputeDistance::ComputeDistance(const CollisionGeometry* o1,
                                  const CollisionGeometry* o2)
@@ -140,14 +199,25 @@ Scalar ComputeDistance::run(const Transform3s& tf1, const Transform3s& tf2,
                             const DistanceRequest& request,
                             DistanceResult& result) const {
   COAL_TRACY_ZONE_SCOPED_N("coal::ComputeDistance::run");
+  internal::QueryStatisticsRecorder recorder(request, result, solver);
   Scalar res;
 
   if (swap_geoms) {
+    internal::CallMetricsRecorder metrics(DISTANCE_METRICS, o2->getNodeType(),
+                                          o1->getNodeType());
     res = func(o2, tf2, o1, tf1, &solver, request, result);
     std::swap(result.o1, result.o2);
     result.nearest_points[0].swap(result.nearest_points[1]);
     result.normal *= -1;
   } else {
+    // Between two shapes, the whole call is the narrow phase.
+    internal::StageTimer narrowphase_timer(
+        (o1->getObjectType() == OT_GEOM && o2->getObjectType() == OT_GEOM)
+            ? recorder.statistics
+            : NULL,
+        &QueryStatistics::narrowphase_time);
+    internal::CallMetricsRecorder metrics(DISTANCE_METRICS, o1->getNodeType(),
+                                          o2->getNodeType());
     res = func(o1, tf1, o2, tf2, &solver, request, result);
   }
   // Cache narrow phase solver result. If the option in the request is selected,
@@ -174,4 +244,137 @@ Scalar ComputeDistance::operator()(const Transform3s& tf1,
   return res;
 }
 
+void BatchDistance::operator()(const std::vector<GeometryPair>& pairs,
+                               const DistanceRequest& request,
+                               std::vector<DistanceResult>& results) const {
+  run(pairs, &request, 0, results);
+}
+
+void BatchDistance::operator()(const std::vector<GeometryPair>& pairs,
+                               const std::vector<DistanceRequest>& requests,
+                               std::vector<DistanceResult>& results) const {
+  if (requests.size() != pairs.size()) {
+    COAL_THROW_PRETTY("The number of requests ("
+                          << requests.size()
+                          << ") does not match the number of pairs ("
+                          << pairs.size() << ").",
+                      std::invalid_argument);
+  }
+  run(pairs, requests.data(), 1, results);
+}
+
+void BatchDistance::run(const std::vector<GeometryPair>& pairs,
+                        const DistanceRequest* requests,
+                        std::size_t request_stride,
+                        std::vector<DistanceResult>& results) const {
+  COAL_TRACY_ZONE_SCOPED_N("coal::BatchDistance::run");
+  const std::size_t num_pairs = pairs.size();
+  results.resize(num_pairs);
+
+  // Sort the pairs by node types (counting sort), so that the distance
+  // function is looked up once per group.
+  // After the sort, offsets[k] is the end of the group of key k in order.
+  const std::size_t num_keys = NODE_COUNT * NODE_COUNT;
+  keys.resize(num_pairs);
+  order.resize(num_pairs);
+  offsets.assign(num_keys + 1, 0);
+  for (std::size_t i = 0; i < num_pairs; ++i) {
+    keys[i] = pairs[i].o1->getNodeType() * NODE_COUNT +
+              pairs[i].o2->getNodeType();
+    ++offsets[keys[i] + 1];
+  }
+  for (std::size_t k = 0; k < num_keys; ++k) offsets[k + 1] += offsets[k];
+  for (std::size_t i = 0; i < num_pairs; ++i) order[offsets[keys[i]]++] = i;
+
+  const DistanceFunctionMatrix& looktable = getDistanceFunctionLookTable();
+  std::size_t begin = 0;
+  for (std::size_t k = 0; k < num_keys; ++k) {
+    const std::size_t end = offsets[k];
+    if (begin == end) continue;
+
+    const GeometryPair& first = pairs[order[begin]];
+    NODE_TYPE node_type1 = first.o1->getNodeType();
+    NODE_TYPE node_type2 = first.o2->getNodeType();
+    OBJECT_TYPE object_type1 = first.o1->getObjectType();
+    OBJECT_TYPE object_type2 = first.o2->getObjectType();
+    const bool swap_geoms =
+        object_type1 == OT_GEOM &&
+        (object_type2 == OT_BVH || object_type2 == OT_HFIELD);
+    const bool shapes = object_type1 == OT_GEOM && object_type2 == OT_GEOM;
+    DistanceFunctionMatrix::DistanceFunc func =
+        swap_geoms ? looktable.distance_matrix[node_type2][node_type1]
+                   : looktable.distance_matrix[node_type1][node_type2];
+    if (!func) {
+      COAL_THROW_PRETTY("Distance function between node type "
+                            << std::string(get_node_type_name(node_type1))
+                            << " and node type "
+                            << std::string(get_node_type_name(node_type2))
+                            << " is not yet supported.",
+                        std::invalid_argument);
+    }
+
+    for (std::size_t j = begin; j < end; ++j) {
+      const std::size_t i = order[j];
+      const GeometryPair& pair = pairs[i];
+      const DistanceRequest& request = requests[i * request_stride];
+      DistanceResult& result = results[i];
+
+      // The guesses of the previous pair are meaningless for this one.
+      solver.cached_guess = Vec3s(1, 0, 0);
+      solver.support_func_cached_guess = support_func_guess_t::Zero();
+      solver.set(request);
+
+      Timer timer(false);
+      if (request.enable_timings) timer.start();
+      {
+        internal::QueryStatisticsRecorder recorder(request, result, solver);
+        // Between two shapes, the whole call is the narrow phase.
+        internal::StageTimer narrowphase_timer(
+            shapes ? recorder.statistics : NULL,
+            &QueryStatistics::narrowphase_time);
+        if (swap_geoms) {
+          internal::CallMetricsRecorder metrics(DISTANCE_METRICS, node_type2,
+                                                node_type1);
+          func(pair.o2, pair.tf2, pair.o1, pair.tf1, &solver, request, result);
+          std::swap(result.o1, result.o2);
+          result.nearest_points[0].swap(result.nearest_points[1]);
+          result.normal *= -1;
+        } else {
+          internal::CallMetricsRecorder metrics(DISTANCE_METRICS, node_type1,
+                                                node_type2);
+          func(pair.o1, pair.tf1, pair.o2, pair.tf2, &solver, request, result);
+        }
+      }
+      if (request.enable_timings) result.timings = timer.elapsed();
+
+      // Cache narrow phase solver result. If the option in the request is
+      // selected, also store the solver result in the request for the next
+      // call.
+      result.cached_gjk_guess = solver.cached_guess;
+      result.cached_support_func_guess = solver.support_func_cached_guess;
+      request.updateGuess(result);
+    }
+    begin = end;
+  }
+}
+
+namespace {
+BatchDistance& getThreadLocalBatchDistance() {
+  static thread_local BatchDistance batch_distance;
+  return batch_distance;
+}
+}  // namespace
+
+void distance(const std::vector<GeometryPair>& pairs,
+              const DistanceRequest& request,
+              std::vector<DistanceResult>& results) {
+  getThreadLocalBatchDistance()(pairs, request, results);
+}
+
+void distance(const std::vector<GeometryPair>& pairs,
+              const std::vector<DistanceRequest>& requests,
+              std::vector<DistanceResult>& results) {
+  getThreadLocalBatchDistance()(pairs, requests, results);
+}
+
 }  // namespace coal
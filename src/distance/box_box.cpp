@@ -0,0 +1,139 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "coal/math/transform.h"
+#include "coal/shape/geometric_shapes.h"
+
+#include "coal/internal/shape_shape_func.h"
+#include "../narrowphase/details.h"
+
+#include "coal/tracy.hh"
+
+namespace coal {
+
+namespace {
+/// Contact manifold of two boxes, including their swept-sphere radii.
+/// Returns 0 if the boxes are separated or if the manifold could not be
+/// computed: GJK must be used instead.
+int boxBoxContacts(const Box& s1, const Transform3s& tf1, const Box& s2,
+                   const Transform3s& tf2, Vec3s& normal, Vec3s p1[4],
+                   Vec3s p2[4], Scalar distances[4]) {
+  int axis;
+  const Scalar separation =
+      details::boxBoxSeparation(s1, tf1, s2, tf2, normal, axis);
+  if (separation > 0) return 0;
+  const int n = details::boxBoxContactManifold(s1, tf1, s2, tf2, separation,
+                                               normal, axis, p1, p2,
+                                               distances);
+
+  // Take swept-sphere radius into account
+  const Scalar ssr1 = s1.getSweptSphereRadius();
+  const Scalar ssr2 = s2.getSweptSphereRadius();
+  if (ssr1 > 0 || ssr2 > 0) {
+    for (int i = 0; i < n; ++i) {
+      p1[i] += ssr1 * normal;
+      p2[i] -= ssr2 * normal;
+      distances[i] -= (ssr1 + ssr2);
+    }
+  }
+  return n;
+}
+}  // namespace
+
+namespace internal {
+template <>
+Scalar ShapeShapeDistance<Box, Box>(const CollisionGeometry* o1,
+                                    const Transform3s& tf1,
+                                    const CollisionGeometry* o2,
+                                    const Transform3s& tf2,
+                                    const GJKSolver* nsolver,
+                                    const bool compute_penetration, Vec3s& p1,
+                                    Vec3s& p2, Vec3s& normal) {
+  COAL_TRACY_ZONE_SCOPED_N("coal::internal::ShapeShapeDistance<Box, Box>");
+  const Box& s1 = static_cast<const Box&>(*o1);
+  const Box& s2 = static_cast<const Box&>(*o2);
+  Vec3s contacts1[4], contacts2[4];
+  Scalar distances[4];
+  // The separating axis test only gives a lower bound of the distance
+  // between separated boxes.
+  if (boxBoxContacts(s1, tf1, s2, tf2, normal, contacts1, contacts2,
+                     distances) == 0)
+    return nsolver->shapeDistance(s1, tf1, s2, tf2, compute_penetration, p1,
+                                  p2, normal);
+  p1 = contacts1[0];
+  p2 = contacts2[0];
+  return distances[0];
+}
+}  // namespace internal
+
+std::size_t ShapeShapeCollider<Box, Box>::run(
+    const CollisionGeometry* o1, const Transform3s& tf1,
+    const CollisionGeometry* o2, const Transform3s& tf2,
+    const GJKSolver* nsolver, const CollisionRequest& request,
+    CollisionResult& result) {
+  COAL_TRACY_ZONE_SCOPED_N("coal::ShapeShapeCollider<Box, Box>::run");
+  if (request.isSatisfied(result)) return result.numContacts();
+
+  const Box& s1 = static_cast<const Box&>(*o1);
+  const Box& s2 = static_cast<const Box&>(*o2);
+  Vec3s p1[4], p2[4], normal;
+  Scalar distances[4];
+  int n = boxBoxContacts(s1, tf1, s2, tf2, normal, p1, p2, distances);
+  if (n == 0) {
+    const bool compute_penetration =
+        request.enable_contact || (request.security_margin < 0);
+    distances[0] = nsolver->shapeDistance(s1, tf1, s2, tf2, compute_penetration,
+                                          p1[0], p2[0], normal);
+    n = 1;
+  }
+
+  internal::updateDistanceLowerBoundFromLeaf(
+      request, result, distances[0] - request.security_margin, p1[0], p2[0],
+      normal);
+
+  // The first contact is the deepest one.
+  size_t num_contacts = 0;
+  for (int i = 0; i < n && result.numContacts() < request.num_max_contacts;
+       ++i) {
+    if (distances[i] - request.security_margin >
+        request.collision_distance_threshold)
+      continue;
+    result.addContact(Contact(o1, o2, Contact::NONE, Contact::NONE, p1[i],
+                              p2[i], normal, distances[i]));
+    num_contacts = result.numContacts();
+  }
+  return num_contacts;
+}
+
+}  // namespace coal
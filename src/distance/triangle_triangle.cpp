@@ -80,8 +80,14 @@ Scalar ShapeShapeDistance<TriangleP, TriangleP>(
       details::EPA::DidNotRun;  // EPA is never called in this function
 
   Vec3ps guess_ = guess.cast<SolverScalar>();
-  details::GJK::Status gjk_status =
-      solver->gjk.evaluate(solver->minkowski_difference, guess_, support_hint);
+  details::GJK::Status gjk_status = solver->gjk.evaluate<
+      details::getSupportFuncTpl<TriangleP, TriangleP, true,
+                                 details::SupportOptions::NoSweptSphere> >(
+      solver->minkowski_difference, guess_, support_hint);
+  if (solver->statistics) {
+    ++solver->statistics->num_gjk_calls;
+    solver->statistics->num_gjk_iterations += solver->gjk.getNumIterations();
+  }
 
   solver->cached_guess = solver->gjk.getGuessFromSimplex().cast<Scalar>();
   solver->support_func_cached_guess = solver->gjk.support_hint;
@@ -42,6 +42,8 @@
 #include "coal/internal/traversal_node_setup.h"
 #include "coal/internal/shape_shape_func.h"
 #include <../src/traits_traversal.h>
+#include "coal/compound.h"
+#include "coal/collision_utility.h"
 
 namespace coal {
 
@@ -197,6 +199,51 @@ struct COAL_LOCAL HeightFieldShapeDistancer {
   }
 };
 
+/// @brief Distance functor between a height field and a mesh or a second
+/// height field
+template <typename BV1, typename T>
+struct COAL_LOCAL HeightFieldDistancer {
+  typedef HeightField<BV1> HF;
+
+  static Scalar distance(const CollisionGeometry* o1, const Transform3s& tf1,
+                         const CollisionGeometry* o2, const Transform3s& tf2,
+                         const GJKSolver* nsolver,
+                         const DistanceRequest& request,
+                         DistanceResult& result) {
+    if (request.isSatisfied(result)) return result.min_distance;
+
+    const HF& height_field = static_cast<const HF&>(*o1);
+    const T& model2 = static_cast<const T&>(*o2);
+
+    typename TraversalTraitsDistance<HF, T>::CollisionTraversal_t node;
+
+    initialize(node, height_field, tf1, model2, tf2, nsolver, request, result);
+    coal::distance(&node);
+    return result.min_distance;
+  }
+};
+
+/// @brief Distance functor between a mesh and a height field, which traverses
+/// the height field first.
+template <typename BV1, typename BV2>
+struct COAL_LOCAL BVHHeightFieldDistancer {
+  static Scalar distance(const CollisionGeometry* o1, const Transform3s& tf1,
+                         const CollisionGeometry* o2, const Transform3s& tf2,
+                         const GJKSolver* nsolver,
+                         const DistanceRequest& request,
+                         DistanceResult& result) {
+    if (request.isSatisfied(result)) return result.min_distance;
+
+    HeightFieldDistancer<BV2, BVHModel<BV1> >::distance(
+        o2, tf2, o1, tf1, nsolver, request, result);
+    std::swap(result.o1, result.o2);
+    std::swap(result.b1, result.b2);
+    result.nearest_points[0].swap(result.nearest_points[1]);
+    result.normal *= -1;
+    return result.min_distance;
+  }
+};
+
 template <typename T_BVH>
 Scalar BVHDistance(const CollisionGeometry* o1, const Transform3s& tf1,
                    const CollisionGeometry* o2, const Transform3s& tf2,
@@ -272,6 +319,97 @@ Scalar BVHDistance(const CollisionGeometry* o1, const Transform3s& tf1,
   return BVHDistance<T_BVH>(o1, tf1, o2, tf2, request, result);
 }
 
+DistanceFunctionMatrix& getDistanceFunctionLookTable();
+
+namespace details {
+/// @brief Distance between a part of a compound and another geometry, in the
+/// order of the geometries expected by the look-up table.
+Scalar compoundPartDistance(const CollisionGeometry* o1, const Transform3s& tf1,
+                            const CollisionGeometry* o2, const Transform3s& tf2,
+                            const GJKSolver* nsolver,
+                            const DistanceRequest& request,
+                            DistanceResult& result) {
+  const DistanceFunctionMatrix& looktable = getDistanceFunctionLookTable();
+  const bool swap =
+      o1->getObjectType() == OT_GEOM &&
+      (o2->getObjectType() == OT_BVH || o2->getObjectType() == OT_HFIELD);
+  const NODE_TYPE node_type1 = o1->getNodeType();
+  const NODE_TYPE node_type2 = o2->getNodeType();
+  const DistanceFunctionMatrix::DistanceFunc func =
+      swap ? looktable.distance_matrix[node_type2][node_type1]
+           : looktable.distance_matrix[node_type1][node_type2];
+  if (!func)
+    COAL_THROW_PRETTY("Distance function between node type "
+                          << std::string(get_node_type_name(node_type1))
+                          << " and node type "
+                          << std::string(get_node_type_name(node_type2))
+                          << " is not yet supported.",
+                      std::invalid_argument);
+
+  if (!swap) return func(o1, tf1, o2, tf2, nsolver, request, result);
+  const Scalar res = func(o2, tf2, o1, tf1, nsolver, request, result);
+  std::swap(result.o1, result.o2);
+  std::swap(result.b1, result.b2);
+  result.nearest_points[0].swap(result.nearest_points[1]);
+  result.normal *= -1;
+  return res;
+}
+}  // namespace details
+
+/// @brief Distance between a compound and another geometry. The parts are
+/// visited by increasing distance between the AABBs, and the visit stops once
+/// the AABBs are further than the current minimal distance.
+template <bool CompoundFirst>
+Scalar CompoundDistance(const CollisionGeometry* o1, const Transform3s& tf1,
+                        const CollisionGeometry* o2, const Transform3s& tf2,
+                        const GJKSolver* nsolver,
+                        const DistanceRequest& request,
+                        DistanceResult& result) {
+  if (request.isSatisfied(result)) return result.min_distance;
+
+  const Compound* compound =
+      static_cast<const Compound*>(CompoundFirst ? o1 : o2);
+  const CollisionGeometry* other = CompoundFirst ? o2 : o1;
+  const Transform3s& tf_compound = CompoundFirst ? tf1 : tf2;
+  const Transform3s& tf_other = CompoundFirst ? tf2 : tf1;
+
+  AABB other_aabb;
+  const bool bounded = Compound::computeRelativeAABB(
+      *other, tf_compound.inverseTimes(tf_other), other_aabb);
+
+  std::vector<std::pair<Scalar, std::size_t> > order(compound->numParts());
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    order[i].first =
+        bounded ? compound->getPartAABB(i).distance(other_aabb) : Scalar(0);
+    order[i].second = i;
+  }
+  std::sort(order.begin(), order.end());
+
+  DistanceResult part_result;
+  for (const std::pair<Scalar, std::size_t>& item : order) {
+    // Overlapping AABBs are always visited, for the penetration depth.
+    if (item.first > 0 && item.first >= result.min_distance) break;
+
+    const std::size_t i = item.second;
+    const CollisionGeometry* part = compound->getPart(i).get();
+    const Transform3s tf_part = tf_compound * compound->getPartPlacement(i);
+    part_result.clear();
+    if (CompoundFirst) {
+      details::compoundPartDistance(part, tf_part, other, tf_other, nsolver,
+                                    request, part_result);
+      part_result.o1 = compound;
+      part_result.b1 = static_cast<int>(i);
+    } else {
+      details::compoundPartDistance(other, tf_other, part, tf_part, nsolver,
+                                    request, part_result);
+      part_result.o2 = compound;
+      part_result.b2 = static_cast<int>(i);
+    }
+    result.update(part_result);
+  }
+  return result.min_distance;
+}
+
 DistanceFunctionMatrix::DistanceFunctionMatrix() {
   for (int i = 0; i < NODE_COUNT; ++i) {
     for (int j = 0; j < NODE_COUNT; ++j) distance_matrix[i][j] = NULL;
@@ -516,6 +654,47 @@ DistanceFunctionMatrix::DistanceFunctionMatrix() {
   distance_matrix[HF_OBBRSS][GEOM_HALFSPACE]                = &HeightFieldShapeDistancer<OBBRSS, Halfspace>::distance;
   distance_matrix[HF_OBBRSS][GEOM_ELLIPSOID]                = &HeightFieldShapeDistancer<OBBRSS, Ellipsoid>::distance;
 
+  distance_matrix[HF_AABB][BV_AABB]                         = &HeightFieldDistancer<AABB, BVHModel<AABB> >::distance;
+  distance_matrix[HF_AABB][BV_OBB]                          = &HeightFieldDistancer<AABB, BVHModel<OBB> >::distance;
+  distance_matrix[HF_AABB][BV_RSS]                          = &HeightFieldDistancer<AABB, BVHModel<RSS> >::distance;
+  distance_matrix[HF_AABB][BV_kIOS]                         = &HeightFieldDistancer<AABB, BVHModel<kIOS> >::distance;
+  distance_matrix[HF_AABB][BV_OBBRSS]                       = &HeightFieldDistancer<AABB, BVHModel<OBBRSS> >::distance;
+  distance_matrix[HF_AABB][BV_KDOP16]                       = &HeightFieldDistancer<AABB, BVHModel<KDOP<16> > >::distance;
+  distance_matrix[HF_AABB][BV_KDOP18]                       = &HeightFieldDistancer<AABB, BVHModel<KDOP<18> > >::distance;
+  distance_matrix[HF_AABB][BV_KDOP24]                       = &HeightFieldDistancer<AABB, BVHModel<KDOP<24> > >::distance;
+
+  distance_matrix[HF_OBBRSS][BV_AABB]                       = &HeightFieldDistancer<OBBRSS, BVHModel<AABB> >::distance;
+  distance_matrix[HF_OBBRSS][BV_OBB]                        = &HeightFieldDistancer<OBBRSS, BVHModel<OBB> >::distance;
+  distance_matrix[HF_OBBRSS][BV_RSS]                        = &HeightFieldDistancer<OBBRSS, BVHModel<RSS> >::distance;
+  distance_matrix[HF_OBBRSS][BV_kIOS]                       = &HeightFieldDistancer<OBBRSS, BVHModel<kIOS> >::distance;
+  distance_matrix[HF_OBBRSS][BV_OBBRSS]                     = &HeightFieldDistancer<OBBRSS, BVHModel<OBBRSS> >::distance;
+  distance_matrix[HF_OBBRSS][BV_KDOP16]                     = &HeightFieldDistancer<OBBRSS, BVHModel<KDOP<16> > >::distance;
+  distance_matrix[HF_OBBRSS][BV_KDOP18]                     = &HeightFieldDistancer<OBBRSS, BVHModel<KDOP<18> > >::distance;
+  distance_matrix[HF_OBBRSS][BV_KDOP24]                     = &HeightFieldDistancer<OBBRSS, BVHModel<KDOP<24> > >::distance;
+
+  distance_matrix[BV_AABB][HF_AABB]                         = &BVHHeightFieldDistancer<AABB, AABB>::distance;
+  distance_matrix[BV_OBB][HF_AABB]                          = &BVHHeightFieldDistancer<OBB, AABB>::distance;
+  distance_matrix[BV_RSS][HF_AABB]                          = &BVHHeightFieldDistancer<RSS, AABB>::distance;
+  distance_matrix[BV_kIOS][HF_AABB]                         = &BVHHeightFieldDistancer<kIOS, AABB>::distance;
+  distance_matrix[BV_OBBRSS][HF_AABB]                       = &BVHHeightFieldDistancer<OBBRSS, AABB>::distance;
+  distance_matrix[BV_KDOP16][HF_AABB]                       = &BVHHeightFieldDistancer<KDOP<16>, AABB>::distance;
+  distance_matrix[BV_KDOP18][HF_AABB]                       = &BVHHeightFieldDistancer<KDOP<18>, AABB>::distance;
+  distance_matrix[BV_KDOP24][HF_AABB]                       = &BVHHeightFieldDistancer<KDOP<24>, AABB>::distance;
+
+  distance_matrix[BV_AABB][HF_OBBRSS]                       = &BVHHeightFieldDistancer<AABB, OBBRSS>::distance;
+  distance_matrix[BV_OBB][HF_OBBRSS]                        = &BVHHeightFieldDistancer<OBB, OBBRSS>::distance;
+  distance_matrix[BV_RSS][HF_OBBRSS]                        = &BVHHeightFieldDistancer<RSS, OBBRSS>::distance;
+  distance_matrix[BV_kIOS][HF_OBBRSS]                       = &BVHHeightFieldDistancer<kIOS, OBBRSS>::distance;
+  distance_matrix[BV_OBBRSS][HF_OBBRSS]                     = &BVHHeightFieldDistancer<OBBRSS, OBBRSS>::distance;
+  distance_matrix[BV_KDOP16][HF_OBBRSS]                     = &BVHHeightFieldDistancer<KDOP<16>, OBBRSS>::distance;
+  distance_matrix[BV_KDOP18][HF_OBBRSS]                     = &BVHHeightFieldDistancer<KDOP<18>, OBBRSS>::distance;
+  distance_matrix[BV_KDOP24][HF_OBBRSS]                     = &BVHHeightFieldDistancer<KDOP<24>, OBBRSS>::distance;
+
+  distance_matrix[HF_AABB][HF_AABB]                         = &HeightFieldDistancer<AABB, HeightField<AABB> >::distance;
+  distance_matrix[HF_AABB][HF_OBBRSS]                       = &HeightFieldDistancer<AABB, HeightField<OBBRSS> >::distance;
+  distance_matrix[HF_OBBRSS][HF_AABB]                       = &HeightFieldDistancer<OBBRSS, HeightField<AABB> >::distance;
+  distance_matrix[HF_OBBRSS][HF_OBBRSS]                     = &HeightFieldDistancer<OBBRSS, HeightField<OBBRSS> >::distance;
+
   distance_matrix[BV_AABB][BV_AABB]                         = &BVHDistance<AABB>;
   distance_matrix[BV_OBB][BV_OBB]                           = &BVHDistance<OBB>;
   distance_matrix[BV_RSS][BV_RSS]                           = &BVHDistance<RSS>;
@@ -569,6 +748,13 @@ DistanceFunctionMatrix::DistanceFunctionMatrix() {
   distance_matrix[HF_OBBRSS][GEOM_OCTREE]                   = &distance_function_not_implemented;
 #endif
   // clang-format on
+
+  // The parts of a compound are dispatched through this table.
+  for (int i = 0; i < NODE_COUNT; ++i) {
+    distance_matrix[GEOM_COMPOUND][i] = &CompoundDistance<true>;
+    distance_matrix[i][GEOM_COMPOUND] = &CompoundDistance<false>;
+  }
+  distance_matrix[GEOM_COMPOUND][GEOM_COMPOUND] = &CompoundDistance<true>;
 }
 // template struct DistanceFunctionMatrix;
 }  // namespace coal
@@ -38,6 +38,7 @@
 #include "coal/internal/intersect.h"
 #include "coal/internal/tools.h"
 
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <vector>
@@ -57,6 +58,92 @@ bool Intersect::buildTrianglePlane(const Vec3s& v1, const Vec3s& v2,
   return false;
 }
 
+namespace {
+/// Interval cut on the intersection line of two planes by a triangle, whose
+/// vertices project to p on the line and lie at the signed distances d
+/// (up to a common positive factor) of the other plane. The distances must
+/// not be all of the same strict sign.
+/// Returns false if the triangle lies in the plane.
+bool triangleLineInterval(const Scalar p[3], const Scalar d[3], Scalar& t0,
+                          Scalar& t1) {
+  // Find the vertex which is alone on its side of the plane.
+  int i;
+  if (d[0] * d[1] > 0)
+    i = 2;
+  else if (d[0] * d[2] > 0)
+    i = 1;
+  else if (d[1] * d[2] > 0 || d[0] != 0)
+    i = 0;
+  else if (d[1] != 0)
+    i = 1;
+  else if (d[2] != 0)
+    i = 2;
+  else
+    return false;
+  const int j = (i + 1) % 3, k = (i + 2) % 3;
+  t0 = p[i] + (p[j] - p[i]) * d[i] / (d[i] - d[j]);
+  t1 = p[i] + (p[k] - p[i]) * d[i] / (d[i] - d[k]);
+  if (t0 > t1) std::swap(t0, t1);
+  return true;
+}
+
+/// Whether the three values are either all strictly positive or all strictly
+/// negative.
+inline bool sameStrictSign(const Scalar d[3]) {
+  return (d[0] > 0 && d[1] > 0 && d[2] > 0) ||
+         (d[0] < 0 && d[1] < 0 && d[2] < 0);
+}
+
+inline Scalar minAbs(const Scalar d[3]) {
+  return (std::min)((std::min)(std::abs(d[0]), std::abs(d[1])),
+                    std::abs(d[2]));
+}
+}  // namespace
+
+bool Intersect::intersectTriangles(const Vec3s& P1, const Vec3s& P2,
+                                   const Vec3s& P3, const Vec3s& Q1,
+                                   const Vec3s& Q2, const Vec3s& Q3,
+                                   Scalar& distLowerBound) {
+  distLowerBound = 0;
+
+  // Triangle Q against the plane of triangle P.
+  const Vec3s N1 = (P2 - P1).cross(P3 - P1);
+  const Scalar dq[3] = {N1.dot(Q1 - P1), N1.dot(Q2 - P1), N1.dot(Q3 - P1)};
+  if (sameStrictSign(dq)) {
+    distLowerBound = minAbs(dq) / N1.norm();
+    return false;
+  }
+
+  // Triangle P against the plane of triangle Q.
+  const Vec3s N2 = (Q2 - Q1).cross(Q3 - Q1);
+  const Scalar dp[3] = {N2.dot(P1 - Q1), N2.dot(P2 - Q1), N2.dot(P3 - Q1)};
+  if (sameStrictSign(dp)) {
+    distLowerBound = minAbs(dp) / N2.norm();
+    return false;
+  }
+
+  // The intersection line of the planes is not well defined if the triangles
+  // are degenerate or (nearly) coplanar: the caller has to compute the
+  // distance.
+  const Vec3s D = N1.cross(N2);
+  const Scalar eps = Eigen::NumTraits<Scalar>::dummy_precision();
+  if (D.squaredNorm() <= eps * eps * N1.squaredNorm() * N2.squaredNorm()) {
+    distLowerBound = -1;
+    return false;
+  }
+
+  // Compare the intervals cut by both triangles on the intersection line.
+  const Scalar p[3] = {0, D.dot(P2 - P1), D.dot(P3 - P1)};
+  const Scalar q[3] = {D.dot(Q1 - P1), D.dot(Q2 - P1), D.dot(Q3 - P1)};
+  Scalar p0, p1, q0, q1;
+  if (!triangleLineInterval(p, dp, p0, p1) ||
+      !triangleLineInterval(q, dq, q0, q1)) {
+    distLowerBound = -1;
+    return false;
+  }
+  return p0 <= q1 && q0 <= p1;
+}
+
 void TriangleDistance::segPoints(const Vec3s& P, const Vec3s& A, const Vec3s& Q,
                                  const Vec3s& B, Vec3s& VEC, Vec3s& X,
                                  Vec3s& Y) {
@@ -0,0 +1,192 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "coal/metrics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace coal {
+
+namespace {
+/// @brief Adds v to an atomic which is only written by the calling thread.
+/// This avoids the cost of an atomic read-modify-write operation.
+template <typename T>
+inline void addSingleWriter(std::atomic<T>& x, T v) {
+  x.store(x.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+}
+}  // namespace
+
+double CallMetrics::binUpperBound(std::size_t bin) {
+  if (bin + 1 >= num_histogram_bins)
+    return std::numeric_limits<double>::infinity();
+  return std::ldexp(1., static_cast<int>(bin));
+}
+
+std::size_t CallMetrics::bin(double time) {
+  if (!(time >= 1.)) return 0;
+  // time is in [2^(exponent-1), 2^exponent).
+  int exponent;
+  std::frexp(time, &exponent);
+  return (std::min)(static_cast<std::size_t>(exponent),
+                    num_histogram_bins - 1);
+}
+
+std::vector<CallMetricsEntry> MetricsSnapshot::calledEntries() const {
+  std::vector<CallMetricsEntry> entries;
+  for (int type = 0; type < METRICS_QUERY_TYPE_COUNT; ++type) {
+    for (int node_type1 = 0; node_type1 < NODE_COUNT; ++node_type1) {
+      for (int node_type2 = 0; node_type2 < NODE_COUNT; ++node_type2) {
+        CallMetricsEntry entry;
+        entry.type = static_cast<MetricsQueryType>(type);
+        entry.node_type1 = static_cast<NODE_TYPE>(node_type1);
+        entry.node_type2 = static_cast<NODE_TYPE>(node_type2);
+        entry.metrics = get(entry.type, entry.node_type1, entry.node_type2);
+        if (entry.metrics.num_calls > 0) entries.push_back(entry);
+      }
+    }
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const CallMetricsEntry& a, const CallMetricsEntry& b) {
+              return a.metrics.total_time > b.metrics.total_time;
+            });
+  return entries;
+}
+
+struct MetricsRegistry::ThreadMetrics {
+  struct Calls {
+    std::atomic<std::size_t> num_calls;
+    std::atomic<double> total_time;
+    std::atomic<std::size_t> histogram[CallMetrics::num_histogram_bins];
+  };
+
+  // The value-initialization of the vector sets all the atomics to zero.
+  ThreadMetrics()
+      : calls(METRICS_QUERY_TYPE_COUNT * NODE_COUNT * NODE_COUNT),
+        in_use(false) {}
+
+  std::vector<Calls> calls;
+  /// @brief Whether a thread owns this storage. Protected by the mutex of the
+  /// registry.
+  bool in_use;
+};
+
+MetricsRegistry& MetricsRegistry::instance() {
+  static MetricsRegistry registry;
+  return registry;
+}
+
+MetricsRegistry::MetricsRegistry() : m_enabled(false) {}
+
+MetricsRegistry::~MetricsRegistry() {}
+
+MetricsRegistry::ThreadMetrics& MetricsRegistry::threadMetrics() {
+  // Gives the storage back to the registry when the thread exits.
+  struct Handle {
+    ThreadMetrics* metrics = nullptr;
+    ~Handle() {
+      if (metrics == nullptr) return;
+      std::lock_guard<std::mutex> lock(MetricsRegistry::instance().m_mutex);
+      metrics->in_use = false;
+    }
+  };
+  thread_local Handle handle;
+  if (handle.metrics != nullptr) return *handle.metrics;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (const std::unique_ptr<ThreadMetrics>& metrics : m_threads) {
+    if (!metrics->in_use) {
+      handle.metrics = metrics.get();
+      break;
+    }
+  }
+  if (handle.metrics == nullptr) {
+    m_threads.emplace_back(new ThreadMetrics());
+    handle.metrics = m_threads.back().get();
+  }
+  handle.metrics->in_use = true;
+  return *handle.metrics;
+}
+
+void MetricsRegistry::record(MetricsQueryType type, NODE_TYPE node_type1,
+                             NODE_TYPE node_type2, double time) {
+  ThreadMetrics::Calls& calls =
+      threadMetrics()
+          .calls[MetricsSnapshot::index(type, node_type1, node_type2)];
+  addSingleWriter<std::size_t>(calls.num_calls, 1);
+  addSingleWriter(calls.total_time, time);
+  addSingleWriter<std::size_t>(calls.histogram[CallMetrics::bin(time)], 1);
+}
+
+MetricsSnapshot MetricsRegistry::accumulate() const {
+  MetricsSnapshot sum;
+  for (const std::unique_ptr<ThreadMetrics>& metrics : m_threads) {
+    for (std::size_t i = 0; i < sum.calls.size(); ++i) {
+      const ThreadMetrics::Calls& calls = metrics->calls[i];
+      CallMetrics& call_metrics = sum.calls[i];
+      call_metrics.num_calls += calls.num_calls.load(std::memory_order_relaxed);
+      call_metrics.total_time +=
+          calls.total_time.load(std::memory_order_relaxed);
+      for (std::size_t bin = 0; bin < CallMetrics::num_histogram_bins; ++bin)
+        call_metrics.histogram[bin] +=
+            calls.histogram[bin].load(std::memory_order_relaxed);
+    }
+  }
+  return sum;
+}
+
+MetricsSnapshot MetricsRegistry::snapshot() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  MetricsSnapshot snapshot = accumulate();
+  for (std::size_t i = 0; i < snapshot.calls.size(); ++i) {
+    CallMetrics& call_metrics = snapshot.calls[i];
+    const CallMetrics& baseline = m_baseline.calls[i];
+    call_metrics.num_calls -= baseline.num_calls;
+    call_metrics.total_time -= baseline.total_time;
+    for (std::size_t bin = 0; bin < CallMetrics::num_histogram_bins; ++bin)
+      call_metrics.histogram[bin] -= baseline.histogram[bin];
+  }
+  return snapshot;
+}
+
+void MetricsRegistry::reset() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  // The threads keep accumulating without locking: the current sums become
+  // the new origin.
+  m_baseline = accumulate();
+}
+
+}  // namespace coal
@@ -0,0 +1,176 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "coal/narrowphase/continuous_collision.h"
+#include "coal/distance.h"
+
+#include "coal/tracy.hh"
+
+namespace coal {
+
+void ContinuousCollisionObject::computeAABB() {
+  const Quats q_beg(tf_beg.getQuatRotation());
+  const Quats q_end(tf_end.getQuatRotation());
+  if (q_beg.angularDistance(q_end) <= Scalar(0)) {
+    CollisionObject obj(cgeom, tf_beg, false);
+    aabb = obj.getAABB();
+    obj.setTransform(tf_end);
+    obj.computeAABB();
+    aabb += obj.getAABB();
+  } else {
+    const Vec3s radius =
+        Vec3s::Constant(boundingRadiusAroundOrigin(cgeom->aabb_local));
+    aabb = AABB(tf_beg.getTranslation() - radius,
+                tf_beg.getTranslation() + radius);
+    aabb += AABB(tf_end.getTranslation() - radius,
+                 tf_end.getTranslation() + radius);
+  }
+}
+
+namespace {
+/// @brief Checks that the local AABB of a geometry has been computed and
+/// returns its bounding radius around the origin.
+Scalar checkedBoundingRadius(const CollisionGeometry* o) {
+  const AABB& aabb = o->aabb_local;
+  if (!(aabb.min_.array() <= aabb.max_.array()).all()) {
+    COAL_THROW_PRETTY(
+        "The local AABB of the geometry is not computed. Call "
+        "CollisionGeometry::computeLocalAABB before continuousCollide.",
+        std::invalid_argument);
+  }
+  return boundingRadiusAroundOrigin(aabb);
+}
+
+/// @brief Bound on the displacement of the points of a geometry due to the
+/// rotation of its motion.
+Scalar rotationBound(const CollisionGeometry* o, const Transform3s& tf_beg,
+                     const Transform3s& tf_end) {
+  const Scalar angle =
+      tf_beg.getQuatRotation().angularDistance(tf_end.getQuatRotation());
+  // Avoid 0 * inf for unbounded geometries (e.g. planes) which only translate.
+  if (angle <= Scalar(0)) return Scalar(0);
+  return angle * checkedBoundingRadius(o);
+}
+}  // namespace
+
+Scalar continuousCollide(const CollisionGeometry* o1,
+                         const Transform3s& tf1_beg,
+                         const Transform3s& tf1_end,
+                         const CollisionGeometry* o2,
+                         const Transform3s& tf2_beg,
+                         const Transform3s& tf2_end,
+                         const ContinuousCollisionRequest& request,
+                         ContinuousCollisionResult& result) {
+  COAL_TRACY_ZONE_SCOPED_N("coal::continuousCollide");
+  if (request.toc_err <= Scalar(0)) {
+    COAL_THROW_PRETTY("The tolerance on the distance at contact (toc_err = "
+                          << request.toc_err << ") must be positive.",
+                      std::invalid_argument);
+  }
+  result.clear();
+
+  const ComputeDistance compute_distance(o1, o2);
+  checkedBoundingRadius(o1);
+  checkedBoundingRadius(o2);
+
+  const Scalar rotation_bound = rotationBound(o1, tf1_beg, tf1_end) +
+                                rotationBound(o2, tf2_beg, tf2_end);
+  const Vec3s relative_translation =
+      (tf2_end.getTranslation() - tf2_beg.getTranslation()) -
+      (tf1_end.getTranslation() - tf1_beg.getTranslation());
+
+  DistanceResult distance_result;
+  Scalar t = 0;
+  Transform3s tf1(tf1_beg), tf2(tf2_beg);
+  while (true) {
+    distance_result.clear();
+    const Scalar d =
+        compute_distance(tf1, tf2, request.distance_request, distance_result);
+    ++result.num_iterations;
+
+    // Direction in which the geometries have to move to get closer.
+    const Vec3s diff =
+        distance_result.nearest_points[1] - distance_result.nearest_points[0];
+    const Scalar diff_norm = diff.norm();
+    Vec3s n = distance_result.normal;
+    if (d > Scalar(0) && diff_norm > Scalar(0)) n = diff / diff_norm;
+
+    if (d <= request.toc_err ||
+        result.num_iterations >= request.num_max_iterations) {
+      result.is_collide = true;
+      result.time_of_contact = t;
+      result.contact_tf1 = tf1;
+      result.contact_tf2 = tf2;
+      result.contact_point = (distance_result.nearest_points[0] +
+                              distance_result.nearest_points[1]) /
+                             2;
+      result.normal = n;
+      return t;
+    }
+
+    const Scalar mu = std::abs(relative_translation.dot(n)) + rotation_bound;
+    if (mu <= Scalar(0)) break;
+    t += d / mu;
+    if (t >= Scalar(1)) break;
+
+    tf1 = interpolateTransform(tf1_beg, tf1_end, t);
+    tf2 = interpolateTransform(tf2_beg, tf2_end, t);
+  }
+
+  result.contact_tf1 = tf1_end;
+  result.contact_tf2 = tf2_end;
+  return result.time_of_contact;
+}
+
+Scalar continuousCollide(const ContinuousCollisionObject* o1,
+                         const ContinuousCollisionObject* o2,
+                         const ContinuousCollisionRequest& request,
+                         ContinuousCollisionResult& result) {
+  return continuousCollide(o1->collisionGeometryPtr(), o1->getStartTransform(),
+                           o1->getEndTransform(), o2->collisionGeometryPtr(),
+                           o2->getStartTransform(), o2->getEndTransform(),
+                           request, result);
+}
+
+Scalar continuousCollide(const CollisionGeometry* o1,
+                         const Transform3s& tf1_beg,
+                         const Transform3s& tf1_end,
+                         const CollisionGeometry* o2, const Transform3s& tf2,
+                         const ContinuousCollisionRequest& request,
+                         ContinuousCollisionResult& result) {
+  return continuousCollide(o1, tf1_beg, tf1_end, o2, tf2, tf2, request,
+                           result);
+}
+
+}  // namespace coal
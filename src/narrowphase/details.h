@@ -492,6 +492,268 @@ inline Scalar boxSphereDistance(const Box& b, const Transform3s& tfb,
   return dist;
 }
 
+/// @brief Separating axis test between two boxes, on the face normals of both
+/// boxes and on the cross products of their edge directions.
+/// Taken from book Real Time Collision Detection, from Christer Ericson
+/// @param[out] normal the axis of maximal separation, pointing from the first
+/// to the second box.
+/// @param[out] axis index of this axis: i for the face normal i of the first
+/// box, 3 + j for the face normal j of the second box and 6 + 3 * i + j for
+/// the cross product of the edge directions i and j of the boxes.
+/// @return the maximal separation of the boxes along the axes. When it is not
+/// positive, the boxes overlap and it is the opposite of their penetration
+/// depth. Otherwise, it is only a lower bound of their distance.
+/// @note the swept-sphere radii are not taken into account.
+inline Scalar boxBoxSeparation(const Box& b1, const Transform3s& tf1,
+                               const Box& b2, const Transform3s& tf2,
+                               Vec3s& normal, int& axis) {
+  const Matrix3s& R1 = tf1.getRotation();
+  const Vec3s& h1 = b1.halfSide;
+  const Vec3s& h2 = b2.halfSide;
+  // Placement of the second box in the frame of the first one.
+  const Matrix3s R(R1.transpose() * tf2.getRotation());
+  const Vec3s T(R1.transpose() *
+                (tf2.getTranslation() - tf1.getTranslation()));
+  const Matrix3s absR(R.cwiseAbs());
+
+  Scalar separation = -(std::numeric_limits<Scalar>::max)();
+  Vec3s local_normal;
+  for (int i = 0; i < 3; ++i) {
+    const Scalar s = std::fabs(T[i]) - (h1[i] + h2.dot(absR.row(i)));
+    if (s > separation) {
+      separation = s;
+      axis = i;
+      local_normal = (T[i] >= 0 ? 1 : -1) * Vec3s::Unit(i);
+    }
+  }
+  for (int j = 0; j < 3; ++j) {
+    const Scalar proj = T.dot(R.col(j));
+    const Scalar s = std::fabs(proj) - (h1.dot(absR.col(j)) + h2[j]);
+    if (s > separation) {
+      separation = s;
+      axis = 3 + j;
+      local_normal = (proj >= 0 ? 1 : -1) * R.col(j);
+    }
+  }
+
+  // The cross products of nearly parallel edges are not accurate enough and
+  // the face normals are preferred over the edge cross products when they
+  // give almost the same separation, which yields better contact manifolds.
+  const Scalar eps = std::sqrt(Eigen::NumTraits<Scalar>::epsilon());
+  const Scalar face_separation = separation + eps * (h1.sum() + h2.sum());
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      const Vec3s L(Vec3s::Unit(i).cross(R.col(j)));
+      const Scalar norm = L.norm();
+      if (norm <= eps) continue;
+      const Scalar proj = T.dot(L);
+      const Scalar s =
+          (std::fabs(proj) - h1.dot(L.cwiseAbs()) -
+           h2.dot((R.transpose() * L).cwiseAbs())) /
+          norm;
+      if (s > separation && s > face_separation) {
+        separation = s;
+        axis = 6 + 3 * i + j;
+        local_normal = ((proj >= 0 ? 1 : -1) / norm) * L;
+      }
+    }
+  }
+
+  normal.noalias() = R1 * local_normal;
+  return separation;
+}
+
+/// @brief Clips the face of box inc which is the most opposed to normal
+/// (incident face) against the face of box ref of normal axis face_axis
+/// (reference face).
+/// @param normal outward normal of the reference face.
+/// @param[out] p_ref, p_inc witness points on the boxes, p_ref being the
+/// projection of p_inc onto the reference face.
+/// @param[out] depths penetration depth of each pair of points.
+/// @return the number of pairs of points, at most 8.
+inline int boxBoxClipIncidentFace(const Box& ref, const Transform3s& tf_ref,
+                                  int face_axis, const Box& inc,
+                                  const Transform3s& tf_inc,
+                                  const Vec3s& normal, Vec3s p_ref[8],
+                                  Vec3s p_inc[8], Scalar depths[8]) {
+  const Matrix3s& Rr = tf_ref.getRotation();
+  const Matrix3s& Ri = tf_inc.getRotation();
+  const Vec3s& Tr = tf_ref.getTranslation();
+
+  // Incident face, in the frame of box ref.
+  int k;
+  (Ri.transpose() * normal).cwiseAbs().maxCoeff(&k);
+  const Vec3s nk(Ri.col(k));
+  const Scalar sk = nk.dot(normal) > 0 ? -1 : 1;
+  const Vec3s center(Rr.transpose() *
+                     (tf_inc.getTranslation() + sk * inc.halfSide[k] * nk -
+                      Tr));
+  const int ku = (k + 1) % 3, kv = (k + 2) % 3;
+  const Vec3s u(inc.halfSide[ku] * (Rr.transpose() * Ri.col(ku)));
+  const Vec3s v(inc.halfSide[kv] * (Rr.transpose() * Ri.col(kv)));
+
+  Vec3s polygon[2][8];
+  int n = 4;
+  polygon[0][0] = center + u + v;
+  polygon[0][1] = center - u + v;
+  polygon[0][2] = center - u - v;
+  polygon[0][3] = center + u - v;
+
+  // Sutherland-Hodgman clipping against the side planes of the reference
+  // face.
+  int current = 0;
+  for (int side = 0; side < 4; ++side) {
+    const int c = (face_axis + 1 + side / 2) % 3;
+    const Scalar sign = (side % 2 == 0) ? 1 : -1;
+    const Scalar limit = ref.halfSide[c];
+    const Vec3s* in = polygon[current];
+    Vec3s* out = polygon[1 - current];
+    int m = 0;
+    for (int i = 0; i < n; ++i) {
+      const Vec3s& a = in[i];
+      const Vec3s& b = in[(i + 1) % n];
+      const Scalar da = sign * a[c] - limit;
+      const Scalar db = sign * b[c] - limit;
+      if (da <= 0) out[m++] = a;
+      if ((da < 0 && db > 0) || (da > 0 && db < 0))
+        out[m++] = a + (da / (da - db)) * (b - a);
+    }
+    n = m;
+    current = 1 - current;
+    if (n == 0) return 0;
+  }
+
+  const Scalar sign = Rr.col(face_axis).dot(normal) > 0 ? 1 : -1;
+  const Scalar limit = ref.halfSide[face_axis];
+  for (int i = 0; i < n; ++i) {
+    Vec3s x(polygon[current][i]);
+    depths[i] = limit - sign * x[face_axis];
+    p_inc[i] = tf_ref.transform(x);
+    x[face_axis] = sign * limit;
+    p_ref[i] = tf_ref.transform(x);
+  }
+  return n;
+}
+
+/// @brief Contact manifold between two overlapping boxes, given the axis
+/// found by boxBoxSeparation.
+/// For a face normal, the face of the other box which is the most opposed to
+/// it is clipped against the side planes of the face of this normal, and
+/// at most four of the clipped points are kept. For an edge cross product,
+/// the manifold is the pair of closest points of the two edges.
+/// @param separation, normal, axis output of boxBoxSeparation.
+/// @param[out] p1, p2 witness points of each contact on the first and second
+/// box.
+/// @param[out] distances signed distance of each contact, such that
+/// p2 - p1 = distance * normal.
+/// @return the number of contacts, at most 4, the deepest one first. Its
+/// distance is separation. 0 is returned if the clipping failed.
+/// @note the swept-sphere radii are not taken into account.
+inline int boxBoxContactManifold(const Box& b1, const Transform3s& tf1,
+                                 const Box& b2, const Transform3s& tf2,
+                                 Scalar separation, const Vec3s& normal,
+                                 int axis, Vec3s p1[4], Vec3s p2[4],
+                                 Scalar distances[4]) {
+  if (axis >= 6) {
+    // Edges of the boxes which are the furthest along the normal.
+    const int i = (axis - 6) / 3, j = (axis - 6) % 3;
+    const Matrix3s& R1 = tf1.getRotation();
+    const Matrix3s& R2 = tf2.getRotation();
+    Vec3s c1(tf1.getTranslation()), c2(tf2.getTranslation());
+    for (int k = 0; k < 3; ++k) {
+      if (k != i)
+        c1 += (R1.col(k).dot(normal) > 0 ? 1 : -1) * b1.halfSide[k] *
+              R1.col(k);
+      if (k != j)
+        c2 -= (R2.col(k).dot(normal) > 0 ? 1 : -1) * b2.halfSide[k] *
+              R2.col(k);
+    }
+    const Vec3s d1(R1.col(i)), d2(R2.col(j));
+    const Vec3s r(c1 - c2);
+    const Scalar b = d1.dot(d2), c = d1.dot(r), f = d2.dot(r);
+    Scalar s = (b * f - c) / (1 - b * b);
+    s = (std::min)((std::max)(s, -b1.halfSide[i]), b1.halfSide[i]);
+    Scalar t = f + s * b;
+    t = (std::min)((std::max)(t, -b2.halfSide[j]), b2.halfSide[j]);
+    s = t * b - c;
+    s = (std::min)((std::max)(s, -b1.halfSide[i]), b1.halfSide[i]);
+    p1[0] = c1 + s * d1;
+    p2[0] = p1[0] + separation * normal;
+    distances[0] = separation;
+    return 1;
+  }
+
+  Vec3s p_ref[8], p_inc[8];
+  Scalar depths[8];
+  int n;
+  if (axis < 3)
+    n = boxBoxClipIncidentFace(b1, tf1, axis, b2, tf2, normal, p_ref, p_inc,
+                               depths);
+  else
+    n = boxBoxClipIncidentFace(b2, tf2, axis - 3, b1, tf1, -normal, p_ref,
+                               p_inc, depths);
+  if (n == 0) return 0;
+
+  // Keep the deepest point, the point the furthest from it and the two
+  // points which span the largest area on each side of these two points.
+  int selected[4];
+  int m = 0;
+  Eigen::Index deepest;
+  Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, 1> >(depths, n)
+      .maxCoeff(&deepest);
+  selected[m++] = int(deepest);
+  if (n > 1) {
+    const Vec3s& a = p_inc[deepest];
+    int furthest = -1;
+    Scalar max_sqr_dist = 0;
+    for (int i = 0; i < n; ++i) {
+      const Scalar sqr_dist = (p_inc[i] - a).squaredNorm();
+      if (sqr_dist > max_sqr_dist) {
+        max_sqr_dist = sqr_dist;
+        furthest = i;
+      }
+    }
+    if (furthest >= 0) {
+      selected[m++] = furthest;
+      const Vec3s ab(p_inc[furthest] - a);
+      int imin = -1, imax = -1;
+      Scalar area_min = 0, area_max = 0;
+      for (int i = 0; i < n; ++i) {
+        const Scalar area = ab.cross(p_inc[i] - a).dot(normal);
+        if (area > area_max) {
+          area_max = area;
+          imax = i;
+        } else if (area < area_min) {
+          area_min = area;
+          imin = i;
+        }
+      }
+      if (imax >= 0) selected[m++] = imax;
+      if (imin >= 0) selected[m++] = imin;
+    }
+  }
+
+  for (int i = 0; i < m; ++i) {
+    const int k = selected[i];
+    if (axis < 3) {
+      p1[i] = p_ref[k];
+      p2[i] = p_inc[k];
+    } else {
+      p1[i] = p_inc[k];
+      p2[i] = p_ref[k];
+    }
+    distances[i] = -depths[k];
+  }
+  // The deepest clipped point may be less deep than the boxes when the
+  // deepest vertex is clipped: the first contact gets the exact distance.
+  if (axis < 3)
+    p1[0] = p2[0] - separation * normal;
+  else
+    p2[0] = p1[0] + separation * normal;
+  distances[0] = separation;
+  return m;
+}
+
 /// @brief return distance between two halfspaces
 /// @param p1 the witness point on the first halfspace.
 /// @param p2 the witness point on the second halfspace.
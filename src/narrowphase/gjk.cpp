@@ -38,6 +38,7 @@
 
 #include "coal/shape/geometric_shapes.h"
 #include "coal/narrowphase/gjk.h"
+#include "coal/narrowphase/support_functions.hxx"
 #include "coal/internal/intersect.h"
 #include "coal/internal/tools.h"
 #include "coal/shape/geometric_shapes_traits.h"
@@ -153,6 +154,16 @@ void getClosestPoints(const GJK::Simplex& simplex, Vec3ps& w0, Vec3ps& w1) {
   return;
 }
 
+/// Support function of the Minkowski difference which calls the one that
+/// `MinkowskiDiff::set` selected at run time. It is the template argument of
+/// the generic versions of GJK::evaluate and EPA::evaluate.
+void getSupportFuncDynamic(const MinkowskiDiff& md, const Vec3s& dir,
+                           Vec3s& support0, Vec3s& support1,
+                           support_func_guess_t& hint,
+                           ShapeSupportData* /*unused*/) {
+  md.support(dir, support0, support1, hint);
+}
+
 /// Inflate the points along a normal.
 /// The normal is typically the normal of the separating plane found by GJK
 /// or the normal found by EPA.
@@ -189,6 +200,12 @@ void GJK::getWitnessPointsAndNormal(const MinkowskiDiff& shape, Vec3ps& w0,
   details::inflate<true>(shape, normal, w0, w1);
 }
 
+GJK::Status GJK::evaluate(const MinkowskiDiff& shape_, const Vec3ps& guess,
+                          const support_func_guess_t& supportHint) {
+  return evaluate<details::getSupportFuncDynamic>(shape_, guess, supportHint);
+}
+
+template <MinkowskiDiff::GetSupportFunction GetSupportFunc>
 GJK::Status GJK::evaluate(const MinkowskiDiff& shape_, const Vec3ps& guess,
                           const support_func_guess_t& supportHint) {
   COAL_TRACY_ZONE_SCOPED_N("coal::details::GJK::evaluate");
@@ -285,7 +302,7 @@ GJK::Status GJK::evaluate(const MinkowskiDiff& shape_, const Vec3ps& guess,
     }
 
     // see below, ray points away from origin
-    appendVertex(curr_simplex, -dir, support_hint);
+    appendVertex<GetSupportFunc>(curr_simplex, -dir, support_hint);
 
     // check removed (by ?): when the new support point is close to previous
     // support points, stop (as the new simplex is degenerated)
@@ -442,6 +459,13 @@ inline void GJK::appendVertex(Simplex& simplex, const Vec3ps& v,
   getSupport(v, *simplex.vertex[simplex.rank++], hint);
 }
 
+template <MinkowskiDiff::GetSupportFunction GetSupportFunc>
+inline void GJK::appendVertex(Simplex& simplex, const Vec3ps& v,
+                              support_func_guess_t& hint) {
+  simplex.vertex[simplex.rank] = free_v[--nfree];  // set the memory
+  getSupport<GetSupportFunc>(v, *simplex.vertex[simplex.rank++], hint);
+}
+
 bool GJK::encloseOrigin() {
   Vec3ps axis(Vec3ps::Zero());
   support_func_guess_t hint = support_func_guess_t::Zero();
@@ -1163,6 +1187,11 @@ EPA::SimplexFace* EPA::findClosestFace() {
   return minf;
 }
 
+EPA::Status EPA::evaluate(GJK& gjk, const Vec3ps& guess) {
+  return evaluate<details::getSupportFuncDynamic>(gjk, guess);
+}
+
+template <MinkowskiDiff::GetSupportFunction GetSupportFunc>
 EPA::Status EPA::evaluate(GJK& gjk, const Vec3ps& guess) {
   COAL_TRACY_ZONE_SCOPED_N("coal::details::EPA::evaluate");
   GJK::Simplex& simplex = *gjk.getSimplex();
@@ -1236,7 +1265,7 @@ EPA::Status EPA::evaluate(GJK& gjk, const Vec3ps& guess) {
         closest_face->pass = ++pass;
         // At the moment, SimplexF.n is always normalized. This could be revised
         // in the future...
-        gjk.getSupport(closest_face->n, w, support_hint);
+        gjk.getSupport<GetSupportFunc>(closest_face->n, w, support_hint);
 
         // Step 2: check for convergence.
         // ------------------------------
@@ -1476,6 +1505,41 @@ void EPA::getWitnessPointsAndNormal(const MinkowskiDiff& shape, Vec3ps& w0,
   details::inflate<false>(shape, normal, w0, w1);
 }
 
+// ============================================================================
+// Instantiations of GJK and EPA for the pairs of shapes of HasSpecializedGJK.
+// The support functions of the primitive shapes are defined in
+// support_functions.hxx, so that they are inlined in the iterations.
+// clang-format off
+#define gjkAndEPATplInstantiation(Shape0, Shape1, TransformIsIdentity)         \
+  template COAL_DLLAPI GJK::Status GJK::evaluate<getSupportFuncTpl<            \
+      Shape0, Shape1, TransformIsIdentity, SupportOptions::NoSweptSphere> >(   \
+      const MinkowskiDiff&, const Vec3ps&, const support_func_guess_t&);       \
+  template COAL_DLLAPI EPA::Status EPA::evaluate<getSupportFuncTpl<            \
+      Shape0, Shape1, TransformIsIdentity, SupportOptions::NoSweptSphere> >(   \
+      GJK&, const Vec3ps&);
+
+#define gjkAndEPATplInstantiationPair(Shape0, Shape1)                          \
+  gjkAndEPATplInstantiation(Shape0, Shape1, true)                              \
+  gjkAndEPATplInstantiation(Shape0, Shape1, false)
+
+#define gjkAndEPATplInstantiationShape0(Shape0)                                \
+  gjkAndEPATplInstantiationPair(Shape0, TriangleP)                             \
+  gjkAndEPATplInstantiationPair(Shape0, Box)                                   \
+  gjkAndEPATplInstantiationPair(Shape0, Sphere)                                \
+  gjkAndEPATplInstantiationPair(Shape0, Ellipsoid)                             \
+  gjkAndEPATplInstantiationPair(Shape0, Capsule)                               \
+  gjkAndEPATplInstantiationPair(Shape0, Cone)                                  \
+  gjkAndEPATplInstantiationPair(Shape0, Cylinder)
+
+gjkAndEPATplInstantiationShape0(TriangleP)
+gjkAndEPATplInstantiationShape0(Box)
+gjkAndEPATplInstantiationShape0(Sphere)
+gjkAndEPATplInstantiationShape0(Ellipsoid)
+gjkAndEPATplInstantiationShape0(Capsule)
+gjkAndEPATplInstantiationShape0(Cone)
+gjkAndEPATplInstantiationShape0(Cylinder)
+// clang-format on
+
 }  // namespace details
 
 template <typename IndexType>
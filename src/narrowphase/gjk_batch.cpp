@@ -0,0 +1,523 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of INRIA nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "coal/narrowphase/gjk_batch.h"
+#include "coal/shape/geometric_shapes.h"
+
+#include <algorithm>
+
+#include "coal/tracy.hh"
+
+namespace coal {
+
+namespace details {
+
+namespace batch {
+
+enum { Lanes = GJK_BATCH_LANES };
+
+/// @brief One rotation per lane; coefficient (i, j) is in column 3 * i + j.
+typedef Eigen::Array<SolverScalar, GJK_BATCH_LANES, 9> LaneMat3;
+
+/// @brief Support functions of the primitive shapes, lane by lane.
+/// They follow the scalar ones of support_functions.hxx, without the
+/// swept-sphere radius. The loops over the lanes have no branches, so that
+/// the compiler vectorizes them.
+template <typename Shape>
+struct LaneSupport;
+
+template <>
+struct LaneSupport<TriangleP> {
+  static SolverScalar sweptSphereRadius(const TriangleP& triangle) {
+    return SolverScalar(triangle.getSweptSphereRadius());
+  }
+
+  static void run(const TriangleP& triangle, const GJKLaneVec3& dir,
+                  GJKLaneVec3& support) {
+    const Vec3ps a(triangle.a.cast<SolverScalar>());
+    const Vec3ps b(triangle.b.cast<SolverScalar>());
+    const Vec3ps c(triangle.c.cast<SolverScalar>());
+    for (int l = 0; l < Lanes; ++l) {
+      const SolverScalar dota =
+          dir(l, 0) * a[0] + dir(l, 1) * a[1] + dir(l, 2) * a[2];
+      const SolverScalar dotb =
+          dir(l, 0) * b[0] + dir(l, 1) * b[1] + dir(l, 2) * b[2];
+      const SolverScalar dotc =
+          dir(l, 0) * c[0] + dir(l, 1) * c[1] + dir(l, 2) * c[2];
+      const bool a_over_b = dota > dotb;
+      const bool pick_c = dotc > (a_over_b ? dota : dotb);
+      support(l, 0) = pick_c ? c[0] : (a_over_b ? a[0] : b[0]);
+      support(l, 1) = pick_c ? c[1] : (a_over_b ? a[1] : b[1]);
+      support(l, 2) = pick_c ? c[2] : (a_over_b ? a[2] : b[2]);
+    }
+  }
+};
+
+template <>
+struct LaneSupport<Box> {
+  static SolverScalar sweptSphereRadius(const Box& box) {
+    return SolverScalar(box.getSweptSphereRadius());
+  }
+
+  static void run(const Box& box, const GJKLaneVec3& dir,
+                  GJKLaneVec3& support) {
+    const SolverScalar eps = Eigen::NumTraits<SolverScalar>::dummy_precision();
+    for (int i = 0; i < 3; ++i) {
+      const SolverScalar h = SolverScalar(box.halfSide[i]);
+      for (int l = 0; l < Lanes; ++l) {
+        const SolverScalar d = dir(l, i);
+        support(l, i) = (d > eps) ? h : ((d < -eps) ? -h : SolverScalar(0));
+      }
+    }
+  }
+};
+
+template <>
+struct LaneSupport<Sphere> {
+  static SolverScalar sweptSphereRadius(const Sphere& sphere) {
+    return SolverScalar(sphere.radius + sphere.getSweptSphereRadius());
+  }
+
+  static void run(const Sphere&, const GJKLaneVec3&, GJKLaneVec3& support) {
+    support.setZero();
+  }
+};
+
+template <>
+struct LaneSupport<Ellipsoid> {
+  static SolverScalar sweptSphereRadius(const Ellipsoid& ellipsoid) {
+    return SolverScalar(ellipsoid.getSweptSphereRadius());
+  }
+
+  static void run(const Ellipsoid& ellipsoid, const GJKLaneVec3& dir,
+                  GJKLaneVec3& support) {
+    const Vec3ps r2(ellipsoid.radii.cast<SolverScalar>().cwiseAbs2());
+    for (int l = 0; l < Lanes; ++l) {
+      const SolverScalar v0 = r2[0] * dir(l, 0);
+      const SolverScalar v1 = r2[1] * dir(l, 1);
+      const SolverScalar v2 = r2[2] * dir(l, 2);
+      const SolverScalar s =
+          1 / std::sqrt(v0 * dir(l, 0) + v1 * dir(l, 1) + v2 * dir(l, 2));
+      support(l, 0) = s * v0;
+      support(l, 1) = s * v1;
+      support(l, 2) = s * v2;
+    }
+  }
+};
+
+template <>
+struct LaneSupport<Capsule> {
+  static SolverScalar sweptSphereRadius(const Capsule& capsule) {
+    return SolverScalar(capsule.radius + capsule.getSweptSphereRadius());
+  }
+
+  static void run(const Capsule& capsule, const GJKLaneVec3& dir,
+                  GJKLaneVec3& support) {
+    const SolverScalar eps = Eigen::NumTraits<SolverScalar>::dummy_precision();
+    const SolverScalar h = SolverScalar(capsule.halfLength);
+    for (int l = 0; l < Lanes; ++l) {
+      const SolverScalar d = dir(l, 2);
+      support(l, 0) = 0;
+      support(l, 1) = 0;
+      support(l, 2) = (d > eps) ? h : ((d < -eps) ? -h : SolverScalar(0));
+    }
+  }
+};
+
+template <>
+struct LaneSupport<Cone> {
+  static SolverScalar sweptSphereRadius(const Cone& cone) {
+    return SolverScalar(cone.getSweptSphereRadius());
+  }
+
+  static void run(const Cone& cone, const GJKLaneVec3& dir,
+                  GJKLaneVec3& support) {
+    const SolverScalar eps = Eigen::NumTraits<SolverScalar>::dummy_precision();
+    const SolverScalar inflate = 1 + SolverScalar(1e-10);
+    const SolverScalar h = SolverScalar(cone.halfLength);
+    const SolverScalar r = SolverScalar(cone.radius);
+    const SolverScalar sin_a = r / std::sqrt(r * r + 4 * h * h);
+    for (int l = 0; l < Lanes; ++l) {
+      const SolverScalar dx = dir(l, 0), dy = dir(l, 1), dz = dir(l, 2);
+      const bool aligned = (std::abs(dx) <= eps) & (std::abs(dy) <= eps);
+      const SolverScalar zdist2 = dx * dx + dy * dy;
+      const SolverScalar len = std::sqrt(zdist2 + dz * dz);
+      // The apex, or a point of the base circle.
+      const bool apex =
+          aligned ? (dz > eps) : ((dz > 0) & (dz > len * sin_a));
+      const SolverScalar rad =
+          (aligned | apex) ? SolverScalar(0) : r / std::sqrt(zdist2);
+      support(l, 0) = rad * dx;
+      support(l, 1) = rad * dy;
+      support(l, 2) = apex ? h : (aligned ? -inflate * h : -h);
+    }
+  }
+};
+
+template <>
+struct LaneSupport<Cylinder> {
+  static SolverScalar sweptSphereRadius(const Cylinder& cylinder) {
+    return SolverScalar(cylinder.getSweptSphereRadius());
+  }
+
+  static void run(const Cylinder& cylinder, const GJKLaneVec3& dir,
+                  GJKLaneVec3& support) {
+    const SolverScalar eps = Eigen::NumTraits<SolverScalar>::dummy_precision();
+    const SolverScalar inflate = 1 + SolverScalar(1e-10);
+    const SolverScalar h = SolverScalar(cylinder.halfLength);
+    const SolverScalar r = SolverScalar(cylinder.radius);
+    for (int l = 0; l < Lanes; ++l) {
+      const SolverScalar dx = dir(l, 0), dy = dir(l, 1), dz = dir(l, 2);
+      const bool aligned = (std::abs(dx) <= eps) & (std::abs(dy) <= eps);
+      const SolverScalar half_h = aligned ? inflate * h : h;
+      const SolverScalar side =
+          (dz > eps) ? SolverScalar(1) : ((dz < -eps) ? -1 : SolverScalar(0));
+      const SolverScalar radius = (side == 0) ? inflate * r : r;
+      const SolverScalar rad =
+          aligned ? SolverScalar(0) : radius / std::sqrt(dx * dx + dy * dy);
+      support(l, 0) = rad * dx;
+      support(l, 1) = rad * dy;
+      support(l, 2) = side * half_h;
+    }
+  }
+};
+
+/// @brief Closest point to the origin of the segment [a, b]: sets its
+/// barycentric coordinates l[0], l[1].
+inline void projectSegment(const Vec3ps& a, const Vec3ps& b, SolverScalar* l) {
+  const Vec3ps ab = b - a;
+  const SolverScalar ab2 = ab.squaredNorm();
+  const SolverScalar t = (ab2 > 0) ? -a.dot(ab) / ab2 : SolverScalar(0);
+  l[1] = (std::min)((std::max)(t, SolverScalar(0)), SolverScalar(1));
+  l[0] = 1 - l[1];
+}
+
+/// @brief Closest point to the origin of the triangle (a, b, c): sets its
+/// barycentric coordinates l[0], l[1], l[2].
+/// It tests the Voronoi regions of the triangle in the order of Ericson's
+/// "Real-Time Collision Detection", section 5.1.5.
+inline void projectTriangle(const Vec3ps& a, const Vec3ps& b, const Vec3ps& c,
+                            SolverScalar* l) {
+  const Vec3ps ab = b - a;
+  const Vec3ps ac = c - a;
+  // Vertex A
+  const SolverScalar d1 = -ab.dot(a);
+  const SolverScalar d2 = -ac.dot(a);
+  if (d1 <= 0 && d2 <= 0) {
+    l[0] = 1, l[1] = 0, l[2] = 0;
+    return;
+  }
+  // Vertex B
+  const SolverScalar d3 = -ab.dot(b);
+  const SolverScalar d4 = -ac.dot(b);
+  if (d3 >= 0 && d4 <= d3) {
+    l[0] = 0, l[1] = 1, l[2] = 0;
+    return;
+  }
+  // Edge AB
+  const SolverScalar vc = d1 * d4 - d3 * d2;
+  if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+    const SolverScalar t = d1 / (d1 - d3);
+    l[0] = 1 - t, l[1] = t, l[2] = 0;
+    return;
+  }
+  // Vertex C
+  const SolverScalar d5 = -ab.dot(c);
+  const SolverScalar d6 = -ac.dot(c);
+  if (d6 >= 0 && d5 <= d6) {
+    l[0] = 0, l[1] = 0, l[2] = 1;
+    return;
+  }
+  // Edge AC
+  const SolverScalar vb = d5 * d2 - d1 * d6;
+  if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+    const SolverScalar t = d2 / (d2 - d6);
+    l[0] = 1 - t, l[1] = 0, l[2] = t;
+    return;
+  }
+  // Edge BC
+  const SolverScalar va = d3 * d6 - d5 * d4;
+  if (va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0) {
+    const SolverScalar t = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+    l[0] = 0, l[1] = 1 - t, l[2] = t;
+    return;
+  }
+  // Face
+  const SolverScalar denom = va + vb + vc;
+  l[1] = vb / denom;
+  l[2] = vc / denom;
+  l[0] = 1 - l[1] - l[2];
+}
+
+/// @brief Closest point to the origin of the tetrahedron (w[0], ..., w[3]):
+/// sets its barycentric coordinates l[0], ..., l[3]. Returns whether the
+/// origin is inside.
+/// As in Ericson's "Real-Time Collision Detection", section 5.1.6, it is the
+/// closest of the projections onto the faces the origin is outside of.
+inline bool projectTetrahedron(const Vec3ps* w, SolverScalar* l) {
+  // The faces and the vertex opposite to them.
+  static const int faces[4][4] = {
+      {0, 1, 2, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {1, 3, 2, 0}};
+
+  SolverScalar best = std::numeric_limits<SolverScalar>::infinity();
+  bool inside = true;
+  l[0] = l[1] = l[2] = l[3] = 0;
+  for (int f = 0; f < 4; ++f) {
+    const Vec3ps& a = w[faces[f][0]];
+    const Vec3ps& b = w[faces[f][1]];
+    const Vec3ps& c = w[faces[f][2]];
+    const Vec3ps& d = w[faces[f][3]];
+    const Vec3ps n = (b - a).cross(c - a);
+    if (!((-a.dot(n)) * (d - a).dot(n) < 0)) continue;
+    inside = false;
+
+    SolverScalar lf[3];
+    projectTriangle(a, b, c, lf);
+    const SolverScalar p2 = (lf[0] * a + lf[1] * b + lf[2] * c).squaredNorm();
+    if (p2 < best) {
+      best = p2;
+      l[faces[f][0]] = lf[0];
+      l[faces[f][1]] = lf[1];
+      l[faces[f][2]] = lf[2];
+      l[faces[f][3]] = 0;
+    }
+  }
+  return inside;
+}
+
+}  // namespace batch
+
+template <typename Shape0, typename Shape1>
+void BatchGJK<Shape0, Shape1>::evaluate(const Shape0& shape0,
+                                        const Shape1& shape1,
+                                        const Transform3s* oM1,
+                                        const Vec3ps* guesses, int num_lanes) {
+  COAL_TRACY_ZONE_SCOPED_N("coal::details::BatchGJK::evaluate");
+  assert(num_lanes > 0 && num_lanes <= Lanes);
+  typedef batch::LaneSupport<Shape0> Support0;
+  typedef batch::LaneSupport<Shape1> Support1;
+
+  swept_sphere_radius[0] = Support0::sweptSphereRadius(shape0);
+  swept_sphere_radius[1] = Support1::sweptSphereRadius(shape1);
+  const SolverScalar swept = swept_sphere_radius[0] + swept_sphere_radius[1];
+  const SolverScalar upper_bound = distance_upper_bound + swept;
+
+  // Relative poses, lane by lane. The lanes past num_lanes repeat the first
+  // problem and are inactive from the start.
+  batch::LaneMat3 R;
+  GJKLaneVec3 t;
+  GJKLaneScalar rl, alpha;
+  bool active[Lanes];
+  for (int l = 0; l < Lanes; ++l) {
+    const int k = (l < num_lanes) ? l : 0;
+    const Matrix3s& oR1 = oM1[k].getRotation();
+    const Vec3s& ot1 = oM1[k].getTranslation();
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) R(l, 3 * i + j) = SolverScalar(oR1(i, j));
+      t(l, i) = SolverScalar(ot1[i]);
+    }
+    Vec3ps guess = guesses[k];
+    if (guess.norm() < tolerance) guess = Vec3ps(-1, 0, 0);
+    for (int i = 0; i < 3; ++i) ray(l, i) = guess[i];
+    rl[l] = guess.norm();
+    alpha[l] = 0;
+    distance[l] = 0;
+    iterations[l] = 0;
+    rank[l] = 0;
+    active[l] = l < num_lanes;
+    status[l] = (l < num_lanes) ? GJK::NoCollision : GJK::DidNotRun;
+  }
+
+  GJKLaneVec3 dir0, dir1, s1, v, v0, v1;
+  GJKLaneScalar omega;
+  bool any_active = true;
+  for (size_t iteration = 0; any_active && iteration < max_iterations;
+       ++iteration) {
+    // Support of the Minkowski difference along -ray, for all the lanes: the
+    // support of shape0 along -ray minus the one of shape1 along ray,
+    // expressed in its frame.
+    for (int i = 0; i < 3; ++i) {
+      for (int l = 0; l < Lanes; ++l) dir0(l, i) = -ray(l, i);
+    }
+    Support0::run(shape0, dir0, v0);
+    for (int j = 0; j < 3; ++j) {
+      for (int l = 0; l < Lanes; ++l) {
+        dir1(l, j) = R(l, j) * ray(l, 0) + R(l, 3 + j) * ray(l, 1) +
+                     R(l, 6 + j) * ray(l, 2);
+      }
+    }
+    Support1::run(shape1, dir1, s1);
+    for (int i = 0; i < 3; ++i) {
+      for (int l = 0; l < Lanes; ++l) {
+        v1(l, i) = R(l, 3 * i) * s1(l, 0) + R(l, 3 * i + 1) * s1(l, 1) +
+                   R(l, 3 * i + 2) * s1(l, 2) + t(l, i);
+        v(l, i) = v0(l, i) - v1(l, i);
+      }
+    }
+    for (int l = 0; l < Lanes; ++l) {
+      omega[l] =
+          (ray(l, 0) * v(l, 0) + ray(l, 1) * v(l, 1) + ray(l, 2) * v(l, 2)) /
+          rl[l];
+    }
+
+    // Termination tests and simplex update, lane by lane.
+    any_active = false;
+    for (int l = 0; l < Lanes; ++l) {
+      if (!active[l]) continue;
+
+      // check B: early stop when the distance is above the upper bound.
+      if (omega[l] > upper_bound) {
+        distance[l] = omega[l] - swept;
+        status[l] = GJK::NoCollisionEarlyStopped;
+        active[l] = false;
+        continue;
+      }
+      // check C: convergence, see GJK::checkConvergence.
+      alpha[l] = (std::max)(alpha[l], omega[l]);
+      if (iteration > 0 &&
+          rl[l] - alpha[l] - (tolerance + tolerance * rl[l]) <= 0) {
+        distance[l] = rl[l] - swept;
+        status[l] = (distance[l] < tolerance)
+                        ? GJK::CollisionWithPenetrationInformation
+                        : GJK::NoCollision;
+        active[l] = false;
+        continue;
+      }
+
+      // Append the support point and project the origin onto the simplex.
+      const int n = rank[l];
+      w[l][n] = Vec3ps(v(l, 0), v(l, 1), v(l, 2));
+      w0[l][n] = Vec3ps(v0(l, 0), v0(l, 1), v0(l, 2));
+      w1[l][n] = Vec3ps(v1(l, 0), v1(l, 1), v1(l, 2));
+      SolverScalar weights[4] = {1, 0, 0, 0};
+      bool inside = false;
+      switch (n) {
+        case 1:
+          batch::projectSegment(w[l][0], w[l][1], weights);
+          break;
+        case 2:
+          batch::projectTriangle(w[l][0], w[l][1], w[l][2], weights);
+          break;
+        case 3:
+          inside = batch::projectTetrahedron(w[l], weights);
+          break;
+        default:
+          break;
+      }
+
+      // Keep the vertices with a positive weight, packed at the front.
+      Vec3ps r(Vec3ps::Zero());
+      int kept = 0;
+      for (int k = 0; k <= n; ++k) {
+        if (!(weights[k] > 0)) continue;
+        w[l][kept] = w[l][k];
+        w0[l][kept] = w0[l][k];
+        w1[l][kept] = w1[l][k];
+        lambda[l][kept] = weights[k];
+        r += weights[k] * w[l][k];
+        ++kept;
+      }
+      rank[l] = kept;
+      for (int i = 0; i < 3; ++i) ray(l, i) = r[i];
+      rl[l] = r.norm();
+
+      if (inside || rl[l] == 0) {
+        distance[l] = rl[l];
+        status[l] = GJK::Collision;
+        active[l] = false;
+        continue;
+      }
+      // Degenerate simplices produce non-finite weights: the scalar GJK takes
+      // over these lanes.
+      if (!(rl[l] < std::numeric_limits<SolverScalar>::infinity())) {
+        status[l] = GJK::Failed;
+        active[l] = false;
+        continue;
+      }
+      ++iterations[l];
+      // check A: the origin is near the simplex, the shapes are in collision.
+      if (rl[l] < tolerance) {
+        distance[l] = rl[l];
+        status[l] = GJK::Collision;
+        active[l] = false;
+        continue;
+      }
+      any_active = true;
+    }
+  }
+  for (int l = 0; l < Lanes; ++l) {
+    if (active[l]) status[l] = GJK::Failed;
+  }
+}
+
+template <typename Shape0, typename Shape1>
+void BatchGJK<Shape0, Shape1>::getWitnessPointsAndNormal(
+    int lane, Vec3ps& p0, Vec3ps& p1, Vec3ps& normal) const {
+  p0.setZero();
+  p1.setZero();
+  for (int k = 0; k < rank[lane]; ++k) {
+    p0 += lambda[lane][k] * w0[lane][k];
+    p1 += lambda[lane][k] * w1[lane][k];
+  }
+  if ((p1 - p0).norm() > Eigen::NumTraits<SolverScalar>::dummy_precision()) {
+    normal = (p1 - p0).normalized();
+  } else {
+    normal = -ray.row(lane).matrix().transpose().normalized();
+  }
+  if (swept_sphere_radius[0] > 0) p0 += swept_sphere_radius[0] * normal;
+  if (swept_sphere_radius[1] > 0) p1 -= swept_sphere_radius[1] * normal;
+}
+
+// clang-format off
+#define batchGJKTplInstantiationShape0(Shape0)                                 \
+  template struct BatchGJK<Shape0, TriangleP>;                                 \
+  template struct BatchGJK<Shape0, Box>;                                       \
+  template struct BatchGJK<Shape0, Sphere>;                                    \
+  template struct BatchGJK<Shape0, Ellipsoid>;                                 \
+  template struct BatchGJK<Shape0, Capsule>;                                   \
+  template struct BatchGJK<Shape0, Cone>;                                      \
+  template struct BatchGJK<Shape0, Cylinder>;
+
+batchGJKTplInstantiationShape0(TriangleP)
+batchGJKTplInstantiationShape0(Box)
+batchGJKTplInstantiationShape0(Sphere)
+batchGJKTplInstantiationShape0(Ellipsoid)
+batchGJKTplInstantiationShape0(Capsule)
+batchGJKTplInstantiationShape0(Cone)
+batchGJKTplInstantiationShape0(Cylinder)
+// clang-format on
+
+}  // namespace details
+
+}  // namespace coal
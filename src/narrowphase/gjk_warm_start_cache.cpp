@@ -0,0 +1,139 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "coal/narrowphase/gjk_warm_start_cache.h"
+
+#include <functional>
+
+namespace coal {
+
+std::size_t GJKWarmStartCache::KeyHash::operator()(const Key& key) const {
+  std::size_t h = std::hash<const void*>()(key.o1);
+  h ^= std::hash<const void*>()(key.o2) + 0x9e3779b9 + (h << 6) + (h >> 2);
+  return h;
+}
+
+bool GJKWarmStartCache::find(const Key& key, Vec3s& guess,
+                             support_func_guess_t& support_hint) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const auto it = m_index.find(key);
+  if (it == m_index.end()) {
+    ++m_statistics.num_misses;
+    return false;
+  }
+  ++m_statistics.num_hits;
+  m_entries.splice(m_entries.begin(), m_entries, it->second);
+  guess = it->second->guess;
+  support_hint = it->second->support_hint;
+  return true;
+}
+
+void GJKWarmStartCache::insert(const Key& key, const Vec3s& guess,
+                               const support_func_guess_t& support_hint,
+                               std::size_t num_gjk_iterations) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_statistics.num_gjk_iterations += num_gjk_iterations;
+  ++m_statistics.num_gjk_calls;
+  if (m_capacity == 0) return;
+
+  const auto it = m_index.find(key);
+  if (it != m_index.end()) {
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    it->second->guess = guess;
+    it->second->support_hint = support_hint;
+    return;
+  }
+
+  evict(m_capacity - 1);
+  Entry entry;
+  entry.key = key;
+  entry.guess = guess;
+  entry.support_hint = support_hint;
+  m_entries.push_front(entry);
+  m_index[key] = m_entries.begin();
+}
+
+void GJKWarmStartCache::erase(const void* obj) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (EntryList::iterator it = m_entries.begin(); it != m_entries.end();) {
+    if (it->key.o1 == obj || it->key.o2 == obj) {
+      m_index.erase(it->key);
+      it = m_entries.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void GJKWarmStartCache::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.clear();
+  m_index.clear();
+}
+
+std::size_t GJKWarmStartCache::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+std::size_t GJKWarmStartCache::capacity() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_capacity;
+}
+
+void GJKWarmStartCache::setCapacity(std::size_t capacity) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_capacity = capacity;
+  evict(m_capacity);
+}
+
+GJKWarmStartCache::Statistics GJKWarmStartCache::getStatistics() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_statistics;
+}
+
+void GJKWarmStartCache::resetStatistics() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_statistics = Statistics();
+}
+
+void GJKWarmStartCache::evict(std::size_t capacity) {
+  while (m_entries.size() > capacity) {
+    m_index.erase(m_entries.back().key);
+    m_entries.pop_back();
+    ++m_statistics.num_evictions;
+  }
+}
+
+}  // namespace coal
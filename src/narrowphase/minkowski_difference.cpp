@@ -37,42 +37,12 @@
 /** \authors Jia Pan, Florent Lamiraux, Josef Mirabel, Louis Montaut */
 
 #include "coal/narrowphase/minkowski_difference.h"
+#include "coal/narrowphase/support_functions.hxx"
 #include "coal/shape/geometric_shapes_traits.h"
 
 namespace coal {
 namespace details {
 
-// ============================================================================
-template <typename Shape0, typename Shape1, bool TransformIsIdentity,
-          int _SupportOptions>
-void getSupportTpl(const Shape0* s0, const Shape1* s1, const Matrix3s& oR1,
-                   const Vec3s& ot1, const Vec3s& dir, Vec3s& support0,
-                   Vec3s& support1, support_func_guess_t& hint,
-                   ShapeSupportData data[2]) {
-  assert(dir.norm() > Eigen::NumTraits<Scalar>::epsilon());
-  getShapeSupport<_SupportOptions>(s0, dir, support0, hint[0], data[0]);
-
-  if (TransformIsIdentity) {
-    getShapeSupport<_SupportOptions>(s1, -dir, support1, hint[1], data[1]);
-  } else {
-    getShapeSupport<_SupportOptions>(s1, -oR1.transpose() * dir, support1,
-                                     hint[1], data[1]);
-    support1 = oR1 * support1 + ot1;
-  }
-}
-
-// ============================================================================
-template <typename Shape0, typename Shape1, bool TransformIsIdentity,
-          int _SupportOptions>
-void getSupportFuncTpl(const MinkowskiDiff& md, const Vec3s& dir,
-                       Vec3s& support0, Vec3s& support1,
-                       support_func_guess_t& hint, ShapeSupportData data[2]) {
-  getSupportTpl<Shape0, Shape1, TransformIsIdentity, _SupportOptions>(
-      static_cast<const Shape0*>(md.shapes[0]),
-      static_cast<const Shape1*>(md.shapes[1]), md.oR1, md.ot1, dir, support0,
-      support1, hint, data);
-}
-
 // ============================================================================
 template <typename Shape0, int _SupportOptions>
 MinkowskiDiff::GetSupportFunction makeGetSupportFunction1(
@@ -133,8 +103,7 @@ MinkowskiDiff::GetSupportFunction makeGetSupportFunction1(
         return getSupportFuncTpl<Shape0, Cylinder, false, _SupportOptions>;
     case GEOM_CONVEX16: {
       const ConvexBase16* convex1 = static_cast<const ConvexBase16*>(s1);
-      if (static_cast<size_t>(convex1->num_points) >
-          ConvexBase16::num_vertices_large_convex_threshold) {
+      if (convex1->useLogSupport()) {
         data[1].visited.assign(convex1->num_points, false);
         data[1].last_dir.setZero();
         if (identity)
@@ -154,8 +123,7 @@ MinkowskiDiff::GetSupportFunction makeGetSupportFunction1(
     }
     case GEOM_CONVEX32: {
       const ConvexBase32* convex1 = static_cast<const ConvexBase32*>(s1);
-      if (static_cast<size_t>(convex1->num_points) >
-          ConvexBase32::num_vertices_large_convex_threshold) {
+      if (convex1->useLogSupport()) {
         data[1].visited.assign(convex1->num_points, false);
         data[1].last_dir.setZero();
         if (identity)
@@ -231,8 +199,7 @@ MinkowskiDiff::GetSupportFunction makeGetSupportFunction0(
       break;
     case GEOM_CONVEX16: {
       const ConvexBase16* convex0 = static_cast<const ConvexBase16*>(s0);
-      if (static_cast<size_t>(convex0->num_points) >
-          ConvexBase16::num_vertices_large_convex_threshold) {
+      if (convex0->useLogSupport()) {
         data[0].visited.assign(convex0->num_points, false);
         data[0].last_dir.setZero();
         return makeGetSupportFunction1<LargeConvex16, _SupportOptions>(
@@ -244,8 +211,7 @@ MinkowskiDiff::GetSupportFunction makeGetSupportFunction0(
     }
     case GEOM_CONVEX32: {
       const ConvexBase32* convex0 = static_cast<const ConvexBase32*>(s0);
-      if (static_cast<size_t>(convex0->num_points) >
-          ConvexBase32::num_vertices_large_convex_threshold) {
+      if (convex0->useLogSupport()) {
         data[0].visited.assign(convex0->num_points, false);
         data[0].last_dir.setZero();
         return makeGetSupportFunction1<LargeConvex32, _SupportOptions>(
@@ -37,8 +37,14 @@
 /** \authors Jia Pan, Florent Lamiraux, Josef Mirabel, Louis Montaut */
 
 #include "coal/narrowphase/support_functions.h"
+#include "coal/narrowphase/support_functions.hxx"
 
 #include <algorithm>
+#include <limits>
+
+#if defined(__AVX__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
 
 namespace coal {
 namespace details {
@@ -109,199 +115,14 @@ template COAL_DLLAPI Vec3s getSupport<SupportOptions::WithSweptSphere>(const Sha
       ShapeSupportData& support_data);
 
 // ============================================================================
-template <int _SupportOptions>
-void getShapeSupport(const TriangleP* triangle, const Vec3s& dir,
-                     Vec3s& support, int& /*unused*/,
-                     ShapeSupportData& /*unused*/) {
-  Scalar dota = dir.dot(triangle->a);
-  Scalar dotb = dir.dot(triangle->b);
-  Scalar dotc = dir.dot(triangle->c);
-  if (dota > dotb) {
-    if (dotc > dota) {
-      support = triangle->c;
-    } else {
-      support = triangle->a;
-    }
-  } else {
-    if (dotc > dotb) {
-      support = triangle->c;
-    } else {
-      support = triangle->b;
-    }
-  }
-
-  if (_SupportOptions == SupportOptions::WithSweptSphere) {
-    support += triangle->getSweptSphereRadius() * dir.normalized();
-  }
-}
+// The support functions of the primitive shapes are defined in
+// support_functions.hxx, so that GJK and EPA can inline them.
 getShapeSupportTplInstantiation(TriangleP);
-
-// ============================================================================
-template <int _SupportOptions>
-void getShapeSupport(const Box* box, const Vec3s& dir, Vec3s& support,
-                     int& /*unused*/, ShapeSupportData& /*unused*/) {
-  // The inflate value is simply to make the specialized functions with box
-  // have a preferred side for edge cases.
-  static const Scalar inflate =
-      (dir.array() == 0).any() ? 1 + Scalar(1e-10) : 1;
-  static const Scalar dummy_precision =
-      Eigen::NumTraits<Scalar>::dummy_precision();
-  Vec3s support1 = (dir.array() > dummy_precision).select(box->halfSide, 0);
-  Vec3s support2 =
-      (dir.array() < -dummy_precision).select(-inflate * box->halfSide, 0);
-  support.noalias() = support1 + support2;
-
-  if (_SupportOptions == SupportOptions::WithSweptSphere) {
-    support += box->getSweptSphereRadius() * dir.normalized();
-  }
-}
 getShapeSupportTplInstantiation(Box);
-
-// ============================================================================
-template <int _SupportOptions>
-void getShapeSupport(const Sphere* sphere, const Vec3s& dir, Vec3s& support,
-                     int& /*unused*/, ShapeSupportData& /*unused*/) {
-  if (_SupportOptions == SupportOptions::WithSweptSphere) {
-    support.noalias() =
-        (sphere->radius + sphere->getSweptSphereRadius()) * dir.normalized();
-  } else {
-    support.setZero();
-  }
-
-  COAL_UNUSED_VARIABLE(sphere);
-  COAL_UNUSED_VARIABLE(dir);
-}
 getShapeSupportTplInstantiation(Sphere);
-
-// ============================================================================
-template <int _SupportOptions>
-void getShapeSupport(const Ellipsoid* ellipsoid, const Vec3s& dir,
-                     Vec3s& support, int& /*unused*/,
-                     ShapeSupportData& /*unused*/) {
-  Scalar a2 = ellipsoid->radii[0] * ellipsoid->radii[0];
-  Scalar b2 = ellipsoid->radii[1] * ellipsoid->radii[1];
-  Scalar c2 = ellipsoid->radii[2] * ellipsoid->radii[2];
-
-  Vec3s v(a2 * dir[0], b2 * dir[1], c2 * dir[2]);
-
-  Scalar d = std::sqrt(v.dot(dir));
-
-  support = v / d;
-
-  if (_SupportOptions == SupportOptions::WithSweptSphere) {
-    support += ellipsoid->getSweptSphereRadius() * dir.normalized();
-  }
-}
 getShapeSupportTplInstantiation(Ellipsoid);
-
-// ============================================================================
-template <int _SupportOptions>
-void getShapeSupport(const Capsule* capsule, const Vec3s& dir, Vec3s& support,
-                     int& /*unused*/, ShapeSupportData& /*unused*/) {
-  static const Scalar dummy_precision =
-      Eigen::NumTraits<Scalar>::dummy_precision();
-  support.setZero();
-  if (dir[2] > dummy_precision) {
-    support[2] = capsule->halfLength;
-  } else if (dir[2] < -dummy_precision) {
-    support[2] = -capsule->halfLength;
-  }
-
-  if (_SupportOptions == SupportOptions::WithSweptSphere) {
-    support +=
-        (capsule->radius + capsule->getSweptSphereRadius()) * dir.normalized();
-  }
-}
 getShapeSupportTplInstantiation(Capsule);
-
-// ============================================================================
-template <int _SupportOptions>
-void getShapeSupport(const Cone* cone, const Vec3s& dir, Vec3s& support,
-                     int& /*unused*/, ShapeSupportData& /*unused*/) {
-  static const Scalar dummy_precision =
-      Eigen::NumTraits<Scalar>::dummy_precision();
-
-  // The cone radius is, for -h < z < h, (h - z) * r / (2*h)
-  // The inflate value is simply to make the specialized functions with cone
-  // have a preferred side for edge cases.
-  static const Scalar inflate = 1 + Scalar(1e-10);
-  Scalar h = cone->halfLength;
-  Scalar r = cone->radius;
-
-  if (dir.head<2>().isZero(dummy_precision)) {
-    support.head<2>().setZero();
-    if (dir[2] > dummy_precision) {
-      support[2] = h;
-    } else {
-      support[2] = -inflate * h;
-    }
-  } else {
-    Scalar zdist = dir[0] * dir[0] + dir[1] * dir[1];
-    Scalar len = zdist + dir[2] * dir[2];
-    zdist = std::sqrt(zdist);
-
-    if (dir[2] <= 0) {
-      Scalar rad = r / zdist;
-      support.head<2>() = rad * dir.head<2>();
-      support[2] = -h;
-    } else {
-      len = std::sqrt(len);
-      Scalar sin_a = r / std::sqrt(r * r + 4 * h * h);
-
-      if (dir[2] > len * sin_a)
-        support << 0, 0, h;
-      else {
-        Scalar rad = r / zdist;
-        support.head<2>() = rad * dir.head<2>();
-        support[2] = -h;
-      }
-    }
-  }
-
-  if (_SupportOptions == SupportOptions::WithSweptSphere) {
-    support += cone->getSweptSphereRadius() * dir.normalized();
-  }
-}
 getShapeSupportTplInstantiation(Cone);
-
-// ============================================================================
-template <int _SupportOptions>
-void getShapeSupport(const Cylinder* cylinder, const Vec3s& dir, Vec3s& support,
-                     int& /*unused*/, ShapeSupportData& /*unused*/) {
-  static const Scalar dummy_precision =
-      Eigen::NumTraits<Scalar>::dummy_precision();
-
-  // The inflate value is simply to make the specialized functions with cylinder
-  // have a preferred side for edge cases.
-  static const Scalar inflate = 1 + Scalar(1e-10);
-  Scalar half_h = cylinder->halfLength;
-  Scalar r = cylinder->radius;
-
-  const bool dir_is_aligned_with_z = dir.head<2>().isZero(dummy_precision);
-  if (dir_is_aligned_with_z) half_h *= inflate;
-
-  if (dir[2] > dummy_precision) {
-    support[2] = half_h;
-  } else if (dir[2] < -dummy_precision) {
-    support[2] = -half_h;
-  } else {
-    support[2] = 0;
-    r *= inflate;
-  }
-
-  if (dir_is_aligned_with_z) {
-    support.head<2>().setZero();
-  } else {
-    support.head<2>() = dir.head<2>().normalized() * r;
-  }
-
-  assert(fabs(support[0] * dir[1] - support[1] * dir[0]) <
-         sqrt(std::numeric_limits<Scalar>::epsilon()));
-
-  if (_SupportOptions == SupportOptions::WithSweptSphere) {
-    support += cylinder->getSweptSphereRadius() * dir.normalized();
-  }
-}
 getShapeSupportTplInstantiation(Cylinder);
 
 // ============================================================================
@@ -383,11 +204,142 @@ void getShapeSupportLog(const ConvexBaseTpl<IndexType>* convex,
   }
 }
 
+// ============================================================================
+#if defined(__AVX512F__) && !defined(COAL_USE_FLOAT_PRECISION)
+#define COAL_SUPPORT_SOA_AVX512
+#elif defined(__AVX__) && !defined(COAL_USE_FLOAT_PRECISION)
+#define COAL_SUPPORT_SOA_AVX
+#endif
+
+namespace {
+#if defined(COAL_SUPPORT_SOA_AVX512) || defined(COAL_SUPPORT_SOA_AVX)
+/// @brief Index of the first point maximizing the dot product with dir,
+/// among the points stored as a structure of arrays (see
+/// ConvexBaseTpl::points_soa). The number of points, stride, is a multiple of
+/// ConvexBaseTpl::points_soa_block_size.
+/// Each lane keeps its own maximum, the lanes are reduced at the end. Two
+/// independent sets of lanes are used to hide the latency of the comparisons.
+int getSupportIndexSoA(const Scalar* xs, const Scalar* ys, const Scalar* zs,
+                       std::size_t stride, const Vec3s& dir) {
+#if defined(COAL_SUPPORT_SOA_AVX512)
+  static const int width = 8;
+  const __m512d dx = _mm512_set1_pd(dir[0]);
+  const __m512d dy = _mm512_set1_pd(dir[1]);
+  const __m512d dz = _mm512_set1_pd(dir[2]);
+  const __m512d step = _mm512_set1_pd(double(2 * width));
+  __m512d ids[2] = {_mm512_set_pd(7, 6, 5, 4, 3, 2, 1, 0),
+                    _mm512_set_pd(15, 14, 13, 12, 11, 10, 9, 8)};
+  __m512d best[2], best_ids[2];
+  for (int k = 0; k < 2; ++k) {
+    best[k] = _mm512_set1_pd(-std::numeric_limits<double>::infinity());
+    best_ids[k] = _mm512_setzero_pd();
+  }
+  for (std::size_t i = 0; i < stride; i += 2 * width) {
+    for (int k = 0; k < 2; ++k) {
+      const std::size_t j = i + std::size_t(k * width);
+      const __m512d dot = _mm512_add_pd(
+          _mm512_add_pd(_mm512_mul_pd(_mm512_loadu_pd(xs + j), dx),
+                        _mm512_mul_pd(_mm512_loadu_pd(ys + j), dy)),
+          _mm512_mul_pd(_mm512_loadu_pd(zs + j), dz));
+      const __mmask8 better = _mm512_cmp_pd_mask(dot, best[k], _CMP_GT_OQ);
+      best[k] = _mm512_mask_blend_pd(better, best[k], dot);
+      best_ids[k] = _mm512_mask_blend_pd(better, best_ids[k], ids[k]);
+      ids[k] = _mm512_add_pd(ids[k], step);
+    }
+  }
+  Scalar lane_best[2 * width], lane_ids[2 * width];
+  for (int k = 0; k < 2; ++k) {
+    _mm512_storeu_pd(lane_best + k * width, best[k]);
+    _mm512_storeu_pd(lane_ids + k * width, best_ids[k]);
+  }
+#else
+  static const int width = 4;
+  const __m256d dx = _mm256_set1_pd(dir[0]);
+  const __m256d dy = _mm256_set1_pd(dir[1]);
+  const __m256d dz = _mm256_set1_pd(dir[2]);
+  const __m256d step = _mm256_set1_pd(double(2 * width));
+  __m256d ids[2] = {_mm256_set_pd(3, 2, 1, 0), _mm256_set_pd(7, 6, 5, 4)};
+  __m256d best[2], best_ids[2];
+  for (int k = 0; k < 2; ++k) {
+    best[k] = _mm256_set1_pd(-std::numeric_limits<double>::infinity());
+    best_ids[k] = _mm256_setzero_pd();
+  }
+  for (std::size_t i = 0; i < stride; i += 2 * width) {
+    for (int k = 0; k < 2; ++k) {
+      const std::size_t j = i + std::size_t(k * width);
+      const __m256d dot = _mm256_add_pd(
+          _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(xs + j), dx),
+                        _mm256_mul_pd(_mm256_loadu_pd(ys + j), dy)),
+          _mm256_mul_pd(_mm256_loadu_pd(zs + j), dz));
+      const __m256d better = _mm256_cmp_pd(dot, best[k], _CMP_GT_OQ);
+      best[k] = _mm256_blendv_pd(best[k], dot, better);
+      best_ids[k] = _mm256_blendv_pd(best_ids[k], ids[k], better);
+      ids[k] = _mm256_add_pd(ids[k], step);
+    }
+  }
+  Scalar lane_best[2 * width], lane_ids[2 * width];
+  for (int k = 0; k < 2; ++k) {
+    _mm256_storeu_pd(lane_best + k * width, best[k]);
+    _mm256_storeu_pd(lane_ids + k * width, best_ids[k]);
+  }
+#endif
+  Scalar maxdot = lane_best[0];
+  Scalar id = lane_ids[0];
+  for (int l = 1; l < 2 * width; ++l) {
+    if (lane_best[l] > maxdot || (lane_best[l] == maxdot && lane_ids[l] < id)) {
+      maxdot = lane_best[l];
+      id = lane_ids[l];
+    }
+  }
+  return static_cast<int>(id);
+}
+#else
+/// @brief Scalar version of the SoA support, used when the library is not
+/// compiled with AVX instructions.
+int getSupportIndexSoA(const Scalar* xs, const Scalar* ys, const Scalar* zs,
+                       std::size_t stride, const Vec3s& dir) {
+  int id = 0;
+  Scalar maxdot = xs[0] * dir[0] + ys[0] * dir[1] + zs[0] * dir[2];
+  for (std::size_t i = 1; i < stride; ++i) {
+    const Scalar dot = xs[i] * dir[0] + ys[i] * dir[1] + zs[i] * dir[2];
+    if (dot > maxdot) {
+      maxdot = dot;
+      id = static_cast<int>(i);
+    }
+  }
+  return id;
+}
+#endif
+}  // namespace
+
+// ============================================================================
+template <int _SupportOptions, typename IndexType>
+void getShapeSupportSoA(const ConvexBaseTpl<IndexType>* convex,
+                        const Vec3s& dir, Vec3s& support, int& hint,
+                        ShapeSupportData& /*unused*/) {
+  assert(convex->points_soa != nullptr && "Convex has no SoA points.");
+  const std::vector<Scalar>& soa = *(convex->points_soa);
+  const std::size_t stride = soa.size() / 3;
+  hint = getSupportIndexSoA(soa.data(), soa.data() + stride,
+                            soa.data() + 2 * stride, stride, dir);
+
+  support = (*(convex->points))[static_cast<size_t>(hint)];
+
+  if (_SupportOptions == SupportOptions::WithSweptSphere) {
+    support += convex->getSweptSphereRadius() * dir.normalized();
+  }
+}
+
 // ============================================================================
 template <int _SupportOptions, typename IndexType>
 void getShapeSupportLinear(const ConvexBaseTpl<IndexType>* convex,
                            const Vec3s& dir, Vec3s& support, int& hint,
-                           ShapeSupportData& /*unused*/) {
+                           ShapeSupportData& support_data) {
+  if (convex->points_soa != nullptr) {
+    getShapeSupportSoA<_SupportOptions>(convex, dir, support, hint,
+                                        support_data);
+    return;
+  }
   const std::vector<Vec3s>& pts = *(convex->points);
 
   hint = 0;
@@ -412,11 +364,7 @@ template <int _SupportOptions, typename IndexType>
 void getShapeSupport(const ConvexBaseTpl<IndexType>* convex, const Vec3s& dir,
                      Vec3s& support, int& hint,
                      ShapeSupportData& support_data) {
-  // TODO add benchmark to set a proper value for switching between linear and
-  // logarithmic.
-  if (convex->num_points >
-          ConvexBaseTpl<IndexType>::num_vertices_large_convex_threshold &&
-      convex->neighbors != nullptr) {
+  if (convex->useLogSupport() && convex->neighbors != nullptr) {
     getShapeSupportLog<_SupportOptions>(convex, dir, support, hint,
                                         support_data);
   } else {
@@ -1024,20 +972,29 @@ COAL_DLLAPI void computeSupportSetConvexHull(SupportSet::Polygon& cloud,
   const Vec2s& v = cvx_hull[0];
 
   // Step 2 - Sort the rest of the point cloud according to the angle made with
-  // v. Note: we use stable_sort instead of sort because sort can fail if two
-  // values are identical.
-  std::stable_sort(
-      cloud.begin() + 1, cloud.end(), [&v](const Vec2s& p1, const Vec2s& p2) {
-        // p1 is "smaller" than p2 if det(p1 - v, p2 - v) >= 0
-        const Scalar det =
-            (p1(0) - v(0)) * (p2(1) - v(1)) - (p1(1) - v(1)) * (p2(0) - v(0));
-        if (std::abs(det) <= Eigen::NumTraits<Scalar>::dummy_precision()) {
-          // If two points are identical or (v, p1, p2) are colinear, p1 is
-          // "smaller" if it is closer to v.
-          return ((p1 - v).squaredNorm() <= (p2 - v).squaredNorm());
-        }
-        return det > 0;
-      });
+  // v. Note: we use a stable sort because sort can fail if two values are
+  // identical. The support sets are small, so an insertion sort is used: as
+  // opposed to std::stable_sort, it does not allocate a temporary buffer.
+  const auto smaller = [&v](const Vec2s& p1, const Vec2s& p2) {
+    // p1 is "smaller" than p2 if det(p1 - v, p2 - v) >= 0
+    const Scalar det =
+        (p1(0) - v(0)) * (p2(1) - v(1)) - (p1(1) - v(1)) * (p2(0) - v(0));
+    if (std::abs(det) <= Eigen::NumTraits<Scalar>::dummy_precision()) {
+      // If two points are identical or (v, p1, p2) are colinear, p1 is
+      // "smaller" if it is closer to v.
+      return ((p1 - v).squaredNorm() <= (p2 - v).squaredNorm());
+    }
+    return det > 0;
+  };
+  for (size_t i = 2; i < cloud.size(); ++i) {
+    const Vec2s p = cloud[i];
+    size_t j = i;
+    while (j > 1 && !smaller(cloud[j - 1], p)) {
+      cloud[j] = cloud[j - 1];
+      --j;
+    }
+    cloud[j] = p;
+  }
 
   // Step 3 - We iterate over the now ordered point of cloud and add the points
   // to the cvx-hull if they successively form "left turns" only. A left turn
@@ -1083,4 +1040,19 @@ COAL_DLLAPI void computeSupportSetConvexHull(SupportSet::Polygon& cloud,
 }
 
 }  // namespace details
+
+// ============================================================================
+template <typename IndexType>
+bool ConvexBaseTpl<IndexType>::useLogSupport() const {
+#if defined(COAL_SUPPORT_SOA_AVX512) || defined(COAL_SUPPORT_SOA_AVX)
+  if (points_soa != nullptr)
+    return num_points > num_vertices_soa_support_threshold;
+#endif
+  return num_points > num_vertices_large_convex_threshold;
+}
+template bool COAL_DLLAPI
+ConvexBaseTpl<Triangle16::IndexType>::useLogSupport() const;
+template bool COAL_DLLAPI
+ConvexBaseTpl<Triangle32::IndexType>::useLogSupport() const;
+
 }  // namespace coal
@@ -194,6 +194,54 @@ void OcTree::exportAsObjFile(const std::string& filename) const {
   }
 }
 
+void OcTree::buildFlatTree() {
+  shared_ptr<std::vector<FlatNode> > nodes(new std::vector<FlatNode>());
+  const OcTreeNode* root = tree->getRoot();
+  if (root) {
+    // Breadth-first copy: sources[k] is the octomap node of (*nodes)[k].
+    std::vector<const OcTreeNode*> sources;
+    nodes->reserve(tree->size());
+    sources.reserve(tree->size());
+
+    FlatNode flat_root;
+    flat_root.bv = getRootBV();
+    nodes->push_back(flat_root);
+    sources.push_back(root);
+
+    for (std::size_t k = 0; k < nodes->size(); ++k) {
+      const OcTreeNode* node = sources[k];
+      unsigned char state = 0;
+      if (isNodeOccupied(node)) state |= FlatNode::OCCUPIED;
+      if (isNodeFree(node)) state |= FlatNode::FREE;
+
+      unsigned char child_mask = 0, occupied_child_mask = 0;
+      const unsigned int first_child = static_cast<unsigned int>(nodes->size());
+      if (nodeHasChildren(node)) {
+        for (unsigned int i = 0; i < 8; ++i) {
+          if (!nodeChildExists(node, i)) continue;
+          const OcTreeNode* child = getNodeChild(node, i);
+          child_mask = static_cast<unsigned char>(child_mask | (1u << i));
+          if (isNodeOccupied(child))
+            occupied_child_mask =
+                static_cast<unsigned char>(occupied_child_mask | (1u << i));
+
+          FlatNode flat_child;
+          computeChildBV((*nodes)[k].bv, i, flat_child.bv);
+          nodes->push_back(flat_child);
+          sources.push_back(child);
+        }
+      }
+
+      FlatNode& flat_node = (*nodes)[k];
+      flat_node.first_child = first_child;
+      flat_node.child_mask = child_mask;
+      flat_node.occupied_child_mask = occupied_child_mask;
+      flat_node.state = state;
+    }
+  }
+  flat_tree = nodes;
+}
+
 OcTreePtr_t makeOctree(
     const Eigen::Matrix<Scalar, Eigen::Dynamic, 3>& point_cloud,
     const Scalar resolution) {
@@ -0,0 +1,179 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "coal/internal/parallel.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace coal {
+namespace internal {
+
+namespace {
+
+/// @brief State of one call to runParallelFor, shared by the threads
+/// running its tasks.
+struct ParallelJob {
+  ParallelJob(std::size_t num_tasks, const ParallelTaskFunction& f)
+      : f(f), num_tasks(num_tasks), next_task(0), num_done(0),
+        cancelled(false) {}
+
+  const ParallelTaskFunction& f;
+  const std::size_t num_tasks;
+  std::atomic<std::size_t> next_task;
+  std::atomic<std::size_t> num_done;
+  std::atomic<bool> cancelled;
+
+  std::mutex mutex;
+  std::condition_variable all_done;
+  std::exception_ptr exception;
+
+  /// @brief Runs the pending tasks as thread thread_id.
+  /// Once all the tasks are claimed, the job may be finished and f destroyed:
+  /// a thread which claims no task must not touch f.
+  void run(std::size_t thread_id) {
+    std::size_t task_id;
+    while ((task_id = next_task.fetch_add(1)) < num_tasks) {
+      // After an exception, the remaining tasks are only counted as done.
+      if (!cancelled.load(std::memory_order_relaxed)) {
+        try {
+          f(task_id, thread_id);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(mutex);
+          if (!exception) exception = std::current_exception();
+          cancelled.store(true);
+        }
+      }
+      if (num_done.fetch_add(1) + 1 == num_tasks) {
+        std::lock_guard<std::mutex> lock(mutex);
+        all_done.notify_all();
+      }
+    }
+  }
+
+  void wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    all_done.wait(lock, [this] { return num_done.load() == num_tasks; });
+  }
+};
+
+/// @brief Pool of threads running the tasks of runParallelFor.
+///
+/// A call with n threads pushes n - 1 entries, one per thread id, to the
+/// queue of the pool. An entry popped once all the tasks of its job are
+/// claimed returns immediately.
+class ThreadPool {
+ public:
+  static ThreadPool& instance() {
+    static ThreadPool pool;
+    return pool;
+  }
+
+  void submit(const std::shared_ptr<ParallelJob>& job,
+              std::size_t num_threads) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      while (workers.size() + 1 < num_threads)
+        workers.push_back(std::thread(&ThreadPool::work, this));
+      for (std::size_t thread_id = 1; thread_id < num_threads; ++thread_id)
+        queue.push_back(Entry(job, thread_id));
+    }
+    if (num_threads == 2)
+      has_entries.notify_one();
+    else
+      has_entries.notify_all();
+  }
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    has_entries.notify_all();
+    for (std::size_t i = 0; i < workers.size(); ++i) workers[i].join();
+  }
+
+ private:
+  typedef std::pair<std::shared_ptr<ParallelJob>, std::size_t> Entry;
+
+  ThreadPool() : stopping(false) {}
+
+  void work() {
+    while (true) {
+      Entry entry;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        has_entries.wait(lock, [this] { return stopping || !queue.empty(); });
+        if (stopping) return;
+        entry = queue.front();
+        queue.pop_front();
+      }
+      entry.first->run(entry.second);
+    }
+  }
+
+  std::mutex mutex;
+  std::condition_variable has_entries;
+  std::deque<Entry> queue;
+  std::vector<std::thread> workers;
+  bool stopping;
+};
+
+}  // namespace
+
+void runParallelFor(std::size_t num_tasks, std::size_t num_threads,
+                    const ParallelTaskFunction& f) {
+  num_threads = getNumThreads(num_threads);
+  if (num_threads > num_tasks) num_threads = num_tasks;
+  if (num_threads <= 1) {
+    for (std::size_t task_id = 0; task_id < num_tasks; ++task_id)
+      f(task_id, std::size_t(0));
+    return;
+  }
+
+  std::shared_ptr<ParallelJob> job(new ParallelJob(num_tasks, f));
+  ThreadPool::instance().submit(job, num_threads);
+  job->run(0);
+  job->wait();
+
+  if (job->exception) std::rethrow_exception(job->exception);
+}
+
+}  // namespace internal
+}  // namespace coal
@@ -0,0 +1,611 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "coal/serialization/flat_binary.h"
+
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#ifdef _WIN32
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace coal {
+namespace serialization {
+
+const std::uint32_t FlatBinaryHeader::current_version;
+const std::uint64_t FlatBinaryHeader::alignment;
+
+namespace {
+
+const char flat_binary_magic[8] = {'C', 'O', 'A', 'L', 'F', 'L', 'A', 'T'};
+const std::uint32_t flat_binary_byte_order_mark = 0x01020304;
+
+/// @brief Fields of CollisionGeometry stored in the metadata section.
+struct GeometryMetadata {
+  Scalar aabb_center[3];
+  Scalar aabb_radius;
+  Scalar aabb_min[3];
+  Scalar aabb_max[3];
+  Scalar cost_density;
+  Scalar threshold_occupied;
+  Scalar threshold_free;
+};
+
+struct BVHModelMetadata {
+  GeometryMetadata geometry;
+  std::uint64_t num_vertices;
+  std::uint64_t num_tris;
+  std::uint64_t num_bvs;
+  std::uint64_t num_primitives;
+  std::int32_t build_state;
+  std::uint32_t reserved;
+};
+
+struct HeightFieldMetadata {
+  GeometryMetadata geometry;
+  Scalar x_dim;
+  Scalar y_dim;
+  Scalar min_height;
+  Scalar max_height;
+  std::uint64_t rows;
+  std::uint64_t cols;
+  std::uint64_t num_nodes;
+  std::uint64_t num_bvs;
+};
+
+template <typename BV>
+struct BVHModelAccessor : BVHModel<BV> {
+  typedef BVHModel<BV> Base;
+  using Base::bvs;
+  using Base::last_updated_vertices;
+  using Base::num_bvs;
+  using Base::num_bvs_allocated;
+  using Base::num_tris_allocated;
+  using Base::num_vertices_allocated;
+  using Base::primitive_indices;
+  using Base::refit_topology;
+};
+
+template <typename BV>
+struct HeightFieldAccessor : HeightField<BV> {
+  typedef HeightField<BV> Base;
+  using Base::bvs;
+  using Base::heights;
+  using Base::max_height;
+  using Base::min_height;
+  using Base::num_bvs;
+  using Base::x_dim;
+  using Base::x_grid;
+  using Base::y_dim;
+  using Base::y_grid;
+};
+
+void saveGeometry(const CollisionGeometry& geom, GeometryMetadata& meta) {
+  for (int i = 0; i < 3; ++i) {
+    meta.aabb_center[i] = geom.aabb_center[i];
+    meta.aabb_min[i] = geom.aabb_local.min_[i];
+    meta.aabb_max[i] = geom.aabb_local.max_[i];
+  }
+  meta.aabb_radius = geom.aabb_radius;
+  meta.cost_density = geom.cost_density;
+  meta.threshold_occupied = geom.threshold_occupied;
+  meta.threshold_free = geom.threshold_free;
+}
+
+void loadGeometry(const GeometryMetadata& meta, CollisionGeometry& geom) {
+  for (int i = 0; i < 3; ++i) {
+    geom.aabb_center[i] = meta.aabb_center[i];
+    geom.aabb_local.min_[i] = meta.aabb_min[i];
+    geom.aabb_local.max_[i] = meta.aabb_max[i];
+  }
+  geom.aabb_radius = meta.aabb_radius;
+  geom.cost_density = meta.cost_density;
+  geom.threshold_occupied = meta.threshold_occupied;
+  geom.threshold_free = meta.threshold_free;
+}
+
+/// @brief Writes a header followed by the given sections, each of them being
+/// aligned on FlatBinaryHeader::alignment bytes.
+void writeFlatBinary(const std::string& filename,
+                     FlatBinaryObjectType object_type, NODE_TYPE node_type,
+                     std::size_t node_size,
+                     const std::vector<const void*>& data,
+                     const std::vector<std::uint64_t>& sizes) {
+  const std::uint64_t alignment = FlatBinaryHeader::alignment;
+  const std::size_t num_sections = data.size();
+
+  std::vector<FlatBinarySection> sections(num_sections);
+  std::uint64_t offset = sizeof(FlatBinaryHeader) +
+                         num_sections * sizeof(FlatBinarySection);
+  for (std::size_t i = 0; i < num_sections; ++i) {
+    offset = (offset + alignment - 1) / alignment * alignment;
+    sections[i].offset = offset;
+    sections[i].size = sizes[i];
+    offset += sizes[i];
+  }
+
+  FlatBinaryHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, flat_binary_magic, sizeof(header.magic));
+  header.version = FlatBinaryHeader::current_version;
+  header.byte_order_mark = flat_binary_byte_order_mark;
+  header.object_type = static_cast<std::uint32_t>(object_type);
+  header.node_type = static_cast<std::int32_t>(node_type);
+  header.scalar_size = static_cast<std::uint32_t>(sizeof(Scalar));
+  header.node_size = static_cast<std::uint32_t>(node_size);
+  header.num_sections = static_cast<std::uint32_t>(num_sections);
+  header.file_size = offset;
+
+  std::ofstream ofs(filename.c_str(), std::ios::binary | std::ios::trunc);
+  if (!ofs) {
+    COAL_THROW_PRETTY(filename + " cannot be opened for writing.",
+                      std::invalid_argument);
+  }
+  ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  ofs.write(reinterpret_cast<const char*>(sections.data()),
+            static_cast<std::streamsize>(num_sections *
+                                         sizeof(FlatBinarySection)));
+  std::uint64_t position =
+      sizeof(FlatBinaryHeader) + num_sections * sizeof(FlatBinarySection);
+  const char padding[FlatBinaryHeader::alignment] = {0};
+  for (std::size_t i = 0; i < num_sections; ++i) {
+    ofs.write(padding,
+              static_cast<std::streamsize>(sections[i].offset - position));
+    if (sizes[i] > 0)
+      ofs.write(reinterpret_cast<const char*>(data[i]),
+                static_cast<std::streamsize>(sizes[i]));
+    position = sections[i].offset + sizes[i];
+  }
+  if (!ofs) {
+    COAL_THROW_PRETTY("Failed to write " + filename + ".",
+                      std::invalid_argument);
+  }
+}
+
+/// @brief Checks the header of file against the expected object and returns
+/// the metadata section.
+template <typename Metadata>
+const Metadata& checkFlatBinary(const FlatBinaryFile& file,
+                                const std::string& filename,
+                                FlatBinaryObjectType object_type,
+                                NODE_TYPE node_type, std::size_t node_size,
+                                std::size_t num_sections) {
+  const FlatBinaryHeader& header = file.header();
+  if (header.object_type != static_cast<std::uint32_t>(object_type) ||
+      header.node_type != static_cast<std::int32_t>(node_type) ||
+      header.num_sections != num_sections) {
+    COAL_THROW_PRETTY(filename + " does not contain an object of this type.",
+                      std::invalid_argument);
+  }
+  if (header.node_size != node_size ||
+      file.section(0).size != sizeof(Metadata)) {
+    COAL_THROW_PRETTY(filename +
+                          " was written with a different memory layout.",
+                      std::invalid_argument);
+  }
+  return *static_cast<const Metadata*>(file.sectionData(0));
+}
+
+/// @brief Checks that the i-th section holds count elements of type T.
+template <typename T>
+void checkSectionSize(const FlatBinaryFile& file, const std::string& filename,
+                      std::size_t i, std::uint64_t count) {
+  if (count > file.section(i).size / sizeof(T) ||
+      file.section(i).size != count * sizeof(T)) {
+    std::ostringstream oss;
+    oss << filename << ": the size of section " << i
+        << " does not match the metadata.";
+    COAL_THROW_PRETTY(oss.str(), std::invalid_argument);
+  }
+}
+
+/// @brief Returns the i-th section as an array of T, which lies in place in
+/// the file.
+template <typename T>
+const T* sectionBegin(const FlatBinaryFile& file, std::size_t i) {
+  return static_cast<const T*>(file.sectionData(i));
+}
+
+template <typename T>
+const T* sectionEnd(const FlatBinaryFile& file, std::size_t i) {
+  return sectionBegin<T>(file, i) +
+         static_cast<std::size_t>(file.section(i).size / sizeof(T));
+}
+
+void throwCorrupted(const std::string& filename, const std::string& what) {
+  COAL_THROW_PRETTY(filename + " is corrupted: " + what + ".",
+                    std::invalid_argument);
+}
+
+/// @brief Checks that the triangles, the nodes and the primitive indices of
+/// a BVHModel only refer to existing vertices, nodes and primitives, so that
+/// a corrupted file cannot make the queries read out of bounds.
+template <typename BV>
+void checkBVHModelIndices(const FlatBinaryFile& file,
+                          const std::string& filename,
+                          const BVHModelMetadata& meta) {
+  if (meta.num_vertices > INT_MAX || meta.num_tris > INT_MAX ||
+      meta.num_bvs > INT_MAX)
+    throwCorrupted(filename, "too many elements");
+  if (!(meta.build_state == BVH_BUILD_STATE_PROCESSED ||
+        meta.build_state == BVH_BUILD_STATE_UPDATED))
+    throwCorrupted(filename, "invalid build state");
+  if (meta.num_primitives !=
+      (meta.num_tris > 0 ? meta.num_tris : meta.num_vertices))
+    throwCorrupted(filename, "invalid number of primitives");
+  // There is one primitive index per node, and as many nodes as primitives
+  // in the last level of the hierarchy.
+  if (meta.num_primitives > meta.num_bvs ||
+      (meta.num_bvs > 0 && meta.num_primitives == 0))
+    throwCorrupted(filename, "invalid number of nodes");
+
+  for (const Triangle32* tri = sectionBegin<Triangle32>(file, 2);
+       tri != sectionEnd<Triangle32>(file, 2); ++tri) {
+    if ((*tri)[0] >= meta.num_vertices || (*tri)[1] >= meta.num_vertices ||
+        (*tri)[2] >= meta.num_vertices)
+      throwCorrupted(filename, "vertex index out of range");
+  }
+
+  const BVNode<BV>* nodes = sectionBegin<BVNode<BV> >(file, 3);
+  const std::int64_t num_bvs = static_cast<std::int64_t>(meta.num_bvs);
+  for (std::int64_t i = 0; i < num_bvs; ++i) {
+    const BVNode<BV>& node = nodes[i];
+    if (std::uint64_t(node.first_primitive) + node.num_primitives >
+        meta.num_primitives)
+      throwCorrupted(filename, "primitive range out of range");
+    if (node.isLeaf()) {
+      if (std::uint64_t(node.primitiveId()) >= meta.num_primitives)
+        throwCorrupted(filename, "primitive index out of range");
+    } else if (node.first_child <= i || node.first_child >= num_bvs - 1) {
+      // Children are stored after their parent, which also rules out cycles.
+      throwCorrupted(filename, "child index out of range");
+    }
+  }
+
+  for (const unsigned int* id = sectionBegin<unsigned int>(file, 4);
+       id != sectionEnd<unsigned int>(file, 4); ++id) {
+    if (*id >= meta.num_primitives)
+      throwCorrupted(filename, "primitive index out of range");
+  }
+}
+
+/// @brief Checks that the nodes of a HeightField cover cells of the grid and
+/// only refer to existing nodes.
+template <typename BV>
+void checkHeightFieldIndices(const FlatBinaryFile& file,
+                             const std::string& filename,
+                             const HeightFieldMetadata& meta) {
+  typedef typename HeightField<BV>::Node Node;
+  // HeightField::buildTree splits the grid down to single cells, which
+  // gives a full binary tree with one leaf per cell.
+  const std::uint64_t num_cells = (meta.rows - 1) * (meta.cols - 1);
+  if (meta.num_bvs != 2 * num_cells - 1 || meta.num_nodes < meta.num_bvs)
+    throwCorrupted(filename, "invalid number of nodes");
+
+  const Node* nodes = sectionBegin<Node>(file, 4);
+  const std::uint64_t num_bvs = meta.num_bvs;
+  const Eigen::DenseIndex max_x = static_cast<Eigen::DenseIndex>(meta.cols) - 1;
+  const Eigen::DenseIndex max_y = static_cast<Eigen::DenseIndex>(meta.rows) - 1;
+  for (std::uint64_t i = 0; i < num_bvs; ++i) {
+    const Node& node = nodes[i];
+    if (node.x_id < 0 || node.y_id < 0 || node.x_size < 1 ||
+        node.y_size < 1 || node.x_size > max_x - node.x_id ||
+        node.y_size > max_y - node.y_id)
+      throwCorrupted(filename, "cell range out of the grid");
+    if (!node.isLeaf() &&
+        (node.first_child <= i || node.first_child >= num_bvs - 1))
+      throwCorrupted(filename, "child index out of range");
+  }
+}
+
+}  // namespace
+
+FlatBinaryFile::FlatBinaryFile(const std::string& filename)
+    : data_(NULL), size_(0), mapped_(false) {
+#ifdef _WIN32
+  std::ifstream ifs(filename.c_str(), std::ios::binary);
+  if (!ifs) {
+    COAL_THROW_PRETTY(filename + " does not seem to be a valid file.",
+                      std::invalid_argument);
+  }
+  std::vector<char> buffer((std::istreambuf_iterator<char>(ifs)),
+                           std::istreambuf_iterator<char>());
+  size_ = buffer.size();
+  unsigned char* data = new unsigned char[size_ > 0 ? size_ : 1];
+  if (size_ > 0) std::memcpy(data, buffer.data(), size_);
+  data_ = data;
+#else
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    COAL_THROW_PRETTY(filename + " does not seem to be a valid file.",
+                      std::invalid_argument);
+  }
+  struct stat st;
+  if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+    ::close(fd);
+    COAL_THROW_PRETTY(filename + " does not seem to be a valid file.",
+                      std::invalid_argument);
+  }
+  size_ = static_cast<std::size_t>(st.st_size);
+  void* data = ::mmap(NULL, size_, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    COAL_THROW_PRETTY(filename + " cannot be memory mapped.",
+                      std::invalid_argument);
+  }
+  data_ = static_cast<const unsigned char*>(data);
+  mapped_ = true;
+#endif
+
+  const FlatBinaryHeader* header =
+      reinterpret_cast<const FlatBinaryHeader*>(data_);
+  std::string error;
+  if (size_ < sizeof(FlatBinaryHeader) ||
+      std::memcmp(header->magic, flat_binary_magic, sizeof(header->magic)) !=
+          0)
+    error = " is not a flat binary file.";
+  else if (header->version != FlatBinaryHeader::current_version)
+    error = " was written with an unsupported version of the format.";
+  else if (header->byte_order_mark != flat_binary_byte_order_mark ||
+           header->scalar_size != sizeof(Scalar))
+    error = " was written on a platform with a different byte order or " +
+            std::string("scalar type.");
+  else if (header->file_size != size_ ||
+           sizeof(FlatBinaryHeader) +
+                   std::uint64_t(header->num_sections) *
+                       sizeof(FlatBinarySection) >
+               size_)
+    error = " is truncated.";
+  else {
+    for (std::size_t i = 0; i < header->num_sections; ++i) {
+      const FlatBinarySection& s = section(i);
+      if (s.offset % FlatBinaryHeader::alignment != 0 || s.offset > size_ ||
+          s.size > size_ - s.offset) {
+        error = " is corrupted.";
+        break;
+      }
+    }
+  }
+  if (!error.empty()) {
+    release();
+    COAL_THROW_PRETTY(filename + error, std::invalid_argument);
+  }
+}
+
+FlatBinaryFile::~FlatBinaryFile() { release(); }
+
+void FlatBinaryFile::release() {
+  if (data_ == NULL) return;
+#ifdef _WIN32
+  delete[] data_;
+#else
+  if (mapped_) ::munmap(const_cast<unsigned char*>(data_), size_);
+#endif
+  data_ = NULL;
+}
+
+const FlatBinarySection& FlatBinaryFile::section(std::size_t i) const {
+  if (i >= numSections()) {
+    COAL_THROW_PRETTY("Section index out of range.", std::invalid_argument);
+  }
+  return reinterpret_cast<const FlatBinarySection*>(
+      data_ + sizeof(FlatBinaryHeader))[i];
+}
+
+template <typename BV>
+void saveToFlatBinary(const BVHModel<BV>& model_,
+                      const std::string& filename) {
+  typedef BVHModelAccessor<BV> Accessor;
+  const Accessor& model = reinterpret_cast<const Accessor&>(model_);
+  if (!(model.build_state == BVH_BUILD_STATE_PROCESSED ||
+        model.build_state == BVH_BUILD_STATE_UPDATED)) {
+    COAL_THROW_PRETTY(
+        "The BVH model is not in a BVH_BUILD_STATE_PROCESSED or "
+        "BVH_BUILD_STATE_UPDATED state.\n"
+        "The BVHModel could not be saved.",
+        std::invalid_argument);
+  }
+
+  BVHModelMetadata meta;
+  std::memset(&meta, 0, sizeof(meta));
+  saveGeometry(model, meta.geometry);
+  meta.num_vertices = model.num_vertices;
+  meta.num_tris = model.num_tris;
+  meta.num_bvs = model.num_bvs;
+  meta.num_primitives = model.getModelType() == BVH_MODEL_TRIANGLES
+                            ? model.num_tris
+                            : model.num_vertices;
+  meta.build_state = static_cast<std::int32_t>(model.build_state);
+
+  std::vector<const void*> data;
+  std::vector<std::uint64_t> sizes;
+  data.push_back(&meta);
+  sizes.push_back(sizeof(meta));
+  data.push_back(model.vertices ? model.vertices->data() : NULL);
+  sizes.push_back(meta.num_vertices * sizeof(Vec3s));
+  data.push_back(model.tri_indices ? model.tri_indices->data() : NULL);
+  sizes.push_back(meta.num_tris * sizeof(Triangle32));
+  data.push_back(model.bvs ? model.bvs->data() : NULL);
+  sizes.push_back(meta.num_bvs * sizeof(BVNode<BV>));
+  data.push_back(model.primitive_indices ? model.primitive_indices->data()
+                                         : NULL);
+  sizes.push_back(meta.num_primitives * sizeof(unsigned int));
+  writeFlatBinary(filename, FLAT_BINARY_BVH_MODEL, model.getNodeType(),
+                  sizeof(BVNode<BV>), data, sizes);
+}
+
+template <typename BV>
+void loadFromFlatBinary(BVHModel<BV>& model_, const std::string& filename) {
+  typedef BVHModelAccessor<BV> Accessor;
+  typedef typename BVHModel<BV>::bv_node_vector_t bv_node_vector_t;
+  Accessor& model = reinterpret_cast<Accessor&>(model_);
+
+  FlatBinaryFile file(filename);
+  const BVHModelMetadata& meta = checkFlatBinary<BVHModelMetadata>(
+      file, filename, FLAT_BINARY_BVH_MODEL, model.getNodeType(),
+      sizeof(BVNode<BV>), 5);
+  checkSectionSize<Vec3s>(file, filename, 1, meta.num_vertices);
+  checkSectionSize<Triangle32>(file, filename, 2, meta.num_tris);
+  checkSectionSize<BVNode<BV> >(file, filename, 3, meta.num_bvs);
+  checkSectionSize<unsigned int>(file, filename, 4, meta.num_primitives);
+  checkBVHModelIndices<BV>(file, filename, meta);
+
+  loadGeometry(meta.geometry, model);
+  model.num_vertices = model.num_vertices_allocated =
+      static_cast<unsigned int>(meta.num_vertices);
+  model.num_tris = model.num_tris_allocated =
+      static_cast<unsigned int>(meta.num_tris);
+  model.build_state = static_cast<BVHBuildState>(meta.build_state);
+
+  model.vertices.reset(new std::vector<Vec3s>(
+      sectionBegin<Vec3s>(file, 1), sectionEnd<Vec3s>(file, 1)));
+  if (meta.num_tris > 0) {
+    model.tri_indices.reset(new std::vector<Triangle32>(
+        sectionBegin<Triangle32>(file, 2), sectionEnd<Triangle32>(file, 2)));
+  } else
+    model.tri_indices.reset();
+  model.prev_vertices.reset();
+  model.last_updated_vertices.clear();
+  model.convex.reset();
+
+  model.num_bvs = model.num_bvs_allocated =
+      static_cast<unsigned int>(meta.num_bvs);
+  model.bvs.reset(new bv_node_vector_t(sectionBegin<BVNode<BV> >(file, 3),
+                                       sectionEnd<BVNode<BV> >(file, 3)));
+  // As in BVHModel::allocateBVs, there is one primitive index per node.
+  model.primitive_indices.reset(new std::vector<unsigned int>(
+      sectionBegin<unsigned int>(file, 4), sectionEnd<unsigned int>(file, 4)));
+  model.primitive_indices->resize(static_cast<std::size_t>(meta.num_bvs));
+  model.refit_topology.reset();
+}
+
+template <typename BV>
+void saveToFlatBinary(const HeightField<BV>& hfield_,
+                      const std::string& filename) {
+  typedef HeightFieldAccessor<BV> Accessor;
+  typedef typename HeightField<BV>::Node Node;
+  const Accessor& hfield = reinterpret_cast<const Accessor&>(hfield_);
+
+  HeightFieldMetadata meta;
+  std::memset(&meta, 0, sizeof(meta));
+  saveGeometry(hfield, meta.geometry);
+  meta.x_dim = hfield.x_dim;
+  meta.y_dim = hfield.y_dim;
+  meta.min_height = hfield.min_height;
+  meta.max_height = hfield.max_height;
+  meta.rows = static_cast<std::uint64_t>(hfield.heights.rows());
+  meta.cols = static_cast<std::uint64_t>(hfield.heights.cols());
+  meta.num_nodes = hfield.bvs.size();
+  meta.num_bvs = hfield.num_bvs;
+
+  std::vector<const void*> data;
+  std::vector<std::uint64_t> sizes;
+  data.push_back(&meta);
+  sizes.push_back(sizeof(meta));
+  data.push_back(hfield.heights.data());
+  sizes.push_back(meta.rows * meta.cols * sizeof(Scalar));
+  data.push_back(hfield.x_grid.data());
+  sizes.push_back(meta.cols * sizeof(Scalar));
+  data.push_back(hfield.y_grid.data());
+  sizes.push_back(meta.rows * sizeof(Scalar));
+  data.push_back(hfield.bvs.data());
+  sizes.push_back(meta.num_nodes * sizeof(Node));
+  writeFlatBinary(filename, FLAT_BINARY_HEIGHT_FIELD, hfield.getNodeType(),
+                  sizeof(Node), data, sizes);
+}
+
+template <typename BV>
+void loadFromFlatBinary(HeightField<BV>& hfield_,
+                        const std::string& filename) {
+  typedef HeightFieldAccessor<BV> Accessor;
+  typedef typename HeightField<BV>::Node Node;
+  Accessor& hfield = reinterpret_cast<Accessor&>(hfield_);
+
+  FlatBinaryFile file(filename);
+  const HeightFieldMetadata& meta = checkFlatBinary<HeightFieldMetadata>(
+      file, filename, FLAT_BINARY_HEIGHT_FIELD, hfield.getNodeType(),
+      sizeof(Node), 5);
+  if (meta.rows < 2 || meta.cols < 2 || meta.rows > INT_MAX ||
+      meta.cols > INT_MAX)
+    throwCorrupted(filename, "invalid grid size");
+  checkSectionSize<Scalar>(file, filename, 1, meta.rows * meta.cols);
+  checkSectionSize<Scalar>(file, filename, 2, meta.cols);
+  checkSectionSize<Scalar>(file, filename, 3, meta.rows);
+  checkSectionSize<Node>(file, filename, 4, meta.num_nodes);
+  checkHeightFieldIndices<BV>(file, filename, meta);
+
+  loadGeometry(meta.geometry, hfield);
+  hfield.x_dim = meta.x_dim;
+  hfield.y_dim = meta.y_dim;
+  hfield.min_height = meta.min_height;
+  hfield.max_height = meta.max_height;
+  const Eigen::DenseIndex rows = static_cast<Eigen::DenseIndex>(meta.rows);
+  const Eigen::DenseIndex cols = static_cast<Eigen::DenseIndex>(meta.cols);
+  hfield.heights =
+      Eigen::Map<const MatrixXs>(sectionBegin<Scalar>(file, 1), rows, cols);
+  hfield.x_grid = Eigen::Map<const VecXs>(sectionBegin<Scalar>(file, 2), cols);
+  hfield.y_grid = Eigen::Map<const VecXs>(sectionBegin<Scalar>(file, 3), rows);
+  hfield.bvs.assign(sectionBegin<Node>(file, 4), sectionEnd<Node>(file, 4));
+  hfield.num_bvs = static_cast<unsigned int>(meta.num_bvs);
+}
+
+#define COAL_FLAT_BINARY_INSTANTIATE(Model)                                 \
+  template COAL_DLLAPI void saveToFlatBinary(const Model&,                  \
+                                             const std::string&);           \
+  template COAL_DLLAPI void loadFromFlatBinary(Model&, const std::string&);
+
+COAL_FLAT_BINARY_INSTANTIATE(BVHModel<AABB>)
+COAL_FLAT_BINARY_INSTANTIATE(BVHModel<OBB>)
+COAL_FLAT_BINARY_INSTANTIATE(BVHModel<RSS>)
+COAL_FLAT_BINARY_INSTANTIATE(BVHModel<kIOS>)
+COAL_FLAT_BINARY_INSTANTIATE(BVHModel<OBBRSS>)
+COAL_FLAT_BINARY_INSTANTIATE(BVHModel<KDOP<16> >)
+COAL_FLAT_BINARY_INSTANTIATE(BVHModel<KDOP<18> >)
+COAL_FLAT_BINARY_INSTANTIATE(BVHModel<KDOP<24> >)
+COAL_FLAT_BINARY_INSTANTIATE(HeightField<AABB>)
+COAL_FLAT_BINARY_INSTANTIATE(HeightField<OBBRSS>)
+
+#undef COAL_FLAT_BINARY_INSTANTIATE
+
+}  // namespace serialization
+}  // namespace coal
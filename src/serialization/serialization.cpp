@@ -44,6 +44,7 @@ using namespace coal;
 #include "coal/serialization/convex.h"
 #include "coal/serialization/hfield.h"
 #include "coal/serialization/BVH_model.h"
+#include "coal/serialization/compound.h"
 #ifdef COAL_HAS_OCTOMAP
 #include "coal/serialization/octree.h"
 #endif
@@ -92,6 +93,8 @@ EXPORT_AND_CAST(BVHModel<KDOP<16>>, BVHModelBase)
 EXPORT_AND_CAST(BVHModel<KDOP<18>>, BVHModelBase)
 EXPORT_AND_CAST(BVHModel<KDOP<24>>, BVHModelBase)
 
+COAL_SERIALIZATION_DEFINE_EXPORT(Compound)
+
 #ifdef COAL_HAS_OCTOMAP
 COAL_SERIALIZATION_DEFINE_EXPORT(OcTree)
 #endif
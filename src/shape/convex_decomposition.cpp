@@ -0,0 +1,667 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of INRIA nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "coal/shape/convex_decomposition.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+
+#include "coal/BVH/BVH_model.h"
+#include "coal/compound.h"
+#include "coal/internal/parallel.h"
+#include "coal/shape/convex.h"
+#include "coal/serialization/archive.h"
+#include "coal/serialization/compound.h"
+
+namespace coal {
+
+namespace {
+
+/// @brief Version of the decomposition, part of the key of the cache files.
+const std::uint32_t CONVEX_DECOMPOSITION_VERSION = 1;
+
+/// @brief Convex hull of a set of points. The triangles are oriented outward
+/// and lie on the planes normal.dot(x) + offset = 0.
+struct Hull {
+  std::vector<Vec3s> points;
+  std::vector<Triangle32> triangles;
+  std::vector<Vec3s> normals;
+  std::vector<Scalar> offsets;
+  /// Whether the points are coplanar, in which case the triangles are a
+  /// two-sided fan and there are no normals.
+  bool flat;
+
+  Hull() : flat(false) {}
+};
+
+struct HullFace {
+  std::array<unsigned int, 3> v;
+  Vec3s normal;
+  Scalar offset;
+
+  Scalar signedDistance(const Vec3s& p) const { return normal.dot(p) + offset; }
+};
+
+HullFace makeFace(const std::vector<Vec3s>& points, unsigned int a,
+                  unsigned int b, unsigned int c) {
+  HullFace face;
+  face.v = {a, b, c};
+  face.normal = (points[b] - points[a]).cross(points[c] - points[a]);
+  const Scalar norm = face.normal.norm();
+  if (norm > 0) face.normal /= norm;
+  face.offset = -face.normal.dot(points[a]);
+  return face;
+}
+
+inline std::uint64_t edgeKey(unsigned int a, unsigned int b) {
+  return (std::uint64_t(a) << 32) | std::uint64_t(b);
+}
+
+/// @brief Two-sided fan over the 2D convex hull of coplanar points.
+bool computeFlatHull(const std::vector<Vec3s>& points, const Vec3s& normal,
+                     Hull& hull) {
+  const Vec3s u = normal.unitOrthogonal();
+  const Vec3s w = normal.cross(u);
+  std::vector<Vec2s, Eigen::aligned_allocator<Vec2s>> coords(points.size());
+  std::vector<unsigned int> order(points.size());
+  for (unsigned int i = 0; i < points.size(); ++i) {
+    coords[i] << u.dot(points[i]), w.dot(points[i]);
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(), [&](unsigned int a, unsigned int b) {
+    return coords[a][0] < coords[b][0] ||
+           (coords[a][0] == coords[b][0] && coords[a][1] < coords[b][1]);
+  });
+
+  // Andrew's monotone chain, counter-clockwise around normal.
+  auto cross = [&](unsigned int o, unsigned int a, unsigned int b) {
+    const Vec2s oa = coords[a] - coords[o], ob = coords[b] - coords[o];
+    return oa[0] * ob[1] - oa[1] * ob[0];
+  };
+  std::vector<unsigned int> chain(2 * order.size());
+  std::size_t k = 0;
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    while (k >= 2 && cross(chain[k - 2], chain[k - 1], order[i]) <= 0) --k;
+    chain[k++] = order[i];
+  }
+  for (std::size_t i = order.size() - 1, lower = k + 1; i > 0; --i) {
+    while (k >= lower && cross(chain[k - 2], chain[k - 1], order[i - 1]) <= 0)
+      --k;
+    chain[k++] = order[i - 1];
+  }
+  chain.resize(k - 1);
+  if (chain.size() < 3) return false;
+
+  hull.flat = true;
+  for (unsigned int i : chain) hull.points.push_back(points[i]);
+  for (unsigned int i = 1; i + 1 < chain.size(); ++i) {
+    hull.triangles.push_back(Triangle32(0, i, i + 1));
+    hull.triangles.push_back(Triangle32(0, i + 1, i));
+  }
+  return true;
+}
+
+/// @brief Incremental convex hull of a set of points.
+/// \param[in] eps distance below which a point is considered on a face.
+/// \return false if the points are collinear.
+bool computeHull(std::vector<Vec3s> points, Scalar eps, Hull& hull) {
+  hull = Hull();
+  std::sort(points.begin(), points.end(), [](const Vec3s& a, const Vec3s& b) {
+    return std::lexicographical_compare(a.data(), a.data() + 3, b.data(),
+                                        b.data() + 3);
+  });
+  points.erase(std::unique(points.begin(), points.end()), points.end());
+  if (points.size() < 3) return false;
+  // Sorted points are all outside the hull of the previous ones: insert them
+  // in a random, but reproducible, order instead.
+  std::mt19937 generator(0);
+  for (std::size_t i = points.size() - 1; i > 0; --i)
+    std::swap(points[i], points[generator() % (i + 1)]);
+
+  // Initial tetrahedron: the most distant extreme points along an axis, the
+  // point the furthest from their line and the point the furthest from the
+  // plane of the three.
+  unsigned int i0 = 0, i1 = 0;
+  Scalar extent = -1;
+  for (int axis = 0; axis < 3; ++axis) {
+    unsigned int imin = 0, imax = 0;
+    for (unsigned int i = 1; i < points.size(); ++i) {
+      if (points[i][axis] < points[imin][axis]) imin = i;
+      if (points[i][axis] > points[imax][axis]) imax = i;
+    }
+    if (points[imax][axis] - points[imin][axis] > extent) {
+      extent = points[imax][axis] - points[imin][axis];
+      i0 = imin;
+      i1 = imax;
+    }
+  }
+  if (extent <= eps) return false;
+
+  const Vec3s dir = (points[i1] - points[i0]).normalized();
+  unsigned int i2 = i0;
+  Scalar max_distance = eps;
+  for (unsigned int i = 0; i < points.size(); ++i) {
+    const Vec3s d = points[i] - points[i0];
+    const Scalar distance = (d - d.dot(dir) * dir).norm();
+    if (distance > max_distance) {
+      max_distance = distance;
+      i2 = i;
+    }
+  }
+  if (i2 == i0) return false;
+
+  const Vec3s normal =
+      (points[i1] - points[i0]).cross(points[i2] - points[i0]).normalized();
+  unsigned int i3 = i0;
+  max_distance = eps;
+  for (unsigned int i = 0; i < points.size(); ++i) {
+    const Scalar distance = std::abs(normal.dot(points[i] - points[i0]));
+    if (distance > max_distance) {
+      max_distance = distance;
+      i3 = i;
+    }
+  }
+  if (i3 == i0) return computeFlatHull(points, normal, hull);
+
+  // Faces are only marked as removed, so that their indices remain valid in
+  // the map from the oriented edges to the faces.
+  std::vector<HullFace> faces;
+  std::vector<char> removed;
+  std::unordered_map<std::uint64_t, std::size_t> edge_to_face;
+  auto addFace = [&](const HullFace& face) {
+    for (int e = 0; e < 3; ++e)
+      edge_to_face[edgeKey(face.v[e], face.v[(e + 1) % 3])] = faces.size();
+    faces.push_back(face);
+    removed.push_back(0);
+  };
+  const Vec3s inside = (points[i0] + points[i1] + points[i2] + points[i3]) / 4;
+  auto addInitialFace = [&](unsigned int a, unsigned int b, unsigned int c) {
+    HullFace face = makeFace(points, a, b, c);
+    if (face.signedDistance(inside) > 0) face = makeFace(points, a, c, b);
+    addFace(face);
+  };
+  addInitialFace(i0, i1, i2);
+  addInitialFace(i0, i1, i3);
+  addInitialFace(i0, i2, i3);
+  addInitialFace(i1, i2, i3);
+
+  // Add the points one by one: the faces seen by the point are replaced by
+  // the cone from the point to the horizon. The visible faces are grown from
+  // the most visible one through the edges, so that they stay connected
+  // despite the rounding errors. Otherwise the horizon is not a single loop
+  // and the hull is no longer a closed surface.
+  std::vector<char> visible(faces.size(), 0);
+  std::vector<std::size_t> visited, stack;
+  std::vector<std::pair<unsigned int, unsigned int>> horizon;
+  for (unsigned int k = 0; k < points.size(); ++k) {
+    if (k == i0 || k == i1 || k == i2 || k == i3) continue;
+    std::size_t seed = faces.size();
+    Scalar max_distance = eps;
+    for (std::size_t f = 0; f < faces.size(); ++f) {
+      if (removed[f]) continue;
+      const Scalar distance = faces[f].signedDistance(points[k]);
+      if (distance > max_distance) {
+        max_distance = distance;
+        seed = f;
+      }
+    }
+    if (seed == faces.size()) continue;
+
+    visible.resize(faces.size(), 0);
+    visible[seed] = 1;
+    visited.assign(1, seed);
+    stack.assign(1, seed);
+    horizon.clear();
+    while (!stack.empty()) {
+      const std::size_t f = stack.back();
+      stack.pop_back();
+      for (int e = 0; e < 3; ++e) {
+        const unsigned int a = faces[f].v[e], b = faces[f].v[(e + 1) % 3];
+        const std::size_t neighbor = edge_to_face.at(edgeKey(b, a));
+        if (visible[neighbor]) continue;
+        if (faces[neighbor].signedDistance(points[k]) > eps) {
+          visible[neighbor] = 1;
+          visited.push_back(neighbor);
+          stack.push_back(neighbor);
+        }
+      }
+    }
+    for (std::size_t f : visited) {
+      for (int e = 0; e < 3; ++e) {
+        const unsigned int a = faces[f].v[e], b = faces[f].v[(e + 1) % 3];
+        if (!visible[edge_to_face.at(edgeKey(b, a))]) horizon.push_back({a, b});
+      }
+    }
+
+    for (std::size_t f : visited) {
+      removed[f] = 1;
+      visible[f] = 0;
+      for (int e = 0; e < 3; ++e)
+        edge_to_face.erase(edgeKey(faces[f].v[e], faces[f].v[(e + 1) % 3]));
+    }
+    for (const std::pair<unsigned int, unsigned int>& edge : horizon)
+      addFace(makeFace(points, edge.first, edge.second, k));
+  }
+
+  std::vector<int> index(points.size(), -1);
+  for (std::size_t f = 0; f < faces.size(); ++f) {
+    if (removed[f]) continue;
+    const HullFace& face = faces[f];
+    std::array<std::uint32_t, 3> v;
+    for (int i = 0; i < 3; ++i) {
+      if (index[face.v[i]] < 0) {
+        index[face.v[i]] = static_cast<int>(hull.points.size());
+        hull.points.push_back(points[face.v[i]]);
+      }
+      v[i] = static_cast<std::uint32_t>(index[face.v[i]]);
+    }
+    hull.triangles.push_back(Triangle32(v[0], v[1], v[2]));
+    hull.normals.push_back(face.normal);
+    hull.offsets.push_back(face.offset);
+  }
+  return true;
+}
+
+struct Cut {
+  int axis;
+  Scalar position;
+};
+
+/// @brief Squared distance from p to the triangle (a, b, c).
+Scalar squaredDistanceToTriangle(const Vec3s& p, const Vec3s& a,
+                                 const Vec3s& b, const Vec3s& c) {
+  const Vec3s ab = b - a, ac = c - a, ap = p - a;
+  const Scalar d1 = ab.dot(ap), d2 = ac.dot(ap);
+  if (d1 <= 0 && d2 <= 0) return ap.squaredNorm();
+  const Vec3s bp = p - b;
+  const Scalar d3 = ab.dot(bp), d4 = ac.dot(bp);
+  if (d3 >= 0 && d4 <= d3) return bp.squaredNorm();
+  const Scalar vc = d1 * d4 - d3 * d2;
+  if (vc <= 0 && d1 >= 0 && d3 <= 0)
+    return (ap - (d1 / (d1 - d3)) * ab).squaredNorm();
+  const Vec3s cp = p - c;
+  const Scalar d5 = ab.dot(cp), d6 = ac.dot(cp);
+  if (d6 >= 0 && d5 <= d6) return cp.squaredNorm();
+  const Scalar vb = d5 * d2 - d1 * d6;
+  if (vb <= 0 && d2 >= 0 && d6 <= 0)
+    return (ap - (d2 / (d2 - d6)) * ac).squaredNorm();
+  const Scalar va = d3 * d6 - d5 * d4;
+  if (va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0)
+    return (bp - ((d4 - d3) / ((d4 - d3) + (d5 - d6))) * (c - b))
+        .squaredNorm();
+  const Scalar denom = va + vb + vc;
+  if (denom <= 0) return (std::min)(ap.squaredNorm(), bp.squaredNorm());
+  return (ap - (vb / denom) * ab - (vc / denom) * ac).squaredNorm();
+}
+
+/// @brief Concavity of the triangles with respect to their hull.
+///
+/// It is the largest of
+/// - the distance from the vertices and the centroids of the triangles to the
+///   boundary of the hull, which measures the dents of the surface,
+/// - the distance from the centers of the faces of the hull to the triangles,
+///   which measures the gaps that the hull bridges, like the hole of a ring.
+///   The faces lying on the cut planes of the part are skipped: they close the
+///   part where it was cut off the mesh.
+Scalar computeConcavity(const Hull& hull, const std::vector<Vec3s>& triangles,
+                        const std::vector<Cut>& cuts, Scalar eps) {
+  if (hull.flat || hull.triangles.empty()) return 0;
+  Scalar concavity = 0;
+  auto visit = [&](const Vec3s& p) {
+    // The depth of p only decreases with the faces: stop as soon as it cannot
+    // increase the concavity.
+    Scalar depth = (std::numeric_limits<Scalar>::max)();
+    for (std::size_t i = 0; i < hull.normals.size() && depth > concavity; ++i)
+      depth = (std::min)(depth, -(hull.normals[i].dot(p) + hull.offsets[i]));
+    concavity = (std::max)(concavity, depth);
+  };
+  for (std::size_t t = 0; t < triangles.size(); t += 3) {
+    visit(triangles[t]);
+    visit(triangles[t + 1]);
+    visit(triangles[t + 2]);
+    visit((triangles[t] + triangles[t + 1] + triangles[t + 2]) / 3);
+  }
+
+  auto onCutPlane = [&](const Vec3s& p) {
+    for (const Cut& cut : cuts)
+      if (std::abs(p[cut.axis] - cut.position) <= eps) return true;
+    return false;
+  };
+  // Neighbouring faces of the hull are usually close to the same triangles:
+  // start the search of each face from the closest triangle of the previous
+  // one.
+  std::size_t hint = 0;
+  const std::size_t num_triangles = triangles.size() / 3;
+  for (const Triangle32& face : hull.triangles) {
+    const Vec3s& a = hull.points[face[0]];
+    const Vec3s& b = hull.points[face[1]];
+    const Vec3s& c = hull.points[face[2]];
+    if (onCutPlane(a) && onCutPlane(b) && onCutPlane(c)) continue;
+    const Vec3s center = (a + b + c) / 3;
+    // The distance of center only decreases with the triangles: stop as soon
+    // as it cannot increase the concavity.
+    const Scalar sqr_concavity = concavity * concavity;
+    Scalar sqr_distance = (std::numeric_limits<Scalar>::max)();
+    const std::size_t start = hint;
+    for (std::size_t k = 0; k < num_triangles && sqr_distance > sqr_concavity;
+         ++k) {
+      const std::size_t t = (start + k) % num_triangles;
+      const Scalar d =
+          squaredDistanceToTriangle(center, triangles[3 * t],
+                                    triangles[3 * t + 1], triangles[3 * t + 2]);
+      if (d < sqr_distance) {
+        sqr_distance = d;
+        hint = t;
+      }
+    }
+    if (sqr_distance > sqr_concavity) concavity = std::sqrt(sqr_distance);
+  }
+  return concavity;
+}
+
+/// @brief Part of the mesh, stored as a soup of triangles (three vertices per
+/// triangle).
+struct Part {
+  std::vector<Vec3s> triangles;
+  /// Cuts which separated the part from the rest of the mesh.
+  std::vector<Cut> cuts;
+  Hull hull;
+  Scalar concavity;
+  /// Whether no cut separates the triangles of the part.
+  bool final;
+
+  Part() : concavity(0), final(false) {}
+
+  void computeHullAndConcavity(Scalar eps) {
+    if (computeHull(triangles, eps, hull))
+      concavity = computeConcavity(hull, triangles, cuts, eps);
+    else
+      concavity = 0;
+  }
+};
+
+void addPolygon(const std::array<Vec3s, 4>& polygon, std::size_t size,
+                std::vector<Vec3s>& triangles) {
+  for (std::size_t i = 1; i + 1 < size; ++i) {
+    triangles.push_back(polygon[0]);
+    triangles.push_back(polygon[i]);
+    triangles.push_back(polygon[i + 1]);
+  }
+}
+
+/// @brief Clip the triangles on each side of the cut.
+void cutTriangles(const std::vector<Vec3s>& triangles, const Cut& cut,
+                  std::vector<Vec3s>& below, std::vector<Vec3s>& above) {
+  below.clear();
+  above.clear();
+  std::array<Vec3s, 4> polygon_below, polygon_above;
+  for (std::size_t t = 0; t < triangles.size(); t += 3) {
+    const Vec3s* p = &triangles[t];
+    Scalar s[3];
+    for (int i = 0; i < 3; ++i) s[i] = p[i][cut.axis] - cut.position;
+    if (s[0] <= 0 && s[1] <= 0 && s[2] <= 0) {
+      below.insert(below.end(), p, p + 3);
+      continue;
+    }
+    if (s[0] >= 0 && s[1] >= 0 && s[2] >= 0) {
+      above.insert(above.end(), p, p + 3);
+      continue;
+    }
+    std::size_t num_below = 0, num_above = 0;
+    for (int i = 0; i < 3; ++i) {
+      const int j = (i + 1) % 3;
+      if (s[i] <= 0) polygon_below[num_below++] = p[i];
+      if (s[i] >= 0) polygon_above[num_above++] = p[i];
+      if ((s[i] < 0 && s[j] > 0) || (s[i] > 0 && s[j] < 0)) {
+        Vec3s x = p[i] + (s[i] / (s[i] - s[j])) * (p[j] - p[i]);
+        x[cut.axis] = cut.position;
+        polygon_below[num_below++] = x;
+        polygon_above[num_above++] = x;
+      }
+    }
+    addPolygon(polygon_below, num_below, below);
+    addPolygon(polygon_above, num_above, above);
+  }
+}
+
+/// @brief Largest concavity of the two sides of a cut, or infinity if a side
+/// is empty.
+Scalar evaluateCut(const Part& part, const Cut& cut, Scalar eps) {
+  std::vector<Vec3s> below, above;
+  cutTriangles(part.triangles, cut, below, above);
+  if (below.empty() || above.empty())
+    return std::numeric_limits<Scalar>::infinity();
+  std::vector<Cut> cuts(part.cuts);
+  cuts.push_back(cut);
+  Scalar cost = 0;
+  Hull hull;
+  if (computeHull(below, eps, hull))
+    cost = computeConcavity(hull, below, cuts, eps);
+  if (computeHull(above, eps, hull))
+    cost = (std::max)(cost, computeConcavity(hull, above, cuts, eps));
+  return cost;
+}
+
+shared_ptr<ConvexBase32> makeConvex(const Hull& hull) {
+  shared_ptr<std::vector<Vec3s>> points(new std::vector<Vec3s>(hull.points));
+  shared_ptr<std::vector<Triangle32>> triangles(
+      new std::vector<Triangle32>(hull.triangles));
+  ConvexTpl<Triangle32>* convex = new ConvexTpl<Triangle32>(
+      points, static_cast<unsigned int>(points->size()), triangles,
+      static_cast<unsigned int>(triangles->size()));
+  if (!hull.normals.empty()) {
+    convex->normals.reset(new std::vector<Vec3s>(hull.normals));
+    convex->offsets.reset(new std::vector<Scalar>(hull.offsets));
+    convex->num_normals_and_offsets =
+        static_cast<unsigned int>(hull.normals.size());
+  }
+  convex->computeLocalAABB();
+  return shared_ptr<ConvexBase32>(convex);
+}
+
+/// @brief FNV-1a hash of the bytes of values.
+struct Hasher {
+  std::uint64_t hash;
+
+  Hasher() : hash(14695981039346656037ull) {}
+
+  template <typename T>
+  void add(const T& value) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+      hash ^= bytes[i];
+      hash *= 1099511628211ull;
+    }
+  }
+};
+
+}  // namespace
+
+std::vector<shared_ptr<ConvexBase32>> computeConvexDecomposition(
+    const BVHModelBase& model, const ConvexDecompositionParameters& params) {
+  if (model.getModelType() != BVH_MODEL_TRIANGLES)
+    COAL_THROW_PRETTY("The convex decomposition requires a mesh of triangles.",
+                      std::invalid_argument);
+  if (params.max_num_parts == 0)
+    COAL_THROW_PRETTY("The maximal number of parts must be positive.",
+                      std::invalid_argument);
+
+  std::vector<Part> parts(1);
+  const std::vector<Vec3s>& vertices = *model.vertices;
+  const std::vector<Triangle32>& tri_indices = *model.tri_indices;
+  AABB aabb;
+  for (unsigned int i = 0; i < model.num_tris; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      parts[0].triangles.push_back(vertices[tri_indices[i][j]]);
+      aabb += parts[0].triangles.back();
+    }
+  }
+  const Scalar diagonal = (aabb.max_ - aabb.min_).norm();
+  const Scalar eps =
+      diagonal * std::sqrt(std::numeric_limits<Scalar>::epsilon());
+  const Scalar threshold = params.concavity_threshold * diagonal;
+  const Scalar num_planes = static_cast<Scalar>(params.num_candidate_planes);
+  parts[0].computeHullAndConcavity(eps);
+
+  std::vector<std::size_t> selected;
+  std::vector<std::pair<std::size_t, Cut>> cuts;
+  std::vector<Scalar> costs;
+  while (parts.size() < params.max_num_parts) {
+    // Cut first the most concave parts.
+    selected.clear();
+    for (std::size_t i = 0; i < parts.size(); ++i) {
+      if (!parts[i].final && parts[i].concavity > threshold &&
+          parts[i].cuts.size() < params.max_depth)
+        selected.push_back(i);
+    }
+    if (selected.empty()) break;
+    std::stable_sort(selected.begin(), selected.end(),
+                     [&](std::size_t a, std::size_t b) {
+                       return parts[a].concavity > parts[b].concavity;
+                     });
+    if (selected.size() > params.max_num_parts - parts.size())
+      selected.resize(params.max_num_parts - parts.size());
+
+    // Evaluate the candidate cuts of all the selected parts in parallel.
+    cuts.clear();
+    for (std::size_t s = 0; s < selected.size(); ++s) {
+      AABB part_aabb;
+      for (const Vec3s& p : parts[selected[s]].triangles) part_aabb += p;
+      for (int axis = 0; axis < 3; ++axis) {
+        const Scalar extent = part_aabb.max_[axis] - part_aabb.min_[axis];
+        if (extent <= eps) continue;
+        for (std::size_t k = 1; k <= params.num_candidate_planes; ++k) {
+          const Cut cut = {axis, part_aabb.min_[axis] +
+                                     extent * static_cast<Scalar>(k) /
+                                         (num_planes + 1)};
+          cuts.push_back(std::make_pair(s, cut));
+        }
+      }
+    }
+    costs.assign(cuts.size(), std::numeric_limits<Scalar>::infinity());
+    internal::parallelFor(
+        cuts.size(), params.num_threads, [&](std::size_t c, std::size_t) {
+          costs[c] =
+              evaluateCut(parts[selected[cuts[c].first]], cuts[c].second, eps);
+        });
+
+    std::vector<std::size_t> best(selected.size(), cuts.size());
+    for (std::size_t c = 0; c < cuts.size(); ++c) {
+      std::size_t& b = best[cuts[c].first];
+      if (costs[c] < std::numeric_limits<Scalar>::infinity() &&
+          (b == cuts.size() || costs[c] < costs[b]))
+        b = c;
+    }
+
+    // Cut the selected parts in parallel.
+    std::vector<Part> children(2 * selected.size());
+    internal::parallelFor(
+        selected.size(), params.num_threads,
+        [&](std::size_t s, std::size_t) {
+          if (best[s] == cuts.size()) return;
+          const Part& part = parts[selected[s]];
+          Part& below = children[2 * s];
+          Part& above = children[2 * s + 1];
+          cutTriangles(part.triangles, cuts[best[s]].second, below.triangles,
+                       above.triangles);
+          below.cuts = part.cuts;
+          below.cuts.push_back(cuts[best[s]].second);
+          above.cuts = below.cuts;
+          below.computeHullAndConcavity(eps);
+          above.computeHullAndConcavity(eps);
+        });
+    for (std::size_t s = 0; s < selected.size(); ++s) {
+      if (best[s] == cuts.size()) {
+        parts[selected[s]].final = true;
+        continue;
+      }
+      parts[selected[s]] = std::move(children[2 * s]);
+      parts.push_back(std::move(children[2 * s + 1]));
+    }
+  }
+
+  std::vector<shared_ptr<ConvexBase32>> convexes;
+  for (const Part& part : parts) {
+    if (!part.hull.triangles.empty())
+      convexes.push_back(makeConvex(part.hull));
+  }
+  return convexes;
+}
+
+CompoundPtr_t loadOrComputeConvexDecomposition(
+    const BVHModelBase& model, const ConvexDecompositionParameters& params,
+    const std::string& cache_directory) {
+  Hasher hasher;
+  hasher.add(CONVEX_DECOMPOSITION_VERSION);
+  hasher.add(model.num_vertices);
+  for (unsigned int i = 0; i < model.num_vertices; ++i)
+    for (int j = 0; j < 3; ++j) hasher.add((*model.vertices)[i][j]);
+  hasher.add(model.num_tris);
+  for (unsigned int i = 0; i < model.num_tris; ++i)
+    for (int j = 0; j < 3; ++j) hasher.add((*model.tri_indices)[i][j]);
+  hasher.add(params.concavity_threshold);
+  hasher.add(params.max_num_parts);
+  hasher.add(params.max_depth);
+  hasher.add(params.num_candidate_planes);
+
+  std::ostringstream filename;
+  filename << cache_directory << "/convex_decomposition_" << std::hex
+           << std::setw(16) << std::setfill('0') << hasher.hash << ".bin";
+
+  CompoundPtr_t compound(new Compound());
+  if (std::ifstream(filename.str().c_str()).good()) {
+    try {
+      serialization::loadFromBinary(*compound, filename.str());
+      return compound;
+    } catch (const std::exception&) {
+      // Unreadable cache file: compute the decomposition again.
+      compound->clear();
+    }
+  }
+  for (const shared_ptr<ConvexBase32>& convex :
+       computeConvexDecomposition(model, params))
+    compound->addPart(convex);
+  serialization::saveToBinary(*compound, filename.str());
+  return compound;
+}
+
+}  // namespace coal
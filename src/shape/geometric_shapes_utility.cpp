@@ -43,8 +43,9 @@ namespace coal {
 
 namespace details {
 
-std::vector<Vec3s> getBoundVertices(const Box& box, const Transform3s& tf) {
-  std::vector<Vec3s> result(8);
+void getBoundVertices(const Box& box, const Transform3s& tf,
+                      std::vector<Vec3s>& result) {
+  result.resize(8);
   Scalar a = box.halfSide[0];
   Scalar b = box.halfSide[1];
   Scalar c = box.halfSide[2];
@@ -56,14 +57,12 @@ std::vector<Vec3s> getBoundVertices(const Box& box, const Transform3s& tf) {
   result[5] = tf.transform(Vec3s(-a, b, -c));
   result[6] = tf.transform(Vec3s(-a, -b, c));
   result[7] = tf.transform(Vec3s(-a, -b, -c));
-
-  return result;
 }
 
 // we use icosahedron to bound the sphere
-std::vector<Vec3s> getBoundVertices(const Sphere& sphere,
-                                    const Transform3s& tf) {
-  std::vector<Vec3s> result(12);
+void getBoundVertices(const Sphere& sphere, const Transform3s& tf,
+                      std::vector<Vec3s>& result) {
+  result.resize(12);
   const Scalar m = (1 + sqrt(Scalar(5))) / Scalar(2);
   Scalar edge_size = sphere.radius * 6 / (sqrt(Scalar(27)) + sqrt(Scalar(15)));
 
@@ -81,14 +80,12 @@ std::vector<Vec3s> getBoundVertices(const Sphere& sphere,
   result[9] = tf.transform(Vec3s(b, 0, -a));
   result[10] = tf.transform(Vec3s(-b, 0, a));
   result[11] = tf.transform(Vec3s(-b, 0, -a));
-
-  return result;
 }
 
 // we use scaled icosahedron to bound the ellipsoid
-std::vector<Vec3s> getBoundVertices(const Ellipsoid& ellipsoid,
-                                    const Transform3s& tf) {
-  std::vector<Vec3s> result(12);
+void getBoundVertices(const Ellipsoid& ellipsoid, const Transform3s& tf,
+                      std::vector<Vec3s>& result) {
+  result.resize(12);
   const Scalar phi = (1 + sqrt(Scalar(5))) / Scalar(2);
 
   const Scalar a = sqrt(Scalar(3)) / (phi * phi);
@@ -116,13 +113,11 @@ std::vector<Vec3s> getBoundVertices(const Ellipsoid& ellipsoid,
   result[9] = tf.transform(Vec3s(Ab, 0, -Ca));
   result[10] = tf.transform(Vec3s(-Ab, 0, Ca));
   result[11] = tf.transform(Vec3s(-Ab, 0, -Ca));
-
-  return result;
 }
 
-std::vector<Vec3s> getBoundVertices(const Capsule& capsule,
-                                    const Transform3s& tf) {
-  std::vector<Vec3s> result(36);
+void getBoundVertices(const Capsule& capsule, const Transform3s& tf,
+                      std::vector<Vec3s>& result) {
+  result.resize(36);
   const Scalar m = (1 + sqrt(Scalar(5))) / Scalar(2);
 
   Scalar hl = capsule.halfLength;
@@ -172,12 +167,11 @@ std::vector<Vec3s> getBoundVertices(const Capsule& capsule,
   result[33] = tf.transform(Vec3s(-r2, 0, -hl));
   result[34] = tf.transform(Vec3s(-c, -d, -hl));
   result[35] = tf.transform(Vec3s(c, -d, -hl));
-
-  return result;
 }
 
-std::vector<Vec3s> getBoundVertices(const Cone& cone, const Transform3s& tf) {
-  std::vector<Vec3s> result(7);
+void getBoundVertices(const Cone& cone, const Transform3s& tf,
+                      std::vector<Vec3s>& result) {
+  result.resize(7);
 
   Scalar hl = cone.halfLength;
   Scalar r2 = cone.radius * 2 / sqrt(Scalar(3));
@@ -192,13 +186,11 @@ std::vector<Vec3s> getBoundVertices(const Cone& cone, const Transform3s& tf) {
   result[5] = tf.transform(Vec3s(a, -b, -hl));
 
   result[6] = tf.transform(Vec3s(0, 0, hl));
-
-  return result;
 }
 
-std::vector<Vec3s> getBoundVertices(const Cylinder& cylinder,
-                                    const Transform3s& tf) {
-  std::vector<Vec3s> result(12);
+void getBoundVertices(const Cylinder& cylinder, const Transform3s& tf,
+                      std::vector<Vec3s>& result) {
+  result.resize(12);
 
   Scalar hl = cylinder.halfLength;
   Scalar r2 = cylinder.radius * 2 / sqrt(Scalar(3));
@@ -218,18 +210,14 @@ std::vector<Vec3s> getBoundVertices(const Cylinder& cylinder,
   result[9] = tf.transform(Vec3s(-r2, 0, hl));
   result[10] = tf.transform(Vec3s(-a, -b, hl));
   result[11] = tf.transform(Vec3s(a, -b, hl));
-
-  return result;
 }
 
-std::vector<Vec3s> getBoundVertices(const TriangleP& triangle,
-                                    const Transform3s& tf) {
-  std::vector<Vec3s> result(3);
+void getBoundVertices(const TriangleP& triangle, const Transform3s& tf,
+                      std::vector<Vec3s>& result) {
+  result.resize(3);
   result[0] = tf.transform(triangle.a);
   result[1] = tf.transform(triangle.b);
   result[2] = tf.transform(triangle.c);
-
-  return result;
 }
 
 }  // namespace details
@@ -20,6 +20,19 @@ namespace coal {
 template <typename TypeA, typename TypeB>
 struct COAL_LOCAL TraversalTraitsCollision {};
 
+template <typename T_HF, typename T_BVH>
+struct COAL_LOCAL TraversalTraitsCollision<HeightField<T_HF>,
+                                           BVHModel<T_BVH> > {
+  typedef HeightFieldMeshCollisionTraversalNode<T_HF, T_BVH>
+      CollisionTraversal_t;
+};
+
+template <typename T_HF1, typename T_HF2>
+struct COAL_LOCAL TraversalTraitsCollision<HeightField<T_HF1>,
+                                           HeightField<T_HF2> > {
+  typedef HeightFieldCollisionTraversalNode<T_HF1, T_HF2> CollisionTraversal_t;
+};
+
 #ifdef COAL_HAS_OCTOMAP
 
 template <typename T_SH>
@@ -64,6 +77,18 @@ struct COAL_LOCAL TraversalTraitsCollision<HeightField<T_HF>, OcTree> {
 template <typename TypeA, typename TypeB>
 struct COAL_LOCAL TraversalTraitsDistance {};
 
+template <typename T_HF, typename T_BVH>
+struct COAL_LOCAL TraversalTraitsDistance<HeightField<T_HF>, BVHModel<T_BVH> > {
+  typedef HeightFieldMeshDistanceTraversalNode<T_HF, T_BVH>
+      CollisionTraversal_t;
+};
+
+template <typename T_HF1, typename T_HF2>
+struct COAL_LOCAL TraversalTraitsDistance<HeightField<T_HF1>,
+                                          HeightField<T_HF2> > {
+  typedef HeightFieldDistanceTraversalNode<T_HF1, T_HF2> CollisionTraversal_t;
+};
+
 #ifdef COAL_HAS_OCTOMAP
 
 template <typename T_SH>
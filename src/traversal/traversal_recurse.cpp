@@ -36,10 +36,54 @@
 /** \author Jia Pan */
 
 #include "coal/internal/traversal_recurse.h"
+#include "coal/internal/query_statistics.h"
 
 #include <vector>
 
 namespace coal {
+
+namespace {
+// The following functions forward to the node, and count the tests in the
+// statistics of the query when they are enabled.
+
+inline bool BVDisjoints(const CollisionTraversalNodeBase* node,
+                        unsigned int b1, unsigned int b2,
+                        Scalar& sqrDistLowerBound) {
+  QueryStatistics* statistics = node->queryStatistics();
+  if (statistics) ++statistics->num_bv_tests;
+  return node->BVDisjoints(b1, b2, sqrDistLowerBound);
+}
+
+inline void leafCollides(const CollisionTraversalNodeBase* node,
+                         unsigned int b1, unsigned int b2,
+                         Scalar& sqrDistLowerBound) {
+  QueryStatistics* statistics = node->queryStatistics();
+  if (statistics && node->leafTestsArePrimitiveTests()) {
+    ++statistics->num_leaf_tests;
+    internal::StageTimer timer(statistics, &QueryStatistics::narrowphase_time);
+    node->leafCollides(b1, b2, sqrDistLowerBound);
+  } else
+    node->leafCollides(b1, b2, sqrDistLowerBound);
+}
+
+inline Scalar BVDistanceLowerBound(const DistanceTraversalNodeBase* node,
+                                   unsigned int b1, unsigned int b2) {
+  QueryStatistics* statistics = node->queryStatistics();
+  if (statistics) ++statistics->num_bv_tests;
+  return node->BVDistanceLowerBound(b1, b2);
+}
+
+inline void leafComputeDistance(const DistanceTraversalNodeBase* node,
+                                unsigned int b1, unsigned int b2) {
+  QueryStatistics* statistics = node->queryStatistics();
+  if (statistics && node->leafTestsArePrimitiveTests()) {
+    ++statistics->num_leaf_tests;
+    internal::StageTimer timer(statistics, &QueryStatistics::narrowphase_time);
+    node->leafComputeDistance(b1, b2);
+  } else
+    node->leafComputeDistance(b1, b2);
+}
+}  // namespace
 void collisionRecurse(CollisionTraversalNodeBase* node, unsigned int b1,
                       unsigned int b2, BVHFrontList* front_list,
                       Scalar& sqrDistLowerBound) {
@@ -50,11 +94,11 @@ void collisionRecurse(CollisionTraversalNodeBase* node, unsigned int b1,
     updateFrontList(front_list, b1, b2);
 
     // if(node->BVDisjoints(b1, b2, sqrDistLowerBound)) return;
-    node->leafCollides(b1, b2, sqrDistLowerBound);
+    leafCollides(node, b1, b2, sqrDistLowerBound);
     return;
   }
 
-  if (node->BVDisjoints(b1, b2, sqrDistLowerBound)) {
+  if (BVDisjoints(node, b1, b2, sqrDistLowerBound)) {
     updateFrontList(front_list, b1, b2);
     return;
   }
@@ -89,8 +133,11 @@ void collisionNonRecurse(CollisionTraversalNodeBase* node,
   // typedef std::stack<BVPair_t, std::vector<BVPair_t> > Stack_t;
   typedef std::vector<BVPair_t> Stack_t;
 
-  Stack_t pairs;
-  pairs.reserve(1000);
+  // The stack is kept between the traversals of a thread so that it is only
+  // allocated once.
+  static thread_local Stack_t pairs;
+  pairs.clear();
+  if (pairs.capacity() < 1000) pairs.reserve(1000);
   sqrDistLowerBound = std::numeric_limits<Scalar>::infinity();
   Scalar sdlb = std::numeric_limits<Scalar>::infinity();
 
@@ -112,7 +159,7 @@ void collisionNonRecurse(CollisionTraversalNodeBase* node,
       // if (sdlb < sqrDistLowerBound) sqrDistLowerBound = sdlb;
       // continue;
       //}
-      node->leafCollides(a, b, sdlb);
+      leafCollides(node, a, b, sdlb);
       if (sdlb < sqrDistLowerBound) sqrDistLowerBound = sdlb;
       if (node->canStop() && !front_list) return;
       continue;
@@ -124,7 +171,7 @@ void collisionNonRecurse(CollisionTraversalNodeBase* node,
     // }
 
     // Check the BV
-    if (node->BVDisjoints(a, b, sdlb)) {
+    if (BVDisjoints(node, a, b, sdlb)) {
       if (sdlb < sqrDistLowerBound) sqrDistLowerBound = sdlb;
       updateFrontList(front_list, a, b);
       continue;
@@ -156,7 +203,7 @@ void distanceRecurse(DistanceTraversalNodeBase* node, unsigned int b1,
   if (l1 && l2) {
     updateFrontList(front_list, b1, b2);
 
-    node->leafComputeDistance(b1, b2);
+    leafComputeDistance(node, b1, b2);
     return;
   }
 
@@ -174,8 +221,8 @@ void distanceRecurse(DistanceTraversalNodeBase* node, unsigned int b1,
     c2 = (unsigned int)node->getSecondRightChild(b2);
   }
 
-  Scalar d1 = node->BVDistanceLowerBound(a1, a2);
-  Scalar d2 = node->BVDistanceLowerBound(c1, c2);
+  Scalar d1 = BVDistanceLowerBound(node, a1, a2);
+  Scalar d2 = BVDistanceLowerBound(node, c1, c2);
 
   if (d2 < d1) {
     if (!node->canStop(d2))
@@ -254,7 +301,7 @@ void distanceQueueRecurse(DistanceTraversalNodeBase* node, unsigned int b1,
     if (l1 && l2) {
       updateFrontList(front_list, min_test.b1, min_test.b2);
 
-      node->leafComputeDistance(min_test.b1, min_test.b2);
+      leafComputeDistance(node, min_test.b1, min_test.b2);
     } else if (bvtq.full()) {
       // queue should not get two more tests, recur
 
@@ -268,21 +315,21 @@ void distanceQueueRecurse(DistanceTraversalNodeBase* node, unsigned int b1,
         unsigned int c2 = (unsigned int)node->getFirstRightChild(min_test.b1);
         bvt1.b1 = c1;
         bvt1.b2 = min_test.b2;
-        bvt1.d = node->BVDistanceLowerBound(bvt1.b1, bvt1.b2);
+        bvt1.d = BVDistanceLowerBound(node, bvt1.b1, bvt1.b2);
 
         bvt2.b1 = c2;
         bvt2.b2 = min_test.b2;
-        bvt2.d = node->BVDistanceLowerBound(bvt2.b1, bvt2.b2);
+        bvt2.d = BVDistanceLowerBound(node, bvt2.b1, bvt2.b2);
       } else {
         unsigned int c1 = (unsigned int)node->getSecondLeftChild(min_test.b2);
         unsigned int c2 = (unsigned int)node->getSecondRightChild(min_test.b2);
         bvt1.b1 = min_test.b1;
         bvt1.b2 = c1;
-        bvt1.d = node->BVDistanceLowerBound(bvt1.b1, bvt1.b2);
+        bvt1.d = BVDistanceLowerBound(node, bvt1.b1, bvt1.b2);
 
         bvt2.b1 = min_test.b1;
         bvt2.b2 = c2;
-        bvt2.d = node->BVDistanceLowerBound(bvt2.b1, bvt2.b2);
+        bvt2.d = BVDistanceLowerBound(node, bvt2.b1, bvt2.b2);
       }
 
       bvtq.push(bvt1);
@@ -310,6 +357,9 @@ void propagateBVHFrontListCollisionRecurse(CollisionTraversalNodeBase* node,
   Scalar sqrDistLowerBound = -1, sqrDistLowerBound1 = 0, sqrDistLowerBound2 = 0;
   BVHFrontList::iterator front_iter;
   BVHFrontList append;
+  // The new front nodes go to append, so that this loop only visits
+  // the nodes of the previous front: a leaf pair appended to front_list
+  // would be tested a second time.
   for (front_iter = front_list->begin(); front_iter != front_list->end();
        ++front_iter) {
     unsigned int b1 = front_iter->left;
@@ -318,25 +368,29 @@ void propagateBVHFrontListCollisionRecurse(CollisionTraversalNodeBase* node,
     bool l2 = node->isSecondNodeLeaf(b2);
 
     if (l1 & l2) {
-      front_iter->valid = false;  // the front node is no longer valid, in
-                                  // collideRecurse will add again.
-      collisionRecurse(node, b1, b2, &append, sqrDistLowerBound);
+      // A leaf pair stays in the front without running the narrow phase as
+      // long as its bounding volumes are disjoint.
+      if (!BVDisjoints(node, b1, b2, sqrDistLowerBound)) {
+        front_iter->valid = false;  // the front node is no longer valid, in
+                                    // collideRecurse will add again.
+        collisionRecurse(node, b1, b2, &append, sqrDistLowerBound);
+      }
     } else {
-      if (!node->BVDisjoints(b1, b2, sqrDistLowerBound)) {
+      if (!BVDisjoints(node, b1, b2, sqrDistLowerBound)) {
         front_iter->valid = false;
         if (node->firstOverSecond(b1, b2)) {
           unsigned int c1 = (unsigned int)node->getFirstLeftChild(b1);
           unsigned int c2 = (unsigned int)node->getFirstRightChild(b1);
 
-          collisionRecurse(node, c1, b2, front_list, sqrDistLowerBound1);
-          collisionRecurse(node, c2, b2, front_list, sqrDistLowerBound2);
+          collisionRecurse(node, c1, b2, &append, sqrDistLowerBound1);
+          collisionRecurse(node, c2, b2, &append, sqrDistLowerBound2);
           sqrDistLowerBound = std::min(sqrDistLowerBound1, sqrDistLowerBound2);
         } else {
           unsigned int c1 = (unsigned int)node->getSecondLeftChild(b2);
           unsigned int c2 = (unsigned int)node->getSecondRightChild(b2);
 
-          collisionRecurse(node, b1, c1, front_list, sqrDistLowerBound1);
-          collisionRecurse(node, b1, c2, front_list, sqrDistLowerBound2);
+          collisionRecurse(node, b1, c1, &append, sqrDistLowerBound1);
+          collisionRecurse(node, b1, c2, &append, sqrDistLowerBound2);
           sqrDistLowerBound = std::min(sqrDistLowerBound1, sqrDistLowerBound2);
         }
       }
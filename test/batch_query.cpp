@@ -0,0 +1,187 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE COAL_BATCH_QUERY
+#include <boost/test/included/unit_test.hpp>
+
+#include "coal/collision.h"
+#include "coal/distance.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/shape/geometric_shapes.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+namespace {
+
+/// Build a set of pairs mixing several node types, including a mesh so that
+/// both the swapped and the non swapped dispatch paths are exercised.
+void makeScene(std::vector<CollisionGeometryPtr_t>& geoms,
+               std::vector<GeometryPair>& pairs, std::size_t n) {
+  const NODE_TYPE node_types[] = {GEOM_BOX,      GEOM_SPHERE, GEOM_CAPSULE,
+                                  GEOM_CYLINDER, GEOM_CONVEX, GEOM_ELLIPSOID};
+  const std::size_t num_node_types = sizeof(node_types) / sizeof(NODE_TYPE);
+  for (std::size_t i = 0; i < num_node_types; ++i)
+    geoms.push_back(makeRandomGeometry(node_types[i]));
+
+  shared_ptr<BVHModel<OBBRSS> > mesh(new BVHModel<OBBRSS>());
+  generateBVHModel(*mesh, Box(1, 0.5, 0.8), Transform3s());
+  geoms.push_back(mesh);
+
+  Scalar extents[] = {-1, -1, -1, 1, 1, 1};
+  std::vector<Transform3s> tf1s, tf2s;
+  generateRandomTransforms(extents, tf1s, n);
+  generateRandomTransforms(extents, tf2s, n);
+
+  pairs.clear();
+  for (std::size_t i = 0; i < n; ++i) {
+    const std::size_t i1 = static_cast<std::size_t>(rand()) % geoms.size();
+    std::size_t i2 = static_cast<std::size_t>(rand()) % geoms.size();
+    // Keep only shape-shape, shape-mesh and mesh-shape pairs.
+    if (i1 == num_node_types && i2 == num_node_types) i2 = 0;
+    pairs.push_back(
+        GeometryPair(geoms[i1].get(), tf1s[i], geoms[i2].get(), tf2s[i]));
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(batch_collide) {
+  std::vector<CollisionGeometryPtr_t> geoms;
+  std::vector<GeometryPair> pairs;
+  makeScene(geoms, pairs, 500);
+
+  CollisionRequest request;
+  request.enable_contact = true;
+  request.num_max_contacts = 4;
+
+  std::vector<CollisionResult> results(pairs.size());
+  std::size_t num_colliding = collide(pairs, request, results);
+
+  std::size_t expected_num_colliding = 0;
+  for (std::size_t i = 0; i < pairs.size(); ++i) {
+    CollisionResult result;
+    const GeometryPair& pair = pairs[i];
+    collide(pair.o1, pair.tf1, pair.o2, pair.tf2, request, result);
+    if (result.isCollision()) ++expected_num_colliding;
+
+    BOOST_CHECK_EQUAL(result.isCollision(), results[i].isCollision());
+    BOOST_CHECK_EQUAL(result.numContacts(), results[i].numContacts());
+    for (std::size_t c = 0;
+         c < (std::min)(result.numContacts(), results[i].numContacts()); ++c) {
+      const Contact& expected = result.getContact(c);
+      const Contact& contact = results[i].getContact(c);
+      BOOST_CHECK(expected.o1 == contact.o1);
+      BOOST_CHECK(expected.o2 == contact.o2);
+      BOOST_CHECK_SMALL(expected.penetration_depth - contact.penetration_depth,
+                        Scalar(1e-6));
+      BOOST_CHECK_SMALL((expected.normal - contact.normal).norm(),
+                        Scalar(1e-6));
+    }
+  }
+  BOOST_CHECK_EQUAL(num_colliding, expected_num_colliding);
+
+  // Calling twice with the same workspace gives the same results.
+  BatchCollision batch_collide;
+  std::vector<CollisionResult> results2(pairs.size());
+  batch_collide(pairs, request, results2);
+  for (std::size_t i = 0; i < pairs.size(); ++i) results2[i].clear();
+  BOOST_CHECK_EQUAL(batch_collide(pairs, request, results2), num_colliding);
+  for (std::size_t i = 0; i < pairs.size(); ++i) {
+    BOOST_CHECK_EQUAL(results2[i].numContacts(), results[i].numContacts());
+  }
+
+  // One request per pair.
+  std::vector<CollisionRequest> requests(pairs.size(), request);
+  requests[0].security_margin = -std::numeric_limits<Scalar>::infinity();
+  std::vector<CollisionResult> results3(pairs.size());
+  batch_collide(pairs, requests, results3);
+  BOOST_CHECK(!results3[0].isCollision());
+  for (std::size_t i = 1; i < pairs.size(); ++i) {
+    BOOST_CHECK_EQUAL(results3[i].numContacts(), results[i].numContacts());
+  }
+
+  // The results are resized to the number of pairs.
+  std::vector<CollisionResult> too_small(pairs.size() - 1);
+  BOOST_CHECK_EQUAL(batch_collide(pairs, request, too_small), num_colliding);
+  BOOST_CHECK_EQUAL(too_small.size(), pairs.size());
+  for (std::size_t i = 0; i < pairs.size(); ++i) {
+    BOOST_CHECK_EQUAL(too_small[i].numContacts(), results[i].numContacts());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(batch_distance) {
+  std::vector<CollisionGeometryPtr_t> geoms;
+  std::vector<GeometryPair> pairs;
+  makeScene(geoms, pairs, 500);
+
+  DistanceRequest request;
+  request.enable_nearest_points = true;
+
+  std::vector<DistanceResult> results(pairs.size());
+  distance(pairs, request, results);
+
+  for (std::size_t i = 0; i < pairs.size(); ++i) {
+    DistanceResult result;
+    const GeometryPair& pair = pairs[i];
+    distance(pair.o1, pair.tf1, pair.o2, pair.tf2, request, result);
+
+    BOOST_CHECK_SMALL(result.min_distance - results[i].min_distance,
+                      Scalar(1e-6));
+    BOOST_CHECK(result.o1 == results[i].o1);
+    BOOST_CHECK(result.o2 == results[i].o2);
+    BOOST_CHECK_SMALL(
+        (result.nearest_points[0] - results[i].nearest_points[0]).norm(),
+        Scalar(1e-6));
+    BOOST_CHECK_SMALL(
+        (result.nearest_points[1] - results[i].nearest_points[1]).norm(),
+        Scalar(1e-6));
+  }
+
+  BatchDistance batch_distance;
+  std::vector<DistanceRequest> requests(pairs.size() + 1, request);
+  BOOST_CHECK_THROW(batch_distance(pairs, requests, results),
+                    std::invalid_argument);
+
+  // The results are resized to the number of pairs.
+  std::vector<DistanceResult> too_small(1);
+  batch_distance(pairs, request, too_small);
+  BOOST_CHECK_EQUAL(too_small.size(), pairs.size());
+  for (std::size_t i = 0; i < pairs.size(); ++i) {
+    BOOST_CHECK_SMALL(too_small[i].min_distance - results[i].min_distance,
+                      Scalar(1e-6));
+  }
+}
@@ -0,0 +1,137 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <iostream>
+
+#include "coal/collision.h"
+#include "coal/distance.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/shape/geometric_shapes.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+// Compares the per-pair collide / distance calls against the batched
+// interface on a set of pairs mixing primitive shapes and meshes.
+//
+// Usage: benchmark-batch [--nb-run N]
+
+int main(int argc, char** argv) {
+  const std::size_t n = getNbRun(argc, argv, 100000);
+
+  std::vector<CollisionGeometryPtr_t> geoms;
+  const NODE_TYPE node_types[] = {GEOM_BOX,      GEOM_SPHERE, GEOM_CAPSULE,
+                                  GEOM_CYLINDER, GEOM_CONVEX, GEOM_ELLIPSOID};
+  const std::size_t num_node_types = sizeof(node_types) / sizeof(NODE_TYPE);
+  for (std::size_t i = 0; i < num_node_types; ++i)
+    geoms.push_back(makeRandomGeometry(node_types[i]));
+  shared_ptr<BVHModel<OBBRSS> > mesh(new BVHModel<OBBRSS>());
+  generateBVHModel(*mesh, Sphere(0.5), Transform3s(), 16, 16);
+  geoms.push_back(mesh);
+
+  Scalar extents[] = {-2, -2, -2, 2, 2, 2};
+  std::vector<Transform3s> tf1s, tf2s;
+  generateRandomTransforms(extents, tf1s, n);
+  generateRandomTransforms(extents, tf2s, n);
+
+  std::vector<GeometryPair> pairs;
+  pairs.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const std::size_t i1 = static_cast<std::size_t>(rand()) % geoms.size();
+    std::size_t i2 = static_cast<std::size_t>(rand()) % geoms.size();
+    if (i1 == num_node_types && i2 == num_node_types) i2 = 0;
+    pairs.push_back(
+        GeometryPair(geoms[i1].get(), tf1s[i], geoms[i2].get(), tf2s[i]));
+  }
+
+  BenchTimer timer;
+  std::size_t num_colliding;
+
+  // Collision
+  CollisionRequest col_request;
+  std::vector<CollisionResult> col_results(n);
+
+  num_colliding = 0;
+  timer.start();
+  for (std::size_t i = 0; i < n; ++i) {
+    col_results[i].clear();
+    if (collide(pairs[i].o1, pairs[i].tf1, pairs[i].o2, pairs[i].tf2,
+                col_request, col_results[i]))
+      ++num_colliding;
+  }
+  timer.stop();
+  const double per_pair_collide = timer.getElapsedTimeInMicroSec();
+  std::cout << "collide (per pair):  " << per_pair_collide / double(n)
+            << " us/pair, " << num_colliding << " colliding pairs\n";
+
+  BatchCollision batch_collide;
+  for (std::size_t i = 0; i < n; ++i) col_results[i].clear();
+  timer.start();
+  num_colliding = batch_collide(pairs, col_request, col_results);
+  timer.stop();
+  const double batch_collide_time = timer.getElapsedTimeInMicroSec();
+  std::cout << "collide (batched):   " << batch_collide_time / double(n)
+            << " us/pair, " << num_colliding << " colliding pairs\n";
+
+  // Distance
+  DistanceRequest dist_request;
+  std::vector<DistanceResult> dist_results(n);
+
+  timer.start();
+  for (std::size_t i = 0; i < n; ++i) {
+    dist_results[i].clear();
+    distance(pairs[i].o1, pairs[i].tf1, pairs[i].o2, pairs[i].tf2,
+             dist_request, dist_results[i]);
+  }
+  timer.stop();
+  const double per_pair_distance = timer.getElapsedTimeInMicroSec();
+  std::cout << "distance (per pair): " << per_pair_distance / double(n)
+            << " us/pair\n";
+
+  BatchDistance batch_distance;
+  for (std::size_t i = 0; i < n; ++i) dist_results[i].clear();
+  timer.start();
+  batch_distance(pairs, dist_request, dist_results);
+  timer.stop();
+  const double batch_distance_time = timer.getElapsedTimeInMicroSec();
+  std::cout << "distance (batched):  " << batch_distance_time / double(n)
+            << " us/pair\n";
+
+  std::cout << "\nSpeed-up: collide x" << per_pair_collide / batch_collide_time
+            << ", distance x" << per_pair_distance / batch_distance_time
+            << std::endl;
+  return 0;
+}
@@ -0,0 +1,145 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <iostream>
+#include <iomanip>
+
+#include "coal/collision.h"
+#include "coal/narrowphase/narrowphase.h"
+#include "coal/shape/geometric_shapes.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+// Compares the box-box collision based on the separating axis test, which
+// returns a contact manifold, to GJK and EPA, under the conditions of
+// test/box_box_collision.cpp: two unit cubes, with the cached GJK guess
+// enabled and a distance upper bound of 1e-6.
+//
+// Usage: benchmark-box-box [--nb-run N]
+
+namespace {
+
+CollisionRequest makeRequest(std::size_t num_max_contacts) {
+  CollisionRequest request(CONTACT, num_max_contacts);
+  request.enable_cached_gjk_guess = true;
+  request.distance_upper_bound = Scalar(1e-6);
+  return request;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t n = getNbRun(argc, argv, 100000);
+
+  const Box box1(1, 1, 1);
+  const Box box2(1, 1, 1);
+  Scalar extents[] = {-1, -1, -1, 1, 1, 1};
+  std::vector<Transform3s> tfs;
+  generateRandomTransforms(extents, tfs, n);
+  // Resting contacts of the second box on the top face of the first one.
+  std::vector<Transform3s> resting(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const Scalar angle = Scalar(3.14159) * Scalar(std::rand()) / RAND_MAX;
+    Vec3s offset(Scalar(0.6) * Vec3s::Random());
+    offset[2] = Scalar(0.999);
+    resting[i] = Transform3s(
+        Eigen::AngleAxis<Scalar>(angle, Vec3s::UnitZ()).toRotationMatrix(),
+        offset);
+  }
+
+  const char* names[] = {"random", "resting"};
+  const std::vector<Transform3s>* poses[] = {&tfs, &resting};
+  std::cout << "Timings in ns per query\n"
+            << std::setw(10) << "poses" << std::setw(12) << "GJK/EPA"
+            << std::setw(12) << "SAT" << std::setw(16) << "SAT manifold"
+            << std::setw(14) << "collisions" << std::setw(14)
+            << "contacts" << std::setw(16) << "max depth diff\n";
+  for (int k = 0; k < 2; ++k) {
+    const std::vector<Transform3s>& placements = *poses[k];
+    const CollisionRequest request = makeRequest(1);
+    const CollisionRequest request_manifold = makeRequest(4);
+
+    // GJK and EPA, as for the other pairs of shapes.
+    GJKSolver solver(request);
+    std::vector<Scalar> gjk_distances(placements.size());
+    Vec3s p1, p2, normal;
+    BenchTimer timer;
+    timer.start();
+    for (std::size_t i = 0; i < placements.size(); ++i)
+      gjk_distances[i] = solver.shapeDistance(
+          box1, Transform3s(), box2, placements[i], true, p1, p2, normal);
+    timer.stop();
+    const double gjk =
+        timer.getElapsedTimeInMicroSec() * 1e3 / double(placements.size());
+
+    std::vector<Scalar> sat_distances(placements.size());
+    CollisionResult result;
+    std::size_t num_collisions = 0;
+    timer.start();
+    for (std::size_t i = 0; i < placements.size(); ++i) {
+      result.clear();
+      num_collisions += collide(&box1, Transform3s(), &box2, placements[i],
+                                request, result);
+      sat_distances[i] = result.distance_lower_bound;
+    }
+    timer.stop();
+    const double sat =
+        timer.getElapsedTimeInMicroSec() * 1e3 / double(placements.size());
+
+    std::size_t num_contacts = 0;
+    timer.start();
+    for (std::size_t i = 0; i < placements.size(); ++i) {
+      result.clear();
+      num_contacts += collide(&box1, Transform3s(), &box2, placements[i],
+                              request_manifold, result);
+    }
+    timer.stop();
+    const double manifold =
+        timer.getElapsedTimeInMicroSec() * 1e3 / double(placements.size());
+
+    Scalar max_diff = 0;
+    for (std::size_t i = 0; i < placements.size(); ++i) {
+      if (gjk_distances[i] < 0)
+        max_diff = (std::max)(
+            max_diff, std::abs(gjk_distances[i] - sat_distances[i]));
+    }
+    std::cout << std::setw(10) << names[k] << std::setw(12) << gjk
+              << std::setw(12) << sat << std::setw(16) << manifold
+              << std::setw(14) << num_collisions << std::setw(14)
+              << num_contacts << std::setw(16) << max_diff << "\n";
+  }
+  return 0;
+}
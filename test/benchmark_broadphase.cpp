@@ -0,0 +1,216 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <iostream>
+#include <iomanip>
+
+#include "coal/broadphase/broadphase_dynamic_AABB_tree_array.h"
+#include "coal/broadphase/broadphase_wide_AABB_tree.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+// Compares DynamicAABBTreeArrayCollisionManager and
+// WideAABBTreeCollisionManager on the random scenes of the broadphase tests.
+// The callbacks only count the pairs and compute the distance between the
+// AABBs, so that the timings measure the broad phase only.
+//
+// Usage: benchmark-broadphase [--nb-run N]
+
+namespace {
+
+struct CountCallBack : CollisionCallBackBase {
+  CountCallBack() : count(0) {}
+  void init() { count = 0; }
+  bool collide(CollisionObject*, CollisionObject*) {
+    ++count;
+    return false;
+  }
+  std::size_t count;
+};
+
+struct AABBDistanceCallBack : DistanceCallBackBase {
+  AABBDistanceCallBack() : min_distance(0), count(0) {}
+  void init() {
+    min_distance = (std::numeric_limits<Scalar>::max)();
+    count = 0;
+  }
+  bool distance(CollisionObject* o1, CollisionObject* o2, Scalar& dist) {
+    ++count;
+    min_distance =
+        (std::min)(min_distance, o1->getAABB().distance(o2->getAABB()));
+    dist = min_distance;
+    return false;
+  }
+  Scalar min_distance;
+  std::size_t count;
+};
+
+struct Timings {
+  Timings()
+      : build(0),
+        self_collide(0),
+        collide(0),
+        distance(0),
+        update(0),
+        update_some(0) {}
+  double build, self_collide, collide, distance, update, update_some;
+  std::size_t num_self_pairs, num_pairs;
+};
+
+Timings run(BroadPhaseCollisionManager& manager,
+            const std::vector<CollisionObject*>& env,
+            const std::vector<CollisionObject*>& query,
+            const std::vector<Transform3s>& moves, std::size_t nb_run) {
+  Timings t;
+  BenchTimer timer;
+  for (std::size_t r = 0; r < nb_run; ++r) {
+    manager.clear();
+    timer.start();
+    manager.registerObjects(env);
+    manager.setup();
+    timer.stop();
+    t.build += timer.getElapsedTimeInMicroSec();
+
+    CountCallBack count;
+    timer.start();
+    manager.collide(&count);
+    timer.stop();
+    t.self_collide += timer.getElapsedTimeInMicroSec();
+    t.num_self_pairs = count.count;
+
+    t.num_pairs = 0;
+    timer.start();
+    for (std::size_t i = 0; i < query.size(); ++i) {
+      manager.collide(query[i], &count);
+      t.num_pairs += count.count;
+    }
+    timer.stop();
+    t.collide += timer.getElapsedTimeInMicroSec();
+
+    AABBDistanceCallBack dist;
+    timer.start();
+    for (std::size_t i = 0; i < query.size(); ++i)
+      manager.distance(query[i], &dist);
+    timer.stop();
+    t.distance += timer.getElapsedTimeInMicroSec();
+
+    // Move the objects back and forth, then update the manager.
+    for (std::size_t i = 0; i < env.size(); ++i) {
+      env[i]->setTransform(moves[i] * env[i]->getTransform());
+      env[i]->computeAABB();
+    }
+    timer.start();
+    manager.update();
+    timer.stop();
+    t.update += timer.getElapsedTimeInMicroSec();
+    for (std::size_t i = 0; i < env.size(); ++i) {
+      env[i]->setTransform(moves[i].inverseTimes(env[i]->getTransform()));
+      env[i]->computeAABB();
+    }
+
+    // Move 1% of the objects, updating the manager object by object.
+    const std::size_t num_moved = (std::max)(env.size() / 100, std::size_t(1));
+    for (std::size_t i = 0; i < num_moved; ++i) {
+      env[i]->setTransform(moves[i] * env[i]->getTransform());
+      env[i]->computeAABB();
+    }
+    timer.start();
+    for (std::size_t i = 0; i < num_moved; ++i) manager.update(env[i]);
+    timer.stop();
+    t.update_some += timer.getElapsedTimeInMicroSec();
+    for (std::size_t i = 0; i < num_moved; ++i) {
+      env[i]->setTransform(moves[i].inverseTimes(env[i]->getTransform()));
+      env[i]->computeAABB();
+    }
+    manager.update();
+  }
+  const double n = double(nb_run);
+  t.build /= n;
+  t.self_collide /= n;
+  t.collide /= n;
+  t.distance /= n;
+  t.update /= n;
+  t.update_some /= n;
+  return t;
+}
+
+void print(const char* name, const Timings& t) {
+  std::cout << std::setw(12) << name << std::setw(12) << t.build
+            << std::setw(14) << t.self_collide << std::setw(12) << t.collide
+            << std::setw(12) << t.distance << std::setw(12) << t.update
+            << std::setw(12) << t.update_some
+            << "   (" << t.num_self_pairs << " self pairs, " << t.num_pairs
+            << " query pairs)\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t nb_run = getNbRun(argc, argv, 20);
+
+  const Scalar env_scales[] = {200, 2000};
+  const std::size_t env_sizes[] = {100, 1000, 5000};
+  const std::size_t query_size = 100;
+  Scalar move_extents[] = {-1, -1, -1, 1, 1, 1};
+
+  std::cout << "Timings in us, averaged over " << nb_run << " runs\n";
+  for (std::size_t s = 0; s < sizeof(env_scales) / sizeof(Scalar); ++s) {
+    for (std::size_t k = 0; k < sizeof(env_sizes) / sizeof(std::size_t);
+         ++k) {
+      std::vector<CollisionObject*> env, query;
+      generateEnvironments(env, env_scales[s], env_sizes[k]);
+      generateEnvironments(query, env_scales[s], query_size);
+      std::vector<Transform3s> moves;
+      generateRandomTransforms(move_extents, moves, env.size());
+
+      std::cout << "\nscale " << env_scales[s] << ", " << env.size()
+                << " objects\n"
+                << std::setw(12) << "manager" << std::setw(12) << "build"
+                << std::setw(14) << "self collide" << std::setw(12)
+                << "collide" << std::setw(12) << "distance" << std::setw(12)
+                << "update" << std::setw(12) << "update 1%\n";
+
+      DynamicAABBTreeArrayCollisionManager array_manager;
+      WideAABBTreeCollisionManager wide_manager;
+      print("tree array", run(array_manager, env, query, moves, nb_run));
+      print("wide tree", run(wide_manager, env, query, moves, nb_run));
+
+      for (std::size_t i = 0; i < env.size(); ++i) delete env[i];
+      for (std::size_t i = 0; i < query.size(); ++i) delete query[i];
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,158 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <iostream>
+
+#include "coal/collision.h"
+#include "coal/distance.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/shape/geometric_shapes.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
+#include "coal/internal/BV_splitter.h"
+#include "coal/internal/parallel.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+// Compares the construction of a BVHModel with the mean split rule and with
+// the binned SAH split rule, serially and in parallel, and the time of
+// mesh-mesh queries on the resulting hierarchies.
+//
+// The mesh is a finely tessellated sphere crossed by a coarse, long cylinder,
+// so that the triangles have very different sizes.
+//
+// Usage: benchmark-bvh-build [--nb-run N]
+
+typedef BVHModel<OBBRSS> Model;
+
+void appendMesh(const BVHModelBase& part, std::vector<Vec3s>& vertices,
+                std::vector<Triangle32>& triangles) {
+  const Triangle32::IndexType offset =
+      static_cast<Triangle32::IndexType>(vertices.size());
+  vertices.insert(vertices.end(), part.vertices->begin(),
+                  part.vertices->end());
+  for (std::size_t i = 0; i < part.tri_indices->size(); ++i) {
+    const Triangle32& t = (*part.tri_indices)[i];
+    triangles.push_back(
+        Triangle32(t[0] + offset, t[1] + offset, t[2] + offset));
+  }
+}
+
+shared_ptr<Model> buildModel(const std::vector<Vec3s>& vertices,
+                             const std::vector<Triangle32>& triangles,
+                             SplitMethodType split_method,
+                             std::size_t num_threads, double& build_time) {
+  shared_ptr<Model> model(new Model);
+  model->bv_splitter.reset(new BVSplitter<OBBRSS>(split_method));
+  model->num_build_threads = num_threads;
+  BenchTimer timer;
+  timer.start();
+  model->beginModel(static_cast<unsigned int>(triangles.size()),
+                    static_cast<unsigned int>(vertices.size()));
+  model->addSubModel(vertices, triangles);
+  model->endModel();
+  timer.stop();
+  build_time = timer.getElapsedTimeInMilliSec();
+  return model;
+}
+
+void benchmarkQueries(const char* name, const Model& model,
+                      const std::vector<Transform3s>& transforms) {
+  BenchTimer timer;
+  CollisionRequest col_request;
+  std::size_t num_colliding = 0;
+  timer.start();
+  for (std::size_t i = 0; i < transforms.size(); ++i) {
+    CollisionResult result;
+    if (collide(&model, Transform3s(), &model, transforms[i], col_request,
+                result))
+      ++num_colliding;
+  }
+  timer.stop();
+  const double collide_time = timer.getElapsedTimeInMicroSec();
+
+  DistanceRequest dist_request;
+  timer.start();
+  for (std::size_t i = 0; i < transforms.size(); ++i) {
+    DistanceResult result;
+    distance(&model, Transform3s(), &model, transforms[i], dist_request,
+             result);
+  }
+  timer.stop();
+  const double distance_time = timer.getElapsedTimeInMicroSec();
+
+  const double n = double(transforms.size());
+  std::cout << name << ": collide " << collide_time / n << " us/query ("
+            << num_colliding << " colliding), distance " << distance_time / n
+            << " us/query\n";
+}
+
+int main(int argc, char** argv) {
+  const std::size_t n = getNbRun(argc, argv, 1000);
+
+  std::vector<Vec3s> vertices;
+  std::vector<Triangle32> triangles;
+  {
+    Model sphere, cylinder;
+    generateBVHModel(sphere, Sphere(1), Transform3s(), 256, 256);
+    generateBVHModel(cylinder, Cylinder(0.05, 6), Transform3s(), 8, 2);
+    appendMesh(sphere, vertices, triangles);
+    appendMesh(cylinder, vertices, triangles);
+  }
+  const std::size_t num_threads = internal::getNumThreads(0);
+  std::cout << triangles.size() << " triangles, " << num_threads
+            << " hardware threads\n\n";
+
+  double mean_time, sah_time, mean_parallel_time, sah_parallel_time;
+  shared_ptr<Model> mean_model =
+      buildModel(vertices, triangles, SPLIT_METHOD_MEAN, 1, mean_time);
+  shared_ptr<Model> sah_model =
+      buildModel(vertices, triangles, SPLIT_METHOD_BINNED_SAH, 1, sah_time);
+  buildModel(vertices, triangles, SPLIT_METHOD_MEAN, 0, mean_parallel_time);
+  buildModel(vertices, triangles, SPLIT_METHOD_BINNED_SAH, 0,
+             sah_parallel_time);
+
+  std::cout << "build mean (serial):      " << mean_time << " ms\n"
+            << "build mean (parallel):    " << mean_parallel_time << " ms\n"
+            << "build SAH (serial):       " << sah_time << " ms\n"
+            << "build SAH (parallel):     " << sah_parallel_time << " ms\n\n";
+
+  Scalar extents[] = {-3, -3, -3, 3, 3, 3};
+  std::vector<Transform3s> transforms;
+  generateRandomTransforms(extents, transforms, n);
+  benchmarkQueries("mean", *mean_model, transforms);
+  benchmarkQueries("SAH ", *sah_model, transforms);
+  return 0;
+}
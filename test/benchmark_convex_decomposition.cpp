@@ -0,0 +1,166 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "coal/collision.h"
+#include "coal/compound.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/shape/convex_decomposition.h"
+#include "coal/shape/geometric_shapes.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+// Collides a torus mesh, and the compound of its convex decomposition, with
+// a box and with the same torus at random placements around the torus. Prints
+// the time per query and how often the compound and the mesh disagree.
+//
+// Usage: benchmark-convex-decomposition [--nb-run N]
+// where N is the number of placements.
+
+namespace {
+
+shared_ptr<BVHModel<OBBRSS>> makeTorus(Scalar R, Scalar r, unsigned int nu,
+                                       unsigned int nv) {
+  std::vector<Vec3s> vertices;
+  std::vector<Triangle32> triangles;
+  for (unsigned int i = 0; i < nu; ++i) {
+    const Scalar u = Scalar(2 * M_PI) * Scalar(i) / Scalar(nu);
+    for (unsigned int j = 0; j < nv; ++j) {
+      const Scalar v = Scalar(2 * M_PI) * Scalar(j) / Scalar(nv);
+      vertices.push_back(Vec3s((R + r * std::cos(v)) * std::cos(u),
+                               (R + r * std::cos(v)) * std::sin(u),
+                               r * std::sin(v)));
+    }
+  }
+  for (unsigned int i = 0; i < nu; ++i) {
+    for (unsigned int j = 0; j < nv; ++j) {
+      const unsigned int a = i * nv + j, b = ((i + 1) % nu) * nv + j,
+                         c = ((i + 1) % nu) * nv + (j + 1) % nv,
+                         d = i * nv + (j + 1) % nv;
+      triangles.push_back(Triangle32(a, b, c));
+      triangles.push_back(Triangle32(a, c, d));
+    }
+  }
+  shared_ptr<BVHModel<OBBRSS>> model(new BVHModel<OBBRSS>);
+  model->beginModel();
+  model->addSubModel(vertices, triangles);
+  model->endModel();
+  model->computeLocalAABB();
+  return model;
+}
+
+void run(const std::string& name, const CollisionGeometry& mesh,
+         const CollisionGeometry& compound, const CollisionGeometry& other,
+         const std::vector<Transform3s>& placements) {
+  const CollisionRequest request;
+  double times[2] = {0, 0};
+  std::size_t collisions[2] = {0, 0}, mismatches = 0;
+  BenchTimer timer;
+  for (const Transform3s& placement : placements) {
+    bool collision[2];
+    for (int k = 0; k < 2; ++k) {
+      CollisionResult result;
+      timer.start();
+      collide(k == 0 ? &mesh : &compound, Transform3s(), &other, placement,
+              request, result);
+      timer.stop();
+      times[k] += timer.getElapsedTimeInMicroSec();
+      collision[k] = result.isCollision();
+      collisions[k] += collision[k];
+    }
+    mismatches += collision[0] != collision[1];
+  }
+
+  const double nd = double(placements.size());
+  std::cout << std::setw(24) << name << std::setw(12) << times[0] / nd
+            << std::setw(12) << times[1] / nd << std::setw(12) << collisions[0]
+            << std::setw(12) << collisions[1] << std::setw(12) << mismatches
+            << "\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t n = getNbRun(argc, argv, 2000);
+
+  const shared_ptr<BVHModel<OBBRSS>> torus = makeTorus(1, 0.3, 64, 32);
+  ConvexDecompositionParameters params;
+  params.num_threads = 0;
+  BenchTimer timer;
+  timer.start();
+  const Compound compound(computeConvexDecomposition(*torus, params));
+  timer.stop();
+  std::cout << "Decomposition of " << torus->num_tris << " triangles into "
+            << compound.numParts() << " parts in "
+            << timer.getElapsedTimeInMilliSec() << " ms\n";
+
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<Scalar> uniform(-1, 1);
+  std::vector<Transform3s> placements;
+  for (std::size_t i = 0; i < n; ++i) {
+    const Vec3s axis(uniform(generator), uniform(generator),
+                     uniform(generator));
+    placements.push_back(Transform3s(
+        Eigen::AngleAxis<Scalar>(Scalar(M_PI) * uniform(generator),
+                                 axis.normalized())
+            .toRotationMatrix(),
+        Vec3s(Scalar(1.5) * uniform(generator),
+              Scalar(1.5) * uniform(generator),
+              Scalar(0.5) * uniform(generator))));
+  }
+
+  std::cout << "Time in us per query, number of collisions, " << n
+            << " placements\n"
+            << std::setw(24) << "pair" << std::setw(12) << "mesh"
+            << std::setw(12) << "compound" << std::setw(12) << "coll mesh"
+            << std::setw(12) << "coll cmpd" << std::setw(12) << "mismatches"
+            << "\n"
+            << std::fixed << std::setprecision(2);
+
+  Box box(0.3, 0.2, 0.1);
+  box.computeLocalAABB();
+  run("torus-box", *torus, compound, box, placements);
+  run("torus-torus", *torus, compound, *torus, placements);
+  run("torus-compound", *torus, compound, compound, placements);
+
+  return 0;
+}
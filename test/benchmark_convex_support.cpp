@@ -0,0 +1,132 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <iostream>
+#include <iomanip>
+
+#include "coal/distance.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/narrowphase/support_functions.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+// Compares the support functions of ConvexBase: the linear scan over the
+// points, the hill climbing over the neighbors and the SIMD scan over the
+// points stored as a structure of arrays (ConvexBase::buildPointsSoA), for
+// hulls of increasing size. Also compares GJK distance queries between two
+// hulls with and without the structure of arrays.
+//
+// Usage: benchmark-convex-support [--nb-run N]
+
+namespace {
+
+template <typename ConvexType>
+double timeSupport(const ConvexBase32& convex, const std::vector<Vec3s>& dirs,
+                   Scalar& checksum) {
+  const ConvexType* shape = reinterpret_cast<const ConvexType*>(&convex);
+  details::ShapeSupportData data;
+  data.visited.assign(convex.num_points, false);
+  Vec3s support;
+  int hint = 0;
+  BenchTimer timer;
+  timer.start();
+  for (std::size_t i = 0; i < dirs.size(); ++i) {
+    details::getShapeSupport(shape, dirs[i], support, hint, data);
+    checksum += support[0];
+  }
+  timer.stop();
+  return timer.getElapsedTimeInMicroSec() * 1e3 / double(dirs.size());
+}
+
+double timeDistance(const ConvexBase32& convex,
+                    const std::vector<Transform3s>& tfs) {
+  DistanceRequest request;
+  DistanceResult result;
+  BenchTimer timer;
+  timer.start();
+  for (std::size_t i = 0; i < tfs.size(); ++i) {
+    result.clear();
+    distance(&convex, Transform3s(), &convex, tfs[i], request, result);
+  }
+  timer.stop();
+  return timer.getElapsedTimeInMicroSec() * 1e3 / double(tfs.size());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t n = getNbRun(argc, argv, 200000);
+
+  std::vector<Vec3s> dirs(n);
+  for (std::size_t i = 0; i < n; ++i) dirs[i] = Vec3s::Random();
+  Scalar extents[] = {-3, -3, -3, 3, 3, 3};
+  std::vector<Transform3s> tfs;
+  generateRandomTransforms(extents, tfs, n / 10);
+
+  Scalar checksum = 0;
+  std::cout << "Timings in ns per call\n"
+            << std::setw(10) << "vertices" << std::setw(10) << "linear"
+            << std::setw(12) << "hill climb" << std::setw(10) << "SoA"
+            << std::setw(16) << "GJK (default)" << std::setw(12)
+            << "GJK (SoA)\n";
+  const unsigned int resolutions[] = {5, 6, 8, 10, 12, 14, 16, 20, 24, 32};
+  for (std::size_t r = 0; r < sizeof(resolutions) / sizeof(unsigned int);
+       ++r) {
+    BVHModel<OBBRSS> mesh;
+    generateBVHModel(mesh, Sphere(1), Transform3s(), resolutions[r],
+                     resolutions[r]);
+    mesh.buildConvexRepresentation(false);
+    const ConvexBase32& convex = *mesh.convex;
+    shared_ptr<ConvexBase32> soa_convex(convex.deepcopy());
+    soa_convex->buildPointsSoA();
+
+    const double linear =
+        timeSupport<details::SmallConvex32>(convex, dirs, checksum);
+    const double log =
+        timeSupport<details::LargeConvex32>(convex, dirs, checksum);
+    const double soa =
+        timeSupport<details::SmallConvex32>(*soa_convex, dirs, checksum);
+    const double gjk = timeDistance(convex, tfs);
+    const double gjk_soa = timeDistance(*soa_convex, tfs);
+    std::cout << std::setw(10) << convex.num_points << std::setw(10) << linear
+              << std::setw(12) << log << std::setw(10) << soa
+              << std::setw(16) << gjk << std::setw(12) << gjk_soa << "\n";
+  }
+  // Prevents the compiler from removing the support computations.
+  std::cout << "(checksum " << checksum << ")\n";
+  return 0;
+}
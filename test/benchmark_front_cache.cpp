@@ -0,0 +1,167 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+#include "coal/collision.h"
+#include "coal/hfield.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/shape/geometric_shapes.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+// Plays back a trajectory of an object sliding over a terrain, a height field
+// or an octree, and compares the collision queries with and without a
+// TraversalFrontCache: time per query, number of bounding volume and leaf
+// tests.
+//
+// Usage: benchmark-front-cache [--nb-run N]
+// where N is the number of frames of the trajectory.
+
+namespace {
+
+Scalar terrainHeight(const Scalar x, const Scalar y) {
+  return Scalar(0.5) * std::sin(x) * std::cos(Scalar(0.7) * y);
+}
+
+/// Placement of the object at frame i: it moves by 1mm per frame, like a foot
+/// or a wheel, touching the terrain and lifting off periodically.
+Transform3s trajectory(const std::size_t i) {
+  const Scalar s = Scalar(0.001) * Scalar(i);
+  const Vec3s p(Scalar(-2) + s, Scalar(0.5) * std::sin(s), 0);
+  return Transform3s(
+      Eigen::AngleAxis<Scalar>(s, Vec3s(0, 0, 1)).toRotationMatrix(),
+      Vec3s(p[0], p[1],
+            terrainHeight(p[0], p[1]) + Scalar(0.15) +
+                Scalar(0.2) * std::sin(10 * s)));
+}
+
+void run(const std::string& name, const CollisionObject& terrain,
+         CollisionObject& object, const std::size_t n) {
+  CollisionRequest request(CONTACT, 1000);
+  request.enable_statistics = true;
+
+  double times[2] = {0, 0};
+  std::size_t bv_tests[2] = {0, 0}, leaf_tests[2] = {0, 0};
+  TraversalFrontCache cache;
+  BenchTimer timer;
+  for (std::size_t i = 0; i < n; ++i) {
+    object.setTransform(trajectory(i));
+    for (int k = 0; k < 2; ++k) {
+      CollisionResult result;
+      timer.start();
+      if (k == 0)
+        collide(&terrain, &object, request, result);
+      else
+        collide(&terrain, &object, request, result, cache);
+      timer.stop();
+      times[k] += timer.getElapsedTimeInMicroSec();
+      bv_tests[k] += result.statistics.num_bv_tests;
+      leaf_tests[k] += result.statistics.num_leaf_tests;
+    }
+  }
+
+  const double nd = double(n);
+  std::cout << std::setw(24) << name << std::setw(12) << times[0] / nd
+            << std::setw(12) << times[1] / nd << std::setw(12)
+            << double(bv_tests[0]) / nd << std::setw(12)
+            << double(bv_tests[1]) / nd << std::setw(12)
+            << double(leaf_tests[0]) / nd << std::setw(12)
+            << double(leaf_tests[1]) / nd << std::setw(10)
+            << cache.getStatistics().num_resets << "\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t n = getNbRun(argc, argv, 5000);
+  const Scalar dim = 10.;
+
+  std::cout << "Time in us, BV and leaf tests per query, " << n
+            << " frames\n"
+            << std::setw(24) << "pair" << std::setw(12) << "time"
+            << std::setw(12) << "time front" << std::setw(12) << "BV tests"
+            << std::setw(12) << "BV front" << std::setw(12) << "leaf tests"
+            << std::setw(12) << "leaf front" << std::setw(10) << "resets"
+            << "\n"
+            << std::fixed << std::setprecision(2);
+
+  CollisionObject box(make_shared<Box>(Scalar(0.4), Scalar(0.3), Scalar(0.2)));
+  CollisionObject sphere(make_shared<Sphere>(Scalar(0.2)));
+  shared_ptr<BVHModel<OBBRSS> > mesh(new BVHModel<OBBRSS>());
+  generateBVHModel(*mesh, Sphere(Scalar(0.2)), Transform3s(), 16, 16);
+  CollisionObject mesh_object(mesh);
+
+  const Eigen::DenseIndex res = 256;
+  MatrixXs heights(res, res);
+  for (Eigen::DenseIndex row = 0; row < res; ++row)
+    for (Eigen::DenseIndex col = 0; col < res; ++col)
+      heights(row, col) =
+          terrainHeight(dim * (Scalar(col) / Scalar(res - 1) - Scalar(0.5)),
+                        dim * (Scalar(0.5) - Scalar(row) / Scalar(res - 1)));
+  CollisionObject hfield_aabb(
+      make_shared<HeightField<AABB> >(dim, dim, heights, -1.));
+  CollisionObject hfield_obbrss(
+      make_shared<HeightField<OBBRSS> >(dim, dim, heights, -1.));
+
+  run("hfield<AABB>-box", hfield_aabb, box, n);
+  run("hfield<OBBRSS>-box", hfield_obbrss, box, n);
+  run("hfield<OBBRSS>-sphere", hfield_obbrss, sphere, n);
+  run("hfield<OBBRSS>-mesh", hfield_obbrss, mesh_object, n);
+
+#ifdef COAL_HAS_OCTOMAP
+  // The same terrain sampled into an octree.
+  const Eigen::DenseIndex num_points = res * res;
+  Eigen::Matrix<Scalar, Eigen::Dynamic, 3> points(num_points, 3);
+  for (Eigen::DenseIndex k = 0; k < num_points; ++k) {
+    const Scalar x = dim * (Scalar(k % res) / Scalar(res - 1) - Scalar(0.5)),
+                 y = dim * (Scalar(k / res) / Scalar(res - 1) - Scalar(0.5));
+    points.row(k) << x, y, terrainHeight(x, y);
+  }
+  OcTreePtr_t octree = makeOctree(points, Scalar(0.05));
+  octree->buildFlatTree();
+  CollisionObject octree_object(octree);
+  run("octree-box", octree_object, box, n);
+  run("octree-mesh", octree_object, mesh_object, n);
+#endif
+
+  return 0;
+}
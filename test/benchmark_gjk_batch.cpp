@@ -0,0 +1,165 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <iostream>
+#include <iomanip>
+#include <limits>
+
+#include "coal/narrowphase/narrowphase.h"
+#include "coal/shape/geometric_shapes.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+// Compares, for pairs of primitive shapes, the distances to many poses of the
+// second shape computed one by one with GJKSolver::shapeDistance, to the batch
+// GJKSolver::shapeDistance, which runs details::BatchGJK on groups of
+// details::GJK_BATCH_LANES poses.
+//
+// Usage: benchmark-gjk-batch [--nb-run N]
+
+namespace {
+
+/// Time in ns per pose of the scalar queries. The sum of the distances is
+/// added to checksum.
+template <typename S1, typename S2>
+double runScalar(const S1& s1, const S2& s2,
+                 const std::vector<Transform3s>& tfs, Scalar& checksum) {
+  GJKSolver solver;
+  const Transform3s tf1;
+  Vec3s p1, p2, normal;
+
+  BenchTimer timer;
+  timer.start();
+  for (std::size_t i = 0; i < tfs.size(); ++i) {
+    checksum += solver.shapeDistance(s1, tf1, s2, tfs[i], true, p1, p2,
+                                     normal);
+  }
+  timer.stop();
+  return timer.getElapsedTimeInMicroSec() * 1e3 / double(tfs.size());
+}
+
+/// Time in ns per pose of the batch query.
+template <typename S1, typename S2>
+double runBatch(const S1& s1, const S2& s2,
+                const std::vector<Transform3s>& tfs, Scalar& checksum) {
+  GJKSolver solver;
+  solver.enable_batch_gjk = true;
+  const Transform3s tf1;
+  std::vector<Scalar> distances;
+  std::vector<Vec3s> p1s, p2s, normals;
+
+  BenchTimer timer;
+  timer.start();
+  solver.shapeDistance(s1, tf1, s2, tfs, true, distances, p1s, p2s, normals);
+  timer.stop();
+  for (std::size_t i = 0; i < distances.size(); ++i) checksum += distances[i];
+  return timer.getElapsedTimeInMicroSec() * 1e3 / double(tfs.size());
+}
+
+template <typename S1, typename S2>
+void runPair(const char* name, const S1& s1, const S2& s2,
+             const std::vector<Transform3s>& tfs) {
+  // Best of a few alternated runs, to reduce the noise of the timings.
+  double scalar = std::numeric_limits<double>::max();
+  double batch = std::numeric_limits<double>::max();
+  Scalar checksum = 0, checksum_batch = 0;
+  for (int k = 0; k < 5; ++k) {
+    scalar = (std::min)(scalar, runScalar(s1, s2, tfs, checksum));
+    batch = (std::min)(batch, runBatch(s1, s2, tfs, checksum_batch));
+  }
+  std::cout << std::setw(22) << name << std::setw(12) << scalar
+            << std::setw(12) << batch << std::setw(10) << scalar / batch
+            << std::setw(15)
+            << std::abs(checksum - checksum_batch) / Scalar(5 * tfs.size())
+            << "\n";
+}
+
+void runPairs(const std::vector<Transform3s>& tfs) {
+  const Box box(1, Scalar(0.5), 2);
+  const Sphere sphere(Scalar(0.7));
+  const Capsule capsule(Scalar(0.3), Scalar(1.5));
+  const Cylinder cylinder(Scalar(0.5), 1);
+  const Cone cone(Scalar(0.5), 1);
+  const Ellipsoid ellipsoid(Scalar(0.4), Scalar(0.6), Scalar(0.8));
+  const TriangleP triangle(Vec3s(0, 0, 0), Vec3s(1, 0, 0), Vec3s(0, 1, 0));
+
+  std::cout << std::setw(22) << "pair" << std::setw(12) << "scalar"
+            << std::setw(12) << "batch" << std::setw(10) << "speedup"
+            << std::setw(16) << "mean diff\n";
+  runPair("box-box", box, box, tfs);
+  runPair("box-sphere", box, sphere, tfs);
+  runPair("box-capsule", box, capsule, tfs);
+  runPair("box-cylinder", box, cylinder, tfs);
+  runPair("capsule-capsule", capsule, capsule, tfs);
+  runPair("cylinder-cylinder", cylinder, cylinder, tfs);
+  runPair("cone-cylinder", cone, cylinder, tfs);
+  runPair("ellipsoid-box", ellipsoid, box, tfs);
+  runPair("triangle-box", triangle, box, tfs);
+}
+
+/// Poses along a random walk in [-4, 4]^3: the poses of a batch are close to
+/// each other, so that its lanes need about the same number of iterations.
+std::vector<Transform3s> randomWalk(std::size_t n) {
+  std::vector<Transform3s> tfs(n);
+  Vec3s t(2, 0, 0);
+  Quats q(Quats::Identity());
+  for (std::size_t i = 0; i < n; ++i) {
+    t = (t + Scalar(0.01) * Vec3s::Random()).cwiseMax(-4).cwiseMin(4);
+    q = (q * Quats(AngleAxis(Scalar(0.01), Vec3s::Random().normalized())))
+            .normalized();
+    tfs[i] = Transform3s(q, t);
+  }
+  return tfs;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t n = getNbRun(argc, argv, 100000);
+
+  std::cout << "Timings in ns per pose, with " << details::GJK_BATCH_LANES
+            << " lanes\n";
+
+  // Mostly separated poses: the batch only helps when GJK alone concludes.
+  Scalar extents[] = {-4, -4, -4, 4, 4, 4};
+  std::vector<Transform3s> tfs;
+  generateRandomTransforms(extents, tfs, n);
+  std::cout << "Random poses\n";
+  runPairs(tfs);
+
+  std::cout << "Poses along a random walk\n";
+  runPairs(randomWalk(n));
+  return 0;
+}
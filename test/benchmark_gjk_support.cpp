@@ -0,0 +1,146 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <limits>
+
+#include "coal/narrowphase/gjk.h"
+#include "coal/narrowphase/narrowphase_defaults.h"
+#include "coal/shape/geometric_shapes.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+// Compares, for each pair of primitive shapes, GJK and EPA calling the support
+// function through MinkowskiDiff::getSupportFunc to their instantiations with
+// the support function of the pair known at compile time, which
+// GJKSolver::runGJKAndEPA uses.
+//
+// Usage: benchmark-gjk-support [--nb-run N]
+
+namespace {
+
+typedef details::SupportOptions SupportOptions;
+
+/// Runs GJK, and EPA when the shapes collide, for each pose and returns the
+/// time in ns per query. The sum of the distances is added to checksum.
+template <bool Specialized, typename S0, typename S1>
+double run(const S0& s0, const S1& s1, const std::vector<Transform3s>& tfs,
+           Scalar& checksum) {
+  details::MinkowskiDiff shape;
+  details::GJK gjk(GJK_DEFAULT_MAX_ITERATIONS, GJK_DEFAULT_TOLERANCE);
+  details::EPA epa(EPA_DEFAULT_MAX_ITERATIONS, EPA_DEFAULT_TOLERANCE);
+  const Vec3ps guess(1, 0, 0);
+
+  BenchTimer timer;
+  timer.start();
+  for (std::size_t i = 0; i < tfs.size(); ++i) {
+    shape.set<SupportOptions::NoSweptSphere>(&s0, &s1, Transform3s(), tfs[i]);
+    gjk.reset(GJK_DEFAULT_MAX_ITERATIONS, GJK_DEFAULT_TOLERANCE);
+    details::GJK::Status status;
+    if (Specialized)
+      status = gjk.evaluate<details::getSupportFuncTpl<
+          S0, S1, false, SupportOptions::NoSweptSphere> >(shape, guess);
+    else
+      status = gjk.evaluate(shape, guess);
+    if (status == details::GJK::Collision) {
+      epa.reset(EPA_DEFAULT_MAX_ITERATIONS, EPA_DEFAULT_TOLERANCE);
+      if (Specialized)
+        epa.evaluate<details::getSupportFuncTpl<
+            S0, S1, false, SupportOptions::NoSweptSphere> >(gjk, -guess);
+      else
+        epa.evaluate(gjk, -guess);
+      checksum -= Scalar(epa.depth);
+    } else {
+      checksum += Scalar(gjk.distance);
+    }
+  }
+  timer.stop();
+  return timer.getElapsedTimeInMicroSec() * 1e3 / double(tfs.size());
+}
+
+template <typename S0, typename S1>
+void runPair(const char* name, const S0& s0, const S1& s1,
+             const std::vector<Transform3s>& tfs) {
+  // Best of a few alternated runs, to reduce the noise of the timings.
+  double dynamic = std::numeric_limits<double>::max();
+  double specialized = std::numeric_limits<double>::max();
+  Scalar checksum = 0, checksum_tpl = 0;
+  for (int k = 0; k < 5; ++k) {
+    dynamic = (std::min)(dynamic, run<false>(s0, s1, tfs, checksum));
+    specialized = (std::min)(specialized, run<true>(s0, s1, tfs, checksum_tpl));
+  }
+  std::cout << std::setw(22) << name << std::setw(14) << dynamic
+            << std::setw(14) << specialized << std::setw(10)
+            << dynamic / specialized << std::setw(15)
+            << std::abs(checksum - checksum_tpl) << "\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t n = getNbRun(argc, argv, 100000);
+
+  const Box box(1, Scalar(0.5), 2);
+  const Sphere sphere(Scalar(0.7));
+  const Capsule capsule(Scalar(0.3), Scalar(1.5));
+  const Cylinder cylinder(Scalar(0.5), 1);
+  const Cone cone(Scalar(0.5), 1);
+  const Ellipsoid ellipsoid(Scalar(0.4), Scalar(0.6), Scalar(0.8));
+  const TriangleP triangle(Vec3s(0, 0, 0), Vec3s(1, 0, 0), Vec3s(0, 1, 0));
+
+  Scalar extents[] = {-2, -2, -2, 2, 2, 2};
+  std::vector<Transform3s> tfs;
+  generateRandomTransforms(extents, tfs, n);
+
+  std::cout << "Timings in ns per query (GJK, and EPA in collision)\n"
+            << std::setw(22) << "pair" << std::setw(14) << "fn pointer"
+            << std::setw(14) << "specialized" << std::setw(10) << "speedup"
+            << std::setw(16) << "checksum diff\n";
+  runPair("box-box", box, box, tfs);
+  runPair("box-sphere", box, sphere, tfs);
+  runPair("box-capsule", box, capsule, tfs);
+  runPair("box-cylinder", box, cylinder, tfs);
+  runPair("sphere-capsule", sphere, capsule, tfs);
+  runPair("capsule-capsule", capsule, capsule, tfs);
+  runPair("capsule-cylinder", capsule, cylinder, tfs);
+  runPair("cylinder-cylinder", cylinder, cylinder, tfs);
+  runPair("cone-cylinder", cone, cylinder, tfs);
+  runPair("ellipsoid-box", ellipsoid, box, tfs);
+  runPair("triangle-box", triangle, box, tfs);
+  runPair("triangle-capsule", triangle, capsule, tfs);
+  return 0;
+}
@@ -0,0 +1,176 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+
+#include "coal/collision.h"
+#include "coal/distance.h"
+#include "coal/hfield.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+// Compares the collision and distance queries between a height field and a
+// mesh to the same queries on the height field triangulated into a BVHModel,
+// which was the only way to handle this pair before. The mesh is a small
+// sphere placed close to the surface of a 10m x 10m terrain.
+//
+// Usage: benchmark-hfield-mesh [--nb-run N]
+
+namespace {
+
+Scalar terrainHeight(const Scalar x, const Scalar y) {
+  return Scalar(0.5) * std::sin(x) * std::cos(Scalar(0.7) * y);
+}
+
+double timePerQuery(BenchTimer& timer, const std::size_t n) {
+  return timer.getElapsedTimeInMicroSec() / double(n);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t n = getNbRun(argc, argv, 2000);
+  const Scalar dim = 10.;
+
+  BVHModel<OBBRSS> mesh;
+  generateBVHModel(mesh, Sphere(0.1), Transform3s(), 16, 16);
+
+  std::cout << "Build times in ms, memory in kB, query times in us\n"
+            << std::setw(8) << "grid" << std::setw(20) << "build hf/tri"
+            << std::setw(20) << "memory hf/tri" << std::setw(20)
+            << "collide hf/tri" << std::setw(20) << "distance hf/tri"
+            << std::setw(20) << "collisions hf/tri"
+            << "\n";
+
+  const Eigen::DenseIndex resolutions[] = {32, 128, 512};
+  for (const Eigen::DenseIndex res : resolutions) {
+    MatrixXs heights(res, res);
+    for (Eigen::DenseIndex row = 0; row < res; ++row)
+      for (Eigen::DenseIndex col = 0; col < res; ++col)
+        heights(row, col) =
+            terrainHeight(dim * (Scalar(col) / Scalar(res - 1) - Scalar(0.5)),
+                          dim * (Scalar(0.5) - Scalar(row) / Scalar(res - 1)));
+
+    BenchTimer timer;
+    timer.start();
+    const HeightField<OBBRSS> hfield(dim, dim, heights, -1.);
+    timer.stop();
+    const double build_hfield = timer.getElapsedTimeInMilliSec();
+
+    BVHModel<OBBRSS> terrain;
+    timer.start();
+    triangulateHeightField(hfield.getHeights(), hfield.getXGrid(),
+                           hfield.getYGrid(), terrain);
+    timer.stop();
+    const double build_terrain = timer.getElapsedTimeInMilliSec();
+
+    const double memory_hfield =
+        double(std::size_t(heights.size()) * sizeof(Scalar) +
+               std::size_t(2 * res) * sizeof(Scalar) +
+               hfield.getNodes().size() * sizeof(HFNode<OBBRSS>)) /
+        1024.;
+    const double memory_terrain =
+        double(terrain.num_vertices * sizeof(Vec3s) +
+               terrain.num_tris * sizeof(Triangle32) +
+               terrain.getNumBVs() * sizeof(BVNode<OBBRSS>)) /
+        1024.;
+
+    // Spheres close to the surface, half of them in collision.
+    std::vector<Transform3s> poses(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      const Vec3s p(Scalar(0.45) * dim * Vec3s::Random());
+      const Scalar offset = Scalar(0.2) * Scalar(std::rand()) / RAND_MAX;
+      poses[i].setTranslation(
+          Vec3s(p[0], p[1], terrainHeight(p[0], p[1]) + offset));
+    }
+
+    const CollisionRequest request;
+    CollisionResult result;
+    std::size_t collisions_hfield = 0, collisions_terrain = 0;
+    timer.start();
+    for (const Transform3s& pose : poses) {
+      result.clear();
+      collisions_hfield +=
+          collide(&hfield, Transform3s(), &mesh, pose, request, result);
+    }
+    timer.stop();
+    const double collide_hfield = timePerQuery(timer, n);
+
+    timer.start();
+    for (const Transform3s& pose : poses) {
+      result.clear();
+      collisions_terrain +=
+          collide(&terrain, Transform3s(), &mesh, pose, request, result);
+    }
+    timer.stop();
+    const double collide_terrain = timePerQuery(timer, n);
+
+    const DistanceRequest distance_request;
+    DistanceResult distance_result;
+    timer.start();
+    for (const Transform3s& pose : poses) {
+      distance_result.clear();
+      distance(&hfield, Transform3s(), &mesh, pose, distance_request,
+               distance_result);
+    }
+    timer.stop();
+    const double distance_hfield = timePerQuery(timer, n);
+
+    timer.start();
+    for (const Transform3s& pose : poses) {
+      distance_result.clear();
+      distance(&terrain, Transform3s(), &mesh, pose, distance_request,
+               distance_result);
+    }
+    timer.stop();
+    const double distance_terrain = timePerQuery(timer, n);
+
+    std::cout << std::setw(8) << res << std::setw(10) << build_hfield
+              << std::setw(10) << build_terrain << std::setw(10)
+              << memory_hfield << std::setw(10) << memory_terrain
+              << std::setw(10) << collide_hfield << std::setw(10)
+              << collide_terrain << std::setw(10) << distance_hfield
+              << std::setw(10) << distance_terrain << std::setw(10)
+              << collisions_hfield << std::setw(10) << collisions_terrain
+              << "\n";
+  }
+  return 0;
+}
@@ -0,0 +1,138 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include "coal/collision.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/shape/geometric_shapes.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+// Collides a moving sphere mesh of increasing resolution with a box and with a
+// small mesh, and compares the time per query of the queries in the frame of
+// the mesh with the former method, which copied the mesh, transformed its
+// vertices and refitted its hierarchy for each query.
+//
+// Usage: benchmark-mesh-relative-transform [--nb-run N]
+// where N is the number of random placements.
+
+namespace {
+
+/// @brief Collision as computed before the queries in the frame of the mesh.
+template <typename BV>
+void collideCopy(const BVHModel<BV>& model, const Transform3s& tf1,
+                 const CollisionGeometry* other, const Transform3s& tf2,
+                 const CollisionRequest& request, CollisionResult& result) {
+  BVHModel<BV> copy(model);
+  std::vector<Vec3s> vertices(model.num_vertices);
+  for (unsigned int i = 0; i < model.num_vertices; ++i)
+    vertices[i] = tf1.transform((*model.vertices)[i]);
+  copy.beginReplaceModel();
+  copy.replaceSubModel(vertices);
+  copy.endReplaceModel(false, false);
+  collide(&copy, Transform3s(), other, tf2, request, result);
+}
+
+template <typename BV>
+void run(const std::string& name, const unsigned int resolution,
+         const std::vector<Transform3s>& tf1s,
+         const std::vector<Transform3s>& tf2s) {
+  BVHModel<BV> model;
+  generateBVHModel(model, Sphere(1), Transform3s(), resolution, resolution);
+  const Box box(Scalar(0.5), Scalar(0.3), Scalar(0.7));
+  BVHModel<BV> small_mesh;
+  generateBVHModel(small_mesh, Sphere(Scalar(0.3)), Transform3s(), 8, 8);
+  const CollisionGeometry* others[2] = {&box, &small_mesh};
+  const char* other_names[2] = {"box", "mesh"};
+
+  CollisionRequest request(CONTACT, 1);
+  BenchTimer timer;
+  for (int o = 0; o < 2; ++o) {
+    double times[2] = {0, 0};
+    std::size_t num_collisions[2] = {0, 0};
+    for (std::size_t i = 0; i < tf1s.size(); ++i) {
+      for (int k = 0; k < 2; ++k) {
+        CollisionResult result;
+        timer.start();
+        if (k == 0)
+          collide(&model, tf1s[i], others[o], tf2s[i], request, result);
+        else
+          collideCopy(model, tf1s[i], others[o], tf2s[i], request, result);
+        timer.stop();
+        times[k] += timer.getElapsedTimeInMicroSec();
+        if (result.isCollision()) ++num_collisions[k];
+      }
+    }
+    const double nd = double(tf1s.size());
+    std::cout << std::setw(16) << name + "-" + other_names[o] << std::setw(10)
+              << model.num_tris << std::setw(12) << times[0] / nd
+              << std::setw(12) << times[1] / nd << std::setw(12)
+              << num_collisions[0] << std::setw(12) << num_collisions[1]
+              << "\n";
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t n = getNbRun(argc, argv, 1000);
+  std::vector<Transform3s> tf1s, tf2s;
+  Scalar extents[] = {-1.5, -1.5, -1.5, 1.5, 1.5, 1.5};
+  generateRandomTransforms(extents, tf1s, n);
+  generateRandomTransforms(extents, tf2s, n);
+
+  std::cout << "Time in us per query, number of collisions, " << n
+            << " placements\n"
+            << std::setw(16) << "pair" << std::setw(10) << "triangles"
+            << std::setw(12) << "mesh frame" << std::setw(12) << "copy"
+            << std::setw(12) << "coll frame" << std::setw(12) << "coll copy"
+            << "\n"
+            << std::fixed << std::setprecision(2);
+
+  const unsigned int resolutions[] = {16, 32, 64, 128};
+  for (unsigned int resolution : resolutions) {
+    run<AABB>("AABB", resolution, tf1s, tf2s);
+    run<KDOP<16> >("KDOP16", resolution, tf1s, tf2s);
+    run<KDOP<24> >("KDOP24", resolution, tf1s, tf2s);
+    run<OBBRSS>("OBBRSS", resolution, tf1s, tf2s);
+  }
+  return 0;
+}
@@ -0,0 +1,112 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <iostream>
+#include <iomanip>
+
+#include "coal/collision.h"
+#include "coal/distance.h"
+#include "coal/metrics.h"
+#include "coal/shape/geometric_shapes.h"
+#include "coal/timings.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+// Measures the overhead of recording the calls in the MetricsRegistry on
+// queries between primitive shapes, whose narrow phase is the shortest.
+//
+// Usage: benchmark-metrics [--nb-run N]
+// where N is the number of queries of each pair.
+
+namespace {
+
+/// Mean time of a query, in nanoseconds.
+double timeQueries(const CollisionGeometry* o1, const CollisionGeometry* o2,
+                   bool distance_query, std::size_t nb_run) {
+  const Transform3s tf2(Vec3s(Scalar(0.7), Scalar(0.1), 0));
+  CollisionRequest col_req;
+  DistanceRequest dist_req;
+  Timer timer;
+  for (std::size_t i = 0; i < nb_run; ++i) {
+    if (distance_query) {
+      DistanceResult res;
+      distance(o1, Transform3s(), o2, tf2, dist_req, res);
+    } else {
+      CollisionResult res;
+      collide(o1, Transform3s(), o2, tf2, col_req, res);
+    }
+  }
+  return 1e3 * timer.elapsed().user / double(nb_run);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t nb_run = getNbRun(argc, argv, 1000000);
+  MetricsRegistry& registry = MetricsRegistry::instance();
+
+  const Sphere sphere(Scalar(0.5));
+  const Capsule capsule(Scalar(0.3), Scalar(0.6));
+  const Box box(Scalar(0.4), Scalar(0.5), Scalar(0.6));
+  const struct {
+    const char* name;
+    const CollisionGeometry* o1;
+    const CollisionGeometry* o2;
+  } pairs[] = {{"sphere-sphere", &sphere, &sphere},
+               {"sphere-box", &sphere, &box},
+               {"capsule-box", &capsule, &box}};
+
+  std::cout << nb_run << " queries per pair, timings in ns per query\n"
+            << std::setw(24) << "pair" << std::setw(12) << "disabled"
+            << std::setw(12) << "enabled" << std::setw(12) << "overhead\n";
+  for (const auto& pair : pairs) {
+    for (int distance_query = 0; distance_query < 2; ++distance_query) {
+      registry.setEnabled(false);
+      const double disabled =
+          timeQueries(pair.o1, pair.o2, distance_query != 0, nb_run);
+      registry.setEnabled(true);
+      const double enabled =
+          timeQueries(pair.o1, pair.o2, distance_query != 0, nb_run);
+      std::cout << std::setw(24)
+                << std::string(pair.name) +
+                       (distance_query ? " distance" : " collide")
+                << std::setw(12) << disabled << std::setw(12) << enabled
+                << std::setw(11) << enabled - disabled << "\n";
+    }
+  }
+  registry.setEnabled(false);
+  return 0;
+}
@@ -0,0 +1,141 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <iostream>
+#include <iomanip>
+
+#include <boost/filesystem.hpp>
+
+#include "coal/BVH/BVH_model.h"
+#include "coal/collision.h"
+#include "coal/distance.h"
+#include "coal/octree.h"
+
+#include "utility.h"
+#include "fcl_resources/config.h"
+
+using namespace coal;
+
+// Compares the octomap tree and the flat tree built by OcTree::buildFlatTree
+// on random placements of the robot of fcl_resources in its environment.
+//
+// Usage: benchmark-octree [--nb-run N]
+// where N is the number of placements.
+
+int main(int argc, char** argv) {
+  const std::size_t N = getNbRun(argc, argv, 1000);
+  const Scalar resolution(10.);
+  boost::filesystem::path path(TEST_RESOURCES_DIR);
+
+  std::vector<Vec3s> pRob;
+  std::vector<Triangle32> tRob;
+  loadOBJFile((path / "rob.obj").string().c_str(), pRob, tRob);
+  BVHModel<OBBRSS> robMesh;
+  robMesh.beginModel();
+  robMesh.addSubModel(pRob, tRob);
+  robMesh.endModel();
+
+  Eigen::Matrix<Scalar, Eigen::Dynamic, 3> robPoints(pRob.size(), 3);
+  for (std::size_t i = 0; i < pRob.size(); ++i)
+    robPoints.row(static_cast<Eigen::DenseIndex>(i)) = pRob[i].transpose();
+  OcTreePtr_t robOctree = makeOctree(robPoints, resolution);
+  OcTree robFlatOctree(*robOctree);
+  robFlatOctree.buildFlatTree();
+
+  OcTree envOctree(loadOctreeFile((path / "env.octree").string(), resolution));
+  OcTree envFlatOctree(envOctree);
+  envFlatOctree.buildFlatTree();
+
+  std::vector<Transform3s> transforms;
+  Scalar extents[] = {-2000, -2000, 0, 2000, 2000, 2000};
+  generateRandomTransforms(extents, transforms, 2 * N);
+
+  // Time spent by the octomap tree and the flat tree, for mesh-octree
+  // collision, octree-mesh distance, octree-octree collision and octree-octree
+  // distance.
+  double time[2][4] = {{0, 0, 0, 0}, {0, 0, 0, 0}};
+  std::size_t num_collisions[2] = {0, 0};
+  BenchTimer timer;
+  const CollisionRequest request(CONTACT | DISTANCE_LOWER_BOUND, 1);
+  const DistanceRequest dreq;
+  for (std::size_t i = 0; i < N; ++i) {
+    const Transform3s& tf1 = transforms[2 * i];
+    const Transform3s& tf2 = transforms[2 * i + 1];
+    for (int flat = 0; flat < 2; ++flat) {
+      const OcTree* env = flat ? &envFlatOctree : &envOctree;
+      const OcTree* rob = flat ? &robFlatOctree : robOctree.get();
+
+      CollisionResult cres;
+      timer.start();
+      collide(&robMesh, tf1, env, tf2, request, cres);
+      timer.stop();
+      time[flat][0] += timer.getElapsedTimeInMicroSec();
+      if (cres.isCollision()) ++num_collisions[0];
+
+      DistanceResult dres;
+      timer.start();
+      distance(env, tf2, &robMesh, tf1, dreq, dres);
+      timer.stop();
+      time[flat][1] += timer.getElapsedTimeInMicroSec();
+
+      cres.clear();
+      timer.start();
+      collide(rob, tf1, env, tf2, request, cres);
+      timer.stop();
+      time[flat][2] += timer.getElapsedTimeInMicroSec();
+      if (cres.isCollision()) ++num_collisions[1];
+
+      dres.clear();
+      timer.start();
+      distance(rob, tf1, env, tf2, dreq, dres);
+      timer.stop();
+      time[flat][3] += timer.getElapsedTimeInMicroSec();
+    }
+  }
+
+  const char* queries[4] = {"mesh-octree collision", "octree-mesh distance",
+                            "octree-octree collision",
+                            "octree-octree distance"};
+  std::cout << N << " placements (" << num_collisions[0] / 2
+            << " mesh-octree and " << num_collisions[1] / 2
+            << " octree-octree collisions), timings in us\n"
+            << std::setw(24) << "query" << std::setw(14) << "octomap tree"
+            << std::setw(12) << "flat tree" << std::setw(10) << "speedup\n";
+  for (int k = 0; k < 4; ++k)
+    std::cout << std::setw(24) << queries[k] << std::setw(14)
+              << time[0][k] / double(N) << std::setw(12)
+              << time[1][k] / double(N) << std::setw(9)
+              << time[0][k] / time[1][k] << "\n";
+  return 0;
+}
@@ -0,0 +1,193 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <iostream>
+#include <iomanip>
+
+#include "coal/BVH/BVH_model.h"
+#include "coal/shape/geometric_shapes.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
+#include "coal/broadphase/broadphase_dynamic_AABB_tree.h"
+#include "coal/collision.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+// Plays back a trajectory of objects moving smoothly in a
+// DynamicAABBTreeCollisionManager and compares the number of GJK iterations
+// of the narrow phase with and without the GJK warm-start cache.
+//
+// Usage: benchmark-warm-start [--nb-run N]
+// where N is the number of frames of the trajectory.
+
+namespace {
+
+struct Scene {
+  std::vector<CollisionObject*> objects;
+  std::vector<Transform3s> initial_tfs;
+  /// Motion of each object between two frames.
+  std::vector<Transform3s> velocities;
+
+  ~Scene() {
+    for (std::size_t i = 0; i < objects.size(); ++i) delete objects[i];
+  }
+};
+
+/// Builds a scene of n objects, with meshes if with_meshes is true.
+void makeScene(Scene& scene, std::size_t n, bool with_meshes) {
+  shared_ptr<BVHModel<OBBRSS> > mesh(new BVHModel<OBBRSS>());
+  generateBVHModel(*mesh, Sphere(0.4), Transform3s(), 12, 12);
+  const CollisionGeometryPtr_t geoms[] = {
+      make_shared<Ellipsoid>(0.5, 0.3, 0.4), make_shared<Cylinder>(0.3, 0.8),
+      make_shared<Cone>(0.4, 0.8), make_shared<Capsule>(0.2, 0.6), mesh};
+  const std::size_t num_geoms =
+      sizeof(geoms) / sizeof(CollisionGeometryPtr_t) - (with_meshes ? 0 : 1);
+
+  Scalar extents[] = {-3, -3, -3, 3, 3, 3};
+  Scalar velocity_extents[] = {-0.02, -0.02, -0.02, 0.02, 0.02, 0.02};
+  generateRandomTransforms(extents, scene.initial_tfs, n);
+  generateRandomTransforms(velocity_extents, scene.velocities, n);
+  for (std::size_t i = 0; i < n; ++i) {
+    // Keep the rotations small so that the motion is smooth.
+    const Quats q(scene.velocities[i].getRotation());
+    scene.velocities[i].setQuatRotation(Quats::Identity().slerp(0.02, q));
+    scene.objects.push_back(
+        new CollisionObject(geoms[i % num_geoms], scene.initial_tfs[i]));
+  }
+}
+
+/// Runs the narrow phase on each pair reported by the broad phase, with its
+/// own result, and counts the contacts.
+struct WarmStartCallBack : CollisionCallBackBase {
+  explicit WarmStartCallBack(std::size_t capacity)
+      : cache(capacity), num_contacts(0) {
+    request.num_max_contacts = 1000;
+  }
+  bool collide(CollisionObject* o1, CollisionObject* o2) {
+    CollisionResult result;
+    coal::collide(o1, o2, request, result, cache);
+    num_contacts += result.numContacts();
+    return false;
+  }
+  CollisionRequest request;
+  GJKWarmStartCache cache;
+  std::size_t num_contacts;
+};
+
+struct Run {
+  GJKWarmStartCache::Statistics stats;
+  std::size_t num_contacts;
+  double time;
+};
+
+Run run(Scene& scene, std::size_t nb_frames, std::size_t capacity) {
+  for (std::size_t i = 0; i < scene.objects.size(); ++i) {
+    scene.objects[i]->setTransform(scene.initial_tfs[i]);
+    scene.objects[i]->computeAABB();
+  }
+  DynamicAABBTreeCollisionManager manager;
+  manager.registerObjects(scene.objects);
+  manager.setup();
+
+  WarmStartCallBack callback(capacity);
+
+  Run r;
+  r.time = 0;
+  BenchTimer timer;
+  for (std::size_t f = 0; f < nb_frames; ++f) {
+    for (std::size_t i = 0; i < scene.objects.size(); ++i) {
+      CollisionObject* o = scene.objects[i];
+      // Bounce back to the center when leaving the scene.
+      Transform3s& v = scene.velocities[i];
+      if (o->getTranslation().norm() > 3 &&
+          o->getTranslation().dot(v.getTranslation()) > 0)
+        v.setTranslation(-v.getTranslation());
+      o->setTransform(v * o->getTransform());
+      o->computeAABB();
+    }
+    manager.update();
+
+    timer.start();
+    manager.collide(&callback);
+    timer.stop();
+    r.time += timer.getElapsedTimeInMicroSec();
+  }
+  r.num_contacts = callback.num_contacts;
+  r.stats = callback.cache.getStatistics();
+  return r;
+}
+
+void print(const char* name, const Run& r) {
+  const GJKWarmStartCache::Statistics& s = r.stats;
+  const double num_lookups = double(s.num_hits + s.num_misses);
+  std::cout << std::setw(10) << name << std::setw(12) << s.num_gjk_calls
+            << std::setw(14) << s.num_gjk_iterations << std::setw(14)
+            << double(s.num_gjk_iterations) / double(s.num_gjk_calls)
+            << std::setw(10)
+            << (num_lookups > 0 ? double(s.num_hits) / num_lookups : 0.)
+            << std::setw(12) << r.time << "   (" << r.num_contacts
+            << " contacts)\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t nb_frames = getNbRun(argc, argv, 500);
+  const std::size_t num_objects = 100;
+
+  for (int with_meshes = 0; with_meshes < 2; ++with_meshes) {
+    Scene scene;
+    makeScene(scene, num_objects, with_meshes != 0);
+    const std::vector<Transform3s> velocities = scene.velocities;
+
+    std::cout << num_objects
+              << (with_meshes ? " shapes and meshes, " : " shapes, ")
+              << nb_frames << " frames, timings in us\n"
+              << std::setw(10) << "cache" << std::setw(12) << "GJK calls"
+              << std::setw(14) << "iterations" << std::setw(14)
+              << "iter / call" << std::setw(10) << "hit rate" << std::setw(12)
+              << "time\n";
+    const Run cold = run(scene, nb_frames, 0);
+    scene.velocities = velocities;
+    const Run warm = run(scene, nb_frames, 65536);
+    print("none", cold);
+    print("LRU", warm);
+    std::cout << "GJK iterations reduced by "
+              << 100. * (1. - double(warm.stats.num_gjk_iterations) /
+                                  double(cold.stats.num_gjk_iterations))
+              << "%\n\n";
+  }
+  return 0;
+}
@@ -45,3 +45,86 @@ BOOST_AUTO_TEST_CASE(box_box_collision) {
   res.clear();
   BOOST_CHECK(collide_functor(T1, T2, req, res) == false);
 }
+
+BOOST_AUTO_TEST_CASE(box_box_penetration_depth) {
+  Box shape1(1, Scalar(0.5), 2);
+  Box shape2(Scalar(0.8), 1, Scalar(0.3));
+  std::vector<Transform3s> transforms;
+  Scalar extents[] = {-1, -1, -1, 1, 1, 1};
+  generateRandomTransforms(extents, transforms, 1000);
+
+  CollisionRequest request(coal::CONTACT, 1);
+  coal::GJKSolver solver(request);
+  std::size_t num_collisions = 0;
+  for (std::size_t i = 0; i < transforms.size(); ++i) {
+    Vec3s p1, p2, normal;
+    const Scalar gjk_distance = solver.shapeDistance(
+        shape1, Transform3s(), shape2, transforms[i], true, p1, p2, normal);
+
+    CollisionResult res;
+    const bool collision =
+        collide(&shape1, Transform3s(), &shape2, transforms[i], request, res);
+    // Touching boxes may be classified differently.
+    if (std::abs(gjk_distance) < 1e-6) continue;
+    BOOST_CHECK_EQUAL(collision, gjk_distance < 0);
+    if (!collision) continue;
+    ++num_collisions;
+
+    const coal::Contact& contact = res.getContact(0);
+    BOOST_CHECK_CLOSE(contact.penetration_depth, gjk_distance, 1e-3);
+    BOOST_CHECK_SMALL((contact.nearest_points[1] - contact.nearest_points[0] -
+                       contact.penetration_depth * contact.normal)
+                          .norm(),
+                      1e-9);
+    // Moving the second box by the penetration depth along the normal
+    // separates the boxes.
+    Transform3s moved(transforms[i]);
+    moved.setTranslation(moved.getTranslation() -
+                         (contact.penetration_depth - 1e-4) * contact.normal);
+    res.clear();
+    BOOST_CHECK(!collide(&shape1, Transform3s(), &shape2, moved, request, res));
+  }
+  BOOST_CHECK(num_collisions > 100);
+}
+
+BOOST_AUTO_TEST_CASE(box_box_contact_manifold) {
+  Box shape1(1, 1, 1);
+  Box shape2(Scalar(0.5), Scalar(0.5), Scalar(0.5));
+
+  // Second box resting on the top face of the first one, rotated about the
+  // vertical axis.
+  const Scalar depth(1e-3);
+  const Transform3s T2(
+      Eigen::AngleAxis<Scalar>(Scalar(0.3), Vec3s::UnitZ()).toRotationMatrix(),
+      Vec3s(Scalar(0.1), Scalar(-0.05), Scalar(0.75) - depth));
+
+  CollisionRequest request(coal::CONTACT, 10);
+  CollisionResult res;
+  BOOST_CHECK_EQUAL(collide(&shape1, Transform3s(), &shape2, T2, request, res),
+                    4);
+  for (std::size_t i = 0; i < res.numContacts(); ++i) {
+    const coal::Contact& contact = res.getContact(i);
+    BOOST_CHECK(contact.normal.isApprox(Vec3s::UnitZ()));
+    BOOST_CHECK_CLOSE(contact.penetration_depth, -depth, 1e-6);
+    BOOST_CHECK_CLOSE(contact.nearest_points[0][2], 0.5, 1e-6);
+    BOOST_CHECK_CLOSE(contact.nearest_points[1][2], 0.5 - depth, 1e-6);
+  }
+
+  // The number of contacts is bounded by the request.
+  request.num_max_contacts = 2;
+  res.clear();
+  BOOST_CHECK_EQUAL(collide(&shape1, Transform3s(), &shape2, T2, request, res),
+                    2);
+
+  // Second box overhanging the first one: the incident face is clipped.
+  const Transform3s T3(Vec3s(Scalar(0.6), Scalar(0.6), Scalar(0.75) - depth));
+  request.num_max_contacts = 10;
+  res.clear();
+  BOOST_CHECK_EQUAL(collide(&shape1, Transform3s(), &shape2, T3, request, res),
+                    4);
+  for (std::size_t i = 0; i < res.numContacts(); ++i) {
+    const Vec3s& p = res.getContact(i).nearest_points[0];
+    BOOST_CHECK(p[0] >= Scalar(0.35) - 1e-9 && p[0] <= Scalar(0.5) + 1e-9);
+    BOOST_CHECK(p[1] >= Scalar(0.35) - 1e-9 && p[1] <= Scalar(0.5) + 1e-9);
+  }
+}
@@ -346,6 +346,7 @@ void broad_phase_self_distance_test(Scalar env_scale, std::size_t env_size,
 #endif
   managers.push_back(new DynamicAABBTreeCollisionManager());
   managers.push_back(new DynamicAABBTreeArrayCollisionManager());
+  managers.push_back(new WideAABBTreeCollisionManager());
 
   {
     DynamicAABBTreeCollisionManager* m = new DynamicAABBTreeCollisionManager();
@@ -495,6 +496,7 @@ void broad_phase_distance_test(Scalar env_scale, std::size_t env_size,
 #endif
   managers.push_back(new DynamicAABBTreeCollisionManager());
   managers.push_back(new DynamicAABBTreeArrayCollisionManager());
+  managers.push_back(new WideAABBTreeCollisionManager());
 
   {
     DynamicAABBTreeCollisionManager* m = new DynamicAABBTreeCollisionManager();
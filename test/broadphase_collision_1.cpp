@@ -45,6 +45,7 @@
 #include "coal/broadphase/broadphase_interval_tree.h"
 #include "coal/broadphase/broadphase_dynamic_AABB_tree.h"
 #include "coal/broadphase/broadphase_dynamic_AABB_tree_array.h"
+#include "coal/broadphase/broadphase_wide_AABB_tree.h"
 #include "coal/broadphase/default_broadphase_callbacks.h"
 #include "coal/broadphase/detail/sparse_hash_table.h"
 #include "coal/broadphase/detail/spatial_hash.h"
@@ -58,6 +59,7 @@
 #include <hash_map>
 #endif
 
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 
@@ -171,6 +173,92 @@ BOOST_AUTO_TEST_CASE(
 #endif
 }
 
+namespace {
+/// @brief Candidate pairs of a manager, each ordered by address, sorted.
+std::vector<CollisionObjectPair> sortedCandidatePairs(
+    const BroadPhaseCollisionManager& manager) {
+  std::vector<CollisionObjectPair> pairs;
+  manager.getCandidatePairs(pairs);
+  for (std::size_t i = 0; i < pairs.size(); ++i)
+    if (pairs[i].second < pairs[i].first)
+      std::swap(pairs[i].first, pairs[i].second);
+  std::sort(pairs.begin(), pairs.end());
+  return pairs;
+}
+
+/// @brief Objects whose AABB overlaps the one of query, found by
+/// manager.collide(query, callback), sorted.
+std::vector<CollisionObject*> sortedOverlaps(
+    const BroadPhaseCollisionManager& manager, CollisionObject* query) {
+  CollisionCallBackCollect collect(1000);
+  manager.collide(query, &collect);
+  std::vector<CollisionObject*> objects;
+  // NaiveCollisionManager reports all its objects.
+  for (const auto& pair : collect.getCollisionPairs()) {
+    CollisionObject* object = pair.first == query ? pair.second : pair.first;
+    if (object->getAABB().overlap(query->getAABB())) objects.push_back(object);
+  }
+  std::sort(objects.begin(), objects.end());
+  return objects;
+}
+}  // namespace
+
+/// The wide AABB tree sees registered, unregistered and moved objects
+/// without a call to setup.
+BOOST_AUTO_TEST_CASE(test_wide_AABB_tree_incremental) {
+  std::vector<CollisionObject*> env, query;
+  generateEnvironments(env, 200, 100);
+  generateEnvironments(query, 200, 10);
+
+  NaiveCollisionManager expected;
+  WideAABBTreeCollisionManager manager;
+  const std::size_t half = env.size() / 2;
+  std::vector<CollisionObject*> first_half(env.begin(),
+                                           env.begin() + (long)half);
+  expected.registerObjects(first_half);
+  manager.registerObjects(first_half);
+  manager.setup();
+  for (std::size_t i = half; i < env.size(); ++i) {
+    expected.registerObject(env[i]);
+    manager.registerObject(env[i]);
+  }
+  BOOST_CHECK_EQUAL(manager.size(), env.size());
+  BOOST_CHECK(sortedCandidatePairs(manager) == sortedCandidatePairs(expected));
+
+  for (std::size_t i = 0; i < env.size(); i += 3) {
+    expected.unregisterObject(env[i]);
+    manager.unregisterObject(env[i]);
+  }
+  BOOST_CHECK_EQUAL(manager.size(), expected.size());
+  BOOST_CHECK(sortedCandidatePairs(manager) == sortedCandidatePairs(expected));
+  for (std::size_t i = 0; i < query.size(); ++i)
+    BOOST_CHECK(sortedOverlaps(manager, query[i]) ==
+                sortedOverlaps(expected, query[i]));
+
+  // Move some of the remaining objects onto the query objects.
+  for (std::size_t i = 1; i < env.size(); i += 7) {
+    env[i]->setTransform(query[i % query.size()]->getTransform());
+    env[i]->computeAABB();
+    manager.update(env[i]);
+  }
+  BOOST_CHECK(sortedCandidatePairs(manager) == sortedCandidatePairs(expected));
+  for (std::size_t i = 0; i < query.size(); ++i)
+    BOOST_CHECK(sortedOverlaps(manager, query[i]) ==
+                sortedOverlaps(expected, query[i]));
+
+  // Rebuilding the tree does not change the pairs.
+  manager.setup();
+  BOOST_CHECK(sortedCandidatePairs(manager) == sortedCandidatePairs(expected));
+
+  for (std::size_t i = 0; i < env.size(); ++i) manager.unregisterObject(env[i]);
+  BOOST_CHECK(manager.empty());
+  manager.registerObject(env[0]);
+  BOOST_CHECK_EQUAL(manager.size(), std::size_t(1));
+
+  for (auto obj : env) delete obj;
+  for (auto obj : query) delete obj;
+}
+
 //==============================================================================
 struct CollisionDataForUniquenessChecking {
   std::set<std::pair<CollisionObject*, CollisionObject*>> checkedPairs;
@@ -231,6 +319,7 @@ void broad_phase_duplicate_check_test(Scalar env_scale, std::size_t env_size,
 #endif
   managers.push_back(new DynamicAABBTreeCollisionManager());
   managers.push_back(new DynamicAABBTreeArrayCollisionManager());
+  managers.push_back(new WideAABBTreeCollisionManager());
 
   {
     DynamicAABBTreeCollisionManager* m = new DynamicAABBTreeCollisionManager();
@@ -404,6 +493,7 @@ void broad_phase_update_collision_test(Scalar env_scale, std::size_t env_size,
 #endif
   managers.push_back(new DynamicAABBTreeCollisionManager());
   managers.push_back(new DynamicAABBTreeArrayCollisionManager());
+  managers.push_back(new WideAABBTreeCollisionManager());
 
   {
     DynamicAABBTreeCollisionManager* m = new DynamicAABBTreeCollisionManager();
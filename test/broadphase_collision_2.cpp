@@ -45,6 +45,7 @@
 #include "coal/broadphase/broadphase_interval_tree.h"
 #include "coal/broadphase/broadphase_dynamic_AABB_tree.h"
 #include "coal/broadphase/broadphase_dynamic_AABB_tree_array.h"
+#include "coal/broadphase/broadphase_wide_AABB_tree.h"
 #include "coal/broadphase/default_broadphase_callbacks.h"
 #include "coal/broadphase/detail/sparse_hash_table.h"
 #include "coal/broadphase/detail/spatial_hash.h"
@@ -234,6 +235,7 @@ void broad_phase_collision_test(Scalar env_scale, std::size_t env_size,
   managers.push_back(new DynamicAABBTreeCollisionManager());
 
   managers.push_back(new DynamicAABBTreeArrayCollisionManager());
+  managers.push_back(new WideAABBTreeCollisionManager());
 
   {
     DynamicAABBTreeCollisionManager* m = new DynamicAABBTreeCollisionManager();
@@ -0,0 +1,405 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE COAL_BROADPHASE_PARALLEL
+#include <boost/test/included/unit_test.hpp>
+
+#include "coal/broadphase/broadphase_bruteforce.h"
+#include "coal/broadphase/broadphase_spatialhash.h"
+#include "coal/broadphase/broadphase_SaP.h"
+#include "coal/broadphase/broadphase_SSaP.h"
+#include "coal/broadphase/broadphase_interval_tree.h"
+#include "coal/broadphase/broadphase_dynamic_AABB_tree.h"
+#include "coal/broadphase/broadphase_dynamic_AABB_tree_array.h"
+#include "coal/broadphase/broadphase_wide_AABB_tree.h"
+#include "coal/broadphase/default_broadphase_callbacks.h"
+#include "coal/broadphase/broadphase_narrowphase.h"
+#include "coal/broadphase/detail/sparse_hash_table.h"
+#include "coal/broadphase/detail/spatial_hash.h"
+#include "coal/collision.h"
+#include "coal/distance.h"
+#include "coal/internal/parallel.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+using namespace coal;
+
+namespace {
+
+typedef std::pair<CollisionObject*, CollisionObject*> ObjectPair;
+
+std::vector<BroadPhaseCollisionManager*> makeManagers(
+    std::vector<CollisionObject*>& env) {
+  std::vector<BroadPhaseCollisionManager*> managers;
+  managers.push_back(new NaiveCollisionManager());
+  managers.push_back(new SSaPCollisionManager());
+  managers.push_back(new SaPCollisionManager());
+  managers.push_back(new IntervalTreeCollisionManager());
+  Vec3s lower_limit, upper_limit;
+  SpatialHashingCollisionManager<>::computeBound(env, lower_limit, upper_limit);
+  Scalar cell_size = std::min(std::min((upper_limit[0] - lower_limit[0]) / 20,
+                                       (upper_limit[1] - lower_limit[1]) / 20),
+                              (upper_limit[2] - lower_limit[2]) / 20);
+  managers.push_back(
+      new SpatialHashingCollisionManager<
+          detail::SparseHashTable<AABB, CollisionObject*, detail::SpatialHash>>(
+          cell_size, lower_limit, upper_limit));
+  managers.push_back(new DynamicAABBTreeCollisionManager());
+  managers.push_back(new DynamicAABBTreeArrayCollisionManager());
+  managers.push_back(new WideAABBTreeCollisionManager());
+  {
+    DynamicAABBTreeCollisionManager* m = new DynamicAABBTreeCollisionManager();
+    m->tree_init_level = 2;
+    managers.push_back(m);
+  }
+  return managers;
+}
+
+/// Returns the collision pairs in a canonical order, so that the results of
+/// the serial and the parallel queries can be compared.
+std::vector<ObjectPair> sortedPairs(const CollisionCallBackCollect& callback) {
+  std::vector<ObjectPair> pairs(callback.getCollisionPairs());
+  for (std::size_t i = 0; i < pairs.size(); ++i)
+    if (pairs[i].second < pairs[i].first)
+      std::swap(pairs[i].first, pairs[i].second);
+  std::sort(pairs.begin(), pairs.end());
+  return pairs;
+}
+
+void deleteAll(std::vector<CollisionObject*>& objects) {
+  for (std::size_t i = 0; i < objects.size(); ++i) delete objects[i];
+  objects.clear();
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(test_parallel_self_collide) {
+  std::vector<CollisionObject*> env;
+  generateEnvironments(env, 100, 300);
+
+  std::vector<BroadPhaseCollisionManager*> managers = makeManagers(env);
+  const std::size_t max_size = env.size() * env.size();
+  for (std::size_t i = 0; i < managers.size(); ++i) {
+    managers[i]->registerObjects(env);
+    managers[i]->setup();
+
+    CollisionCallBackCollect serial(max_size), parallel(max_size);
+    serial.init();
+    parallel.init();
+    managers[i]->collide(&serial);
+    managers[i]->collideParallel(&parallel, 4);
+
+    BOOST_CHECK(serial.numCollisionPairs() > 0);
+    BOOST_CHECK(sortedPairs(serial) == sortedPairs(parallel));
+
+    // The default callback stops at the first contact: the parallel query
+    // must stop as well and report exactly one contact.
+    CollisionCallBackDefault first_contact;
+    managers[i]->collideParallel(&first_contact, 4);
+    BOOST_CHECK(first_contact.data.result.isCollision());
+    BOOST_CHECK_EQUAL(first_contact.data.result.numContacts(), 1);
+
+    CollisionCallBackDefault serial_contacts, parallel_contacts;
+    serial_contacts.data.request.num_max_contacts = max_size;
+    parallel_contacts.data.request.num_max_contacts = max_size;
+    managers[i]->collide(&serial_contacts);
+    managers[i]->collideParallel(&parallel_contacts, 4);
+    BOOST_CHECK(serial_contacts.data.result.numContacts() > 1);
+    BOOST_CHECK_EQUAL(serial_contacts.data.result.numContacts(),
+                      parallel_contacts.data.result.numContacts());
+
+    delete managers[i];
+  }
+  deleteAll(env);
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_manager_collide) {
+  std::vector<CollisionObject*> env, query;
+  generateEnvironments(env, 100, 300);
+  generateEnvironments(query, 100, 30);
+
+  std::vector<BroadPhaseCollisionManager*> managers = makeManagers(env);
+  std::vector<BroadPhaseCollisionManager*> query_managers =
+      makeManagers(query);
+  const std::size_t max_size = env.size() * query.size();
+  for (std::size_t i = 0; i < managers.size(); ++i) {
+    managers[i]->registerObjects(env);
+    managers[i]->setup();
+    query_managers[i]->registerObjects(query);
+    query_managers[i]->setup();
+
+    CollisionCallBackCollect serial(max_size);
+    serial.init();
+    managers[i]->collide(query_managers[i], &serial);
+    BOOST_CHECK(serial.numCollisionPairs() > 0);
+
+    for (std::size_t num_threads = 1; num_threads <= 8; num_threads *= 2) {
+      CollisionCallBackCollect parallel(max_size);
+      parallel.init();
+      managers[i]->collideParallel(query_managers[i], &parallel, num_threads);
+      BOOST_CHECK(sortedPairs(serial) == sortedPairs(parallel));
+    }
+
+    delete managers[i];
+    delete query_managers[i];
+  }
+  deleteAll(env);
+  deleteAll(query);
+}
+
+/// A callback which does not implement clone must still work: the parallel
+/// query falls back to the serial one.
+struct NonClonableCallBack : CollisionCallBackBase {
+  NonClonableCallBack() : count(0) {}
+  bool collide(CollisionObject*, CollisionObject*) {
+    ++count;
+    return false;
+  }
+  std::size_t count;
+};
+
+BOOST_AUTO_TEST_CASE(test_parallel_fallback) {
+  std::vector<CollisionObject*> env;
+  generateEnvironments(env, 100, 100);
+
+  DynamicAABBTreeCollisionManager manager;
+  manager.registerObjects(env);
+  manager.setup();
+
+  NonClonableCallBack serial, parallel;
+  manager.collide(&serial);
+  manager.collideParallel(&parallel, 4);
+  BOOST_CHECK(serial.count > 0);
+  BOOST_CHECK_EQUAL(serial.count, parallel.count);
+  deleteAll(env);
+}
+
+BOOST_AUTO_TEST_CASE(test_candidate_pairs) {
+  std::vector<CollisionObject*> env, query;
+  generateEnvironments(env, 100, 300);
+  generateEnvironments(query, 100, 30);
+
+  std::vector<BroadPhaseCollisionManager*> managers = makeManagers(env);
+  std::vector<BroadPhaseCollisionManager*> query_managers =
+      makeManagers(query);
+  for (std::size_t i = 0; i < managers.size(); ++i) {
+    managers[i]->registerObjects(env);
+    managers[i]->setup();
+    query_managers[i]->registerObjects(query);
+    query_managers[i]->setup();
+
+    // The candidate pairs are the pairs reported to the callback, without
+    // duplicates.
+    CollisionCallBackCollect collect(env.size() * env.size());
+    collect.init();
+    managers[i]->collide(&collect);
+    std::vector<ObjectPair> expected(sortedPairs(collect));
+    expected.erase(std::unique(expected.begin(), expected.end()),
+                   expected.end());
+
+    std::vector<CollisionObjectPair> pairs(1);
+    managers[i]->getCandidatePairs(pairs);
+    CollisionCallBackCollect candidates(pairs.size());
+    candidates.init();
+    for (std::size_t k = 0; k < pairs.size(); ++k)
+      candidates.collide(pairs[k].first, pairs[k].second);
+    BOOST_CHECK_EQUAL(pairs.size(), expected.size());
+    BOOST_CHECK(sortedPairs(candidates) == expected);
+
+    collect.init();
+    managers[i]->collide(query_managers[i], &collect);
+    expected = sortedPairs(collect);
+    expected.erase(std::unique(expected.begin(), expected.end()),
+                   expected.end());
+    managers[i]->getCandidatePairs(query_managers[i], pairs);
+    BOOST_CHECK_EQUAL(pairs.size(), expected.size());
+
+    delete managers[i];
+    delete query_managers[i];
+  }
+  deleteAll(env);
+  deleteAll(query);
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_narrowphase) {
+  std::vector<CollisionObject*> env;
+  generateEnvironments(env, 100, 100);
+
+  DynamicAABBTreeCollisionManager manager;
+  manager.registerObjects(env);
+  manager.setup();
+
+  std::vector<CollisionObjectPair> pairs;
+  manager.getCandidatePairs(pairs);
+  BOOST_REQUIRE(pairs.size() > 100);
+
+  CollisionRequest crequest;
+  DistanceRequest drequest;
+  std::vector<CollisionResult> cexpected(pairs.size());
+  std::vector<DistanceResult> dexpected(pairs.size());
+  std::size_t num_colliding = 0;
+  for (std::size_t i = 0; i < pairs.size(); ++i) {
+    if (coal::collide(pairs[i].first, pairs[i].second, crequest, cexpected[i]))
+      ++num_colliding;
+    coal::distance(pairs[i].first, pairs[i].second, drequest, dexpected[i]);
+  }
+  BOOST_CHECK(num_colliding > 0);
+
+  for (std::size_t num_threads = 1; num_threads <= 8; num_threads *= 2) {
+    std::vector<CollisionResult> cresults(3);
+    std::vector<DistanceResult> dresults;
+    BOOST_CHECK_EQUAL(collide(pairs, crequest, cresults, num_threads),
+                      num_colliding);
+    distance(pairs, drequest, dresults, num_threads);
+    BOOST_REQUIRE_EQUAL(cresults.size(), pairs.size());
+    BOOST_REQUIRE_EQUAL(dresults.size(), pairs.size());
+    for (std::size_t i = 0; i < pairs.size(); ++i) {
+      BOOST_CHECK(cresults[i] == cexpected[i]);
+      BOOST_CHECK_EQUAL(dresults[i].min_distance, dexpected[i].min_distance);
+    }
+  }
+  deleteAll(env);
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_narrowphase_cached_guess) {
+  std::vector<CollisionObject*> env;
+  generateEnvironments(env, 100, 100);
+
+  DynamicAABBTreeCollisionManager manager;
+  manager.registerObjects(env);
+  manager.setup();
+
+  std::vector<CollisionObjectPair> pairs;
+  manager.getCandidatePairs(pairs);
+  BOOST_REQUIRE(pairs.size() > 100);
+
+  // The queries write their guess back into the request: each pair must
+  // start from the guess of the caller's request, whatever the threads.
+  CollisionRequest crequest;
+  crequest.enable_cached_gjk_guess = true;
+  crequest.cached_gjk_guess = Vec3s(0, 0, 1);
+  DistanceRequest drequest;
+  drequest.enable_cached_gjk_guess = true;
+  drequest.cached_gjk_guess = Vec3s(0, 0, 1);
+
+  std::vector<CollisionResult> cexpected(pairs.size());
+  std::vector<DistanceResult> dexpected(pairs.size());
+  for (std::size_t i = 0; i < pairs.size(); ++i) {
+    CollisionRequest crequest_i(crequest);
+    coal::collide(pairs[i].first, pairs[i].second, crequest_i, cexpected[i]);
+    DistanceRequest drequest_i(drequest);
+    coal::distance(pairs[i].first, pairs[i].second, drequest_i,
+                   dexpected[i]);
+  }
+
+  for (std::size_t num_threads = 1; num_threads <= 8; num_threads *= 2) {
+    std::vector<CollisionResult> cresults;
+    std::vector<DistanceResult> dresults;
+    collide(pairs, crequest, cresults, num_threads);
+    distance(pairs, drequest, dresults, num_threads);
+    BOOST_REQUIRE_EQUAL(cresults.size(), pairs.size());
+    BOOST_REQUIRE_EQUAL(dresults.size(), pairs.size());
+    for (std::size_t i = 0; i < pairs.size(); ++i) {
+      BOOST_CHECK(cresults[i] == cexpected[i]);
+      BOOST_CHECK(cresults[i].cached_gjk_guess ==
+                  cexpected[i].cached_gjk_guess);
+      BOOST_CHECK_EQUAL(dresults[i].min_distance, dexpected[i].min_distance);
+      BOOST_CHECK(dresults[i].cached_gjk_guess ==
+                  dexpected[i].cached_gjk_guess);
+    }
+    BOOST_CHECK(crequest.cached_gjk_guess == Vec3s(0, 0, 1));
+    BOOST_CHECK(drequest.cached_gjk_guess == Vec3s(0, 0, 1));
+  }
+  deleteAll(env);
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_for) {
+  const std::size_t num_tasks = 200;
+  const std::size_t num_threads = 4;
+
+  // Each task runs once, with a thread id in [0, num_threads), and a thread
+  // id is never used by two threads at once.
+  std::vector<std::atomic<int> > busy(num_threads);
+  std::vector<int> runs(num_tasks, 0);
+  std::atomic<bool> shared_id(false);
+  for (std::size_t k = 0; k < num_threads; ++k) busy[k] = 0;
+  for (int call = 0; call < 100; ++call) {
+    internal::parallelFor(num_tasks, num_threads,
+                          [&](std::size_t task_id, std::size_t thread_id) {
+                            if (thread_id >= num_threads) {
+                              shared_id = true;
+                              return;
+                            }
+                            if (busy[thread_id].fetch_add(1) != 0)
+                              shared_id = true;
+                            ++runs[task_id];
+                            busy[thread_id].fetch_sub(1);
+                          });
+  }
+  BOOST_CHECK(!shared_id);
+  for (std::size_t i = 0; i < num_tasks; ++i) BOOST_CHECK_EQUAL(runs[i], 100);
+
+  // Nested calls, and calls from several threads at once, complete even when
+  // all the threads of the pool are busy.
+  std::atomic<std::size_t> count(0);
+  auto nested = [&count](std::size_t, std::size_t) {
+    internal::parallelFor(10, 3, [&count](std::size_t, std::size_t) {
+      internal::parallelFor(
+          5, 2, [&count](std::size_t, std::size_t) { ++count; });
+    });
+  };
+  std::vector<std::thread> callers;
+  for (std::size_t k = 0; k < 3; ++k)
+    callers.push_back(
+        std::thread([&nested] { internal::parallelFor(8, 4, nested); }));
+  for (std::size_t k = 0; k < callers.size(); ++k) callers[k].join();
+  BOOST_CHECK_EQUAL(count.load(), std::size_t(3 * 8 * 10 * 5));
+
+  // The first exception is rethrown in the calling thread, and the pool is
+  // still usable afterwards.
+  BOOST_CHECK_THROW(
+      internal::parallelFor(num_tasks, num_threads,
+                            [](std::size_t task_id, std::size_t) {
+                              if (task_id == 10) throw std::runtime_error("");
+                            }),
+      std::runtime_error);
+  count = 0;
+  internal::parallelFor(num_tasks, num_threads,
+                        [&count](std::size_t, std::size_t) { ++count; });
+  BOOST_CHECK_EQUAL(count.load(), num_tasks);
+}
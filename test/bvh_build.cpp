@@ -0,0 +1,169 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE COAL_BVH_BUILD
+#include <boost/test/included/unit_test.hpp>
+
+#include "coal/collision.h"
+#include "coal/distance.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/shape/geometric_shapes.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
+#include "coal/internal/BV_splitter.h"
+#include "utility.h"
+
+using namespace coal;
+
+template <typename BV>
+shared_ptr<BVHModel<BV> > makeSphereModel(SplitMethodType split_method,
+                                          std::size_t num_build_threads) {
+  shared_ptr<BVHModel<BV> > model(new BVHModel<BV>);
+  model->bv_splitter.reset(new BVSplitter<BV>(split_method));
+  model->num_build_threads = num_build_threads;
+  // 64 * 64 * 2 triangles, enough to trigger the parallel build.
+  generateBVHModel(*model, Sphere(1), Transform3s(), 64, 64);
+  return model;
+}
+
+template <typename BV>
+shared_ptr<BVHModel<BV> > makePointCloudModel(
+    const std::vector<Vec3s>& points, SplitMethodType split_method,
+    std::size_t num_build_threads) {
+  shared_ptr<BVHModel<BV> > model(new BVHModel<BV>);
+  model->bv_splitter.reset(new BVSplitter<BV>(split_method));
+  model->num_build_threads = num_build_threads;
+  model->beginModel(0, static_cast<unsigned int>(points.size()));
+  model->addSubModel(points);
+  model->endModel();
+  return model;
+}
+
+template <typename BV>
+void checkHierarchy(const BVHModel<BV>& model) {
+  const unsigned int num_primitives =
+      model.getModelType() == BVH_MODEL_TRIANGLES ? model.num_tris
+                                                  : model.num_vertices;
+  BOOST_REQUIRE_EQUAL(model.getNumBVs(), 2 * num_primitives - 1);
+  for (unsigned int i = 0; i < model.getNumBVs(); ++i) {
+    const BVNode<BV>& node = model.getBV(i);
+    if (node.isLeaf()) {
+      BOOST_CHECK_EQUAL(node.num_primitives, 1);
+      continue;
+    }
+    const BVNode<BV>& left = model.getBV((unsigned int)node.leftChild());
+    const BVNode<BV>& right = model.getBV((unsigned int)node.rightChild());
+    BOOST_CHECK_EQUAL(left.first_primitive, node.first_primitive);
+    BOOST_CHECK_EQUAL(right.first_primitive,
+                      node.first_primitive + left.num_primitives);
+    BOOST_CHECK_EQUAL(left.num_primitives + right.num_primitives,
+                      node.num_primitives);
+  }
+}
+
+template <typename BV>
+void testParallelBuild(SplitMethodType split_method) {
+  shared_ptr<BVHModel<BV> > serial = makeSphereModel<BV>(split_method, 1);
+  checkHierarchy(*serial);
+  for (std::size_t num_threads = 2; num_threads <= 8; num_threads *= 2) {
+    shared_ptr<BVHModel<BV> > parallel =
+        makeSphereModel<BV>(split_method, num_threads);
+    BOOST_CHECK(*serial == *parallel);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(parallel_build_matches_serial_build) {
+  const SplitMethodType methods[] = {SPLIT_METHOD_MEAN, SPLIT_METHOD_MEDIAN,
+                                     SPLIT_METHOD_BV_CENTER,
+                                     SPLIT_METHOD_BINNED_SAH};
+  for (std::size_t i = 0; i < sizeof(methods) / sizeof(methods[0]); ++i) {
+    testParallelBuild<AABB>(methods[i]);
+    testParallelBuild<OBB>(methods[i]);
+    testParallelBuild<RSS>(methods[i]);
+    testParallelBuild<kIOS>(methods[i]);
+    testParallelBuild<OBBRSS>(methods[i]);
+    testParallelBuild<KDOP<16> >(methods[i]);
+    testParallelBuild<KDOP<18> >(methods[i]);
+    testParallelBuild<KDOP<24> >(methods[i]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(parallel_build_point_cloud) {
+  std::vector<Vec3s> points(5000);
+  for (std::size_t i = 0; i < points.size(); ++i)
+    points[i] = Vec3s::Random();
+
+  shared_ptr<BVHModel<AABB> > serial =
+      makePointCloudModel<AABB>(points, SPLIT_METHOD_BINNED_SAH, 1);
+  shared_ptr<BVHModel<AABB> > parallel =
+      makePointCloudModel<AABB>(points, SPLIT_METHOD_BINNED_SAH, 4);
+  checkHierarchy(*serial);
+  BOOST_CHECK(*serial == *parallel);
+}
+
+template <typename BV>
+void testBinnedSAHQueries() {
+  shared_ptr<BVHModel<BV> > mean_model =
+      makeSphereModel<BV>(SPLIT_METHOD_MEAN, 1);
+  shared_ptr<BVHModel<BV> > sah_model =
+      makeSphereModel<BV>(SPLIT_METHOD_BINNED_SAH, 0);
+
+  std::vector<Transform3s> transforms;
+  Scalar extents[] = {-2, -2, -2, 2, 2, 2};
+  generateRandomTransforms(extents, transforms, 50);
+
+  CollisionRequest col_request;
+  DistanceRequest dist_request;
+  for (std::size_t i = 0; i < transforms.size(); ++i) {
+    CollisionResult mean_col, sah_col;
+    collide(mean_model.get(), Transform3s(), mean_model.get(), transforms[i],
+            col_request, mean_col);
+    collide(sah_model.get(), Transform3s(), sah_model.get(), transforms[i],
+            col_request, sah_col);
+    BOOST_CHECK_EQUAL(mean_col.isCollision(), sah_col.isCollision());
+
+    DistanceResult mean_dist, sah_dist;
+    distance(mean_model.get(), Transform3s(), mean_model.get(), transforms[i],
+             dist_request, mean_dist);
+    distance(sah_model.get(), Transform3s(), sah_model.get(), transforms[i],
+             dist_request, sah_dist);
+    BOOST_CHECK_CLOSE(mean_dist.min_distance, sah_dist.min_distance, 1e-6);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(binned_SAH_queries) {
+  testBinnedSAHQueries<AABB>();
+  testBinnedSAHQueries<OBBRSS>();
+  testBinnedSAHQueries<RSS>();
+  testBinnedSAHQueries<kIOS>();
+}
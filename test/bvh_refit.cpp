@@ -0,0 +1,155 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE COAL_BVH_REFIT
+#include <boost/test/included/unit_test.hpp>
+
+#include "coal/collision.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/shape/geometric_shapes.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
+#include "utility.h"
+
+using namespace coal;
+
+/// @brief Moves a random subset of the vertices of model.
+void randomMotion(const BVHModelBase& model, Scalar ratio,
+                  std::vector<unsigned int>& indices,
+                  std::vector<Vec3s>& positions) {
+  indices.clear();
+  positions.clear();
+  for (unsigned int i = 0; i < model.num_vertices; ++i) {
+    if (Scalar(rand()) / Scalar(RAND_MAX) >= ratio) continue;
+    indices.push_back(i);
+    positions.push_back((*model.vertices)[i] + 0.05 * Vec3s::Random());
+  }
+}
+
+/// @brief Applies the same motion with the update API refitting the whole
+/// hierarchy.
+void fullUpdate(BVHModelBase& model, const std::vector<unsigned int>& indices,
+                const std::vector<Vec3s>& positions) {
+  std::vector<Vec3s> vertices(*model.vertices);
+  for (std::size_t k = 0; k < indices.size(); ++k)
+    vertices[indices[k]] = positions[k];
+  model.beginUpdateModel();
+  model.updateSubModel(vertices);
+  model.endUpdateModel(true, true);
+}
+
+void checkSameUpdates(BVHModel<AABB>& model, Scalar ratio,
+                      std::size_t num_threads) {
+  BVHModel<AABB> reference(model);
+  std::vector<unsigned int> indices;
+  std::vector<Vec3s> positions;
+  for (int frame = 0; frame < 5; ++frame) {
+    randomMotion(model, ratio, indices, positions);
+    BOOST_CHECK_EQUAL(model.updateVertices(indices, positions, num_threads),
+                      BVH_OK);
+    fullUpdate(reference, indices, positions);
+    BOOST_CHECK(model.build_state == BVH_BUILD_STATE_UPDATED);
+    BOOST_CHECK(*model.vertices == *reference.vertices);
+    BOOST_CHECK(*model.prev_vertices == *reference.prev_vertices);
+    BOOST_CHECK(model == reference);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(incremental_refit_matches_full_refit) {
+  BVHModel<AABB> model;
+  generateBVHModel(model, Sphere(1), Transform3s(), 64, 64);
+  checkSameUpdates(model, 0.05, 1);
+  // Large updates are refitted in parallel.
+  checkSameUpdates(model, 0.5, 4);
+}
+
+BOOST_AUTO_TEST_CASE(incremental_refit_point_cloud) {
+  std::vector<Vec3s> points(2000);
+  for (std::size_t i = 0; i < points.size(); ++i)
+    points[i] = Vec3s::Random();
+  BVHModel<AABB> model;
+  model.beginModel(0, static_cast<unsigned int>(points.size()));
+  model.addSubModel(points);
+  model.endModel();
+  checkSameUpdates(model, 0.05, 1);
+}
+
+template <typename BV>
+void testIncrementalRefitQueries() {
+  BVHModel<BV> model;
+  generateBVHModel(model, Sphere(1), Transform3s(), 32, 32);
+  BVHModel<BV> reference(model);
+  BVHModel<BV> other;
+  generateBVHModel(other, Box(0.5, 0.5, 0.5), Transform3s());
+
+  std::vector<Transform3s> transforms;
+  Scalar extents[] = {-1.5, -1.5, -1.5, 1.5, 1.5, 1.5};
+  generateRandomTransforms(extents, transforms, 20);
+  CollisionRequest request(CONTACT, 100000);
+  std::vector<unsigned int> indices;
+  std::vector<Vec3s> positions;
+  for (int frame = 0; frame < 5; ++frame) {
+    randomMotion(model, 0.1, indices, positions);
+    model.updateVertices(indices, positions, 2);
+    fullUpdate(reference, indices, positions);
+    for (std::size_t i = 0; i < transforms.size(); ++i) {
+      CollisionResult result, reference_result;
+      collide(&model, Transform3s(), &other, transforms[i], request, result);
+      collide(&reference, Transform3s(), &other, transforms[i], request,
+              reference_result);
+      BOOST_CHECK_EQUAL(result.numContacts(), reference_result.numContacts());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(incremental_refit_queries) {
+  testIncrementalRefitQueries<OBB>();
+  testIncrementalRefitQueries<RSS>();
+  testIncrementalRefitQueries<OBBRSS>();
+}
+
+BOOST_AUTO_TEST_CASE(incremental_refit_errors) {
+  BVHModel<AABB> model;
+  std::vector<unsigned int> indices(1, 0);
+  std::vector<Vec3s> positions(1, Vec3s::Zero());
+  BOOST_CHECK_EQUAL(model.updateVertices(indices, positions),
+                    BVH_ERR_BUILD_EMPTY_PREVIOUS_FRAME);
+
+  generateBVHModel(model, Sphere(1), Transform3s(), 8, 8);
+  positions.push_back(Vec3s::Zero());
+  BOOST_CHECK_EQUAL(model.updateVertices(indices, positions),
+                    BVH_ERR_INCORRECT_DATA);
+  indices.push_back(model.num_vertices);
+  BOOST_CHECK_EQUAL(model.updateVertices(indices, positions),
+                    BVH_ERR_INCORRECT_DATA);
+}
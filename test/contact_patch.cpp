@@ -38,6 +38,7 @@
 #include <boost/test/included/unit_test.hpp>
 
 #include "coal/contact_patch.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
 
 #include "utility.h"
 
@@ -166,6 +167,38 @@ BOOST_AUTO_TEST_CASE(box_box) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(box_box_manifold) {
+  // The box-box narrow phase returns several contacts, which all lie in the
+  // same contact patch.
+  const Box box1(1, 1, 1);
+  const Box box2(1, 1, 1);
+  const Transform3s tf1;
+  Transform3s tf2;
+  tf2.setTranslation(Vec3s(0, 0, 1 - Scalar(0.001)));
+
+  CollisionResult col_res_manifold, col_res_single;
+  coal::collide(&box1, tf1, &box2, tf2,
+                CollisionRequest(CollisionRequestFlag::CONTACT, 4),
+                col_res_manifold);
+  coal::collide(&box1, tf1, &box2, tf2,
+                CollisionRequest(CollisionRequestFlag::CONTACT, 1),
+                col_res_single);
+  BOOST_REQUIRE(col_res_manifold.numContacts() > 1);
+  BOOST_REQUIRE_EQUAL(col_res_single.numContacts(), 1);
+
+  const ContactPatchRequest patch_req(4);
+  ContactPatchResult patch_res_manifold(patch_req);
+  ContactPatchResult patch_res_single(patch_req);
+  coal::computeContactPatch(&box1, tf1, &box2, tf2, col_res_manifold,
+                            patch_req, patch_res_manifold);
+  coal::computeContactPatch(&box1, tf1, &box2, tf2, col_res_single, patch_req,
+                            patch_res_single);
+  BOOST_REQUIRE_EQUAL(patch_res_manifold.numContactPatches(), 1);
+  BOOST_REQUIRE_EQUAL(patch_res_single.numContactPatches(), 1);
+  BOOST_CHECK(patch_res_manifold.getContactPatch(0).isSame(
+      patch_res_single.getContactPatch(0), Scalar(1e-6)));
+}
+
 BOOST_AUTO_TEST_CASE(halfspace_box) {
   const Halfspace hspace(0, 0, 1, 0);
   const Scalar halfside = Scalar(0.5);
@@ -1022,3 +1055,112 @@ BOOST_AUTO_TEST_CASE(edge_case_segment_face) {
     }
   }
 }
+
+namespace {
+
+/// @brief Mesh of the boxes with the given half sides and centers.
+void buildBoxesMesh(const std::vector<Vec3s> &half_sides,
+                    const std::vector<Vec3s> &centers,
+                    BVHModel<OBBRSS> &mesh) {
+  mesh.beginModel();
+  for (size_t i = 0; i < half_sides.size(); ++i) {
+    BVHModel<OBBRSS> box_mesh;
+    Transform3s pose;
+    pose.setTranslation(centers[i]);
+    generateBVHModel(box_mesh, Box(Vec3s(2 * half_sides[i])), pose);
+    mesh.addSubModel(*box_mesh.vertices, *box_mesh.tri_indices);
+  }
+  mesh.endModel();
+}
+
+/// @brief Contact patch of the face z = `z` of a box of half sides
+/// `halfside`, penetrated by `offset` along `normal`. The contacts between
+/// triangles lie on this face, and so does the patch.
+ContactPatch expectedFacePatch(const Scalar halfside, const Scalar z,
+                               const Vec3s &normal, const Scalar offset) {
+  ContactPatch expected(4);
+  expected.tf.rotation() = constructOrthonormalBasisFromVector(normal);
+  expected.tf.translation() = Vec3s(0, 0, z);
+  expected.penetration_depth = -offset;
+  for (const Scalar x : {-halfside, halfside}) {
+    for (const Scalar y : {-halfside, halfside}) {
+      expected.addPoint(Vec3s(x, y, z));
+    }
+  }
+  return expected;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(mesh_mesh) {
+  // A small box resting on a plate: the contacts between the triangles of
+  // the top face of the plate and of the faces of the box are merged into
+  // one patch, the bottom face of the box.
+  const Scalar halfside = 0.5;
+  const Scalar offset = Scalar(0.001);
+  BVHModel<OBBRSS> plate, box;
+  buildBoxesMesh({Vec3s(1, 1, halfside)}, {Vec3s::Zero()}, plate);
+  buildBoxesMesh({Vec3s::Constant(halfside)}, {Vec3s::Zero()}, box);
+
+  const Transform3s tf1;
+  Transform3s tf2;
+  tf2.setTranslation(Vec3s(0, 0, 2 * halfside - offset));
+
+  const size_t num_max_contact = 100;
+  const CollisionRequest col_req(CollisionRequestFlag::CONTACT,
+                                 num_max_contact);
+  CollisionResult col_res;
+  coal::collide(&plate, tf1, &box, tf2, col_req, col_res);
+  BOOST_REQUIRE(col_res.isCollision());
+  BOOST_CHECK(col_res.numContacts() > 1);
+
+  const ContactPatchRequest patch_req(4);
+  ContactPatchResult patch_res(patch_req);
+  coal::computeContactPatch(&plate, tf1, &box, tf2, col_res, patch_req,
+                            patch_res);
+  BOOST_REQUIRE_EQUAL(patch_res.numContactPatches(), 1);
+  const Scalar tol = Scalar(1e-6);
+  const ContactPatch expected =
+      expectedFacePatch(halfside, halfside, Vec3s::UnitZ(), offset);
+  BOOST_CHECK(patch_res.getContactPatch(0).isSame(expected, tol));
+
+}
+
+BOOST_AUTO_TEST_CASE(mesh_mesh_clusters) {
+  // A plate squeezed between two small boxes, which belong to the same mesh:
+  // one contact patch per box.
+  const Scalar halfside = 0.5;
+  const Scalar offset = Scalar(0.001);
+  BVHModel<OBBRSS> plate, boxes;
+  buildBoxesMesh({Vec3s(1, 1, halfside)}, {Vec3s::Zero()}, plate);
+  const Scalar z = 2 * halfside - offset;
+  buildBoxesMesh({Vec3s::Constant(halfside), Vec3s::Constant(halfside)},
+                 {Vec3s(0, 0, z), Vec3s(0, 0, -z)}, boxes);
+
+  const Transform3s tf;
+  const CollisionRequest col_req(CollisionRequestFlag::CONTACT, 100);
+  CollisionResult col_res;
+  coal::collide(&plate, tf, &boxes, tf, col_req, col_res);
+  BOOST_REQUIRE(col_res.isCollision());
+
+  const ContactPatchRequest patch_req(4);
+  ContactPatchResult patch_res(patch_req);
+  coal::computeContactPatch(&plate, tf, &boxes, tf, col_res, patch_req,
+                            patch_res);
+  BOOST_REQUIRE_EQUAL(patch_res.numContactPatches(), 2);
+  const Scalar tol = Scalar(1e-6);
+  const ContactPatch top =
+      expectedFacePatch(halfside, halfside, Vec3s::UnitZ(), offset);
+  const ContactPatch bottom =
+      expectedFacePatch(halfside, -halfside, -Vec3s::UnitZ(), offset);
+  const ContactPatch &patch0 = patch_res.getContactPatch(0);
+  const ContactPatch &patch1 = patch_res.getContactPatch(1);
+  BOOST_CHECK((patch0.isSame(top, tol) && patch1.isSame(bottom, tol)) ||
+              (patch0.isSame(bottom, tol) && patch1.isSame(top, tol)));
+
+  // The patches past `max_num_patch` are dropped.
+  const ContactPatchRequest single_patch_req(1);
+  coal::computeContactPatch(&plate, tf, &boxes, tf, col_res, single_patch_req,
+                            patch_res);
+  BOOST_CHECK_EQUAL(patch_res.numContactPatches(), 1);
+}
@@ -0,0 +1,348 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE COAL_CONTINUOUS_COLLISION
+#include <boost/test/included/unit_test.hpp>
+
+#include "coal/collision.h"
+#include "coal/distance.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/broadphase/broadphase_continuous_dynamic_AABB_tree.h"
+#include "coal/broadphase/default_broadphase_callbacks.h"
+#include "coal/narrowphase/continuous_collision.h"
+#include "coal/shape/geometric_shapes.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
+#include "utility.h"
+
+using namespace coal;
+
+/// @brief Checks that the geometries do not touch before the time of contact
+/// and touch at the time of contact.
+void checkTimeOfContact(const CollisionGeometry* o1, const Transform3s& tf1_beg,
+                        const Transform3s& tf1_end,
+                        const CollisionGeometry* o2, const Transform3s& tf2_beg,
+                        const Transform3s& tf2_end,
+                        const ContinuousCollisionRequest& request,
+                        const ContinuousCollisionResult& result) {
+  DistanceRequest drequest;
+  const std::size_t num_samples = 100;
+  for (std::size_t i = 0; i < num_samples; ++i) {
+    const Scalar t =
+        result.time_of_contact * Scalar(i) / Scalar(num_samples);
+    DistanceResult dresult;
+    const Scalar d = distance(o1, interpolateTransform(tf1_beg, tf1_end, t), o2,
+                              interpolateTransform(tf2_beg, tf2_end, t),
+                              drequest, dresult);
+    BOOST_CHECK(d > 0);
+  }
+  if (result.is_collide) {
+    DistanceResult dresult;
+    const Scalar d = distance(o1, result.contact_tf1, o2, result.contact_tf2,
+                              drequest, dresult);
+    BOOST_CHECK(d <= request.toc_err);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(sphere_sphere_translation) {
+  Sphere s1(1), s2(1);
+  s1.computeLocalAABB();
+  s2.computeLocalAABB();
+  const Transform3s tf1_beg(Vec3s(-5, 0, 0)), tf1_end(Vec3s(5, 0, 0));
+  const Transform3s tf2;
+
+  ContinuousCollisionRequest request;
+  ContinuousCollisionResult result;
+  const Scalar toc =
+      continuousCollide(&s1, tf1_beg, tf1_end, &s2, tf2, request, result);
+
+  BOOST_CHECK(result.is_collide);
+  BOOST_CHECK_EQUAL(toc, result.time_of_contact);
+  BOOST_CHECK_CLOSE(toc, 0.3, 1e-2);
+  BOOST_CHECK(result.normal.isApprox(Vec3s(1, 0, 0), 1e-6));
+  BOOST_CHECK(result.contact_point.isApprox(Vec3s(-1, 0, 0), 1e-3));
+  checkTimeOfContact(&s1, tf1_beg, tf1_end, &s2, tf2, tf2, request, result);
+
+  // The same motion, shifted so that the spheres miss each other.
+  const Transform3s tf1_beg_miss(Vec3s(-5, 3, 0)), tf1_end_miss(Vec3s(5, 3, 0));
+  continuousCollide(&s1, tf1_beg_miss, tf1_end_miss, &s2, tf2, request,
+                    result);
+  BOOST_CHECK(!result.is_collide);
+  BOOST_CHECK_EQUAL(result.time_of_contact, 1);
+
+  // Initial contact.
+  const Transform3s tf1_overlap(Vec3s(1.5, 0, 0));
+  continuousCollide(&s1, tf1_overlap, tf1_end, &s2, tf2, request, result);
+  BOOST_CHECK(result.is_collide);
+  BOOST_CHECK_EQUAL(result.time_of_contact, 0);
+}
+
+BOOST_AUTO_TEST_CASE(tunneling) {
+  // A fast sphere goes through a thin wall: there is no collision at both ends
+  // of the motion.
+  Sphere sphere(0.1);
+  Box wall(0.01, 10, 10);
+  sphere.computeLocalAABB();
+  wall.computeLocalAABB();
+  const Transform3s tf1_beg(Vec3s(-10, 0, 0)), tf1_end(Vec3s(10, 0, 0));
+  const Transform3s tf2;
+
+  CollisionRequest crequest;
+  CollisionResult cresult;
+  BOOST_CHECK(!collide(&sphere, tf1_beg, &wall, tf2, crequest, cresult));
+  BOOST_CHECK(!collide(&sphere, tf1_end, &wall, tf2, crequest, cresult));
+
+  ContinuousCollisionRequest request;
+  ContinuousCollisionResult result;
+  continuousCollide(&sphere, tf1_beg, tf1_end, &wall, tf2, request, result);
+  BOOST_CHECK(result.is_collide);
+  BOOST_CHECK_CLOSE(result.time_of_contact, (10 - 0.105) / 20, 1e-2);
+  checkTimeOfContact(&sphere, tf1_beg, tf1_end, &wall, tf2, tf2, request,
+                     result);
+}
+
+BOOST_AUTO_TEST_CASE(rotation) {
+  // A rotating bar hits a sphere.
+  Box bar(4, 0.2, 0.2);
+  Sphere sphere(0.2);
+  bar.computeLocalAABB();
+  sphere.computeLocalAABB();
+  const Transform3s tf1_beg;
+  const Transform3s tf1_end(
+      Transform3s(fromAxisAngle(Vec3s(0, 0, 1), Scalar(M_PI / 2))));
+  const Transform3s tf2(Vec3s(0, 1.5, 0));
+
+  ContinuousCollisionRequest request;
+  ContinuousCollisionResult result;
+  continuousCollide(&bar, tf1_beg, tf1_end, &sphere, tf2, request, result);
+  BOOST_CHECK(result.is_collide);
+  BOOST_CHECK(result.time_of_contact > 0);
+  BOOST_CHECK(result.time_of_contact < 1);
+  checkTimeOfContact(&bar, tf1_beg, tf1_end, &sphere, tf2, tf2, request,
+                     result);
+
+  // The bar only sweeps the first and third quadrants.
+  const Transform3s tf2_miss(Vec3s(1.2, -1.2, 0));
+  continuousCollide(&bar, tf1_beg, tf1_end, &sphere, tf2_miss, request,
+                    result);
+  BOOST_CHECK(!result.is_collide);
+}
+
+BOOST_AUTO_TEST_CASE(shape_bvh) {
+  Box box(2, 2, 2);
+  box.computeLocalAABB();
+  BVHModel<OBBRSS> mesh;
+  generateBVHModel(mesh, box, Transform3s());
+  Sphere sphere(0.5);
+  sphere.computeLocalAABB();
+
+  const Transform3s tf1_beg(Vec3s(0, 0, 5)), tf1_end(Vec3s(1, 0, -5));
+  const Transform3s tf2(
+      Transform3s(fromAxisAngle(Vec3s(1, 0, 0), Scalar(0.3))));
+
+  ContinuousCollisionRequest request;
+  ContinuousCollisionResult result_shape, result_mesh;
+  continuousCollide(&sphere, tf1_beg, tf1_end, &box, tf2, request,
+                    result_shape);
+  continuousCollide(&sphere, tf1_beg, tf1_end, &mesh, tf2, request,
+                    result_mesh);
+  BOOST_CHECK(result_shape.is_collide);
+  BOOST_CHECK(result_mesh.is_collide);
+  BOOST_CHECK_CLOSE(result_shape.time_of_contact, result_mesh.time_of_contact,
+                    1e-1);
+  checkTimeOfContact(&sphere, tf1_beg, tf1_end, &mesh, tf2, tf2, request,
+                     result_mesh);
+
+  // Both orders of the pair are supported.
+  ContinuousCollisionResult result_swapped;
+  continuousCollide(&mesh, tf2, tf2, &sphere, tf1_beg, tf1_end, request,
+                    result_swapped);
+  BOOST_CHECK(result_swapped.is_collide);
+  BOOST_CHECK_CLOSE(result_swapped.time_of_contact,
+                    result_mesh.time_of_contact, 1e-1);
+  BOOST_CHECK(result_swapped.normal.isApprox(-result_mesh.normal, 1e-3));
+}
+
+BOOST_AUTO_TEST_CASE(invalid_arguments) {
+  Sphere s1(1), s2(1);
+  const Transform3s tf1_beg(Vec3s(-5, 0, 0)), tf1_end(Vec3s(5, 0, 0));
+  const Transform3s tf2;
+  ContinuousCollisionRequest request;
+  ContinuousCollisionResult result;
+  // The local AABBs are not computed.
+  BOOST_CHECK_THROW(
+      continuousCollide(&s1, tf1_beg, tf1_end, &s2, tf2, request, result),
+      std::invalid_argument);
+
+  s1.computeLocalAABB();
+  s2.computeLocalAABB();
+  request.toc_err = 0;
+  BOOST_CHECK_THROW(
+      continuousCollide(&s1, tf1_beg, tf1_end, &s2, tf2, request, result),
+      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(swept_aabb) {
+  shared_ptr<Box> box(new Box(1, 2, 3));
+  const Transform3s tf_beg(Vec3s(-1, 0, 0));
+  const Transform3s tf_end(
+      fromAxisAngle(Vec3s(0, 1, 0), Scalar(2)), Vec3s(2, 1, 0));
+  ContinuousCollisionObject obj(box, tf_beg, tf_end);
+  for (std::size_t i = 0; i <= 50; ++i) {
+    CollisionObject sample(box, obj.getTransform(Scalar(i) / 50));
+    BOOST_CHECK(obj.getAABB().contain(sample.getAABB()));
+  }
+
+  // Pure translation: the swept AABB is the union of the end AABBs.
+  obj.setMotion(tf_beg, Transform3s(Vec3s(2, 1, 0)));
+  BOOST_CHECK(obj.getAABB().min_.isApprox(Vec3s(-1.5, -1, -1.5)));
+  BOOST_CHECK(obj.getAABB().max_.isApprox(Vec3s(2.5, 2, 1.5)));
+}
+
+/// @brief Random spheres moving along random motions.
+void generateMovingSpheres(
+    std::size_t n, std::vector<shared_ptr<ContinuousCollisionObject> >& objs) {
+  objs.clear();
+  for (std::size_t i = 0; i < n; ++i) {
+    shared_ptr<CollisionGeometry> geom(
+        new Sphere(0.2 + 0.2 * std::abs(Vec3s::Random()[0])));
+    const Vec3s p_beg = 10 * Vec3s::Random();
+    const Vec3s p_end = p_beg + 2 * Vec3s::Random();
+    objs.push_back(shared_ptr<ContinuousCollisionObject>(
+        new ContinuousCollisionObject(geom, Transform3s(p_beg),
+                                      Transform3s(p_end))));
+  }
+}
+
+struct ContinuousCollisionCallBackCollect : ContinuousCollisionCallBackBase {
+  bool collide(ContinuousCollisionObject* o1, ContinuousCollisionObject* o2) {
+    if (o1 > o2) std::swap(o1, o2);
+    pairs.insert(std::make_pair(o1, o2));
+    return false;
+  }
+  std::set<std::pair<ContinuousCollisionObject*, ContinuousCollisionObject*> >
+      pairs;
+};
+
+BOOST_AUTO_TEST_CASE(broadphase_manager) {
+  srand(0);
+  std::vector<shared_ptr<ContinuousCollisionObject> > objs;
+  generateMovingSpheres(200, objs);
+  std::vector<ContinuousCollisionObject*> ptrs;
+  for (std::size_t i = 0; i < objs.size(); ++i) ptrs.push_back(objs[i].get());
+
+  DynamicAABBTreeContinuousCollisionManager manager;
+  manager.registerObjects(ptrs);
+  manager.setup();
+  BOOST_CHECK_EQUAL(manager.size(), objs.size());
+
+  // Brute force reference.
+  ContinuousCollisionRequest request;
+  std::set<std::pair<ContinuousCollisionObject*, ContinuousCollisionObject*> >
+      overlapping;
+  Scalar earliest_toc = 1;
+  for (std::size_t i = 0; i < ptrs.size(); ++i) {
+    for (std::size_t j = i + 1; j < ptrs.size(); ++j) {
+      if (!ptrs[i]->getAABB().overlap(ptrs[j]->getAABB())) continue;
+      ContinuousCollisionObject* o1 = std::min(ptrs[i], ptrs[j]);
+      ContinuousCollisionObject* o2 = std::max(ptrs[i], ptrs[j]);
+      overlapping.insert(std::make_pair(o1, o2));
+      ContinuousCollisionResult result;
+      continuousCollide(o1, o2, request, result);
+      if (result.is_collide)
+        earliest_toc = std::min(earliest_toc, result.time_of_contact);
+    }
+  }
+  BOOST_REQUIRE(earliest_toc < 1);
+
+  ContinuousCollisionCallBackCollect collect;
+  manager.collide(&collect);
+  BOOST_CHECK_EQUAL(collect.pairs.size(), overlapping.size());
+  BOOST_CHECK(collect.pairs == overlapping);
+
+  ContinuousCollisionCallBackDefault callback;
+  manager.collide(&callback);
+  BOOST_CHECK(callback.data.result.is_collide);
+  BOOST_CHECK_CLOSE(callback.data.result.time_of_contact, earliest_toc, 1e-6);
+  BOOST_CHECK(callback.data.o1 != nullptr && callback.data.o2 != nullptr);
+
+  // Moving the objects.
+  for (std::size_t i = 0; i < objs.size(); ++i) {
+    const Transform3s tf_end(objs[i]->getEndTransform());
+    const Vec3s p_end = tf_end.getTranslation() + 2 * Vec3s::Random();
+    objs[i]->setMotion(tf_end, Transform3s(p_end));
+  }
+  manager.update();
+  collect.pairs.clear();
+  overlapping.clear();
+  for (std::size_t i = 0; i < ptrs.size(); ++i) {
+    for (std::size_t j = i + 1; j < ptrs.size(); ++j) {
+      if (!ptrs[i]->getAABB().overlap(ptrs[j]->getAABB())) continue;
+      overlapping.insert(std::make_pair(std::min(ptrs[i], ptrs[j]),
+                                        std::max(ptrs[i], ptrs[j])));
+    }
+  }
+  manager.collide(&collect);
+  BOOST_CHECK(collect.pairs == overlapping);
+
+  // Queries against a single object and against another manager.
+  std::vector<shared_ptr<ContinuousCollisionObject> > others;
+  generateMovingSpheres(50, others);
+  DynamicAABBTreeContinuousCollisionManager other_manager;
+  for (std::size_t i = 0; i < others.size(); ++i)
+    other_manager.registerObject(others[i].get());
+  other_manager.setup();
+
+  std::set<std::pair<ContinuousCollisionObject*, ContinuousCollisionObject*> >
+      expected, from_objects;
+  for (std::size_t i = 0; i < others.size(); ++i) {
+    for (std::size_t j = 0; j < ptrs.size(); ++j) {
+      if (!others[i]->getAABB().overlap(ptrs[j]->getAABB())) continue;
+      expected.insert(std::make_pair(std::min(others[i].get(), ptrs[j]),
+                                     std::max(others[i].get(), ptrs[j])));
+    }
+    collect.pairs.clear();
+    manager.collide(others[i].get(), &collect);
+    from_objects.insert(collect.pairs.begin(), collect.pairs.end());
+  }
+  BOOST_CHECK(from_objects == expected);
+
+  collect.pairs.clear();
+  manager.collide(&other_manager, &collect);
+  BOOST_CHECK(collect.pairs == expected);
+
+  manager.unregisterObject(ptrs[0]);
+  BOOST_CHECK_EQUAL(manager.size(), objs.size() - 1);
+  manager.clear();
+  BOOST_CHECK(manager.empty());
+}
@@ -40,6 +40,9 @@
 #include "coal/shape/convex.h"
 #include "coal/collision.h"
 #include "coal/distance.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/narrowphase/support_functions.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
 
 #include "utility.h"
 
@@ -212,6 +215,59 @@ BOOST_AUTO_TEST_CASE(compare_convex_box) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(convex_soa_support) {
+  const unsigned int resolutions[] = {4, 8, 16, 24};
+  for (std::size_t r = 0; r < sizeof(resolutions) / sizeof(unsigned int);
+       ++r) {
+    BVHModel<OBBRSS> mesh;
+    generateBVHModel(mesh, Sphere(1), Transform3s(), resolutions[r],
+                     resolutions[r]);
+    mesh.buildConvexRepresentation(false);
+    const ConvexBase32& convex = *mesh.convex;
+    shared_ptr<ConvexBase32> soa_convex(convex.deepcopy());
+    soa_convex->buildPointsSoA();
+    BOOST_REQUIRE(soa_convex->points_soa != nullptr);
+    BOOST_CHECK_EQUAL(soa_convex->points_soa->size() % 3, 0);
+    BOOST_CHECK_EQUAL(soa_convex->points_soa->size() / 3 %
+                          ConvexBase32::points_soa_block_size,
+                      0);
+    // The SoA points only extend the range of the linear support.
+    BOOST_CHECK(!soa_convex->useLogSupport() || convex.useLogSupport());
+    if (convex.num_points > ConvexBase32::num_vertices_soa_support_threshold)
+      BOOST_CHECK(soa_convex->useLogSupport());
+
+    // Deep copies duplicate the SoA points.
+    shared_ptr<ConvexBase32> copy(soa_convex->deepcopy());
+    BOOST_CHECK(copy->points_soa != nullptr);
+    BOOST_CHECK(*copy->points_soa == *soa_convex->points_soa);
+
+    details::ShapeSupportData data;
+    for (int i = 0; i < 1000; ++i) {
+      const Vec3s dir = Vec3s::Random();
+      Vec3s ref, support;
+      int ref_hint = 0, hint = 0;
+      details::getShapeSupport(
+          reinterpret_cast<const details::SmallConvex32*>(&convex), dir, ref,
+          ref_hint, data);
+      details::getShapeSupport(
+          reinterpret_cast<const details::SmallConvex32*>(soa_convex.get()),
+          dir, support, hint, data);
+      BOOST_CHECK_CLOSE(support.dot(dir), ref.dot(dir), 1e-8);
+      BOOST_CHECK(support == (*convex.points)[std::size_t(hint)]);
+      details::getShapeSupport(soa_convex.get(), dir, support, hint, data);
+      BOOST_CHECK_CLOSE(support.dot(dir), ref.dot(dir), 1e-8);
+    }
+
+    // Same distance with and without the SoA points.
+    Transform3s tf1, tf2(Vec3s(2.5, 0.3, -0.2));
+    DistanceRequest request;
+    DistanceResult res_ref, res_soa;
+    distance(&convex, tf1, &convex, tf2, request, res_ref);
+    distance(soa_convex.get(), tf1, soa_convex.get(), tf2, request, res_soa);
+    BOOST_CHECK_CLOSE(res_ref.min_distance, res_soa.min_distance, 1e-6);
+  }
+}
+
 #ifdef COAL_HAS_QHULL
 BOOST_AUTO_TEST_CASE(convex_hull_throw) {
   std::shared_ptr<std::vector<Vec3s>> points(
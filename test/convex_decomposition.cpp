@@ -0,0 +1,249 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE COAL_CONVEX_DECOMPOSITION
+#include <boost/test/included/unit_test.hpp>
+
+#include <random>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "coal/collision.h"
+#include "coal/compound.h"
+#include "coal/distance.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/shape/convex_decomposition.h"
+#include "coal/shape/geometric_shapes.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
+#include "coal/serialization/archive.h"
+#include "coal/serialization/compound.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+namespace {
+
+// Prism of the given height over a polygon of the plane z = 0, given
+// counter-clockwise and star-shaped with respect to its first vertex.
+shared_ptr<BVHModel<OBBRSS>> makePrism(const std::vector<Vec3s>& outline,
+                                       Scalar height) {
+  const unsigned int n = static_cast<unsigned int>(outline.size());
+  std::vector<Vec3s> vertices;
+  for (const Vec3s& p : outline) vertices.push_back(p);
+  for (const Vec3s& p : outline) vertices.push_back(p + Vec3s(0, 0, height));
+  std::vector<Triangle32> triangles;
+  for (unsigned int i = 0; i < n; ++i) {
+    const unsigned int j = (i + 1) % n;
+    triangles.push_back(Triangle32(i, j, n + j));
+    triangles.push_back(Triangle32(i, n + j, n + i));
+  }
+  for (unsigned int k = 1; k + 1 < n; ++k) {
+    triangles.push_back(Triangle32(0, k + 1, k));
+    triangles.push_back(Triangle32(n, n + k, n + k + 1));
+  }
+  shared_ptr<BVHModel<OBBRSS>> model(new BVHModel<OBBRSS>);
+  model->beginModel();
+  model->addSubModel(vertices, triangles);
+  model->endModel();
+  model->computeLocalAABB();
+  return model;
+}
+
+// L-shaped prism: the union of [0, 2] x [0, 1] x [0, 1] and
+// [0, 1] x [0, 2] x [0, 1].
+shared_ptr<BVHModel<OBBRSS>> makeL() {
+  std::vector<Vec3s> outline;
+  outline.push_back(Vec3s(0, 0, 0));
+  outline.push_back(Vec3s(2, 0, 0));
+  outline.push_back(Vec3s(2, 1, 0));
+  outline.push_back(Vec3s(1, 1, 0));
+  outline.push_back(Vec3s(1, 2, 0));
+  outline.push_back(Vec3s(0, 2, 0));
+  return makePrism(outline, 1);
+}
+
+bool isInside(const ConvexBase32& convex, const Vec3s& p, Scalar margin) {
+  for (unsigned int i = 0; i < convex.num_normals_and_offsets; ++i)
+    if ((*convex.normals)[i].dot(p) + (*convex.offsets)[i] > margin)
+      return false;
+  return true;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(convex_mesh_single_part) {
+  BVHModel<OBBRSS> model;
+  generateBVHModel(model, Box(1, 2, 3), Transform3s());
+
+  const std::vector<shared_ptr<ConvexBase32>> parts =
+      computeConvexDecomposition(model);
+  BOOST_REQUIRE_EQUAL(parts.size(), 1);
+  BOOST_CHECK_EQUAL(parts[0]->num_points, 8);
+  BOOST_CHECK_CLOSE(parts[0]->computeVolume(), 6, 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(concave_mesh_parts_cover_the_mesh) {
+  const shared_ptr<BVHModel<OBBRSS>> model = makeL();
+  ConvexDecompositionParameters params;
+  const std::vector<shared_ptr<ConvexBase32>> parts =
+      computeConvexDecomposition(*model, params);
+  BOOST_CHECK_GE(parts.size(), 2);
+  BOOST_CHECK_LE(parts.size(), params.max_num_parts);
+
+  for (Scalar x = 0.05; x < 2; x += 0.1) {
+    for (Scalar y = 0.05; y < 2; y += 0.1) {
+      const Vec3s p(x, y, 0.5);
+      bool in_a_part = false;
+      for (const shared_ptr<ConvexBase32>& part : parts)
+        in_a_part = in_a_part || isInside(*part, p, 1e-9);
+      if (x < 1 || y < 1)
+        BOOST_CHECK_MESSAGE(in_a_part, "point " << p.transpose()
+                                                << " is in no part");
+      else if (x > 1.2 && y > 1.2)
+        BOOST_CHECK_MESSAGE(!in_a_part, "point " << p.transpose()
+                                                 << " is in a part");
+    }
+  }
+
+  // The parts do not depend on the number of threads.
+  params.num_threads = 4;
+  const std::vector<shared_ptr<ConvexBase32>> parallel_parts =
+      computeConvexDecomposition(*model, params);
+  BOOST_REQUIRE_EQUAL(parallel_parts.size(), parts.size());
+  for (std::size_t i = 0; i < parts.size(); ++i)
+    BOOST_CHECK(*parallel_parts[i] == *parts[i]);
+
+  // A single part is the convex hull of the mesh.
+  params.max_num_parts = 1;
+  const std::vector<shared_ptr<ConvexBase32>> hull =
+      computeConvexDecomposition(*model, params);
+  BOOST_REQUIRE_EQUAL(hull.size(), 1);
+  BOOST_CHECK_CLOSE(hull[0]->computeVolume(), 3.5, 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(compound_collision_and_distance) {
+  const shared_ptr<BVHModel<OBBRSS>> model = makeL();
+  const Compound compound(computeConvexDecomposition(*model));
+  const Sphere sphere(0.2);
+
+  const Transform3s tf_model(
+      Eigen::AngleAxis<Scalar>(0.4, Vec3s(1, 2, 3).normalized())
+          .toRotationMatrix(),
+      Vec3s(0.3, -0.2, 0.5));
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<Scalar> uniform(-0.5, 2.5);
+  const CollisionRequest request(CONTACT, 10);
+  for (int k = 0; k < 500; ++k) {
+    const Vec3s p(uniform(generator), uniform(generator),
+                  uniform(generator) * Scalar(2. / 3.));
+    const Transform3s tf_sphere = tf_model * Transform3s(p);
+
+    CollisionResult mesh_result, compound_result, reverse_result;
+    collide(model.get(), tf_model, &sphere, tf_sphere, request, mesh_result);
+    collide(&compound, tf_model, &sphere, tf_sphere, request, compound_result);
+    collide(&sphere, tf_sphere, &compound, tf_model, request, reverse_result);
+    BOOST_CHECK_EQUAL(compound_result.isCollision(),
+                      reverse_result.isCollision());
+    for (const Contact& contact : compound_result.getContacts()) {
+      BOOST_CHECK(contact.o1 == &compound);
+      BOOST_CHECK(contact.b1 >= 0 &&
+                  contact.b1 < static_cast<int>(compound.numParts()));
+    }
+    for (const Contact& contact : reverse_result.getContacts()) {
+      BOOST_CHECK(contact.o2 == &compound);
+      BOOST_CHECK(contact.b2 >= 0 &&
+                  contact.b2 < static_cast<int>(compound.numParts()));
+    }
+
+    // The parts cover the mesh and its volume, and stay close to it.
+    const bool in_l = p[2] > 0 && p[2] < 1 && p[0] > 0 && p[1] > 0 &&
+                      ((p[0] < 2 && p[1] < 1) || (p[0] < 1 && p[1] < 2));
+    if (mesh_result.isCollision() || in_l)
+      BOOST_CHECK(compound_result.isCollision());
+    if (in_l) continue;
+    DistanceResult mesh_distance, compound_distance;
+    distance(model.get(), tf_model, &sphere, tf_sphere, DistanceRequest(),
+             mesh_distance);
+    if (mesh_distance.min_distance < 0.15) continue;
+    BOOST_CHECK(!compound_result.isCollision());
+    distance(&compound, tf_model, &sphere, tf_sphere, DistanceRequest(),
+             compound_distance);
+    BOOST_CHECK_LE(compound_distance.min_distance,
+                   mesh_distance.min_distance + 1e-6);
+    BOOST_CHECK_GE(compound_distance.min_distance,
+                   mesh_distance.min_distance - 0.15);
+    BOOST_CHECK(compound_distance.o1 == &compound);
+    BOOST_CHECK(compound_distance.o2 == &sphere);
+  }
+
+  // Compound against compound.
+  CollisionResult result;
+  collide(&compound, Transform3s(), &compound, Transform3s(Vec3s(0.5, 0.5, 0)),
+          request, result);
+  BOOST_CHECK(result.isCollision());
+  result.clear();
+  collide(&compound, Transform3s(), &compound, Transform3s(Vec3s(1.2, 1.2, 0)),
+          request, result);
+  BOOST_CHECK(!result.isCollision());
+}
+
+BOOST_AUTO_TEST_CASE(compound_serialization_and_cache) {
+  const shared_ptr<BVHModel<OBBRSS>> model = makeL();
+  Compound compound(computeConvexDecomposition(*model));
+  compound.addPart(make_shared<Sphere>(0.5), Transform3s(Vec3s(3, 0, 0)));
+
+  Compound copy;
+  serialization::loadFromString(copy, serialization::saveToString(compound));
+  BOOST_CHECK(copy == compound);
+
+  const boost::filesystem::path directory =
+      boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path();
+  boost::filesystem::create_directories(directory);
+  const ConvexDecompositionParameters params;
+  const CompoundPtr_t computed =
+      loadOrComputeConvexDecomposition(*model, params, directory.string());
+  BOOST_CHECK_EQUAL(
+      std::distance(boost::filesystem::directory_iterator(directory),
+                    boost::filesystem::directory_iterator()),
+      1);
+  const CompoundPtr_t loaded =
+      loadOrComputeConvexDecomposition(*model, params, directory.string());
+  BOOST_CHECK(*loaded == *computed);
+  BOOST_CHECK_EQUAL(loaded->numParts(),
+                    computeConvexDecomposition(*model).size());
+  boost::filesystem::remove_all(directory);
+}
@@ -0,0 +1,320 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE COAL_FLAT_BINARY
+#include <boost/test/included/unit_test.hpp>
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+
+#include "coal/collision.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/hfield.h"
+#include "coal/shape/geometric_shapes.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
+#include "coal/serialization/flat_binary.h"
+#include "utility.h"
+
+using namespace coal;
+using namespace coal::serialization;
+
+std::string temporaryFilename(const std::string& name) {
+  return (boost::filesystem::temp_directory_path() /
+          boost::filesystem::unique_path("%%%%-%%%%-" + name))
+      .string();
+}
+
+template <typename BV>
+void testBVHModelRoundTrip() {
+  BVHModel<BV> model;
+  generateBVHModel(model, Sphere(1), Transform3s(), 32, 32);
+  const std::string filename = temporaryFilename("mesh.coal");
+  saveToFlatBinary(model, filename);
+
+  BVHModel<BV> loaded;
+  loadFromFlatBinary(loaded, filename);
+  BOOST_CHECK(model == loaded);
+  BOOST_CHECK_EQUAL(loaded.getNumBVs(), model.getNumBVs());
+  BOOST_CHECK(loaded.build_state == BVH_BUILD_STATE_PROCESSED);
+  BOOST_CHECK(loaded.aabb_local == model.aabb_local);
+  BOOST_CHECK_EQUAL(loaded.aabb_radius, model.aabb_radius);
+
+  boost::filesystem::remove(filename);
+}
+
+BOOST_AUTO_TEST_CASE(bvh_model_round_trip) {
+  testBVHModelRoundTrip<AABB>();
+  testBVHModelRoundTrip<OBB>();
+  testBVHModelRoundTrip<RSS>();
+  testBVHModelRoundTrip<kIOS>();
+  testBVHModelRoundTrip<OBBRSS>();
+  testBVHModelRoundTrip<KDOP<16> >();
+  testBVHModelRoundTrip<KDOP<18> >();
+  testBVHModelRoundTrip<KDOP<24> >();
+}
+
+template <typename BV>
+void testBVHModelQueries() {
+  BVHModel<BV> model;
+  generateBVHModel(model, Sphere(1), Transform3s(), 32, 32);
+  const std::string filename = temporaryFilename("mesh.coal");
+  saveToFlatBinary(model, filename);
+  BVHModel<BV> loaded;
+  loadFromFlatBinary(loaded, filename);
+
+  // The loaded hierarchy gives the same results as the original one.
+  std::vector<Transform3s> transforms;
+  Scalar extents[] = {-2, -2, -2, 2, 2, 2};
+  generateRandomTransforms(extents, transforms, 20);
+  CollisionRequest request;
+  for (std::size_t i = 0; i < transforms.size(); ++i) {
+    CollisionResult result, loaded_result;
+    collide(&model, Transform3s(), &model, transforms[i], request, result);
+    collide(&loaded, Transform3s(), &loaded, transforms[i], request,
+            loaded_result);
+    BOOST_CHECK_EQUAL(result.isCollision(), loaded_result.isCollision());
+  }
+
+  boost::filesystem::remove(filename);
+}
+
+BOOST_AUTO_TEST_CASE(bvh_model_queries) {
+  testBVHModelQueries<AABB>();
+  testBVHModelQueries<RSS>();
+  testBVHModelQueries<OBBRSS>();
+}
+
+BOOST_AUTO_TEST_CASE(point_cloud_round_trip) {
+  std::vector<Vec3s> points(500);
+  for (std::size_t i = 0; i < points.size(); ++i)
+    points[i] = Vec3s::Random();
+  BVHModel<AABB> model;
+  model.beginModel(0, static_cast<unsigned int>(points.size()));
+  model.addSubModel(points);
+  model.endModel();
+
+  const std::string filename = temporaryFilename("points.coal");
+  saveToFlatBinary(model, filename);
+  BVHModel<AABB> loaded;
+  loadFromFlatBinary(loaded, filename);
+  BOOST_CHECK(model == loaded);
+  BOOST_CHECK(loaded.getModelType() == BVH_MODEL_POINTCLOUD);
+  boost::filesystem::remove(filename);
+}
+
+template <typename BV>
+void testHeightFieldRoundTrip() {
+  const Eigen::DenseIndex nx = 20, ny = 30;
+  const MatrixXs heights = MatrixXs::Random(ny, nx);
+  HeightField<BV> hfield(2, 3, heights, -1);
+
+  const std::string filename = temporaryFilename("hfield.coal");
+  saveToFlatBinary(hfield, filename);
+  HeightField<BV> loaded;
+  loadFromFlatBinary(loaded, filename);
+  BOOST_CHECK(hfield == loaded);
+  BOOST_CHECK(loaded.getHeights() == hfield.getHeights());
+  BOOST_CHECK(loaded.aabb_local == hfield.aabb_local);
+
+  CollisionRequest request;
+  CollisionResult result, loaded_result;
+  const Sphere sphere(0.5);
+  const Transform3s tf(Vec3s(0.1, 0.2, 0.));
+  collide(&hfield, Transform3s(), &sphere, tf, request, result);
+  collide(&loaded, Transform3s(), &sphere, tf, request, loaded_result);
+  BOOST_CHECK_EQUAL(result.isCollision(), loaded_result.isCollision());
+  boost::filesystem::remove(filename);
+}
+
+BOOST_AUTO_TEST_CASE(height_field_round_trip) {
+  testHeightFieldRoundTrip<AABB>();
+  testHeightFieldRoundTrip<OBBRSS>();
+}
+
+BOOST_AUTO_TEST_CASE(in_place_access) {
+  BVHModel<OBBRSS> model;
+  generateBVHModel(model, Sphere(1), Transform3s(), 16, 16);
+  const std::string filename = temporaryFilename("mesh.coal");
+  saveToFlatBinary(model, filename);
+
+  FlatBinaryFile file(filename);
+  BOOST_CHECK_EQUAL(file.header().version, FlatBinaryHeader::current_version);
+  BOOST_CHECK_EQUAL(file.header().node_type, BV_OBBRSS);
+  BOOST_REQUIRE_EQUAL(file.numSections(), 5);
+  for (std::size_t i = 0; i < file.numSections(); ++i)
+    BOOST_CHECK_EQUAL(file.section(i).offset % FlatBinaryHeader::alignment, 0);
+
+  // The vertices and the nodes can be read from the mapping directly.
+  BOOST_REQUIRE_EQUAL(file.section(1).size,
+                      model.num_vertices * sizeof(Vec3s));
+  const Vec3s* vertices = static_cast<const Vec3s*>(file.sectionData(1));
+  for (unsigned int i = 0; i < model.num_vertices; ++i)
+    BOOST_CHECK((*model.vertices)[i] == vertices[i]);
+  BOOST_REQUIRE_EQUAL(file.section(3).size,
+                      model.getNumBVs() * sizeof(BVNode<OBBRSS>));
+  const BVNode<OBBRSS>* nodes =
+      static_cast<const BVNode<OBBRSS>*>(file.sectionData(3));
+  for (unsigned int i = 0; i < model.getNumBVs(); ++i)
+    BOOST_CHECK(model.getBV(i) == nodes[i]);
+  boost::filesystem::remove(filename);
+}
+
+BOOST_AUTO_TEST_CASE(invalid_files) {
+  BVHModel<OBBRSS> model;
+  BOOST_CHECK_THROW(saveToFlatBinary(model, temporaryFilename("empty.coal")),
+                    std::invalid_argument);
+
+  generateBVHModel(model, Sphere(1), Transform3s(), 8, 8);
+  const std::string filename = temporaryFilename("mesh.coal");
+  saveToFlatBinary(model, filename);
+
+  // Wrong BV type.
+  BVHModel<AABB> aabb_model;
+  BOOST_CHECK_THROW(loadFromFlatBinary(aabb_model, filename),
+                    std::invalid_argument);
+  // Wrong object type.
+  HeightField<OBBRSS> hfield;
+  BOOST_CHECK_THROW(loadFromFlatBinary(hfield, filename),
+                    std::invalid_argument);
+  // Missing file.
+  BOOST_CHECK_THROW(loadFromFlatBinary(model, filename + ".missing"),
+                    std::invalid_argument);
+
+  // Truncated file.
+  const std::uintmax_t size = boost::filesystem::file_size(filename);
+  boost::filesystem::resize_file(filename, size - 8);
+  BOOST_CHECK_THROW(loadFromFlatBinary(model, filename),
+                    std::invalid_argument);
+
+  // Not a flat binary file.
+  {
+    std::ofstream ofs(filename.c_str(), std::ios::trunc);
+    ofs << "this is not a flat binary file, but it is long enough to hold a "
+           "header";
+  }
+  BOOST_CHECK_THROW(loadFromFlatBinary(model, filename),
+                    std::invalid_argument);
+  boost::filesystem::remove(filename);
+}
+
+/// @brief Copies src to a new file and overwrites it with value at the given
+/// offset of its i-th section.
+template <typename T>
+std::string corruptedCopy(const std::string& src, std::size_t i,
+                          std::uint64_t offset, const T& value) {
+  std::uint64_t position;
+  {
+    FlatBinaryFile file(src);
+    position = file.section(i).offset + offset;
+  }
+  const std::string filename = temporaryFilename("corrupted.coal");
+  boost::filesystem::copy_file(src, filename);
+  std::fstream fs(filename.c_str(),
+                  std::ios::binary | std::ios::in | std::ios::out);
+  fs.seekp(static_cast<std::streamoff>(position));
+  fs.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  return filename;
+}
+
+template <typename T>
+void checkCorruptedLoad(const std::string& src, std::size_t i,
+                        std::uint64_t offset, const T& value) {
+  const std::string filename = corruptedCopy(src, i, offset, value);
+  BVHModel<OBBRSS> model;
+  HeightField<OBBRSS> hfield;
+  if (FlatBinaryFile(src).header().object_type == FLAT_BINARY_BVH_MODEL)
+    BOOST_CHECK_THROW(loadFromFlatBinary(model, filename),
+                      std::invalid_argument);
+  else
+    BOOST_CHECK_THROW(loadFromFlatBinary(hfield, filename),
+                      std::invalid_argument);
+  boost::filesystem::remove(filename);
+}
+
+BOOST_AUTO_TEST_CASE(corrupted_indices) {
+  BVHModel<OBBRSS> model;
+  generateBVHModel(model, Sphere(1), Transform3s(), 8, 8);
+  const std::string filename = temporaryFilename("mesh.coal");
+  saveToFlatBinary(model, filename);
+  const BVNode<OBBRSS>& root = model.getBV(0);
+  const std::uint64_t first_child_offset = static_cast<std::uint64_t>(
+      reinterpret_cast<const char*>(&root.first_child) -
+      reinterpret_cast<const char*>(&root));
+  const std::uint64_t num_primitives_offset = static_cast<std::uint64_t>(
+      reinterpret_cast<const char*>(&root.num_primitives) -
+      reinterpret_cast<const char*>(&root));
+  const std::uint64_t last_node_offset =
+      (model.getNumBVs() - 1) * sizeof(BVNode<OBBRSS>);
+
+  // Vertex index of the second triangle.
+  checkCorruptedLoad(filename, 2,
+                     sizeof(Triangle32) + sizeof(Triangle32::IndexType),
+                     Triangle32::IndexType(model.num_vertices));
+  // Root pointing to itself, and children past the end.
+  checkCorruptedLoad(filename, 3, first_child_offset, int(0));
+  checkCorruptedLoad(filename, 3, first_child_offset,
+                     int(model.getNumBVs() - 1));
+  // Leaf pointing to a missing triangle.
+  BOOST_REQUIRE(model.getBV(model.getNumBVs() - 1).isLeaf());
+  checkCorruptedLoad(filename, 3, last_node_offset + first_child_offset,
+                     -int(model.num_tris) - 1);
+  checkCorruptedLoad(filename, 3, num_primitives_offset,
+                     model.num_tris + 1);
+  // Primitive index.
+  checkCorruptedLoad(filename, 4, 0, model.num_tris);
+
+  // The untouched file still loads.
+  BVHModel<OBBRSS> loaded;
+  loadFromFlatBinary(loaded, filename);
+  BOOST_CHECK(model == loaded);
+  boost::filesystem::remove(filename);
+
+  const HeightField<OBBRSS> hfield(2, 3, MatrixXs::Random(5, 4), -1);
+  const std::string hfield_filename = temporaryFilename("hfield.coal");
+  saveToFlatBinary(hfield, hfield_filename);
+  const HFNode<OBBRSS>& hroot = hfield.getBV(0);
+  const char* hroot_begin = reinterpret_cast<const char*>(&hroot);
+  checkCorruptedLoad(
+      hfield_filename, 4,
+      static_cast<std::uint64_t>(
+          reinterpret_cast<const char*>(&hroot.first_child) - hroot_begin),
+      // Number of nodes of the 4 x 3 cells.
+      std::size_t(2 * 4 * 3 - 1));
+  checkCorruptedLoad(
+      hfield_filename, 4,
+      static_cast<std::uint64_t>(
+          reinterpret_cast<const char*>(&hroot.x_size) - hroot_begin),
+      Eigen::DenseIndex(4));
+  boost::filesystem::remove(hfield_filename);
+}
@@ -42,11 +42,14 @@
 #include "coal/internal/traversal_node_setup.h"
 #include <../src/collision_node.h>
 #include "coal/internal/BV_splitter.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
 #include "utility.h"
 
 #include "fcl_resources/config.h"
 #include <boost/filesystem.hpp>
 
+#include <algorithm>
+
 using namespace coal;
 namespace utf = boost::unit_test::framework;
 
@@ -428,3 +431,44 @@ bool collide_Test(const Transform3s& tf, const std::vector<Vec3s>& vertices1,
   else
     return false;
 }
+
+BOOST_AUTO_TEST_CASE(front_list_duplicate_contacts) {
+  // The front built at the first pose only holds the roots. At the second
+  // pose, the traversal from this front reaches the leaves, whose pairs must
+  // be tested once.
+  BVHModel<OBBRSS> m1, m2;
+  generateBVHModel(m1, Sphere(1), Transform3s(), 16, 16);
+  generateBVHModel(m2, Sphere(1), Transform3s(), 16, 16);
+
+  const CollisionRequest request(NO_REQUEST,
+                                 (std::numeric_limits<int>::max)());
+  const Transform3s pose2;
+  Transform3s pose1;
+  pose1.setTranslation(Vec3s(3, 0, 0));
+
+  BVHFrontList front_list;
+  CollisionResult result;
+  MeshCollisionTraversalNodeOBBRSS node(request);
+  BOOST_REQUIRE(initialize(node, m1, pose1, m2, pose2, result));
+  collide(&node, request, result, &front_list);
+  BOOST_CHECK(!result.isCollision());
+  BOOST_CHECK_EQUAL(front_list.size(), 1);
+
+  pose1.setTranslation(Vec3s(1.8, 0, 0));
+  CollisionResult expected;
+  MeshCollisionTraversalNodeOBBRSS reference_node(request);
+  BOOST_REQUIRE(initialize(reference_node, m1, pose1, m2, pose2, expected));
+  collide(&reference_node, request, expected);
+  BOOST_REQUIRE(expected.isCollision());
+
+  result.clear();
+  BOOST_REQUIRE(initialize(node, m1, pose1, m2, pose2, result));
+  collide(&node, request, result, &front_list);
+  BOOST_CHECK_EQUAL(result.numContacts(), expected.numContacts());
+
+  std::vector<std::pair<int, int> > pairs;
+  for (const Contact& contact : result.getContacts())
+    pairs.push_back(std::make_pair(contact.b1, contact.b2));
+  std::sort(pairs.begin(), pairs.end());
+  BOOST_CHECK(std::adjacent_find(pairs.begin(), pairs.end()) == pairs.end());
+}
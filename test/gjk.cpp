@@ -500,3 +500,68 @@ BOOST_AUTO_TEST_CASE(triangle_capsule) {
   test_gjk_triangle_capsule(Vec3s(Scalar(-0.5), Scalar(-0.01), 0), true, true,
                             Vec3s(0, 1, 0), Vec3s(Scalar(0.5), 0, 0));
 }
+
+template <typename S0, typename S1>
+void test_gjk_specialized_support(const S0& s0, const S1& s1) {
+  using namespace coal;
+  typedef details::SupportOptions SupportOptions;
+  BOOST_CHECK((details::HasSpecializedGJK<
+               S0, S1, SupportOptions::NoSweptSphere>::value));
+
+  std::vector<Transform3s> tfs;
+  Scalar extents[] = {-2, -2, -2, 2, 2, 2};
+  generateRandomTransforms(extents, tfs, 100);
+  for (const Transform3s& tf : tfs) {
+    details::MinkowskiDiff shape;
+    shape.set<SupportOptions::NoSweptSphere>(&s0, &s1, Transform3s(), tf);
+
+    // Function pointer path and compile-time support function.
+    details::GJK gjk(128, SolverScalar(1e-8));
+    details::GJK gjk_tpl(128, SolverScalar(1e-8));
+    const details::GJK::Status status = gjk.evaluate(shape, Vec3ps(1, 0, 0));
+    const details::GJK::Status status_tpl =
+        gjk_tpl.evaluate<details::getSupportFuncTpl<
+            S0, S1, false, SupportOptions::NoSweptSphere> >(shape,
+                                                            Vec3ps(1, 0, 0));
+    BOOST_CHECK_EQUAL(status, status_tpl);
+    BOOST_CHECK_EQUAL(gjk.getNumIterations(), gjk_tpl.getNumIterations());
+    BOOST_CHECK_CLOSE(gjk.distance, gjk_tpl.distance, 1e-6);
+    if (status != details::GJK::Collision) continue;
+
+    details::EPA epa(64, SolverScalar(1e-8));
+    details::EPA epa_tpl(64, SolverScalar(1e-8));
+    const details::EPA::Status epa_status =
+        epa.evaluate(gjk, Vec3ps(-1, 0, 0));
+    const details::EPA::Status epa_status_tpl =
+        epa_tpl.evaluate<details::getSupportFuncTpl<
+            S0, S1, false, SupportOptions::NoSweptSphere> >(gjk_tpl,
+                                                            Vec3ps(-1, 0, 0));
+    BOOST_CHECK_EQUAL(epa_status, epa_status_tpl);
+    BOOST_CHECK_CLOSE(epa.depth, epa_tpl.depth, 1e-6);
+    EIGEN_VECTOR_IS_APPROX(epa.normal, epa_tpl.normal, SolverScalar(1e-8));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(specialized_support) {
+  using namespace coal;
+  const Box box(1, Scalar(0.5), 2);
+  const Sphere sphere(Scalar(0.7));
+  const Capsule capsule(Scalar(0.3), Scalar(1.5));
+  const Cylinder cylinder(Scalar(0.5), 1);
+  const Cone cone(Scalar(0.5), 1);
+  const Ellipsoid ellipsoid(Scalar(0.4), Scalar(0.6), Scalar(0.8));
+  const TriangleP triangle(Vec3s(0, 0, 0), Vec3s(1, 0, 0), Vec3s(0, 1, 0));
+
+  test_gjk_specialized_support(box, box);
+  test_gjk_specialized_support(box, capsule);
+  test_gjk_specialized_support(capsule, sphere);
+  test_gjk_specialized_support(cylinder, cone);
+  test_gjk_specialized_support(ellipsoid, box);
+  test_gjk_specialized_support(triangle, cylinder);
+
+  BOOST_CHECK(!(details::HasSpecializedGJK<
+                Box, ConvexBase32,
+                details::SupportOptions::NoSweptSphere>::value));
+  BOOST_CHECK(!(details::HasSpecializedGJK<
+                Box, Box, details::SupportOptions::WithSweptSphere>::value));
+}
@@ -0,0 +1,187 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of INRIA nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE COAL_GJK_BATCH
+#include <boost/test/included/unit_test.hpp>
+
+#include "coal/narrowphase/narrowphase.h"
+#include "coal/shape/geometric_shapes.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+namespace {
+
+/// Poses of the second shape around the first one, close enough for some of
+/// them to be in collision. The number of poses is not a multiple of the
+/// number of lanes.
+std::vector<Transform3s> makePoses() {
+  Scalar extents[] = {-0.8, -0.8, -0.8, 0.8, 0.8, 0.8};
+  std::vector<Transform3s> tfs;
+  generateRandomTransforms(extents, tfs, 4 * details::GJK_BATCH_LANES + 3);
+  return tfs;
+}
+
+/// Compares the batch `shapeDistance` to the scalar one, pose by pose.
+/// Returns the number of poses in collision.
+template <typename S1, typename S2>
+std::size_t checkBatchShapeDistance(const S1& s1, const S2& s2,
+                                    const GJKSolver& settings) {
+  const Transform3s tf1(Transform3s::Identity());
+  const std::vector<Transform3s> tfs2 = makePoses();
+  const bool compute_penetration = true;
+
+  GJKSolver batch_solver(settings);
+  std::vector<Scalar> distances;
+  std::vector<Vec3s> p1s, p2s, normals;
+  batch_solver.shapeDistance(s1, tf1, s2, tfs2, compute_penetration,
+                             distances, p1s, p2s, normals);
+  BOOST_REQUIRE_EQUAL(distances.size(), tfs2.size());
+  BOOST_REQUIRE_EQUAL(normals.size(), tfs2.size());
+
+  const Scalar tol = Scalar(1e-4);
+  // GJK's tolerance bounds the error on the distance. The direction of the
+  // normal is less accurate, e.g. between a face and a flat base.
+  const Scalar normal_tol = Scalar(1e-2);
+  std::size_t num_collisions = 0;
+  for (std::size_t i = 0; i < tfs2.size(); ++i) {
+    // The batch falls back to the generic shapeDistance, whereas the
+    // overloads for triangles run EPA in another frame.
+    GJKSolver solver(settings);
+    Vec3s p1, p2, normal;
+    const Scalar distance = solver.shapeDistance<S1, S2>(
+        s1, tf1, s2, tfs2[i], compute_penetration, p1, p2, normal);
+
+    if (distance > settings.distance_upper_bound) {
+      // Early stopped: both distances are lower bounds above the upper bound.
+      BOOST_CHECK(distances[i] > settings.distance_upper_bound);
+      continue;
+    }
+    BOOST_CHECK_SMALL(distances[i] - distance, tol);
+    EIGEN_VECTOR_IS_APPROX(normals[i], normal, normal_tol);
+    EIGEN_VECTOR_IS_APPROX((p2s[i] - p1s[i]).eval(), (p2 - p1).eval(),
+                           normal_tol);
+    if (distance <= 0) {
+      ++num_collisions;
+      // Poses in collision go through the scalar GJK and EPA.
+      EIGEN_VECTOR_IS_APPROX(p1s[i], p1, tol);
+      EIGEN_VECTOR_IS_APPROX(p2s[i], p2, tol);
+    }
+  }
+  return num_collisions;
+}
+
+template <typename S1, typename S2>
+void checkBatchShapeDistance(const S1& s1, const S2& s2) {
+  GJKSolver settings;
+  settings.enable_batch_gjk = true;
+  const std::size_t num_collisions = checkBatchShapeDistance(s1, s2, settings);
+  BOOST_CHECK(num_collisions > 0);
+  BOOST_CHECK(num_collisions < makePoses().size());
+
+  settings.distance_upper_bound = 0.5;
+  checkBatchShapeDistance(s1, s2, settings);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(sphere_sphere_lanes) {
+  // Separated spheres: every lane concludes without the scalar GJK.
+  const Sphere s0(0.5), s1(0.25);
+  const int num_lanes = details::GJK_BATCH_LANES - 1;
+  std::vector<Transform3s> oM1(details::GJK_BATCH_LANES);
+  std::vector<Vec3ps> guesses(details::GJK_BATCH_LANES, Vec3ps(1, 0, 0));
+  for (int k = 0; k < num_lanes; ++k) {
+    oM1[k].setTranslation(Vec3s(1 + Scalar(k), Scalar(0.3) * Scalar(k), -1));
+    oM1[k].setQuatRotation(Quats::UnitRandom());
+  }
+
+  details::BatchGJK<Sphere, Sphere> gjk(GJK_DEFAULT_MAX_ITERATIONS,
+                                        GJK_DEFAULT_TOLERANCE);
+  gjk.evaluate(s0, s1, oM1.data(), guesses.data(), num_lanes);
+  for (int k = 0; k < num_lanes; ++k) {
+    BOOST_CHECK_EQUAL(gjk.status[k], details::GJK::NoCollision);
+    const Vec3s t = oM1[k].getTranslation();
+    BOOST_CHECK_SMALL(
+        Scalar(gjk.distance[k]) - (t.norm() - s0.radius - s1.radius),
+        Scalar(1e-6));
+    Vec3ps w0, w1, normal;
+    gjk.getWitnessPointsAndNormal(k, w0, w1, normal);
+    EIGEN_VECTOR_IS_APPROX(normal.cast<Scalar>(), t.normalized(), 1e-6);
+    EIGEN_VECTOR_IS_APPROX(w0.cast<Scalar>(), (s0.radius * normal).eval(),
+                           1e-6);
+  }
+  BOOST_CHECK_EQUAL(gjk.status[num_lanes], details::GJK::DidNotRun);
+}
+
+BOOST_AUTO_TEST_CASE(box_box) {
+  checkBatchShapeDistance(Box(1, 0.5, 0.8), Box(0.3, 0.9, 0.6));
+}
+
+BOOST_AUTO_TEST_CASE(sphere_capsule) {
+  checkBatchShapeDistance(Sphere(0.4), Capsule(0.2, 0.8));
+}
+
+BOOST_AUTO_TEST_CASE(ellipsoid_cylinder) {
+  checkBatchShapeDistance(Ellipsoid(0.5, 0.3, 0.2), Cylinder(0.3, 0.7));
+}
+
+BOOST_AUTO_TEST_CASE(cone_triangle) {
+  checkBatchShapeDistance(
+      Cone(0.4, 0.9), TriangleP(Vec3s(-0.5, -0.2, 0), Vec3s(0.6, -0.1, 0.1),
+                                Vec3s(0, 0.7, -0.2)));
+}
+
+BOOST_AUTO_TEST_CASE(swept_sphere_radius) {
+  Box box(0.6, 0.4, 0.7);
+  box.setSweptSphereRadius(0.1);
+  Capsule capsule(0.2, 0.5);
+  capsule.setSweptSphereRadius(0.05);
+  checkBatchShapeDistance(box, capsule);
+}
+
+BOOST_AUTO_TEST_CASE(settings_without_batch) {
+  // By default, the GJK variants and the shapes without batch GJK go through
+  // the scalar GJK, pose by pose.
+  GJKSolver settings;
+  BOOST_CHECK(!settings.enable_batch_gjk);
+  checkBatchShapeDistance(Box(1, 0.5, 0.8), Sphere(0.3), settings);
+  settings.enable_batch_gjk = true;
+  settings.gjk_variant = GJKVariant::NesterovAcceleration;
+  checkBatchShapeDistance(Box(1, 0.5, 0.8), Sphere(0.3), settings);
+
+  const ConvexTpl<Quadrilateral32> convex = buildBox(0.4, 0.8, 0.5);
+  checkBatchShapeDistance(convex, Capsule(0.2, 0.4), GJKSolver());
+}
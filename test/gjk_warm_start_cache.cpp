@@ -0,0 +1,230 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE COAL_GJK_WARM_START_CACHE
+#include <boost/test/included/unit_test.hpp>
+
+#include "coal/collision.h"
+#include "coal/distance.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/shape/geometric_shapes.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
+#include "coal/broadphase/broadphase_dynamic_AABB_tree.h"
+#include "coal/broadphase/default_broadphase_callbacks.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+namespace {
+
+GJKWarmStartCache::Key makeKey(const void* o1, const void* o2) {
+  const GJKWarmStartCache::Key key = {o1, o2};
+  return key;
+}
+
+/// Placement of the second object along a smooth trajectory around the first
+/// one.
+Transform3s trajectory(std::size_t i) {
+  const Scalar t = Scalar(i) * Scalar(0.01);
+  return Transform3s(
+      Eigen::AngleAxis<Scalar>(t, Vec3s(0, 0, 1)).toRotationMatrix(),
+      Vec3s(Scalar(1.6) * std::cos(t), Scalar(1.6) * std::sin(t),
+            Scalar(0.1) * std::sin(3 * t)));
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(lru_eviction) {
+  int a, b, c;
+  GJKWarmStartCache cache(2);
+  support_func_guess_t hint = support_func_guess_t::Zero();
+  cache.insert(makeKey(&a, &b), Vec3s(1, 0, 0), hint, 3);
+  cache.insert(makeKey(&a, &c), Vec3s(0, 1, 0), hint, 5);
+  BOOST_CHECK_EQUAL(cache.size(), 2);
+
+  // Reversed pairs are different entries: the guess depends on the order.
+  Vec3s guess(0, 0, 0);
+  BOOST_CHECK(!cache.find(makeKey(&b, &a), guess, hint));
+  BOOST_CHECK(guess.isZero());
+
+  // Touch (a, b) so that (a, c) becomes the least recently used entry.
+  BOOST_CHECK(cache.find(makeKey(&a, &b), guess, hint));
+  BOOST_CHECK(guess.isApprox(Vec3s(1, 0, 0)));
+  cache.insert(makeKey(&b, &c), Vec3s(0, 0, 1), hint);
+  BOOST_CHECK_EQUAL(cache.size(), 2);
+  BOOST_CHECK(!cache.find(makeKey(&a, &c), guess, hint));
+  BOOST_CHECK(cache.find(makeKey(&b, &c), guess, hint));
+  BOOST_CHECK(guess.isApprox(Vec3s(0, 0, 1)));
+
+  // Updating an entry does not evict anything.
+  hint << 4, 2;
+  cache.insert(makeKey(&a, &b), Vec3s(-1, 0, 0), hint);
+  support_func_guess_t found_hint = support_func_guess_t::Zero();
+  BOOST_CHECK(cache.find(makeKey(&a, &b), guess, found_hint));
+  BOOST_CHECK(guess.isApprox(Vec3s(-1, 0, 0)));
+  BOOST_CHECK(found_hint == hint);
+
+  GJKWarmStartCache::Statistics stats = cache.getStatistics();
+  BOOST_CHECK_EQUAL(stats.num_hits, 3);
+  BOOST_CHECK_EQUAL(stats.num_misses, 2);
+  BOOST_CHECK_EQUAL(stats.num_evictions, 1);
+  BOOST_CHECK_EQUAL(stats.num_gjk_calls, 4);
+  BOOST_CHECK_EQUAL(stats.num_gjk_iterations, 8);
+
+  cache.erase(&c);
+  BOOST_CHECK_EQUAL(cache.size(), 1);
+  cache.setCapacity(0);
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+  cache.insert(makeKey(&a, &b), Vec3s(1, 0, 0), hint);
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+
+  cache.resetStatistics();
+  BOOST_CHECK_EQUAL(cache.getStatistics().num_hits, 0);
+}
+
+BOOST_AUTO_TEST_CASE(shape_pair_trajectory) {
+  CollisionObject o1(make_shared<Ellipsoid>(1, Scalar(0.6), Scalar(0.8)));
+  CollisionObject o2(make_shared<Cylinder>(Scalar(0.5), Scalar(1.2)));
+
+  GJKWarmStartCache cache, cold(0);
+  CollisionRequest col_req;
+  DistanceRequest dist_req;
+  for (std::size_t i = 0; i < 200; ++i) {
+    o2.setTransform(trajectory(i));
+
+    CollisionResult ref, res_warm, res_cold;
+    collide(&o1, &o2, col_req, ref);
+    collide(&o1, &o2, col_req, res_warm, cache);
+    collide(&o1, &o2, col_req, res_cold, cold);
+    BOOST_CHECK_EQUAL(ref.isCollision(), res_warm.isCollision());
+    BOOST_CHECK_EQUAL(ref.isCollision(), res_cold.isCollision());
+
+    DistanceResult dref, dres;
+    distance(&o1, &o2, dist_req, dref);
+    distance(&o1, &o2, dist_req, dres, cache);
+    BOOST_CHECK_SMALL(dref.min_distance - dres.min_distance, Scalar(1e-5));
+  }
+
+  // One entry per pair: collision and distance share it.
+  BOOST_CHECK_EQUAL(cache.size(), 1);
+  const GJKWarmStartCache::Statistics warm = cache.getStatistics();
+  const GJKWarmStartCache::Statistics cold_stats = cold.getStatistics();
+  BOOST_CHECK_EQUAL(warm.num_misses, 1);
+  BOOST_CHECK_EQUAL(warm.num_hits, 399);
+  BOOST_CHECK_EQUAL(cold_stats.num_gjk_calls, 200);
+  BOOST_CHECK_LT(warm.num_gjk_iterations / 2, cold_stats.num_gjk_iterations);
+
+  // Only the collision queries, to compare the iteration counts.
+  GJKWarmStartCache warm_col;
+  for (std::size_t i = 0; i < 200; ++i) {
+    o2.setTransform(trajectory(i));
+    CollisionResult res;
+    collide(&o1, &o2, col_req, res, warm_col);
+  }
+  BOOST_CHECK_LT(warm_col.getStatistics().num_gjk_iterations,
+                 cold_stats.num_gjk_iterations);
+
+  // Analytic pairs do not use GJK and do not fill the cache.
+  CollisionObject s1(make_shared<Sphere>(1)), s2(make_shared<Sphere>(1));
+  GJKWarmStartCache analytic;
+  CollisionResult res;
+  collide(&s1, &s2, col_req, res, analytic);
+  BOOST_CHECK_EQUAL(analytic.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(meshes_are_not_cached) {
+  shared_ptr<BVHModel<OBBRSS> > mesh1(new BVHModel<OBBRSS>()),
+      mesh2(new BVHModel<OBBRSS>());
+  generateBVHModel(*mesh1, Sphere(1), Transform3s(), 10, 10);
+  generateBVHModel(*mesh2, Box(1, 1, 1), Transform3s());
+  CollisionObject m1(mesh1), m2(mesh2, Transform3s(Vec3s(1.2, 0, 0)));
+  CollisionObject box(make_shared<Box>(1, 1, 1),
+                      Transform3s(Vec3s(Scalar(1.2), 0, 0)));
+
+  CollisionRequest request(CONTACT, 1000);
+  DistanceRequest dist_req;
+  GJKWarmStartCache cache;
+  for (int i = 0; i < 2; ++i) {
+    CollisionResult ref, res;
+    collide(&box, &m1, request, ref);
+    collide(&box, &m1, request, res, cache);
+    BOOST_CHECK(res.isCollision());
+    BOOST_CHECK_EQUAL(ref.numContacts(), res.numContacts());
+
+    ref.clear();
+    res.clear();
+    collide(&m1, &m2, request, ref);
+    collide(&m1, &m2, request, res, cache);
+    BOOST_CHECK(res.isCollision());
+    BOOST_CHECK_EQUAL(ref.numContacts(), res.numContacts());
+
+    m2.setTransform(Transform3s(Vec3s(3, 0, 0)));
+    DistanceResult dref, dres;
+    distance(&m1, &m2, dist_req, dref);
+    distance(&m1, &m2, dist_req, dres, cache);
+    BOOST_CHECK_SMALL(dref.min_distance - dres.min_distance, Scalar(1e-8));
+    m2.setTransform(Transform3s(Vec3s(1.2, 0, 0)));
+  }
+
+  // The pairs involving a mesh neither read nor fill the cache.
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+  const GJKWarmStartCache::Statistics stats = cache.getStatistics();
+  BOOST_CHECK_EQUAL(stats.num_hits + stats.num_misses, 0);
+  BOOST_CHECK_EQUAL(stats.num_gjk_calls, 0);
+}
+
+BOOST_AUTO_TEST_CASE(broadphase_callback) {
+  std::vector<CollisionObject*> env;
+  generateEnvironments(env, 5, 50);
+
+  DynamicAABBTreeCollisionManager manager;
+  manager.registerObjects(env);
+  manager.setup();
+
+  CollisionCallBackDefault ref, warm;
+  ref.data.request.num_max_contacts = 1000;
+  warm.data.request.num_max_contacts = 1000;
+  warm.data.warm_start_cache = make_shared<GJKWarmStartCache>();
+  for (int frame = 0; frame < 2; ++frame) {
+    manager.collide(&ref);
+    manager.collide(&warm);
+    BOOST_CHECK_EQUAL(ref.data.result.numContacts(),
+                      warm.data.result.numContacts());
+  }
+  // The cache persists across the frames.
+  BOOST_CHECK_GT(warm.data.warm_start_cache->getStatistics().num_hits, 0);
+
+  for (std::size_t i = 0; i < env.size(); ++i) delete env[i];
+}
@@ -48,6 +48,8 @@
 #include "coal/mesh_loader/loader.h"
 
 #include "coal/collision.h"
+#include "coal/distance.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
 #include "coal/internal/traversal_node_hfield_shape.h"
 
 #include "utility.h"
@@ -931,3 +933,244 @@ BOOST_AUTO_TEST_CASE(test_hfield_single_bin) {
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(hfield_update_heights_block) {
+  const Eigen::DenseIndex nx = 37, ny = 23;
+  const Scalar x_dim = 2., y_dim = 1., min_altitude = -1.;
+  MatrixXs heights = MatrixXs::Random(ny, nx);
+
+  HeightField<OBBRSS> hfield(x_dim, y_dim, heights, min_altitude);
+
+  // Blocks at the corners, on the borders and inside the grid.
+  const Eigen::DenseIndex blocks[][4] = {{0, 0, 3, 5},   {20, 30, 3, 7},
+                                         {5, 0, 10, 1},  {0, 11, 1, 26},
+                                         {7, 13, 6, 9},  {0, 0, ny, nx},
+                                         {12, 17, 1, 1}, {4, 4, 0, 3}};
+  for (const Eigen::DenseIndex* block : blocks) {
+    const MatrixXs values = MatrixXs::Random(block[2], block[3]);
+    hfield.updateHeights(values, block[0], block[1]);
+    heights.block(block[0], block[1], block[2], block[3]) = values;
+
+    const HeightField<OBBRSS> hfield_check(x_dim, y_dim, heights,
+                                           min_altitude);
+    BOOST_CHECK(hfield == hfield_check);
+  }
+
+  BOOST_CHECK_THROW(hfield.updateHeights(MatrixXs::Zero(3, 3), ny - 2, 0),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(hfield.updateHeights(MatrixXs::Zero(3, 3), 0, -1),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(hfield_scroll) {
+  const Eigen::DenseIndex nx = 31, ny = 17;
+  const Scalar x_dim = 3., y_dim = 2., min_altitude = -1., fill = 0.25;
+  const Scalar dx = x_dim / Scalar(nx - 1), dy = y_dim / Scalar(ny - 1);
+  MatrixXs heights = MatrixXs::Random(ny, nx);
+
+  HeightField<AABB> hfield(x_dim, y_dim, heights, min_altitude);
+  Vec3s offset(Vec3s::Zero());
+
+  const Eigen::DenseIndex shifts[][2] = {{3, 0}, {0, 2},  {-4, 1},
+                                         {2, -5}, {0, 0}, {nx, -1}};
+  for (const Eigen::DenseIndex* shift : shifts) {
+    hfield.scroll(shift[0], shift[1], fill);
+    offset += Vec3s(Scalar(shift[0]) * dx, Scalar(shift[1]) * dy, 0);
+
+    // Heights of the cells which remain in the grid keep their position.
+    MatrixXs expected = MatrixXs::Constant(ny, nx, fill);
+    for (Eigen::DenseIndex row = 0; row < ny; ++row) {
+      for (Eigen::DenseIndex col = 0; col < nx; ++col) {
+        const Eigen::DenseIndex old_row = row - shift[1],
+                                old_col = col + shift[0];
+        if (old_row >= 0 && old_row < ny && old_col >= 0 && old_col < nx)
+          expected(row, col) = heights(old_row, old_col);
+      }
+    }
+    heights = expected;
+    BOOST_CHECK(hfield.getHeights() == heights);
+
+    // The hierarchy is the one of the same height field, moved by the offset.
+    const HeightField<AABB> hfield_check(x_dim, y_dim, heights, min_altitude);
+    const VecXs x_grid = hfield_check.getXGrid().array() + offset[0],
+                y_grid = hfield_check.getYGrid().array() + offset[1];
+    BOOST_CHECK(hfield.getXGrid().isApprox(x_grid));
+    BOOST_CHECK(hfield.getYGrid().isApprox(y_grid));
+    BOOST_CHECK(hfield.getMaxHeight() == hfield_check.getMaxHeight());
+    BOOST_CHECK(hfield.getNodes().size() == hfield_check.getNodes().size());
+    for (std::size_t k = 0; k < hfield.getNodes().size(); ++k) {
+      const HFNode<AABB>& node = hfield.getNodes()[k];
+      const HFNode<AABB>& node_check = hfield_check.getNodes()[k];
+      BOOST_CHECK(static_cast<const HFNodeBase&>(node) ==
+                  static_cast<const HFNodeBase&>(node_check));
+      BOOST_CHECK(node.bv.min_.isApprox(node_check.bv.min_ + offset));
+      BOOST_CHECK(node.bv.max_.isApprox(node_check.bv.max_ + offset));
+    }
+  }
+}
+
+namespace {
+/// Smooth terrain with some noise, whose heights stay above -0.5.
+MatrixXs makeTerrain(const Eigen::DenseIndex nx, const Eigen::DenseIndex ny) {
+  MatrixXs heights(ny, nx);
+  for (Eigen::DenseIndex row = 0; row < ny; ++row)
+    for (Eigen::DenseIndex col = 0; col < nx; ++col)
+      heights(row, col) = Scalar(0.2) * std::sin(Scalar(0.4 * double(col))) *
+                          std::cos(Scalar(0.3 * double(row)));
+  return heights + Scalar(0.05) * MatrixXs::Random(ny, nx);
+}
+}  // namespace
+
+template <typename BV>
+void test_hfield_mesh(const Transform3s& hfield_pose) {
+  const Scalar x_dim = 2., y_dim = 2., min_altitude = -1.;
+  const MatrixXs heights = makeTerrain(21, 17);
+  const HeightField<BV> hfield(x_dim, y_dim, heights, min_altitude);
+
+  // Triangulated surface of the height field, as used to be done before the
+  // height field - mesh queries.
+  BVHModel<OBBRSS> terrain;
+  triangulateHeightField(hfield.getHeights(), hfield.getXGrid(),
+                         hfield.getYGrid(), terrain);
+
+  BVHModel<OBBRSS> mesh;
+  generateBVHModel(mesh, Box(0.3, 0.2, 0.1), Transform3s());
+
+  Scalar extents[] = {-0.8, -0.8, -0.4, 0.8, 0.8, 0.6};
+  std::vector<Transform3s> poses;
+  generateRandomTransforms(extents, poses, 200);
+
+  const CollisionRequest request;
+  const DistanceRequest distance_request;
+  std::size_t num_collisions = 0;
+  for (const Transform3s& pose : poses) {
+    const Transform3s mesh_pose = hfield_pose * pose;
+
+    CollisionResult result, terrain_result, swapped_result;
+    const bool collision =
+        collide(&hfield, hfield_pose, &mesh, mesh_pose, request, result);
+    const bool terrain_collision = collide(&terrain, hfield_pose, &mesh,
+                                           mesh_pose, request, terrain_result);
+    const bool swapped_collision = collide(&mesh, mesh_pose, &hfield,
+                                           hfield_pose, request,
+                                           swapped_result);
+    num_collisions += collision;
+
+    // The mesh may be inside the volume of the height field without touching
+    // its surface.
+    BOOST_CHECK(!terrain_collision || collision);
+    BOOST_CHECK(swapped_collision == collision);
+    if (collision) {
+      const Contact& contact = result.getContact(0);
+      const Contact& swapped_contact = swapped_result.getContact(0);
+      BOOST_CHECK(contact.o1 == &hfield);
+      BOOST_CHECK(contact.o2 == &mesh);
+      BOOST_CHECK(swapped_contact.o1 == &mesh);
+      BOOST_CHECK(swapped_contact.o2 == &hfield);
+      BOOST_CHECK(contact.b1 == swapped_contact.b2);
+      BOOST_CHECK(contact.b2 == swapped_contact.b1);
+      EIGEN_VECTOR_IS_APPROX(contact.normal, -swapped_contact.normal, 1e-8);
+    }
+
+    DistanceResult distance_result, terrain_distance_result,
+        swapped_distance_result;
+    const Scalar distance =
+        coal::distance(&hfield, hfield_pose, &mesh, mesh_pose,
+                       distance_request, distance_result);
+    const Scalar swapped_distance =
+        coal::distance(&mesh, mesh_pose, &hfield, hfield_pose,
+                       distance_request, swapped_distance_result);
+    BOOST_CHECK_CLOSE(distance, swapped_distance, 1e-6);
+    EIGEN_VECTOR_IS_APPROX(distance_result.nearest_points[0],
+                           swapped_distance_result.nearest_points[1], 1e-8);
+    BOOST_CHECK(distance_result.o1 == &hfield);
+    BOOST_CHECK(swapped_distance_result.o2 == &hfield);
+
+    if (!collision) {
+      // Above the height field, the closest points lie on its surface.
+      const Scalar terrain_distance =
+          coal::distance(&terrain, hfield_pose, &mesh, mesh_pose,
+                         distance_request, terrain_distance_result);
+      BOOST_CHECK(!terrain_collision);
+      BOOST_CHECK(distance > 0);
+      BOOST_CHECK_SMALL(distance - terrain_distance, 1e-5);
+      BOOST_CHECK_SMALL((distance_result.nearest_points[1] -
+                         distance_result.nearest_points[0])
+                                .norm() -
+                            distance,
+                        1e-5);
+    } else
+      BOOST_CHECK(distance <= 1e-6);
+  }
+  // Both cases are covered by the poses.
+  BOOST_CHECK(num_collisions > 0);
+  BOOST_CHECK(num_collisions < poses.size());
+}
+
+BOOST_AUTO_TEST_CASE(hfield_mesh) {
+  const Transform3s identity;
+  const Transform3s pose(makeQuat(0.9, 0.1, -0.3, 0.2).normalized(),
+                         Vec3s(0.5, -1., 0.3));
+  test_hfield_mesh<AABB>(identity);
+  test_hfield_mesh<OBBRSS>(identity);
+  test_hfield_mesh<AABB>(pose);
+  test_hfield_mesh<OBBRSS>(pose);
+}
+
+template <typename BV1, typename BV2>
+void test_hfield_hfield() {
+  const Scalar x_dim = 2., y_dim = 2., min_altitude = -1.;
+  const HeightField<BV1> hfield1(x_dim, y_dim, makeTerrain(21, 17),
+                                 min_altitude);
+  const HeightField<BV2> hfield2(x_dim, y_dim, makeTerrain(13, 19),
+                                 min_altitude);
+
+  BVHModel<OBBRSS> terrain1, terrain2;
+  triangulateHeightField(hfield1.getHeights(), hfield1.getXGrid(),
+                         hfield1.getYGrid(), terrain1);
+  triangulateHeightField(hfield2.getHeights(), hfield2.getXGrid(),
+                         hfield2.getYGrid(), terrain2);
+
+  // The second height field is upside down above the first one, so that the
+  // closest points lie on the surfaces of both height fields.
+  const Transform3s pose1(makeQuat(0.9, 0.1, -0.3, 0.2).normalized(),
+                          Vec3s(0.5, -1., 0.3));
+  const Matrix3s flip(Eigen::AngleAxis<Scalar>(Scalar(M_PI), Vec3s::UnitX()));
+
+  const CollisionRequest request;
+  const DistanceRequest distance_request;
+  std::size_t num_collisions = 0;
+  for (int k = 0; k < 40; ++k) {
+    const Scalar height = Scalar(0.03) * Scalar(k);
+    const Transform3s pose2 =
+        pose1 * Transform3s(flip, Vec3s(0.05, -0.03, height));
+
+    CollisionResult result, terrain_result;
+    const bool collision =
+        collide(&hfield1, pose1, &hfield2, pose2, request, result);
+    const bool terrain_collision =
+        collide(&terrain1, pose1, &terrain2, pose2, request, terrain_result);
+    num_collisions += collision;
+    BOOST_CHECK(!terrain_collision || collision);
+
+    DistanceResult distance_result, terrain_distance_result;
+    const Scalar distance = coal::distance(&hfield1, pose1, &hfield2, pose2,
+                                           distance_request, distance_result);
+    if (!collision) {
+      const Scalar terrain_distance =
+          coal::distance(&terrain1, pose1, &terrain2, pose2, distance_request,
+                         terrain_distance_result);
+      BOOST_CHECK(!terrain_collision);
+      BOOST_CHECK_SMALL(distance - terrain_distance, 1e-5);
+    } else
+      BOOST_CHECK(distance <= 1e-6);
+  }
+  BOOST_CHECK(num_collisions > 0);
+  BOOST_CHECK(num_collisions < 40);
+}
+
+BOOST_AUTO_TEST_CASE(hfield_hfield) {
+  test_hfield_hfield<AABB, AABB>();
+  test_hfield_hfield<AABB, OBBRSS>();
+  test_hfield_hfield<OBBRSS, OBBRSS>();
+}
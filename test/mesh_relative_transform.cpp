@@ -0,0 +1,184 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE COAL_MESH_RELATIVE_TRANSFORM
+#include <boost/test/included/unit_test.hpp>
+
+#include <vector>
+
+#include "coal/collision.h"
+#include "coal/BV/AABB.h"
+#include "coal/BV/OBB.h"
+#include "coal/BV/kDOP.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/shape/geometric_shapes.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+namespace {
+
+AABB randomAABB() {
+  const Vec3s center(Vec3s::Random());
+  const Vec3s half((Vec3s::Random().array() + 1.5).matrix() / 2);
+  return AABB(center - half, center + half);
+}
+
+Matrix3s randomRotation() {
+  Quats q;
+  q.coeffs().setRandom();
+  q.normalize();
+  return q.toRotationMatrix();
+}
+
+OBB toOBB(const AABB& aabb) {
+  OBB obb;
+  obb.axes.setIdentity();
+  obb.To = aabb.center();
+  obb.extent = (aabb.max_ - aabb.min_) / 2;
+  return obb;
+}
+
+template <typename BV>
+void checkMeshCollisions() {
+  BVHModel<BV> model;
+  generateBVHModel(model, Sphere(1), Transform3s(), 24, 24);
+  BVHModel<BV> other;
+  generateBVHModel(other, Box(0.6, 0.4, 0.8), Transform3s());
+  BVHModel<OBBRSS> model_ref;
+  generateBVHModel(model_ref, Sphere(1), Transform3s(), 24, 24);
+  BVHModel<OBBRSS> other_ref;
+  generateBVHModel(other_ref, Box(0.6, 0.4, 0.8), Transform3s());
+  const BV root_bv = model.getBV(0).bv;
+
+  const Box box(0.5, 0.3, 0.7);
+  const Capsule capsule(0.2, 0.8);
+  std::vector<Transform3s> tf1s, tf2s;
+  Scalar extents[] = {-1.5, -1.5, -1.5, 1.5, 1.5, 1.5};
+  generateRandomTransforms(extents, tf1s, 200);
+  generateRandomTransforms(extents, tf2s, 200);
+
+  CollisionRequest request(CONTACT, 1000);
+  std::size_t num_collisions = 0;
+  for (std::size_t i = 0; i < tf1s.size(); ++i) {
+    CollisionResult result, result_ref;
+    collide(&model, tf1s[i], &box, tf2s[i], request, result);
+    collide(&model_ref, tf1s[i], &box, tf2s[i], request, result_ref);
+    BOOST_CHECK_EQUAL(result.numContacts(), result_ref.numContacts());
+    if (result.isCollision()) ++num_collisions;
+
+    result.clear();
+    result_ref.clear();
+    collide(&model, tf1s[i], &capsule, tf2s[i], request, result);
+    collide(&model_ref, tf1s[i], &capsule, tf2s[i], request, result_ref);
+    BOOST_CHECK_EQUAL(result.numContacts(), result_ref.numContacts());
+
+    result.clear();
+    result_ref.clear();
+    collide(&model, tf1s[i], &other, tf2s[i], request, result);
+    collide(&model_ref, tf1s[i], &other_ref, tf2s[i], request, result_ref);
+    BOOST_CHECK_EQUAL(result.numContacts(), result_ref.numContacts());
+  }
+  BOOST_CHECK(num_collisions > 0);
+  BOOST_CHECK(num_collisions < tf1s.size());
+  // The queries leave the model in its own frame.
+  BOOST_CHECK(model.getBV(0).bv == root_bv);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(aabb_relative_overlap_is_exact) {
+  CollisionRequest request(NO_REQUEST, 1);
+  std::size_t num_disjoint = 0;
+  for (int i = 0; i < 1000; ++i) {
+    const AABB b1(randomAABB()), b2(randomAABB());
+    const Matrix3s R(randomRotation());
+    const Vec3s T(Vec3s::Random());
+
+    Scalar sqr_lower_bound, sqr_lower_bound_ref;
+    const bool overlap_aabb =
+        overlap(R, T, b1, b2, request, sqr_lower_bound);
+    const bool overlap_obb = overlap(R, T, toOBB(b1), toOBB(b2), request,
+                                     sqr_lower_bound_ref);
+    BOOST_CHECK_EQUAL(overlap_aabb, overlap_obb);
+    BOOST_CHECK_EQUAL(overlap(R, T, b1, b2),
+                      overlap(R, T, toOBB(b1), toOBB(b2)));
+    if (!overlap_aabb) {
+      BOOST_CHECK_CLOSE(sqr_lower_bound, sqr_lower_bound_ref, 1e-8);
+      ++num_disjoint;
+    }
+  }
+  BOOST_CHECK(num_disjoint > 0);
+}
+
+BOOST_AUTO_TEST_CASE(kdop_relative_overlap_is_conservative) {
+  CollisionRequest request(NO_REQUEST, 1);
+  std::size_t num_disjoint = 0;
+  for (int i = 0; i < 1000; ++i) {
+    // KDOPs of the corners of random oriented boxes.
+    OBB obb1(toOBB(randomAABB())), obb2(toOBB(randomAABB()));
+    obb1.axes = randomRotation();
+    obb2.axes = randomRotation();
+    KDOP<18> k1, k2;
+    for (int c = 0; c < 8; ++c) {
+      const Vec3s s(c & 1 ? 1 : -1, c & 2 ? 1 : -1, c & 4 ? 1 : -1);
+      k1 += Vec3s(obb1.To + obb1.axes * obb1.extent.cwiseProduct(s));
+      k2 += Vec3s(obb2.To + obb2.axes * obb2.extent.cwiseProduct(s));
+    }
+    const Matrix3s R(randomRotation());
+    const Vec3s T(Vec3s::Random());
+
+    Scalar sqr_lower_bound, sqr_lower_bound_ref;
+    const bool overlap_kdop = overlap(R, T, k1, k2, request, sqr_lower_bound);
+    const bool overlap_obb =
+        overlap(R, T, obb1, obb2, request, sqr_lower_bound_ref);
+    BOOST_CHECK_EQUAL(overlap(R, T, k1, k2), overlap_kdop);
+    // The KDOPs contain the boxes: they may only be less often disjoint.
+    if (!overlap_kdop) {
+      BOOST_CHECK(!overlap_obb);
+      BOOST_CHECK(sqr_lower_bound > 0);
+      ++num_disjoint;
+    }
+  }
+  BOOST_CHECK(num_disjoint > 0);
+}
+
+BOOST_AUTO_TEST_CASE(mesh_collision_in_model_frame) {
+  checkMeshCollisions<AABB>();
+  checkMeshCollisions<KDOP<16> >();
+  checkMeshCollisions<KDOP<18> >();
+  checkMeshCollisions<KDOP<24> >();
+}
@@ -0,0 +1,185 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#define BOOST_TEST_MODULE COAL_METRICS
+#include <boost/test/included/unit_test.hpp>
+
+#include <thread>
+
+#include "coal/collision.h"
+#include "coal/distance.h"
+#include "coal/metrics.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/shape/geometric_shapes.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+namespace {
+std::size_t histogramCount(const CallMetrics& metrics) {
+  std::size_t count = 0;
+  for (std::size_t bin_count : metrics.histogram) count += bin_count;
+  return count;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(histogram_bins) {
+  BOOST_CHECK_EQUAL(CallMetrics::bin(0.), 0);
+  BOOST_CHECK_EQUAL(CallMetrics::bin(0.5), 0);
+  BOOST_CHECK_EQUAL(CallMetrics::bin(1.), 1);
+  BOOST_CHECK_EQUAL(CallMetrics::bin(1.5), 1);
+  BOOST_CHECK_EQUAL(CallMetrics::bin(2.), 2);
+  BOOST_CHECK_EQUAL(CallMetrics::bin(3.), 2);
+  BOOST_CHECK_EQUAL(CallMetrics::bin(1e12), CallMetrics::num_histogram_bins - 1);
+
+  for (std::size_t bin = 0; bin + 1 < CallMetrics::num_histogram_bins; ++bin) {
+    const double bound = CallMetrics::binUpperBound(bin);
+    BOOST_CHECK_EQUAL(CallMetrics::bin(0.99 * bound), bin);
+    BOOST_CHECK_EQUAL(CallMetrics::bin(bound), bin + 1);
+  }
+  BOOST_CHECK(std::isinf(
+      CallMetrics::binUpperBound(CallMetrics::num_histogram_bins - 1)));
+}
+
+BOOST_AUTO_TEST_CASE(count_queries) {
+  MetricsRegistry& registry = MetricsRegistry::instance();
+  BOOST_CHECK(!registry.isEnabled());
+  registry.setEnabled(true);
+  registry.reset();
+
+  Sphere s1(0.5), s2(0.3);
+  shared_ptr<BVHModel<OBBRSS> > mesh(new BVHModel<OBBRSS>);
+  generateBVHModel(*mesh, Box(1, 1, 1), Transform3s());
+  const Transform3s tf2(Vec3s(0.6, 0., 0.));
+
+  const std::size_t num_queries = 10;
+  CollisionRequest col_req;
+  DistanceRequest dist_req;
+  for (std::size_t i = 0; i < num_queries; ++i) {
+    CollisionResult col_res;
+    collide(&s1, Transform3s(), &s2, tf2, col_req, col_res);
+    DistanceResult dist_res;
+    distance(&s1, Transform3s(), &s2, tf2, dist_req, dist_res);
+    // The shape comes first: the entry of the BVH model and the shape is
+    // called.
+    col_res.clear();
+    collide(&s1, tf2, mesh.get(), Transform3s(), col_req, col_res);
+  }
+
+  const MetricsSnapshot snapshot = registry.snapshot();
+  const CallMetrics& spheres =
+      snapshot.get(COLLISION_METRICS, GEOM_SPHERE, GEOM_SPHERE);
+  BOOST_CHECK_EQUAL(spheres.num_calls, num_queries);
+  BOOST_CHECK_EQUAL(histogramCount(spheres), num_queries);
+  BOOST_CHECK(spheres.total_time > 0);
+  BOOST_CHECK_CLOSE(spheres.meanTime() * num_queries, spheres.total_time,
+                    1e-8);
+
+  BOOST_CHECK_EQUAL(
+      snapshot.get(DISTANCE_METRICS, GEOM_SPHERE, GEOM_SPHERE).num_calls,
+      num_queries);
+  BOOST_CHECK_EQUAL(
+      snapshot.get(COLLISION_METRICS, BV_OBBRSS, GEOM_SPHERE).num_calls,
+      num_queries);
+  BOOST_CHECK_EQUAL(
+      snapshot.get(COLLISION_METRICS, GEOM_SPHERE, BV_OBBRSS).num_calls, 0);
+
+  // The called entries are sorted by decreasing total time.
+  const std::vector<CallMetricsEntry> entries = snapshot.calledEntries();
+  BOOST_CHECK_EQUAL(entries.size(), 3);
+  for (std::size_t i = 1; i < entries.size(); ++i)
+    BOOST_CHECK(entries[i - 1].metrics.total_time >=
+                entries[i].metrics.total_time);
+
+  // ComputeCollision is counted as well.
+  ComputeCollision compute_collision(&s1, &s2);
+  CollisionResult col_res;
+  compute_collision(Transform3s(), tf2, col_req, col_res);
+  BOOST_CHECK_EQUAL(registry.snapshot()
+                        .get(COLLISION_METRICS, GEOM_SPHERE, GEOM_SPHERE)
+                        .num_calls,
+                    num_queries + 1);
+
+  registry.reset();
+  BOOST_CHECK(registry.snapshot().calledEntries().empty());
+  registry.setEnabled(false);
+}
+
+BOOST_AUTO_TEST_CASE(disabled) {
+  MetricsRegistry& registry = MetricsRegistry::instance();
+  registry.reset();
+  registry.setEnabled(false);
+
+  Sphere s1(0.5), s2(0.3);
+  CollisionRequest col_req;
+  CollisionResult col_res;
+  collide(&s1, Transform3s(), &s2, Transform3s(), col_req, col_res);
+  BOOST_CHECK(registry.snapshot().calledEntries().empty());
+}
+
+BOOST_AUTO_TEST_CASE(threads) {
+  MetricsRegistry& registry = MetricsRegistry::instance();
+  registry.setEnabled(true);
+  registry.reset();
+
+  const std::size_t num_threads = 4;
+  const std::size_t num_queries = 100;
+  Sphere s1(0.5), s2(0.3);
+  const Transform3s tf2(Vec3s(0.6, 0., 0.));
+
+  // Two waves of threads: the second one reuses the storages of the first
+  // one, whose metrics are kept.
+  for (int wave = 0; wave < 2; ++wave) {
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < num_threads; ++t) {
+      threads.emplace_back([&]() {
+        CollisionRequest col_req;
+        for (std::size_t i = 0; i < num_queries; ++i) {
+          CollisionResult col_res;
+          collide(&s1, Transform3s(), &s2, tf2, col_req, col_res);
+        }
+      });
+    }
+    for (std::thread& thread : threads) thread.join();
+  }
+
+  const CallMetrics spheres = registry.snapshot().get(
+      COLLISION_METRICS, GEOM_SPHERE, GEOM_SPHERE);
+  BOOST_CHECK_EQUAL(spheres.num_calls, 2 * num_threads * num_queries);
+  BOOST_CHECK_EQUAL(histogramCount(spheres), 2 * num_threads * num_queries);
+  registry.setEnabled(false);
+}
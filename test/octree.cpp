@@ -177,6 +177,32 @@ BOOST_AUTO_TEST_CASE(octree_mesh) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(octree_box_contacts) {
+  // A box resting on a voxel: the box-box narrow phase returns a manifold of
+  // several contacts, which must all refer to the voxel.
+  const Scalar resolution(1.);
+  octomap::OcTreePtr_t octomap_tree(new octomap::OcTree(resolution));
+  octomap_tree->updateNode(octomap::point3d(0.5f, 0.5f, 0.5f), true);
+  octomap_tree->updateInnerOccupancy();
+  const OcTree octree(octomap_tree);
+
+  const Box box(1, 1, 1);
+  Transform3s tf_box;
+  tf_box.setTranslation(Vec3s(0.5, 0.5, 1.49));
+
+  const CollisionRequest request(coal::CONTACT, 10);
+  CollisionResult result;
+  coal::collide(&octree, Transform3s(), &box, tf_box, request, result);
+  BOOST_REQUIRE(result.isCollision());
+  BOOST_CHECK(result.numContacts() > 1);
+  for (const Contact& contact : result.getContacts()) {
+    BOOST_CHECK(contact.o1 == &octree);
+    BOOST_CHECK(contact.o2 == &box);
+    BOOST_CHECK(contact.b1 != Contact::NONE);
+    BOOST_CHECK_CLOSE(contact.penetration_depth, -0.01, 1e-6);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(octree_height_field) {
   Eigen::IOFormat tuple(Eigen::FullPrecision, Eigen::DontAlignCols, "", ", ",
                         "", "", "(", ")");
@@ -248,3 +274,219 @@ BOOST_AUTO_TEST_CASE(octree_height_field) {
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(octree_flat_tree) {
+  Scalar resolution(10.);
+  std::vector<Vec3s> pRob;
+  std::vector<Triangle32> tRob;
+  boost::filesystem::path path(TEST_RESOURCES_DIR);
+  loadOBJFile((path / "rob.obj").string().c_str(), pRob, tRob);
+
+  BVHModel<OBBRSS> robMesh;
+  makeMesh(pRob, tRob, robMesh);
+  // Octree of the robot vertices, for the octree-octree queries.
+  Eigen::Matrix<Scalar, Eigen::Dynamic, 3> robPoints(pRob.size(), 3);
+  for (std::size_t i = 0; i < pRob.size(); ++i)
+    robPoints.row(static_cast<Eigen::DenseIndex>(i)) = pRob[i].transpose();
+  OcTreePtr_t robOctree = coal::makeOctree(robPoints, resolution);
+  OcTree robFlatOctree(*robOctree);
+  robFlatOctree.buildFlatTree();
+
+  OcTree envOctree(
+      coal::loadOctreeFile((path / "env.octree").string(), resolution));
+  OcTree envFlatOctree(envOctree);
+  envFlatOctree.buildFlatTree();
+
+  BOOST_CHECK(!envOctree.hasFlatTree());
+  BOOST_CHECK(envFlatOctree.hasFlatTree());
+  BOOST_CHECK(envFlatOctree.getFlatTreeSize() == envOctree.size());
+  BOOST_CHECK(envFlatOctree == envOctree);
+
+  // The flat tree follows the thresholds.
+  {
+    OcTree octree(envFlatOctree);
+    octree.setOccupancyThres(Scalar(1.1));
+    BOOST_CHECK(octree.hasFlatTree());
+    BOOST_CHECK(!octree.isNodeOccupied(octree.getFlatRoot()));
+    BOOST_CHECK(envFlatOctree.isNodeOccupied(envFlatOctree.getFlatRoot()));
+    octree.clearFlatTree();
+    BOOST_CHECK(!octree.hasFlatTree());
+    BOOST_CHECK(octree.getFlatRoot() == NULL);
+  }
+
+  std::vector<Transform3s> transforms;
+  Scalar extents[] = {-2000, -2000, 0, 2000, 2000, 2000};
+#ifndef NDEBUG  // if debug mode
+  std::size_t N = 100;
+#else
+  std::size_t N = 1000;
+#endif
+  N = coal::getNbRun(utf::master_test_suite().argc,
+                     utf::master_test_suite().argv, N);
+
+  generateRandomTransforms(extents, transforms, 2 * N);
+
+  // The timings of the flat tree are measured by benchmark-octree.
+  CollisionRequest request(coal::CONTACT | coal::DISTANCE_LOWER_BOUND, 1);
+  DistanceRequest dreq;
+  for (std::size_t i = 0; i < N; ++i) {
+    Transform3s tf1(transforms[2 * i]);
+    Transform3s tf2(transforms[2 * i + 1]);
+
+    {
+      CollisionResult octomap_result, flat_result;
+      coal::collide(&robMesh, tf1, &envOctree, tf2, request, octomap_result);
+      coal::collide(&robMesh, tf1, &envFlatOctree, tf2, request, flat_result);
+      BOOST_CHECK_EQUAL(octomap_result.isCollision(),
+                        flat_result.isCollision());
+    }
+    {
+      DistanceResult octomap_result, flat_result;
+      coal::distance(&envOctree, tf2, &robMesh, tf1, dreq, octomap_result);
+      coal::distance(&envFlatOctree, tf2, &robMesh, tf1, dreq, flat_result);
+      BOOST_CHECK_SMALL(octomap_result.min_distance - flat_result.min_distance,
+                        Scalar(1e-6));
+    }
+    {
+      CollisionResult octomap_result, flat_result;
+      coal::collide(robOctree.get(), tf1, &envOctree, tf2, request,
+                    octomap_result);
+      coal::collide(&robFlatOctree, tf1, &envFlatOctree, tf2, request,
+                    flat_result);
+      BOOST_CHECK_EQUAL(octomap_result.isCollision(),
+                        flat_result.isCollision());
+      BOOST_CHECK_EQUAL(octomap_result.numContacts(),
+                        flat_result.numContacts());
+      if (flat_result.isCollision()) {
+        BOOST_CHECK_SMALL(octomap_result.getContact(0).penetration_depth -
+                              flat_result.getContact(0).penetration_depth,
+                          Scalar(1e-6));
+      }
+    }
+    {
+      DistanceResult octomap_result, flat_result;
+      coal::distance(robOctree.get(), tf1, &envOctree, tf2, dreq,
+                     octomap_result);
+      coal::distance(&robFlatOctree, tf1, &envFlatOctree, tf2, dreq,
+                     flat_result);
+      BOOST_CHECK_SMALL(octomap_result.min_distance - flat_result.min_distance,
+                        Scalar(1e-6));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(octree_octree_contacts) {
+  // Two octrees whose inner nodes overlap, but whose voxels do not: the
+  // octree-octree collision must go down to the leaves, with or without
+  // contacts.
+  const Scalar resolution(1.);
+  octomap::OcTreePtr_t tree1(new octomap::OcTree(resolution)),
+      tree2(new octomap::OcTree(resolution));
+  tree1->updateNode(octomap::point3d(0.5f, 0.5f, 0.5f), true);
+  tree1->updateNode(octomap::point3d(3.5f, 3.5f, 3.5f), true);
+  tree1->updateInnerOccupancy();
+  tree2->updateNode(octomap::point3d(3.5f, 0.5f, 0.5f), true);
+  tree2->updateNode(octomap::point3d(0.5f, 3.5f, 3.5f), true);
+  tree2->updateInnerOccupancy();
+  OcTree octree1(tree1), octree2(tree2);
+  OcTree flat_octree1(tree1), flat_octree2(tree2);
+  flat_octree1.buildFlatTree();
+  flat_octree2.buildFlatTree();
+
+  const CollisionRequest requests[2] = {CollisionRequest(coal::NO_REQUEST, 10),
+                                        CollisionRequest(coal::CONTACT, 10)};
+  for (const CollisionRequest& request : requests) {
+    CollisionResult result, flat_result;
+    coal::collide(&octree1, Transform3s(), &octree2, Transform3s(), request,
+                  result);
+    coal::collide(&flat_octree1, Transform3s(), &flat_octree2, Transform3s(),
+                  request, flat_result);
+    BOOST_CHECK(!result.isCollision());
+    BOOST_CHECK(!flat_result.isCollision());
+  }
+
+  // Once a voxel of each tree overlaps, the contact is the one of the two
+  // leaves, with its witness points.
+  const Transform3s tf2(Vec3s(Scalar(-2.5), 0, 0));
+  for (const CollisionRequest& request : requests) {
+    CollisionResult result, flat_result;
+    coal::collide(&octree1, Transform3s(), &octree2, tf2, request, result);
+    coal::collide(&flat_octree1, Transform3s(), &flat_octree2, tf2, request,
+                  flat_result);
+    BOOST_REQUIRE(result.isCollision());
+    BOOST_REQUIRE(flat_result.isCollision());
+    BOOST_CHECK_EQUAL(result.numContacts(), flat_result.numContacts());
+    if (!request.enable_contact) continue;
+    const Contact& contact = flat_result.getContact(0);
+    BOOST_CHECK_CLOSE(contact.penetration_depth, -0.5, 1e-6);
+    BOOST_CHECK_CLOSE(std::abs(contact.normal[0]), 1, 1e-6);
+    BOOST_CHECK_CLOSE(result.getContact(0).penetration_depth, -0.5, 1e-6);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(octree_front_cache) {
+  Scalar resolution(10.);
+  std::vector<Vec3s> pRob;
+  std::vector<Triangle32> tRob;
+  boost::filesystem::path path(TEST_RESOURCES_DIR);
+  loadOBJFile((path / "rob.obj").string().c_str(), pRob, tRob);
+
+  shared_ptr<BVHModel<OBBRSS> > robMesh(new BVHModel<OBBRSS>());
+  makeMesh(pRob, tRob, *robMesh);
+  Eigen::Matrix<Scalar, Eigen::Dynamic, 3> robPoints(pRob.size(), 3);
+  for (std::size_t i = 0; i < pRob.size(); ++i)
+    robPoints.row(static_cast<Eigen::DenseIndex>(i)) = pRob[i].transpose();
+  OcTreePtr_t robOctree = coal::makeOctree(robPoints, resolution);
+  robOctree->buildFlatTree();
+
+  OcTreePtr_t envOctree(new OcTree(
+      coal::loadOctreeFile((path / "env.octree").string(), resolution)));
+  OcTreePtr_t envFlatOctree(new OcTree(*envOctree));
+  envFlatOctree->buildFlatTree();
+
+  // Pairs mesh-octree, octree-box and octree-octree, then the octomap tree,
+  // which ignores the cache.
+  CollisionObject env(envFlatOctree), octomap_env(envOctree);
+  CollisionObject mesh(robMesh), box(make_shared<Box>(200, 100, 50)),
+      rob(robOctree);
+  const CollisionObject* pairs[4][2] = {
+      {&mesh, &env}, {&env, &box}, {&rob, &env}, {&mesh, &octomap_env}};
+  TraversalFrontCache caches[4];
+  std::size_t leaf_tests_ref[4] = {0, 0, 0, 0},
+              leaf_tests_res[4] = {0, 0, 0, 0};
+  std::size_t num_collisions = 0;
+
+  CollisionRequest requests[4] = {CollisionRequest(coal::CONTACT, 100000),
+                                  CollisionRequest(coal::CONTACT, 100000),
+                                  CollisionRequest(coal::CONTACT, 100000),
+                                  CollisionRequest(coal::CONTACT, 100000)};
+  for (int k = 0; k < 4; ++k) requests[k].enable_statistics = true;
+  const std::size_t N = 200;
+  for (std::size_t i = 0; i < N; ++i) {
+    const Scalar t = Scalar(i) / Scalar(N);
+    const Transform3s tf(
+        Eigen::AngleAxis<Scalar>(t, Vec3s(0, 0, 1)).toRotationMatrix(),
+        Vec3s(-1500 + 3000 * t, -1000 + 1500 * t, 400 * t));
+    mesh.setTransform(tf);
+    box.setTransform(tf);
+    rob.setTransform(tf);
+
+    for (int k = 0; k < 4; ++k) {
+      CollisionResult ref, res;
+      coal::collide(pairs[k][0], pairs[k][1], requests[k], ref);
+      coal::collide(pairs[k][0], pairs[k][1], requests[k], res, caches[k]);
+      BOOST_CHECK_EQUAL(ref.isCollision(), res.isCollision());
+      BOOST_CHECK_EQUAL(ref.numContacts(), res.numContacts());
+      leaf_tests_ref[k] += ref.statistics.num_leaf_tests;
+      leaf_tests_res[k] += res.statistics.num_leaf_tests;
+      if (k == 0 && ref.isCollision()) ++num_collisions;
+    }
+  }
+  BOOST_CHECK_GT(num_collisions, 0);
+
+  for (int k = 0; k < 3; ++k)
+    BOOST_CHECK_GT(caches[k].getStatistics().num_restarts, 0);
+  BOOST_CHECK_EQUAL(caches[3].getStatistics().num_restarts, 0);
+  BOOST_CHECK_EQUAL(caches[3].size(), 0);
+  BOOST_CHECK_EQUAL(leaf_tests_res[3], leaf_tests_ref[3]);
+}
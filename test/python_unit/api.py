@@ -26,6 +26,66 @@ class TestMainAPI(TestCase):
 
         self.assertTrue(coal.distance(capsule, M1, capsule, M2, req, res) > 0)
 
+    def test_distance_batch(self):
+        capsule = coal.Capsule(1.0, 2.0)
+        box = coal.Box(1.0, 1.0, 1.0)
+        N = 100
+        rng = np.random.default_rng(0)
+        poses = np.zeros((N, 7))
+        poses[:, :3] = rng.uniform(-4.0, 4.0, (N, 3))
+        poses[:, 3:] = rng.normal(size=(N, 4))
+        poses[:, 3:] /= np.linalg.norm(poses[:, 3:], axis=1)[:, None]
+
+        req = coal.DistanceRequest()
+        dists, normals, p1, p2 = coal.distanceBatch(
+            capsule, np.eye(4), box, poses, req, num_threads=4
+        )
+        self.assertEqual(dists.shape, (N,))
+        self.assertEqual(normals.shape, (N, 3))
+        self.assertEqual(p1.shape, (N, 3))
+        self.assertEqual(p2.shape, (N, 3))
+
+        matrices = np.tile(np.eye(4), (N, 1, 1))
+        for i in range(N):
+            x, y, z, w = poses[i, 3:]
+            R = np.array(
+                [
+                    [1 - 2 * (y * y + z * z), 2 * (x * y - z * w), 2 * (x * z + y * w)],
+                    [2 * (x * y + z * w), 1 - 2 * (x * x + z * z), 2 * (y * z - x * w)],
+                    [2 * (x * z - y * w), 2 * (y * z + x * w), 1 - 2 * (x * x + y * y)],
+                ]
+            )
+            matrices[i, :3, :3] = R
+            matrices[i, :3, 3] = poses[i, :3]
+            M2 = coal.Transform3s(R, poses[i, :3])
+            res = coal.DistanceResult()
+            d = coal.distance(capsule, coal.Transform3s(), box, M2, req, res)
+            self.assertAlmostEqual(dists[i], d)
+            self.assertApprox(p1[i], res.getNearestPoint1())
+            self.assertApprox(p2[i], res.getNearestPoint2())
+
+        dists_matrices = coal.distanceBatch(capsule, np.eye(4), box, matrices)[0]
+        self.assertApprox(dists_matrices, dists)
+
+        with self.assertRaises(ValueError):
+            coal.distanceBatch(capsule, poses[:2], box, poses)
+
+    def test_collide_batch(self):
+        capsule = coal.Capsule(1.0, 2.0)
+        identity = np.array([0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0])
+        poses = np.tile(identity, (3, 1))
+        poses[:, 0] = [0.5, 1.5, 2.5]
+
+        req = coal.CollisionRequest()
+        collisions, dists, normals, p1, p2 = coal.collideBatch(
+            capsule, identity, capsule, poses, req, num_threads=0
+        )
+        self.assertEqual(list(collisions), [True, True, False])
+        self.assertAlmostEqual(dists[0], -1.5)
+        self.assertAlmostEqual(dists[1], -0.5)
+        self.assertTrue(dists[2] > 0)
+        self.assertTrue(np.isnan(normals[2]).all())
+
 
 if __name__ == "__main__":
     unittest.main()
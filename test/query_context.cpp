@@ -0,0 +1,210 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE COAL_QUERY_CONTEXT
+#include <boost/test/included/unit_test.hpp>
+
+#include <cstdlib>
+#include <new>
+
+#include "coal/collision.h"
+#include "coal/distance.h"
+#include "coal/contact_patch.h"
+#include "coal/query_context.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/shape/geometric_shapes.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
+
+#include "utility.h"
+
+namespace {
+bool count_allocations = false;
+std::size_t num_allocations = 0;
+
+void* countedAllocation(std::size_t size) {
+  if (count_allocations) ++num_allocations;
+  void* ptr = std::malloc(size == 0 ? 1 : size);
+  if (ptr == NULL) throw std::bad_alloc();
+  return ptr;
+}
+}  // namespace
+
+// Every allocation of the program goes through these operators, including the
+// ones of the library.
+void* operator new(std::size_t size) { return countedAllocation(size); }
+void* operator new[](std::size_t size) { return countedAllocation(size); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+
+using namespace coal;
+
+namespace {
+
+typedef std::vector<CollisionGeometryPtr_t> Geometries;
+
+/// Runs the collision and distance queries between all the pairs of
+/// geometries and the contact patch queries between the pairs of shapes, with
+/// the poses of tf1s and tf2s. Returns the number of allocations made by the
+/// queries.
+std::size_t runQueries(const Geometries& geoms,
+                       const std::vector<Transform3s>& tf1s,
+                       const std::vector<Transform3s>& tf2s,
+                       const CollisionRequest& col_req,
+                       const DistanceRequest& dist_req,
+                       const ContactPatchRequest& patch_req,
+                       QueryContext& context) {
+  num_allocations = 0;
+  count_allocations = true;
+  for (std::size_t k = 0; k < tf1s.size(); ++k) {
+    for (std::size_t i = 0; i < geoms.size(); ++i) {
+      for (std::size_t j = 0; j < geoms.size(); ++j) {
+        const CollisionGeometry* o1 = geoms[i].get();
+        const CollisionGeometry* o2 = geoms[j].get();
+        if (o1->getObjectType() == OT_BVH && o2->getObjectType() == OT_BVH &&
+            i > j)
+          continue;
+        context.clear();
+        collide(o1, tf1s[k], o2, tf2s[k], col_req, context.collision_result,
+                context);
+        if (o1->getObjectType() == OT_GEOM && o2->getObjectType() == OT_GEOM)
+          computeContactPatch(o1, tf1s[k], o2, tf2s[k],
+                              context.collision_result, patch_req,
+                              context.contact_patch_result, context);
+        distance(o1, tf1s[k], o2, tf2s[k], dist_req, context.distance_result,
+                 context);
+      }
+    }
+  }
+  count_allocations = false;
+  return num_allocations;
+}
+
+/// Checks that the queries with a context give the same results as the
+/// queries without context.
+void checkResults(const Geometries& geoms, const Transform3s& tf1,
+                  const Transform3s& tf2, const CollisionRequest& col_req,
+                  const DistanceRequest& dist_req, QueryContext& context) {
+  for (std::size_t i = 0; i < geoms.size(); ++i) {
+    for (std::size_t j = 0; j < geoms.size(); ++j) {
+      const CollisionGeometry* o1 = geoms[i].get();
+      const CollisionGeometry* o2 = geoms[j].get();
+      CollisionResult col_res;
+      collide(o1, tf1, o2, tf2, col_req, col_res);
+      context.clear();
+      collide(o1, tf1, o2, tf2, col_req, context.collision_result, context);
+      BOOST_CHECK_EQUAL(col_res.numContacts(),
+                        context.collision_result.numContacts());
+      if (col_res.isCollision() && context.collision_result.isCollision()) {
+        BOOST_CHECK_CLOSE(col_res.getContact(0).penetration_depth,
+                          context.collision_result.getContact(0)
+                              .penetration_depth,
+                          1e-4);
+      }
+
+      DistanceResult dist_res;
+      distance(o1, tf1, o2, tf2, dist_req, dist_res);
+      distance(o1, tf1, o2, tf2, dist_req, context.distance_result, context);
+      BOOST_CHECK_CLOSE(dist_res.min_distance,
+                        context.distance_result.min_distance, 1e-4);
+    }
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(shapes_no_allocation) {
+  const NODE_TYPE node_types[] = {GEOM_BOX,      GEOM_SPHERE, GEOM_CAPSULE,
+                                  GEOM_CYLINDER, GEOM_CONVEX, GEOM_ELLIPSOID};
+  Geometries geoms;
+  for (std::size_t i = 0; i < sizeof(node_types) / sizeof(NODE_TYPE); ++i)
+    geoms.push_back(makeRandomGeometry(node_types[i]));
+
+  Scalar extents[] = {-0.5, -0.5, -0.5, 0.5, 0.5, 0.5};
+  std::vector<Transform3s> tf1s, tf2s;
+  generateRandomTransforms(extents, tf1s, 100);
+  generateRandomTransforms(extents, tf2s, 100);
+
+  CollisionRequest col_req;
+  col_req.num_max_contacts = 4;
+  DistanceRequest dist_req;
+  ContactPatchRequest patch_req;
+
+  QueryContext context;
+  checkResults(geoms, tf1s[0], tf2s[0], col_req, dist_req, context);
+
+  // The first queries allocate the buffers of the context.
+  const std::vector<Transform3s> first_tf1(tf1s.begin(), tf1s.begin() + 50);
+  const std::vector<Transform3s> first_tf2(tf2s.begin(), tf2s.begin() + 50);
+  const std::vector<Transform3s> next_tf1(tf1s.begin() + 50, tf1s.end());
+  const std::vector<Transform3s> next_tf2(tf2s.begin() + 50, tf2s.end());
+  BOOST_CHECK(runQueries(geoms, first_tf1, first_tf2, col_req, dist_req,
+                         patch_req, context) > 0);
+  BOOST_CHECK_EQUAL(runQueries(geoms, next_tf1, next_tf2, col_req, dist_req,
+                               patch_req, context),
+                    0);
+}
+
+BOOST_AUTO_TEST_CASE(meshes_no_allocation) {
+  Geometries geoms;
+  shared_ptr<BVHModel<OBBRSS> > box(new BVHModel<OBBRSS>());
+  generateBVHModel(*box, Box(0.6, 0.4, 0.5), Transform3s());
+  geoms.push_back(box);
+  shared_ptr<BVHModel<OBBRSS> > sphere(new BVHModel<OBBRSS>());
+  generateBVHModel(*sphere, Sphere(0.3), Transform3s(), 10, 10);
+  geoms.push_back(sphere);
+  geoms.push_back(CollisionGeometryPtr_t(new Capsule(0.2, 0.4)));
+
+  Scalar extents[] = {-0.3, -0.3, -0.3, 0.3, 0.3, 0.3};
+  std::vector<Transform3s> tf1s, tf2s;
+  generateRandomTransforms(extents, tf1s, 40);
+  generateRandomTransforms(extents, tf2s, 40);
+
+  CollisionRequest col_req;
+  col_req.num_max_contacts = 100;
+  DistanceRequest dist_req;
+  ContactPatchRequest patch_req;
+
+  QueryContext context;
+  checkResults(geoms, tf1s[0], tf2s[0], col_req, dist_req, context);
+
+  const std::vector<Transform3s> first_tf1(tf1s.begin(), tf1s.begin() + 20);
+  const std::vector<Transform3s> first_tf2(tf2s.begin(), tf2s.begin() + 20);
+  const std::vector<Transform3s> next_tf1(tf1s.begin() + 20, tf1s.end());
+  const std::vector<Transform3s> next_tf2(tf2s.begin() + 20, tf2s.end());
+  BOOST_CHECK(runQueries(geoms, first_tf1, first_tf2, col_req, dist_req,
+                         patch_req, context) > 0);
+  BOOST_CHECK_EQUAL(runQueries(geoms, next_tf1, next_tf2, col_req, dist_req,
+                               patch_req, context),
+                    0);
+}
@@ -0,0 +1,254 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE COAL_QUERY_STATISTICS
+#include <boost/test/included/unit_test.hpp>
+
+#include <limits>
+
+#include "coal/collision.h"
+#include "coal/distance.h"
+#include "coal/contact_patch.h"
+#include "coal/hfield.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/shape/geometric_shapes.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+namespace {
+shared_ptr<BVHModel<OBBRSS> > makeMesh(const Box& box) {
+  shared_ptr<BVHModel<OBBRSS> > mesh(new BVHModel<OBBRSS>);
+  generateBVHModel(*mesh, box, Transform3s());
+  return mesh;
+}
+
+void checkIsEmpty(const QueryStatistics& statistics) {
+  BOOST_CHECK_EQUAL(statistics.num_bv_tests, 0);
+  BOOST_CHECK_EQUAL(statistics.num_leaf_tests, 0);
+  BOOST_CHECK_EQUAL(statistics.num_gjk_calls, 0);
+  BOOST_CHECK_EQUAL(statistics.num_gjk_iterations, 0);
+  BOOST_CHECK_EQUAL(statistics.num_epa_calls, 0);
+  BOOST_CHECK_EQUAL(statistics.num_epa_iterations, 0);
+  BOOST_CHECK_EQUAL(statistics.num_epa_faces, 0);
+  BOOST_CHECK_EQUAL(statistics.stop_reason, QUERY_NOT_RUN);
+  BOOST_CHECK_EQUAL(statistics.dispatch_time, 0);
+  BOOST_CHECK_EQUAL(statistics.traversal_time, 0);
+  BOOST_CHECK_EQUAL(statistics.narrowphase_time, 0);
+  BOOST_CHECK_EQUAL(statistics.patch_time, 0);
+}
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(disabled_by_default) {
+  Ellipsoid e1(1, 0.5, 0.8), e2(0.5, 1, 0.6);
+  shared_ptr<BVHModel<OBBRSS> > m1 = makeMesh(Box(1, 0.5, 0.8));
+  shared_ptr<BVHModel<OBBRSS> > m2 = makeMesh(Box(0.5, 1, 0.6));
+  Transform3s tf2(Vec3s(0.2, 0.1, 0.));
+
+  CollisionRequest col_req;
+  BOOST_CHECK(!col_req.enable_statistics);
+  DistanceRequest dist_req;
+  BOOST_CHECK(!dist_req.enable_statistics);
+
+  CollisionResult col_res;
+  collide(&e1, Transform3s(), &e2, tf2, col_req, col_res);
+  collide(m1.get(), Transform3s(), m2.get(), tf2, col_req, col_res);
+  checkIsEmpty(col_res.statistics);
+
+  DistanceResult dist_res;
+  distance(&e1, Transform3s(), &e2, tf2, dist_req, dist_res);
+  distance(m1.get(), Transform3s(), m2.get(), tf2, dist_req, dist_res);
+  checkIsEmpty(dist_res.statistics);
+}
+
+BOOST_AUTO_TEST_CASE(shapes) {
+  Ellipsoid e1(1, 0.5, 0.8), e2(0.5, 1, 0.6);
+  Transform3s tf2(Vec3s(0.2, 0.1, 0.));
+
+  CollisionRequest col_req;
+  col_req.enable_statistics = true;
+  CollisionResult col_res;
+  BOOST_CHECK(collide(&e1, Transform3s(), &e2, tf2, col_req, col_res) > 0);
+  const QueryStatistics& col_stats = col_res.statistics;
+  BOOST_CHECK_EQUAL(col_stats.num_bv_tests, 0);
+  BOOST_CHECK_EQUAL(col_stats.num_leaf_tests, 0);
+  BOOST_CHECK_EQUAL(col_stats.num_gjk_calls, 1);
+  BOOST_CHECK(col_stats.num_gjk_iterations > 0);
+  BOOST_CHECK_EQUAL(col_stats.num_epa_calls, 1);
+  BOOST_CHECK(col_stats.num_epa_iterations > 0);
+  BOOST_CHECK(col_stats.num_epa_faces > 0);
+  BOOST_CHECK_EQUAL(col_stats.stop_reason, QUERY_COMPLETED);
+  BOOST_CHECK(col_stats.narrowphase_time > 0);
+  BOOST_CHECK(col_stats.dispatch_time >= 0);
+  BOOST_CHECK_EQUAL(col_stats.traversal_time, 0);
+
+  // The statistics accumulate until the result is cleared. The request must
+  // allow a second contact, otherwise the second query stops right away.
+  CollisionRequest two_contacts_req(CONTACT, 2);
+  two_contacts_req.enable_statistics = true;
+  collide(&e1, Transform3s(), &e2, tf2, two_contacts_req, col_res);
+  BOOST_CHECK_EQUAL(col_stats.num_gjk_calls, 2);
+  col_res.clear();
+  checkIsEmpty(col_stats);
+
+  DistanceRequest dist_req;
+  dist_req.enable_statistics = true;
+  DistanceResult dist_res;
+  distance(&e1, Transform3s(), &e2, Transform3s(Vec3s(3., 0., 0.)), dist_req,
+           dist_res);
+  BOOST_CHECK_EQUAL(dist_res.statistics.num_gjk_calls, 1);
+  BOOST_CHECK_EQUAL(dist_res.statistics.num_epa_calls, 0);
+  BOOST_CHECK_EQUAL(dist_res.statistics.stop_reason, QUERY_COMPLETED);
+  BOOST_CHECK(dist_res.statistics.narrowphase_time > 0);
+
+  // ComputeCollision fills the same statistics.
+  ComputeCollision compute_collision(&e1, &e2);
+  CollisionResult compute_res;
+  compute_collision(Transform3s(), tf2, col_req, compute_res);
+  BOOST_CHECK_EQUAL(compute_res.statistics.num_gjk_calls, 1);
+  BOOST_CHECK_EQUAL(compute_res.statistics.num_epa_calls, 1);
+  BOOST_CHECK(compute_res.statistics.narrowphase_time > 0);
+
+  // The solver does not keep a reference to the statistics after the query.
+  ComputeDistance compute_distance(&e1, &e2);
+  DistanceResult compute_dist_res;
+  compute_distance(Transform3s(), tf2, dist_req, compute_dist_res);
+  dist_req.enable_statistics = false;
+  DistanceResult unused;
+  compute_distance(Transform3s(), tf2, dist_req, unused);
+  BOOST_CHECK_EQUAL(compute_dist_res.statistics.num_gjk_calls, 1);
+  checkIsEmpty(unused.statistics);
+}
+
+BOOST_AUTO_TEST_CASE(meshes) {
+  shared_ptr<BVHModel<OBBRSS> > m1 = makeMesh(Box(1, 0.5, 0.8));
+  shared_ptr<BVHModel<OBBRSS> > m2 = makeMesh(Box(0.5, 1, 0.6));
+  Transform3s tf2(Vec3s(0.2, 0.1, 0.));
+
+  CollisionRequest col_req(CONTACT, 1);
+  col_req.enable_statistics = true;
+  CollisionResult col_res;
+  BOOST_CHECK(collide(m1.get(), Transform3s(), m2.get(), tf2, col_req,
+                      col_res) > 0);
+  BOOST_CHECK(col_res.statistics.num_bv_tests > 0);
+  BOOST_CHECK(col_res.statistics.num_leaf_tests > 0);
+  BOOST_CHECK_EQUAL(col_res.statistics.stop_reason,
+                    QUERY_MAX_CONTACTS_REACHED);
+  BOOST_CHECK(col_res.statistics.traversal_time > 0);
+  BOOST_CHECK(col_res.statistics.narrowphase_time > 0);
+
+  // Without early stop, more pairs are tested.
+  CollisionRequest all_req(CONTACT, 1000);
+  all_req.enable_statistics = true;
+  CollisionResult all_res;
+  collide(m1.get(), Transform3s(), m2.get(), tf2, all_req, all_res);
+  BOOST_CHECK_EQUAL(all_res.statistics.stop_reason, QUERY_COMPLETED);
+  BOOST_CHECK(all_res.statistics.num_leaf_tests >
+              col_res.statistics.num_leaf_tests);
+
+  DistanceRequest dist_req;
+  dist_req.enable_statistics = true;
+  DistanceResult dist_res;
+  distance(m1.get(), Transform3s(), m2.get(),
+           Transform3s(Vec3s(3., 0., 0.)), dist_req, dist_res);
+  BOOST_CHECK(dist_res.statistics.num_bv_tests > 0);
+  BOOST_CHECK(dist_res.statistics.num_leaf_tests > 0);
+  // The distance between two triangles is computed without GJK.
+  BOOST_CHECK_EQUAL(dist_res.statistics.num_gjk_calls, 0);
+  BOOST_CHECK_EQUAL(dist_res.statistics.stop_reason, QUERY_COMPLETED);
+}
+
+BOOST_AUTO_TEST_CASE(mesh_shape) {
+  shared_ptr<BVHModel<OBBRSS> > mesh = makeMesh(Box(1, 0.5, 0.8));
+  Ellipsoid ellipsoid(0.5, 1, 0.6);
+  Transform3s tf2(Vec3s(0.2, 0.1, 0.));
+
+  CollisionRequest col_req(CONTACT, 1000);
+  col_req.enable_statistics = true;
+  CollisionResult col_res;
+  // The shape comes first: the geometries are swapped by the narrow phase.
+  collide(&ellipsoid, tf2, mesh.get(), Transform3s(), col_req, col_res);
+  BOOST_CHECK(col_res.isCollision());
+  BOOST_CHECK(col_res.statistics.num_bv_tests > 0);
+  BOOST_CHECK(col_res.statistics.num_leaf_tests > 0);
+  BOOST_CHECK(col_res.statistics.num_gjk_calls > 0);
+  BOOST_CHECK_EQUAL(col_res.statistics.stop_reason, QUERY_COMPLETED);
+}
+
+BOOST_AUTO_TEST_CASE(height_field_shape) {
+  const MatrixXs heights = MatrixXs::Constant(10, 10, 0.5);
+  HeightField<OBBRSS> hfield(2., 2., heights, -1.);
+  Sphere sphere(0.2);
+
+  CollisionRequest col_req(CONTACT, 10);
+  col_req.enable_statistics = true;
+  CollisionResult col_res;
+  collide(&hfield, Transform3s(), &sphere, Transform3s(Vec3s(0., 0., 0.6)),
+          col_req, col_res);
+  BOOST_CHECK(col_res.isCollision());
+  BOOST_CHECK(col_res.statistics.num_bv_tests > 0);
+  BOOST_CHECK(col_res.statistics.num_leaf_tests > 0);
+  BOOST_CHECK(col_res.statistics.num_gjk_calls > 0);
+}
+
+BOOST_AUTO_TEST_CASE(skipped_query) {
+  Ellipsoid e1(1, 0.5, 0.8), e2(0.5, 1, 0.6);
+  CollisionRequest col_req;
+  col_req.enable_statistics = true;
+  col_req.security_margin = -std::numeric_limits<Scalar>::infinity();
+  CollisionResult col_res;
+  collide(&e1, Transform3s(), &e2, Transform3s(), col_req, col_res);
+  BOOST_CHECK_EQUAL(col_res.statistics.stop_reason, QUERY_SKIPPED);
+  BOOST_CHECK_EQUAL(col_res.statistics.num_gjk_calls, 0);
+}
+
+BOOST_AUTO_TEST_CASE(contact_patch) {
+  Box b1(1, 1, 1), b2(0.5, 0.5, 0.5);
+  Transform3s tf2(Vec3s(0., 0., 0.7));
+  CollisionRequest col_req;
+  col_req.enable_statistics = true;
+  CollisionResult col_res;
+  collide(&b1, Transform3s(), &b2, tf2, col_req, col_res);
+  BOOST_CHECK(col_res.isCollision());
+
+  const ContactPatchRequest patch_req(col_req);
+  BOOST_CHECK(patch_req.enable_statistics);
+  ContactPatchResult patch_res(patch_req);
+  computeContactPatch(&b1, Transform3s(), &b2, tf2, col_res, patch_req,
+                      patch_res);
+  BOOST_CHECK_EQUAL(patch_res.numContactPatches(), 1);
+  BOOST_CHECK(patch_res.statistics.patch_time > 0);
+}
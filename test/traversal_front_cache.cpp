@@ -0,0 +1,244 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#define BOOST_TEST_MODULE COAL_TRAVERSAL_FRONT_CACHE
+#include <boost/test/included/unit_test.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "coal/collision.h"
+#include "coal/hfield.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/shape/geometric_shapes.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+namespace {
+
+typedef std::vector<std::pair<int, int> > ContactIds;
+
+ContactIds contactIds(const CollisionResult& result) {
+  ContactIds ids;
+  for (std::size_t i = 0; i < result.numContacts(); ++i)
+    ids.push_back(
+        std::make_pair(result.getContact(i).b1, result.getContact(i).b2));
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+template <typename BV>
+HeightField<BV> makeTerrain(const Eigen::DenseIndex res) {
+  MatrixXs heights(res, res);
+  for (Eigen::DenseIndex row = 0; row < res; ++row)
+    for (Eigen::DenseIndex col = 0; col < res; ++col)
+      heights(row, col) = Scalar(0.3) * std::sin(Scalar(0.4) * Scalar(col)) *
+                          std::cos(Scalar(0.3) * Scalar(row));
+  return HeightField<BV>(4, 4, heights, -1);
+}
+
+/// Placement of an object moving slowly over the terrain, in and out of
+/// collision.
+Transform3s trajectory(const std::size_t i) {
+  const Scalar t = Scalar(i) * Scalar(0.005);
+  return Transform3s(
+      Eigen::AngleAxis<Scalar>(t, Vec3s(0, 0, 1)).toRotationMatrix(),
+      Vec3s(Scalar(1.2) * std::cos(t), Scalar(1.2) * std::sin(2 * t),
+            Scalar(0.2) + Scalar(0.4) * std::sin(5 * t)));
+}
+
+/// Replays the trajectory of o2 with and without the cache and checks that
+/// both give the same contacts.
+void checkTrajectory(const CollisionObject& o1, CollisionObject& o2,
+                     const std::size_t n) {
+  CollisionRequest request(CONTACT, 100000);
+  request.enable_statistics = true;
+  TraversalFrontCache cache;
+  std::size_t num_collisions = 0, leaf_tests_ref = 0, leaf_tests_res = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    o2.setTransform(trajectory(i));
+    CollisionResult ref, res;
+    collide(&o1, &o2, request, ref);
+    collide(&o1, &o2, request, res, cache);
+    BOOST_CHECK_EQUAL(ref.isCollision(), res.isCollision());
+    BOOST_CHECK(contactIds(ref) == contactIds(res));
+    if (ref.isCollision()) ++num_collisions;
+    leaf_tests_ref += ref.statistics.num_leaf_tests;
+    leaf_tests_res += res.statistics.num_leaf_tests;
+  }
+  BOOST_CHECK_GT(num_collisions, 0);
+  BOOST_CHECK_LT(num_collisions, n);
+
+  const TraversalFrontCache::Statistics& stats = cache.getStatistics();
+  BOOST_CHECK_EQUAL(stats.num_queries, n);
+  BOOST_CHECK_GT(stats.num_restarts, num_collisions / 2);
+  BOOST_CHECK_GT(stats.num_resets, 0);
+  // The leaf pairs of the front are tested only if their bounding volumes
+  // overlap.
+  BOOST_CHECK_LT(leaf_tests_res, leaf_tests_ref);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(reset_policy) {
+  int a, b;
+  TraversalFrontCache cache(2);
+  BOOST_CHECK(!cache.beginQuery(&a, &b));
+  cache.front().push_back(BVHFrontNode(0, 0));
+  cache.front().push_back(BVHFrontNode(1, 0));
+  cache.endQuery(false);
+
+  // The front may grow up to twice the size of the reference front.
+  BOOST_CHECK(cache.beginQuery(&a, &b));
+  cache.front().push_back(BVHFrontNode(2, 0));
+  cache.front().push_back(BVHFrontNode(3, 0));
+  cache.endQuery(true);
+  BOOST_CHECK_EQUAL(cache.size(), 4);
+  BOOST_CHECK(cache.beginQuery(&a, &b));
+  cache.front().push_back(BVHFrontNode(4, 0));
+  cache.endQuery(true);
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+
+  // Another pair, or the same pair in the other order, drops the front.
+  BOOST_CHECK(!cache.beginQuery(&a, &b));
+  cache.front().push_back(BVHFrontNode(0, 0));
+  cache.endQuery(false);
+  BOOST_CHECK(!cache.beginQuery(&b, &a));
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+  cache.endQuery(false);
+
+  const TraversalFrontCache::Statistics& stats = cache.getStatistics();
+  BOOST_CHECK_EQUAL(stats.num_queries, 5);
+  BOOST_CHECK_EQUAL(stats.num_restarts, 2);
+  BOOST_CHECK_EQUAL(stats.num_resets, 1);
+  cache.resetStatistics();
+  BOOST_CHECK_EQUAL(cache.getStatistics().num_queries, 0);
+}
+
+BOOST_AUTO_TEST_CASE(hfield_shape_trajectory) {
+  CollisionObject terrain_aabb(
+      make_shared<HeightField<AABB> >(makeTerrain<AABB>(64)));
+  CollisionObject terrain_obbrss(
+      make_shared<HeightField<OBBRSS> >(makeTerrain<OBBRSS>(64)));
+  CollisionObject box(make_shared<Box>(Scalar(0.4), Scalar(0.3), Scalar(0.2)));
+  CollisionObject sphere(make_shared<Sphere>(Scalar(0.2)));
+
+  checkTrajectory(terrain_aabb, box, 400);
+  checkTrajectory(terrain_obbrss, box, 400);
+  checkTrajectory(terrain_obbrss, sphere, 400);
+}
+
+BOOST_AUTO_TEST_CASE(hfield_mesh_trajectory) {
+  CollisionObject terrain(
+      make_shared<HeightField<OBBRSS> >(makeTerrain<OBBRSS>(32)));
+  shared_ptr<BVHModel<OBBRSS> > mesh(new BVHModel<OBBRSS>());
+  generateBVHModel(*mesh, Sphere(Scalar(0.2)), Transform3s(), 10, 10);
+  CollisionObject o2(mesh);
+
+  checkTrajectory(terrain, o2, 200);
+}
+
+BOOST_AUTO_TEST_CASE(shape_hfield_order_and_teleport) {
+  shared_ptr<HeightField<OBBRSS> > hfield(
+      new HeightField<OBBRSS>(makeTerrain<OBBRSS>(64)));
+  CollisionObject terrain(hfield);
+  // Below the surface of the terrain, hence always in collision.
+  CollisionObject box(make_shared<Box>(Scalar(0.4), Scalar(0.3), Scalar(0.2)),
+                      Transform3s(Vec3s(Scalar(0.5), Scalar(0.5), -0.5)));
+
+  // The shape-height field pair is swapped by the narrow phase: both orders
+  // share the same front.
+  CollisionRequest request(CONTACT, 100000);
+  TraversalFrontCache cache(1);
+  CollisionResult ref, res;
+  collide(&terrain, &box, request, ref);
+  collide(&box, &terrain, request, res, cache);
+  BOOST_CHECK_GT(cache.size(), 0);
+  collide(&terrain, &box, request, res, cache);
+  BOOST_CHECK_EQUAL(cache.getStatistics().num_restarts, 1);
+  BOOST_CHECK_EQUAL(cache.getStatistics().num_resets, 0);
+  BOOST_CHECK_EQUAL(2 * ref.numContacts(), res.numContacts());
+
+  // A jump to the other side of the terrain grows the front, which is then
+  // dropped.
+  box.setTransform(Transform3s(Vec3s(-1.5, -1.5, -0.5)));
+  ref.clear();
+  res.clear();
+  collide(&terrain, &box, request, ref);
+  collide(&terrain, &box, request, res, cache);
+  BOOST_CHECK(contactIds(ref) == contactIds(res));
+  BOOST_CHECK_EQUAL(cache.getStatistics().num_resets, 1);
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+
+  // The next query starts from the roots.
+  res.clear();
+  collide(&terrain, &box, request, res, cache);
+  BOOST_CHECK(contactIds(ref) == contactIds(res));
+  BOOST_CHECK_GT(cache.size(), 0);
+
+  // The front is dropped when the objects are no longer in collision.
+  box.setTransform(Transform3s(Vec3s(-1.5, -1.5, 1)));
+  res.clear();
+  collide(&terrain, &box, request, res, cache);
+  BOOST_CHECK(!res.isCollision());
+  BOOST_CHECK_EQUAL(cache.getStatistics().num_resets, 2);
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+
+  // Updating the heights keeps the front valid.
+  box.setTransform(Transform3s(Vec3s(-1.5, -1.5, -0.5)));
+  res.clear();
+  collide(&terrain, &box, request, res, cache);
+  MatrixXs heights = hfield->getHeights();
+  heights.array() += Scalar(0.05);
+  hfield->updateHeights(heights);
+  ref.clear();
+  res.clear();
+  collide(&terrain, &box, request, ref);
+  collide(&terrain, &box, request, res, cache);
+  BOOST_CHECK(contactIds(ref) == contactIds(res));
+  BOOST_CHECK_EQUAL(cache.getStatistics().num_restarts, 4);
+
+  // A query with another pair drops the front.
+  CollisionObject sphere(make_shared<Sphere>(Scalar(0.2)),
+                         Transform3s(Vec3s(-1.5, -1.5, -0.5)));
+  res.clear();
+  collide(&terrain, &sphere, request, res, cache);
+  BOOST_CHECK(res.isCollision());
+  BOOST_CHECK_EQUAL(cache.getStatistics().num_restarts, 4);
+}
@@ -0,0 +1,182 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Willow Garage, Inc. nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE COAL_TRIANGLE_INTERSECTION
+#include <boost/test/included/unit_test.hpp>
+
+#include <set>
+#include <utility>
+
+#include "coal/collision.h"
+#include "coal/distance.h"
+#include "coal/BVH/BVH_model.h"
+#include "coal/internal/intersect.h"
+#include "coal/shape/geometric_shape_to_BVH_model.h"
+
+#include "utility.h"
+
+using namespace coal;
+
+namespace {
+
+Vec3s randomPoint(Scalar half_extent) {
+  return half_extent * Vec3s::Random();
+}
+
+typedef std::set<std::pair<int, int> > PrimitivePairs;
+
+PrimitivePairs collidingPrimitives(const CollisionResult& result) {
+  PrimitivePairs pairs;
+  for (std::size_t i = 0; i < result.numContacts(); ++i) {
+    const Contact& contact = result.getContact(i);
+    pairs.insert(std::make_pair(contact.b1, contact.b2));
+  }
+  return pairs;
+}
+
+/// Compares the collision between two meshes when the leaves are tested with
+/// GJK (contact requested) and with the triangle overlap test (no contact).
+template <typename BV>
+void checkMeshMeshCollision() {
+  shared_ptr<BVHModel<BV> > m1(new BVHModel<BV>);
+  shared_ptr<BVHModel<BV> > m2(new BVHModel<BV>);
+  generateBVHModel(*m1, Sphere(1), Transform3s(), 16, 16);
+  generateBVHModel(*m2, Box(1.5, 0.8, 1.2), Transform3s());
+
+  std::vector<Transform3s> transforms;
+  Scalar extents[] = {-2, -2, -2, 2, 2, 2};
+  generateRandomTransforms(extents, transforms, 200);
+
+  const std::size_t max_contacts = 100000;
+  CollisionRequest request_gjk(CONTACT, max_contacts);
+  CollisionRequest request_boolean(NO_REQUEST, max_contacts);
+  std::size_t num_collisions = 0;
+  for (std::size_t i = 0; i < transforms.size(); ++i) {
+    CollisionResult result_gjk, result_boolean;
+    collide(m1.get(), Transform3s(), m2.get(), transforms[i], request_gjk,
+            result_gjk);
+    collide(m1.get(), Transform3s(), m2.get(), transforms[i],
+            request_boolean, result_boolean);
+
+    BOOST_CHECK_EQUAL(result_gjk.isCollision(), result_boolean.isCollision());
+    BOOST_CHECK(collidingPrimitives(result_gjk) ==
+                collidingPrimitives(result_boolean));
+    if (result_boolean.isCollision()) {
+      ++num_collisions;
+      BOOST_CHECK_EQUAL(result_boolean.distance_lower_bound, 0);
+      continue;
+    }
+
+    // The lower bound must not exceed the distance between the meshes.
+    DistanceRequest distance_request;
+    DistanceResult distance_result;
+    distance(m1.get(), Transform3s(), m2.get(), transforms[i],
+             distance_request, distance_result);
+    BOOST_CHECK_LE(result_boolean.distance_lower_bound,
+                   distance_result.min_distance + 1e-6);
+  }
+  BOOST_CHECK(num_collisions > 0);
+  BOOST_CHECK(num_collisions < transforms.size());
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(triangle_triangle_overlap) {
+  std::srand(0);
+  std::size_t num_overlaps = 0, num_separated = 0;
+  for (int i = 0; i < 20000; ++i) {
+    Vec3s S[3], T[3];
+    for (int k = 0; k < 3; ++k) {
+      S[k] = randomPoint(1);
+      T[k] = Vec3s(Scalar(0.5), 0, 0) + randomPoint(1);
+    }
+
+    Scalar lower_bound;
+    const bool overlap = Intersect::intersectTriangles(
+        S[0], S[1], S[2], T[0], T[1], T[2], lower_bound);
+    Vec3s P, Q;
+    const Scalar distance =
+        std::sqrt(TriangleDistance::sqrTriDistance(S, T, P, Q));
+
+    BOOST_CHECK_GE(lower_bound, 0);
+    BOOST_CHECK_LE(lower_bound, distance + 1e-9);
+    // Skip the pairs which are too close to tell.
+    if (distance > 1e-12 && distance < 1e-6) continue;
+    BOOST_CHECK_EQUAL(overlap, distance <= 1e-12);
+    if (overlap)
+      ++num_overlaps;
+    else
+      ++num_separated;
+  }
+  BOOST_CHECK(num_overlaps > 1000);
+  BOOST_CHECK(num_separated > 1000);
+}
+
+BOOST_AUTO_TEST_CASE(triangle_triangle_special_cases) {
+  const Vec3s A(0, 0, 0), B(1, 0, 0), C(0, 1, 0);
+  Scalar lower_bound;
+
+  // Parallel triangles.
+  const Vec3s up(0, 0, Scalar(0.5));
+  BOOST_CHECK(
+      !Intersect::intersectTriangles(A, B, C, A + up, B + up, C + up,
+                                     lower_bound));
+  BOOST_CHECK_CLOSE(lower_bound, 0.5, 1e-9);
+
+  // Vertex touching the inside of the other triangle.
+  BOOST_CHECK(Intersect::intersectTriangles(
+      A, B, C, Vec3s(Scalar(0.2), Scalar(0.2), 0), Vec3s(0, 0, 1),
+      Vec3s(1, 1, 1), lower_bound));
+
+  // Triangle crossing the plane of the other one outside of it.
+  const Scalar half(0.5);
+  BOOST_CHECK(!Intersect::intersectTriangles(
+      A, B, C, Vec3s(1 + half, 1 + half, -1), Vec3s(1 + half, 1 + half, 1),
+      Vec3s(3, 3, 0), lower_bound));
+  BOOST_CHECK_EQUAL(lower_bound, 0);
+
+  // Coplanar and degenerate triangles are left to the distance computation.
+  BOOST_CHECK(!Intersect::intersectTriangles(
+      A, B, C, Vec3s(Scalar(0.1), Scalar(0.1), 0),
+      Vec3s(Scalar(0.5), Scalar(0.1), 0), Vec3s(Scalar(0.1), Scalar(0.5), 0),
+      lower_bound));
+  BOOST_CHECK_EQUAL(lower_bound, -1);
+  BOOST_CHECK(!Intersect::intersectTriangles(A, B, A, A, B, C, lower_bound));
+  BOOST_CHECK_EQUAL(lower_bound, -1);
+}
+
+BOOST_AUTO_TEST_CASE(mesh_mesh_boolean_collision) {
+  checkMeshMeshCollision<OBBRSS>();
+  checkMeshMeshCollision<AABB>();
+}
@@ -286,43 +286,6 @@ void generateRandomTransforms(Scalar extents[6], Scalar delta_trans[3],
   }
 }
 
-bool defaultCollisionFunction(CollisionObject* o1, CollisionObject* o2,
-                              void* cdata_) {
-  CollisionData* cdata = static_cast<CollisionData*>(cdata_);
-  const CollisionRequest& request = cdata->request;
-  CollisionResult& result = cdata->result;
-
-  if (cdata->done) return true;
-
-  collide(o1, o2, request, result);
-
-  if ((result.isCollision()) &&
-      (result.numContacts() >= request.num_max_contacts))
-    cdata->done = true;
-
-  return cdata->done;
-}
-
-bool defaultDistanceFunction(CollisionObject* o1, CollisionObject* o2,
-                             void* cdata_, Scalar& dist) {
-  DistanceData* cdata = static_cast<DistanceData*>(cdata_);
-  const DistanceRequest& request = cdata->request;
-  DistanceResult& result = cdata->result;
-
-  if (cdata->done) {
-    dist = result.min_distance;
-    return true;
-  }
-
-  distance(o1, o2, request, result);
-
-  dist = result.min_distance;
-
-  if (dist <= 0) return true;  // in collision or in touch
-
-  return cdata->done;
-}
-
 std::string getNodeTypeName(NODE_TYPE node_type) {
   if (node_type == BV_UNKNOWN)
     return std::string("BV_UNKNOWN");
@@ -478,6 +441,33 @@ ConvexTpl<Quadrilateral32> buildBox(Scalar l, Scalar w, Scalar d) {
   );
 }
 
+void triangulateHeightField(const MatrixXs& heights, const VecXs& x_grid,
+                            const VecXs& y_grid, BVHModel<OBBRSS>& model) {
+  const Eigen::DenseIndex nx = heights.cols(), ny = heights.rows();
+  std::vector<Vec3s> vertices;
+  vertices.reserve(std::size_t(nx * ny));
+  for (Eigen::DenseIndex row = 0; row < ny; ++row)
+    for (Eigen::DenseIndex col = 0; col < nx; ++col)
+      vertices.push_back(Vec3s(x_grid[col], y_grid[row], heights(row, col)));
+
+  std::vector<Triangle32> triangles;
+  triangles.reserve(std::size_t(2 * (nx - 1) * (ny - 1)));
+  for (Eigen::DenseIndex row = 0; row + 1 < ny; ++row) {
+    for (Eigen::DenseIndex col = 0; col + 1 < nx; ++col) {
+      const Triangle32::IndexType i00 = Triangle32::IndexType(row * nx + col),
+                                  i01 = i00 + 1,
+                                  i10 = i00 + Triangle32::IndexType(nx),
+                                  i11 = i10 + 1;
+      triangles.push_back(Triangle32(i00, i10, i01));
+      triangles.push_back(Triangle32(i10, i11, i01));
+    }
+  }
+
+  model.beginModel();
+  model.addSubModel(vertices, triangles);
+  model.endModel();
+}
+
 /// Takes a point and projects it onto the surface of the unit sphere
 void toSphere(Vec3s& point) {
   assert(point.norm() > 1e-8);
@@ -43,6 +43,7 @@
 #include "coal/collision_object.h"
 #include "coal/broadphase/default_broadphase_callbacks.h"
 #include "coal/shape/convex.h"
+#include "coal/BVH/BVH_model.h"
 
 #ifdef COAL_HAS_OCTOMAP
 #include "coal/octree.h"
@@ -169,17 +170,6 @@ struct DistanceRes {
   Vec3s p2;
 };
 
-/// @brief Default collision callback for two objects o1 and o2 in broad phase.
-/// return value means whether the broad phase can stop now.
-bool defaultCollisionFunction(CollisionObject* o1, CollisionObject* o2,
-                              void* cdata);
-
-/// @brief Default distance callback for two objects o1 and o2 in broad phase.
-/// return value means whether the broad phase can stop now. also return dist,
-/// i.e. the bmin distance till now
-bool defaultDistanceFunction(CollisionObject* o1, CollisionObject* o2,
-                             void* cdata, Scalar& dist);
-
 std::string getNodeTypeName(NODE_TYPE node_type);
 
 Quats makeQuat(Scalar w, Scalar x, Scalar y, Scalar z);
@@ -201,6 +191,12 @@ void generateEnvironmentsMesh(std::vector<CollisionObject*>& env,
 /// the z-axis.
 ConvexTpl<Quadrilateral32> buildBox(Scalar l, Scalar w, Scalar d);
 
+/// @brief Triangulates the surface of a height field given by its heights and
+/// its grids. The bins are split along the same diagonal as the prisms built
+/// by the height field queries.
+void triangulateHeightField(const MatrixXs& heights, const VecXs& x_grid,
+                            const VecXs& y_grid, BVHModel<OBBRSS>& model);
+
 /// @brief We give an ellipsoid as input. The output is a 20 faces polytope
 /// which vertices belong to the original ellipsoid surface. The procedure is
 /// simple: we construct a icosahedron, see